@@ -150,7 +150,7 @@ class MS_API Kernel {
   schema::PrimitiveType type_ = schema::PrimitiveType_NONE;
   const schema::Primitive *primitive_ = nullptr;
   std::map<std::string, std::string> attrs_;
-  const std::map<std::string, std::map<std::string, std::string>> *config_;
+  const std::map<std::string, std::map<std::string, std::string>> *config_ = nullptr;
   schema::QuantType quant_type_ = schema::QuantType_QUANT_NONE;
 
  private:
@@ -21,6 +21,9 @@
 #include "include/common/utils/anfalgo.h"
 #include "include/common/debug/anf_dump_utils.h"
 #include "include/common/debug/common.h"
+#ifdef ENABLE_DEBUGGER
+#include "debug/data_dump/tensor_stat_stream.h"
+#endif
 #include "mindspore/core/utils/file_utils.h"
 
 namespace mindspore {
@@ -104,12 +107,8 @@ void CPUE2eDump::DumpInputImpl(const CNodePtr &node, const std::string &dump_pat
     std::string op_type = common::AnfAlgo::GetCNodeName(node);
     std::string op_name = GetOpNameWithoutScope(*kernel_name);
     uint64_t timestamp = Common::GetTimeStamp();
-    const uint32_t kTaskId = 0;
-    const uint32_t kStreamId = 0;
-    std::string file_path = dump_path + '/' + op_type + '.' + op_name + '.' + std::to_string(kTaskId) + '.' +
-                            std::to_string(kStreamId) + '.' + std::to_string(timestamp) + ".input." + std::to_string(j);
     MS_EXCEPTION_IF_NULL(addr);
-    DumpMemToFile(file_path, *addr, int_shapes, type);
+    DumpTensor(dump_path, *addr, int_shapes, type, op_type, op_name, true, j, timestamp);
   }
 }
 
@@ -128,13 +127,8 @@ void CPUE2eDump::DumpOutputImpl(const CNodePtr &node, const std::string &dump_pa
     auto type = common::AnfAlgo::GetOutputInferDataType(node, j);
     std::string op_type = common::AnfAlgo::GetCNodeName(node);
     std::string op_name = GetOpNameWithoutScope(*kernel_name);
-    const uint32_t kTaskId = 0;
-    const uint32_t kStreamId = 0;
     uint64_t timestamp = Common::GetTimeStamp();
-    std::string file_path = dump_path + '/' + op_type + '.' + op_name + '.' + std::to_string(kTaskId) + '.' +
-                            std::to_string(kStreamId) + '.' + std::to_string(timestamp) + ".output." +
-                            std::to_string(j);
-    DumpMemToFile(file_path, *addr, int_shapes, type);
+    DumpTensor(dump_path, *addr, int_shapes, type, op_type, op_name, false, j, timestamp);
   }
 }
 
@@ -175,11 +169,29 @@ void CPUE2eDump::DumpSingleAnfNode(const AnfNodePtr &anf_node, const size_t outp
   auto type = common::AnfAlgo::GetOutputInferDataType(anf_node, output_index);
 
   uint64_t timestamp = Common::GetTimeStamp();
-  const uint32_t kTaskId = 0;
-  const uint32_t kStreamId = 0;
-  std::string file_path = dump_path + "/Parameter." + dump_name + '.' + std::to_string(kTaskId) + '.' +
-                          std::to_string(kStreamId) + '.' + std::to_string(timestamp) + ".output.0";
-  DumpMemToFile(file_path, *addr, int_shapes, type);
+  DumpTensor(dump_path, *addr, int_shapes, type, "Parameter", dump_name, false, 0, timestamp);
+}
+
+void CPUE2eDump::DumpTensor(const std::string &dump_path, const device::DeviceAddress &addr,
+                            const ShapeVector &int_shapes, TypeId type, const std::string &op_type,
+                            const std::string &op_name, bool input, size_t slot, uint64_t timestamp) {
+  auto &dump_json_parser = DumpJsonParser::GetInstance();
+#ifdef ENABLE_DEBUGGER
+  if (dump_json_parser.IsStatisticDump()) {
+    // The device address of cpu is host memory, so the statistics are computed in place without copying the tensor.
+    TensorStatStream::GetInstance().Record(dump_path, op_type, op_name, input, slot, timestamp, type, int_shapes,
+                                           addr.GetPtr(), addr.GetSize());
+  }
+#endif
+  if (dump_json_parser.IsTensorDump()) {
+    // The file name is only built for the tensor dump, the statistic dump never formats on the execution thread.
+    const uint32_t kTaskId = 0;
+    const uint32_t kStreamId = 0;
+    std::string file_path = dump_path + '/' + op_type + '.' + op_name + '.' + std::to_string(kTaskId) + '.' +
+                            std::to_string(kStreamId) + '.' + std::to_string(timestamp) +
+                            (input ? ".input." : ".output.") + std::to_string(slot);
+    DumpMemToFile(file_path, addr, int_shapes, type);
+  }
 }
 
 void CPUE2eDump::DumpParameters(const session::KernelGraph *graph, uint32_t graph_id) {
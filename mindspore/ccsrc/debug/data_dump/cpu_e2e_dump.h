@@ -52,6 +52,10 @@ class CPUE2eDump {
 
   static void DumpOutputImpl(const CNodePtr &node, const std::string &dump_path, std::string *kernel_name);
 
+  static void DumpTensor(const std::string &dump_path, const device::DeviceAddress &addr, const ShapeVector &int_shapes,
+                         TypeId type, const std::string &op_type, const std::string &op_name, bool input, size_t slot,
+                         uint64_t timestamp);
+
   inline static unsigned int prev_run_iter_ = UINT32_MAX;
 };
 }  // namespace mindspore
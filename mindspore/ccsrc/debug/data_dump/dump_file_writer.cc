@@ -0,0 +1,166 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "debug/data_dump/dump_file_writer.h"
+#include <algorithm>
+#include <exception>
+#include <utility>
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+DumpFileWriter &DumpFileWriter::GetInstance() {
+  static DumpFileWriter instance;
+  return instance;
+}
+
+DumpFileWriter::~DumpFileWriter() { Finalize(); }
+
+void DumpFileWriter::Init(size_t thread_num, size_t max_staging_bytes) {
+  Finalize();
+  std::lock_guard<std::mutex> lock(lock_);
+  stop_ = false;
+  max_staging_bytes_ = max_staging_bytes;
+  for (size_t i = 0; i < thread_num; ++i) {
+    (void)workers_.emplace_back(&DumpFileWriter::WorkerLoop, this);
+  }
+  MS_LOG(INFO) << "Dump file writer uses " << thread_num << " threads, staging limit " << max_staging_bytes_
+               << " bytes.";
+}
+
+bool DumpFileWriter::enabled() {
+  std::lock_guard<std::mutex> lock(lock_);
+  return !workers_.empty();
+}
+
+bool DumpFileWriter::Submit(const std::string &file_path, std::string &&header, const void *data, size_t len,
+                            const WriteFunc &write_func) {
+  if (!enabled()) {
+    if (!write_func(file_path, header, data, len)) {
+      MS_LOG(ERROR) << "Write dump file " << file_path << " failed.";
+      return false;
+    }
+    return true;
+  }
+  {
+    // Back-pressure: wait for the writers to drain the staging buffer. A single task larger than the limit is
+    // still accepted when nothing else is staged.
+    std::unique_lock<std::mutex> lock(lock_);
+    space_cond_.wait(lock, [this, len]() {
+      return stop_ || staging_bytes_ == 0 || staging_bytes_ + len <= max_staging_bytes_;
+    });
+    staging_bytes_ += len;
+  }
+  WriteTask task{file_path, std::move(header), std::vector<uint8_t>(len), write_func};
+  // memcpy_s copies at most SECUREC_MEM_MAX_LEN bytes at a time.
+  for (size_t offset = 0; offset < len; offset += SECUREC_MEM_MAX_LEN) {
+    auto size = std::min(len - offset, static_cast<size_t>(SECUREC_MEM_MAX_LEN));
+    auto ret = memcpy_s(task.data.data() + offset, size, static_cast<const uint8_t *>(data) + offset, size);
+    if (ret != EOK) {
+      MS_LOG(ERROR) << "Copy dump data of " << file_path << " failed, memcpy_s errorno: " << ret;
+      {
+        std::lock_guard<std::mutex> lock(lock_);
+        staging_bytes_ -= len;
+      }
+      space_cond_.notify_all();
+      return false;
+    }
+  }
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    if (!stop_) {
+      tasks_.push_back(std::move(task));
+      task_cond_.notify_one();
+      return true;
+    }
+    // The writer is finalized meanwhile.
+    staging_bytes_ -= len;
+  }
+  if (!write_func(file_path, task.header, task.data.data(), len)) {
+    MS_LOG(ERROR) << "Write dump file " << file_path << " failed.";
+    return false;
+  }
+  return true;
+}
+
+bool DumpFileWriter::Flush() {
+  std::unique_lock<std::mutex> lock(lock_);
+  space_cond_.wait(lock, [this]() { return tasks_.empty() && running_tasks_ == 0; });
+  if (failed_tasks_ > 0) {
+    MS_LOG(ERROR) << "Failed to write " << failed_tasks_ << " dump files.";
+    failed_tasks_ = 0;
+    return false;
+  }
+  return true;
+}
+
+void DumpFileWriter::WorkerLoop() {
+  while (true) {
+    WriteTask task;
+    {
+      std::unique_lock<std::mutex> lock(lock_);
+      task_cond_.wait(lock, [this]() { return stop_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+      ++running_tasks_;
+    }
+    bool success = false;
+    try {
+      success = task.write_func(task.file_path, task.header, task.data.data(), task.data.size());
+      if (!success) {
+        MS_LOG(ERROR) << "Write dump file " << task.file_path << " failed.";
+      }
+    } catch (const std::exception &e) {
+      MS_LOG(ERROR) << "Write dump file " << task.file_path << " failed: " << e.what();
+    }
+    {
+      std::lock_guard<std::mutex> lock(lock_);
+      staging_bytes_ -= task.data.size();
+      --running_tasks_;
+      if (!success) {
+        ++failed_tasks_;
+      }
+    }
+    space_cond_.notify_all();
+  }
+}
+
+void DumpFileWriter::Finalize() {
+  std::vector<std::thread> workers;
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    if (workers_.empty()) {
+      return;
+    }
+    stop_ = true;
+    workers.swap(workers_);
+  }
+  // The workers drain the queued tasks before exiting.
+  task_cond_.notify_all();
+  space_cond_.notify_all();
+  for (auto &worker : workers) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+  std::lock_guard<std::mutex> lock(lock_);
+  if (failed_tasks_ > 0) {
+    MS_LOG(ERROR) << "Failed to write " << failed_tasks_ << " dump files.";
+    failed_tasks_ = 0;
+  }
+}
+}  // namespace mindspore
@@ -0,0 +1,80 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_DUMP_FILE_WRITER_H_
+#define MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_DUMP_FILE_WRITER_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "utils/ms_utils.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+// Writes dump files in background threads. Submitted data is copied into a staging buffer, so the caller can reuse
+// its memory once Submit returns. The staging memory is bounded: Submit blocks while the staged bytes exceed the
+// limit, which throttles the execution thread when the disk falls behind. A failed background write is reported by
+// the next Flush.
+class BACKEND_EXPORT DumpFileWriter {
+ public:
+  // Write the data to file_path. The header is written before the data.
+  using WriteFunc = std::function<bool(const std::string &file_path, const std::string &header, const void *data,
+                                       size_t len)>;
+
+  static DumpFileWriter &GetInstance();
+  ~DumpFileWriter();
+
+  // Start thread_num writer threads with at most max_staging_bytes staged, thread_num 0 means synchronous writing.
+  void Init(size_t thread_num, size_t max_staging_bytes);
+  bool enabled();
+  // Returns false if the file is written synchronously and fails, or the data can not be staged.
+  bool Submit(const std::string &file_path, std::string &&header, const void *data, size_t len,
+              const WriteFunc &write_func);
+  // Wait until all the submitted files are written, returns false if any of them failed since the last Flush.
+  bool Flush();
+  // Write the staged files and stop the writer threads, called when the process exits.
+  void Finalize();
+
+ private:
+  struct WriteTask {
+    std::string file_path;
+    std::string header;
+    std::vector<uint8_t> data;
+    WriteFunc write_func;
+  };
+
+  DumpFileWriter() = default;
+  DISABLE_COPY_AND_ASSIGN(DumpFileWriter)
+  void WorkerLoop();
+
+  std::mutex lock_;
+  std::condition_variable task_cond_;
+  std::condition_variable space_cond_;
+  std::deque<WriteTask> tasks_;
+  std::vector<std::thread> workers_;
+  size_t max_staging_bytes_{0};
+  size_t staging_bytes_{0};
+  size_t running_tasks_{0};
+  size_t failed_tasks_{0};
+  bool stop_{false};
+};
+}  // namespace mindspore
+#endif  // MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_DUMP_FILE_WRITER_H_
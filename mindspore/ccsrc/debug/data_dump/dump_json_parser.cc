@@ -23,6 +23,10 @@
 #include "backend/common/session/anf_runtime_algorithm.h"
 #include "include/common/utils/anfalgo.h"
 #include "debug/data_dump/npy_header.h"
+#include "debug/data_dump/dump_file_writer.h"
+#ifdef ENABLE_DEBUGGER
+#include "debug/data_dump/tensor_stat_stream.h"
+#endif
 #include "include/common/debug/anf_dump_utils.h"
 #include "include/common/utils/comm_manager.h"
 #include "mindspore/core/utils/file_utils.h"
@@ -46,6 +50,10 @@ constexpr auto kStatisticDump = "statistic";
 constexpr auto kTensorDump = "tensor";
 constexpr auto kFullDump = "full";
 constexpr auto kFileFormat = "file_format";
+constexpr auto kAsyncWriteThreads = "async_write_threads";
+constexpr auto kAsyncWriteBufferMb = "async_write_buffer_mb";
+constexpr size_t kDefaultAsyncWriteBufferMb = 1024;
+constexpr size_t kMbToByte = 1024 * 1024;
 constexpr auto kDumpInputAndOutput = 0;
 constexpr auto kDumpInputOnly = 1;
 constexpr auto kDumpOutputOnly = 2;
@@ -61,6 +69,25 @@ auto DumpJsonParser::CheckJsonKeyExist(const nlohmann::json &content, const std:
   return iter;
 }
 
+bool WriteNpyFile(const std::string &file_path, const std::string &npy_header, const void *data, size_t len) {
+  ChangeFileMode(file_path, S_IWUSR);
+  std::ofstream fd(file_path, std::ios::out | std::ios::trunc | std::ios::binary);
+  if (!fd.is_open()) {
+    MS_LOG(EXCEPTION) << "Open file " << file_path << " failed." << ErrnoToString(errno);
+  }
+  if (!npy_header.empty()) {
+    fd << npy_header;
+    (void)fd.write(reinterpret_cast<const char *>(data), SizeToLong(len));
+    if (fd.bad()) {
+      fd.close();
+      MS_LOG(EXCEPTION) << "Write mem to file " << file_path << " failed.";
+    }
+    fd.close();
+    ChangeFileMode(file_path, S_IRUSR);
+  }
+  return true;
+}
+
 std::string GetIfstreamString(const std::ifstream &ifstream) {
   std::stringstream buffer;
   buffer << ifstream.rdbuf();
@@ -239,6 +266,17 @@ void DumpJsonParser::CopyMSCfgJsonToDir(uint32_t rank_id) {
   }
 }
 
+void DumpJsonParser::UpdateDumpIter() {
+  // Make sure the files of the finished iteration are complete before moving to the next one.
+  if (!DumpFileWriter::GetInstance().Flush()) {
+    MS_LOG(ERROR) << "Some dump files of iteration " << cur_dump_iter_ << " are not written.";
+  }
+#ifdef ENABLE_DEBUGGER
+  TensorStatStream::GetInstance().Flush();
+#endif
+  ++cur_dump_iter_;
+}
+
 bool DumpJsonParser::GetIterDumpFlag() const { return e2e_dump_enabled_ && IsDumpIter(cur_dump_iter_); }
 
 bool DumpJsonParser::DumpEnabledForIter() const {
@@ -296,23 +334,8 @@ bool DumpJsonParser::DumpToFile(const std::string &filename, const void *data, s
   }
   const std::string file_path_str = file_path.value();
   MS_LOG(INFO) << "Dump path is " << file_path_str;
-  ChangeFileMode(file_path_str, S_IWUSR);
-  std::ofstream fd(file_path_str, std::ios::out | std::ios::trunc | std::ios::binary);
-  if (!fd.is_open()) {
-    MS_LOG(EXCEPTION) << "Open file " << file_path_str << " failed." << ErrnoToString(errno);
-  }
-  std::string npy_header = GenerateNpyHeader(shape, type);
-  if (!npy_header.empty()) {
-    fd << npy_header;
-    (void)fd.write(reinterpret_cast<const char *>(data), SizeToLong(len));
-    if (fd.bad()) {
-      fd.close();
-      MS_LOG(EXCEPTION) << "Write mem to file " << file_path_str << " failed.";
-    }
-    fd.close();
-    ChangeFileMode(file_path_str, S_IRUSR);
-  }
-  return true;
+  // The file is written in background when the async writer is enabled, see DumpFileWriter.
+  return DumpFileWriter::GetInstance().Submit(file_path_str, GenerateNpyHeader(shape, type), data, len, WriteNpyFile);
 }
 
 void DumpJsonParser::ParseCommonDumpSetting(const nlohmann::json &content) {
@@ -371,6 +394,7 @@ void DumpJsonParser::ParseE2eDumpSetting(const nlohmann::json &content) {
     MS_LOG(WARNING) << "Deprecated: Synchronous dump mode is deprecated and will be removed in a future release";
   }
   trans_flag_ = ParseEnable(*trans_flag);
+  ParseAsyncWriter(*e2e_dump_setting);
 }
 
 void CheckJsonUnsignedType(const nlohmann::json &content, const std::string &key) {
@@ -456,10 +480,12 @@ void DumpJsonParser::ParseSavedData(const nlohmann::json &content) {
                       << saved_data_ << ". Please set saved_data to either statistic, tensor, or full";
   }
   auto context = MsContext::GetInstance();
+#ifndef ENABLE_DEBUGGER
   if (IsStatisticDump() && context->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kCPUDevice) {
-    MS_LOG(EXCEPTION) << "Dump Json parse failed, storing statistic dump is only supported on GPU and Ascend, please "
-                         "set saved_data to tensor or use a GPU or Ascend device";
+    MS_LOG(EXCEPTION) << "Dump Json parse failed, storing statistic dump on CPU requires the debugger module, please "
+                         "set saved_data to tensor or use a build with debugger enabled";
   }
+#endif
   if (IsStatisticDump() && context->get_param<std::string>(MS_CTX_DEVICE_TARGET) == kAscendDevice) {
     if (!IsNpyFormat()) {
       MS_LOG(EXCEPTION) << "Dump Json parse failed, storing statistic dump is only supported on Ascend when "
@@ -630,6 +656,25 @@ void DumpJsonParser::ParseFileFormat(const nlohmann::json &content) {
   }
 }
 
+void DumpJsonParser::ParseAsyncWriter(const nlohmann::json &content) {
+  auto threads = content.find(kAsyncWriteThreads);
+  if (threads == content.end()) {
+    return;
+  }
+  CheckJsonUnsignedType(*threads, kAsyncWriteThreads);
+  size_t thread_num = *threads;
+  size_t buffer_mb = kDefaultAsyncWriteBufferMb;
+  auto buffer = content.find(kAsyncWriteBufferMb);
+  if (buffer != content.end()) {
+    CheckJsonUnsignedType(*buffer, kAsyncWriteBufferMb);
+    buffer_mb = *buffer;
+  }
+  if (thread_num > 0 && buffer_mb == 0) {
+    MS_LOG(EXCEPTION) << "Dump config parse failed, " << kAsyncWriteBufferMb << " should be greater than 0.";
+  }
+  DumpFileWriter::GetInstance().Init(thread_num, buffer_mb * kMbToByte);
+}
+
 void DumpJsonParser::JsonConfigToString() {
   std::string cur_config;
   cur_config.append("dump_mode:");
@@ -66,7 +66,7 @@ class BACKEND_EXPORT DumpJsonParser {
   bool trans_flag() const { return trans_flag_; }
   uint32_t cur_dump_iter() const { return cur_dump_iter_; }
   uint32_t input_output() const { return input_output_; }
-  void UpdateDumpIter() { ++cur_dump_iter_; }
+  void UpdateDumpIter();
   bool FileFormatIsNpy() const { return file_format_ == JsonFileFormat::FORMAT_NPY; }
   bool GetIterDumpFlag() const;
   bool DumpEnabledForIter() const;
@@ -128,6 +128,7 @@ class BACKEND_EXPORT DumpJsonParser {
   bool ParseEnable(const nlohmann::json &content) const;
   void ParseOpDebugMode(const nlohmann::json &content);
   void ParseFileFormat(const nlohmann::json &content);
+  void ParseAsyncWriter(const nlohmann::json &content);
 
   void JudgeDumpEnabled();
   void JsonConfigToString();
@@ -166,17 +166,34 @@ bool TensorStatDump::DumpTensorStatsToFile(const std::string &dump_path, const s
     type = "unsupported(" + std::to_string(data->GetType()) + ")";
     MS_LOG(INFO) << "Unsupported tensor data_type " << type << " for tensor " << data->GetName();
   }
+  const DebugServices::TensorStat &stat = DebugServices::GetTensorStatistics(data);
+  TensorStatValues values;
+  values.data_size = stat.data_size;
+  values.max_value = stat.max_value;
+  values.min_value = stat.min_value;
+  values.avg_value = stat.avg_value;
+  values.count = stat.count;
+  values.neg_zero_count = stat.neg_zero_count;
+  values.pos_zero_count = stat.pos_zero_count;
+  values.nan_count = stat.nan_count;
+  values.neg_inf_count = stat.neg_inf_count;
+  values.pos_inf_count = stat.pos_inf_count;
+  values.zero_count = stat.zero_count;
+  return DumpTensorStatsToFile(dump_path, type, stat.shape, values);
+}
+
+bool TensorStatDump::DumpTensorStatsToFile(const std::string &dump_path, const std::string &type,
+                                           const ShapeVector &shape, const TensorStatValues &stat) {
   if (!OpenStatisticsFile(dump_path)) {
     return false;
   }
-  const DebugServices::TensorStat &stat = DebugServices::GetTensorStatistics(data);
   // write tensor statistics to csv file
-  std::ostringstream shape;
-  shape << "\"(";
-  for (size_t i = 0; i < stat.shape.size(); i++) {
-    shape << (i > 0 ? "," : "") << stat.shape[i];
+  std::ostringstream shape_str;
+  shape_str << "\"(";
+  for (size_t i = 0; i < shape.size(); i++) {
+    shape_str << (i > 0 ? "," : "") << shape[i];
   }
-  shape << ")\"";
+  shape_str << ")\"";
   CsvWriter &csv = CsvWriter::GetInstance();
   csv.WriteToCsv(op_type_);
   csv.WriteToCsv(op_name_);
@@ -187,7 +204,7 @@ bool TensorStatDump::DumpTensorStatsToFile(const std::string &dump_path, const s
   csv.WriteToCsv(slot_);
   csv.WriteToCsv(stat.data_size);
   csv.WriteToCsv(type);
-  csv.WriteToCsv(shape.str());
+  csv.WriteToCsv(shape_str.str());
   if (stat.count == stat.nan_count + stat.neg_inf_count + stat.pos_inf_count) {
     csv.WriteToCsv("null");
     csv.WriteToCsv("null");
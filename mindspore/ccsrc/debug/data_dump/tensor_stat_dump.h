@@ -17,16 +17,33 @@
 #ifndef MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_TENSOR_STAT_DUMP_H_
 #define MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_TENSOR_STAT_DUMP_H_
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <fstream>
 #include <mutex>
 
+#include "mindapi/base/shape_vector.h"
 #include "utils/ms_utils.h"
 
 namespace mindspore {
 class Debugger;
 class TensorData;
+// The statistics of one tensor written as a row of statistic.csv.
+struct TensorStatValues {
+  uint64_t data_size = 0;
+  double max_value = std::numeric_limits<double>::lowest();
+  double min_value = std::numeric_limits<double>::max();
+  double avg_value = 0.0;
+  uint64_t count = 0;
+  uint64_t neg_zero_count = 0;
+  uint64_t pos_zero_count = 0;
+  uint64_t nan_count = 0;
+  uint64_t neg_inf_count = 0;
+  uint64_t pos_inf_count = 0;
+  uint64_t zero_count = 0;
+};
+
 class CsvWriter {
  public:
   static CsvWriter &GetInstance() {
@@ -61,6 +78,8 @@ class TensorStatDump {
   bool DumpTensorStatsToFile(const std::string &dump_path, const std::shared_ptr<TensorData> data);
   bool DumpTensorStatsToFile(const std::string &original_kernel_name, const std::string &dump_path,
                              const Debugger *debugger);
+  bool DumpTensorStatsToFile(const std::string &dump_path, const std::string &type, const ShapeVector &shape,
+                             const TensorStatValues &stat);
 
  private:
   const std::string op_type_;
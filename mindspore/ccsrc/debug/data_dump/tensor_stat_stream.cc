@@ -0,0 +1,425 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "debug/data_dump/tensor_stat_stream.h"
+#include <algorithm>
+#include <exception>
+#include <limits>
+#include <map>
+#include <type_traits>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__aarch64__)
+#include <arm_neon.h>
+#endif
+#include "base/float16.h"
+#include "utils/log_adapter.h"
+
+namespace mindspore {
+namespace {
+constexpr size_t kStatRingCapacity = 4096;
+constexpr size_t kStatLanes = 8;
+
+std::string StatTypeString(TypeId type) {
+  static const std::map<TypeId, std::string> kTypeToString = {
+    {kNumberTypeBool, "bool"},       {kNumberTypeInt8, "int8"},       {kNumberTypeInt16, "int16"},
+    {kNumberTypeInt32, "int32"},     {kNumberTypeInt64, "int64"},     {kNumberTypeUInt8, "uint8"},
+    {kNumberTypeUInt16, "uint16"},   {kNumberTypeUInt32, "uint32"},   {kNumberTypeUInt64, "uint64"},
+    {kNumberTypeFloat16, "float16"}, {kNumberTypeFloat32, "float32"}, {kNumberTypeFloat64, "float64"}};
+  auto iter = kTypeToString.find(type);
+  return iter == kTypeToString.end() ? "unsupported(" + std::to_string(static_cast<int>(type)) + ")" : iter->second;
+}
+
+// The portable path of the types without a vector kernel. Every lane keeps its own accumulators, so consecutive
+// elements do not wait on each other's min, max and sum.
+template <typename T>
+void ComputeStat(const T *data, size_t num, TensorStatValues *stat) {
+  constexpr bool kMayBeNonFinite = std::is_floating_point<T>::value || std::is_same<T, float16>::value;
+  constexpr double kInf = std::numeric_limits<double>::infinity();
+  double lane_max[kStatLanes];
+  double lane_min[kStatLanes];
+  double lane_sum[kStatLanes] = {0.0};
+  uint64_t lane_neg[kStatLanes] = {0};
+  uint64_t lane_pos[kStatLanes] = {0};
+  uint64_t lane_zero[kStatLanes] = {0};
+  uint64_t lane_nan[kStatLanes] = {0};
+  uint64_t lane_neg_inf[kStatLanes] = {0};
+  uint64_t lane_pos_inf[kStatLanes] = {0};
+  std::fill(lane_max, lane_max + kStatLanes, std::numeric_limits<double>::lowest());
+  std::fill(lane_min, lane_min + kStatLanes, std::numeric_limits<double>::max());
+  auto process = [&](size_t lane, double value) {
+    bool finite = true;
+    if constexpr (kMayBeNonFinite) {
+      bool is_nan = value != value;
+      bool is_pos_inf = value == kInf;
+      bool is_neg_inf = value == -kInf;
+      lane_nan[lane] += static_cast<uint64_t>(is_nan);
+      lane_pos_inf[lane] += static_cast<uint64_t>(is_pos_inf);
+      lane_neg_inf[lane] += static_cast<uint64_t>(is_neg_inf);
+      finite = !(is_nan || is_pos_inf || is_neg_inf);
+    }
+    lane_zero[lane] += static_cast<uint64_t>(value == 0.0);
+    lane_neg[lane] += static_cast<uint64_t>(finite && value < 0.0);
+    lane_pos[lane] += static_cast<uint64_t>(finite && value > 0.0);
+    lane_max[lane] = (finite && value > lane_max[lane]) ? value : lane_max[lane];
+    lane_min[lane] = (finite && value < lane_min[lane]) ? value : lane_min[lane];
+    lane_sum[lane] += finite ? value : 0.0;
+  };
+  size_t i = 0;
+  for (; i + kStatLanes <= num; i += kStatLanes) {
+    for (size_t lane = 0; lane < kStatLanes; ++lane) {
+      process(lane, static_cast<double>(data[i + lane]));
+    }
+  }
+  for (; i < num; ++i) {
+    process(0, static_cast<double>(data[i]));
+  }
+
+  double sum = 0.0;
+  for (size_t lane = 0; lane < kStatLanes; ++lane) {
+    stat->max_value = std::max(stat->max_value, lane_max[lane]);
+    stat->min_value = std::min(stat->min_value, lane_min[lane]);
+    sum += lane_sum[lane];
+    stat->neg_zero_count += lane_neg[lane];
+    stat->pos_zero_count += lane_pos[lane];
+    stat->zero_count += lane_zero[lane];
+    stat->nan_count += lane_nan[lane];
+    stat->neg_inf_count += lane_neg_inf[lane];
+    stat->pos_inf_count += lane_pos_inf[lane];
+  }
+  stat->count = num;
+  auto finite_count = num - stat->nan_count - stat->neg_inf_count - stat->pos_inf_count;
+  stat->avg_value = finite_count == 0 ? 0.0 : sum / static_cast<double>(finite_count);
+}
+
+#if defined(__SSE2__) || defined(__aarch64__)
+constexpr size_t kFloatLanes = 4;
+// The counters of a block are int32 lanes and its sum is accumulated in float, the blocks are added up in uint64 and
+// double, which bounds both the overflow and the rounding error of the float sum.
+constexpr size_t kFloatStatBlock = 4096;
+
+struct FloatBlockStat {
+  float max_value;
+  float min_value;
+  float sum;
+  uint32_t neg_count;
+  uint32_t pos_count;
+  uint32_t zero_count;
+  uint32_t nan_count;
+  uint32_t neg_inf_count;
+  uint32_t pos_inf_count;
+};
+
+// Compute the statistics of num float32, num is a multiple of kFloatLanes. The non-finite values are replaced by
+// -inf for the max, +inf for the min and 0 for the sum, and counted by masks, so the loop has no branches.
+void ComputeFloatBlock(const float *data, size_t num, FloatBlockStat *block) {
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+#if defined(__SSE2__)
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 inf = _mm_set1_ps(kInf);
+  const __m128 neg_inf = _mm_set1_ps(-kInf);
+  const __m128 abs_mask = _mm_castsi128_ps(_mm_set1_epi32(0x7fffffff));
+  __m128 max_value = neg_inf;
+  __m128 min_value = inf;
+  __m128 sum = zero;
+  __m128i neg_count = _mm_setzero_si128();
+  __m128i pos_count = _mm_setzero_si128();
+  __m128i zero_count = _mm_setzero_si128();
+  __m128i nan_count = _mm_setzero_si128();
+  __m128i neg_inf_count = _mm_setzero_si128();
+  __m128i pos_inf_count = _mm_setzero_si128();
+  for (size_t i = 0; i < num; i += kFloatLanes) {
+    __m128 x = _mm_loadu_ps(data + i);
+    __m128 finite = _mm_cmplt_ps(_mm_and_ps(x, abs_mask), inf);
+    __m128 finite_x = _mm_and_ps(finite, x);
+    sum = _mm_add_ps(sum, finite_x);
+    max_value = _mm_max_ps(max_value, _mm_or_ps(finite_x, _mm_andnot_ps(finite, neg_inf)));
+    min_value = _mm_min_ps(min_value, _mm_or_ps(finite_x, _mm_andnot_ps(finite, inf)));
+    // A true mask is -1, subtracting it counts one.
+    neg_count = _mm_sub_epi32(neg_count, _mm_castps_si128(_mm_cmplt_ps(finite_x, zero)));
+    pos_count = _mm_sub_epi32(pos_count, _mm_castps_si128(_mm_cmpgt_ps(finite_x, zero)));
+    zero_count = _mm_sub_epi32(zero_count, _mm_castps_si128(_mm_cmpeq_ps(x, zero)));
+    nan_count = _mm_sub_epi32(nan_count, _mm_castps_si128(_mm_cmpunord_ps(x, x)));
+    neg_inf_count = _mm_sub_epi32(neg_inf_count, _mm_castps_si128(_mm_cmpeq_ps(x, neg_inf)));
+    pos_inf_count = _mm_sub_epi32(pos_inf_count, _mm_castps_si128(_mm_cmpeq_ps(x, inf)));
+  }
+  float lane_max[kFloatLanes];
+  float lane_min[kFloatLanes];
+  float lane_sum[kFloatLanes];
+  uint32_t lane_counts[6][kFloatLanes];
+  _mm_storeu_ps(lane_max, max_value);
+  _mm_storeu_ps(lane_min, min_value);
+  _mm_storeu_ps(lane_sum, sum);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(lane_counts[0]), neg_count);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(lane_counts[1]), pos_count);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(lane_counts[2]), zero_count);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(lane_counts[3]), nan_count);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(lane_counts[4]), neg_inf_count);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(lane_counts[5]), pos_inf_count);
+  *block = {lane_max[0], lane_min[0], 0.0f, 0, 0, 0, 0, 0, 0};
+  for (size_t lane = 0; lane < kFloatLanes; ++lane) {
+    block->max_value = std::max(block->max_value, lane_max[lane]);
+    block->min_value = std::min(block->min_value, lane_min[lane]);
+    block->sum += lane_sum[lane];
+    block->neg_count += lane_counts[0][lane];
+    block->pos_count += lane_counts[1][lane];
+    block->zero_count += lane_counts[2][lane];
+    block->nan_count += lane_counts[3][lane];
+    block->neg_inf_count += lane_counts[4][lane];
+    block->pos_inf_count += lane_counts[5][lane];
+  }
+#else
+  const float32x4_t zero = vdupq_n_f32(0.0f);
+  const float32x4_t inf = vdupq_n_f32(kInf);
+  const float32x4_t neg_inf = vdupq_n_f32(-kInf);
+  float32x4_t max_value = neg_inf;
+  float32x4_t min_value = inf;
+  float32x4_t sum = zero;
+  uint32x4_t neg_count = vdupq_n_u32(0);
+  uint32x4_t pos_count = vdupq_n_u32(0);
+  uint32x4_t zero_count = vdupq_n_u32(0);
+  uint32x4_t nan_count = vdupq_n_u32(0);
+  uint32x4_t neg_inf_count = vdupq_n_u32(0);
+  uint32x4_t pos_inf_count = vdupq_n_u32(0);
+  for (size_t i = 0; i < num; i += kFloatLanes) {
+    float32x4_t x = vld1q_f32(data + i);
+    uint32x4_t finite = vcltq_f32(vabsq_f32(x), inf);
+    float32x4_t finite_x = vreinterpretq_f32_u32(vandq_u32(finite, vreinterpretq_u32_f32(x)));
+    sum = vaddq_f32(sum, finite_x);
+    max_value = vmaxq_f32(max_value, vbslq_f32(finite, x, neg_inf));
+    min_value = vminq_f32(min_value, vbslq_f32(finite, x, inf));
+    // A true mask is all ones, subtracting it counts one.
+    neg_count = vsubq_u32(neg_count, vcltq_f32(finite_x, zero));
+    pos_count = vsubq_u32(pos_count, vcgtq_f32(finite_x, zero));
+    zero_count = vsubq_u32(zero_count, vceqq_f32(x, zero));
+    nan_count = vsubq_u32(nan_count, vmvnq_u32(vceqq_f32(x, x)));
+    neg_inf_count = vsubq_u32(neg_inf_count, vceqq_f32(x, neg_inf));
+    pos_inf_count = vsubq_u32(pos_inf_count, vceqq_f32(x, inf));
+  }
+  *block = {vmaxvq_f32(max_value),     vminvq_f32(min_value),     vaddvq_f32(sum),
+            vaddvq_u32(neg_count),     vaddvq_u32(pos_count),     vaddvq_u32(zero_count),
+            vaddvq_u32(nan_count),     vaddvq_u32(neg_inf_count), vaddvq_u32(pos_inf_count)};
+#endif
+}
+
+void ComputeFloatStat(const float *data, size_t num, TensorStatValues *stat) {
+  constexpr double kInf = std::numeric_limits<double>::infinity();
+  size_t vector_num = num / kFloatLanes * kFloatLanes;
+  double sum = 0.0;
+  for (size_t begin = 0; begin < vector_num; begin += kFloatStatBlock) {
+    FloatBlockStat block;
+    ComputeFloatBlock(data + begin, std::min(kFloatStatBlock, vector_num - begin), &block);
+    if (block.max_value >= block.min_value) {
+      stat->max_value = std::max(stat->max_value, static_cast<double>(block.max_value));
+      stat->min_value = std::min(stat->min_value, static_cast<double>(block.min_value));
+    }
+    sum += block.sum;
+    stat->neg_zero_count += block.neg_count;
+    stat->pos_zero_count += block.pos_count;
+    stat->zero_count += block.zero_count;
+    stat->nan_count += block.nan_count;
+    stat->neg_inf_count += block.neg_inf_count;
+    stat->pos_inf_count += block.pos_inf_count;
+  }
+  for (size_t i = vector_num; i < num; ++i) {
+    double value = static_cast<double>(data[i]);
+    stat->zero_count += static_cast<uint64_t>(value == 0.0);
+    if (value != value) {
+      ++stat->nan_count;
+    } else if (value == kInf) {
+      ++stat->pos_inf_count;
+    } else if (value == -kInf) {
+      ++stat->neg_inf_count;
+    } else {
+      stat->neg_zero_count += static_cast<uint64_t>(value < 0.0);
+      stat->pos_zero_count += static_cast<uint64_t>(value > 0.0);
+      stat->max_value = std::max(stat->max_value, value);
+      stat->min_value = std::min(stat->min_value, value);
+      sum += value;
+    }
+  }
+  stat->count = num;
+  auto finite_count = num - stat->nan_count - stat->neg_inf_count - stat->pos_inf_count;
+  stat->avg_value = finite_count == 0 ? 0.0 : sum / static_cast<double>(finite_count);
+}
+#endif
+
+template <typename T>
+void ComputeStatOf(const void *data, size_t size, TensorStatValues *stat) {
+#if defined(__SSE2__) || defined(__aarch64__)
+  if constexpr (std::is_same<T, float>::value) {
+    ComputeFloatStat(static_cast<const float *>(data), size / sizeof(float), stat);
+    return;
+  }
+#endif
+  ComputeStat(static_cast<const T *>(data), size / sizeof(T), stat);
+}
+}  // namespace
+
+bool ComputeHostTensorStat(const void *data, size_t size, TypeId type, TensorStatValues *stat) {
+  MS_EXCEPTION_IF_NULL(stat);
+  *stat = TensorStatValues();
+  stat->data_size = size;
+  if (data == nullptr && size != 0) {
+    return false;
+  }
+  switch (type) {
+    case kNumberTypeBool:
+      ComputeStatOf<bool>(data, size, stat);
+      break;
+    case kNumberTypeInt8:
+      ComputeStatOf<int8_t>(data, size, stat);
+      break;
+    case kNumberTypeInt16:
+      ComputeStatOf<int16_t>(data, size, stat);
+      break;
+    case kNumberTypeInt32:
+      ComputeStatOf<int32_t>(data, size, stat);
+      break;
+    case kNumberTypeInt64:
+      ComputeStatOf<int64_t>(data, size, stat);
+      break;
+    case kNumberTypeUInt8:
+      ComputeStatOf<uint8_t>(data, size, stat);
+      break;
+    case kNumberTypeUInt16:
+      ComputeStatOf<uint16_t>(data, size, stat);
+      break;
+    case kNumberTypeUInt32:
+      ComputeStatOf<uint32_t>(data, size, stat);
+      break;
+    case kNumberTypeUInt64:
+      ComputeStatOf<uint64_t>(data, size, stat);
+      break;
+    case kNumberTypeFloat16:
+      ComputeStatOf<float16>(data, size, stat);
+      break;
+    case kNumberTypeFloat32:
+      ComputeStatOf<float>(data, size, stat);
+      break;
+    case kNumberTypeFloat64:
+      ComputeStatOf<double>(data, size, stat);
+      break;
+    default:
+      return false;
+  }
+  return true;
+}
+
+TensorStatStream &TensorStatStream::GetInstance() {
+  // The flush thread writes through CsvWriter, construct it first so that it outlives this instance.
+  (void)CsvWriter::GetInstance();
+  static TensorStatStream instance;
+  return instance;
+}
+
+TensorStatStream::~TensorStatStream() { Stop(); }
+
+const TensorStatStream::StatName *TensorStatStream::InternName(const std::string &dump_path,
+                                                                const std::string &op_type,
+                                                                const std::string &op_name) {
+  auto &op_names = names_[dump_path][op_type];
+  auto iter = op_names.find(op_name);
+  if (iter == op_names.end()) {
+    iter = op_names.emplace(op_name, StatName{dump_path, op_type, op_name}).first;
+  }
+  return &iter->second;
+}
+
+const ShapeVector *TensorStatStream::InternShape(const ShapeVector &shape) { return &*shapes_.insert(shape).first; }
+
+void TensorStatStream::Record(const std::string &dump_path, const std::string &op_type, const std::string &op_name,
+                              bool input, size_t slot, uint64_t timestamp, TypeId type, const ShapeVector &shape,
+                              const void *data, size_t size) {
+  TensorStatValues stat;
+  if (!ComputeHostTensorStat(data, size, type, &stat)) {
+    MS_LOG(INFO) << "Unsupported tensor data_type " << StatTypeString(type) << " for tensor " << op_name;
+  }
+  std::unique_lock<std::mutex> lock(lock_);
+  if (!flush_thread_.joinable()) {
+    ring_.resize(kStatRingCapacity);
+    stop_ = false;
+    flush_thread_ = std::thread(&TensorStatStream::FlushLoop, this);
+  }
+  space_cond_.wait(lock, [this]() { return size_ < ring_.size(); });
+  auto &record = ring_[(head_ + size_) % ring_.size()];
+  record.name = InternName(dump_path, op_type, op_name);
+  record.shape = InternShape(shape);
+  record.input = input;
+  record.slot = slot;
+  record.timestamp = timestamp;
+  record.type = type;
+  record.stat = stat;
+  ++size_;
+  lock.unlock();
+  record_cond_.notify_one();
+}
+
+void TensorStatStream::Flush() {
+  std::unique_lock<std::mutex> lock(lock_);
+  space_cond_.wait(lock, [this]() { return size_ == 0 && !writing_; });
+}
+
+void TensorStatStream::FlushLoop() {
+  std::vector<StatRecord> records;
+  records.reserve(kStatRingCapacity);
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(lock_);
+      record_cond_.wait(lock, [this]() { return stop_ || size_ > 0; });
+      if (size_ == 0) {
+        return;
+      }
+      // Take all the queued records at once, they are formatted and written without the lock.
+      records.clear();
+      for (; size_ > 0; --size_) {
+        records.push_back(ring_[head_]);
+        head_ = (head_ + 1) % ring_.size();
+      }
+      writing_ = true;
+    }
+    space_cond_.notify_all();
+    for (const auto &record : records) {
+      const auto &name = *record.name;
+      TensorStatDump stat_dump(name.op_type, name.op_name, 0, 0, record.timestamp, record.input, record.slot, 0);
+      try {
+        (void)stat_dump.DumpTensorStatsToFile(name.dump_path, StatTypeString(record.type), *record.shape,
+                                              record.stat);
+      } catch (const std::exception &e) {
+        MS_LOG(ERROR) << "Write statistics of " << name.op_name << " failed: " << e.what();
+      }
+    }
+    {
+      std::lock_guard<std::mutex> lock(lock_);
+      writing_ = false;
+    }
+    space_cond_.notify_all();
+  }
+}
+
+void TensorStatStream::Stop() {
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+    if (!flush_thread_.joinable()) {
+      return;
+    }
+    stop_ = true;
+  }
+  // The flush thread drains the ring buffer before exiting.
+  record_cond_.notify_all();
+  flush_thread_.join();
+}
+}  // namespace mindspore
@@ -0,0 +1,90 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_TENSOR_STAT_STREAM_H_
+#define MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_TENSOR_STAT_STREAM_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include "debug/data_dump/tensor_stat_dump.h"
+#include "ir/dtype/type_id.h"
+#include "utils/ms_utils.h"
+#include "include/backend/visible.h"
+
+namespace mindspore {
+// Compute the statistics of a tensor in host memory with a single pass over the data. Returns false if the data type
+// is not supported.
+BACKEND_EXPORT bool ComputeHostTensorStat(const void *data, size_t size, TypeId type, TensorStatValues *stat);
+
+// Streams the tensor statistics of the CPU e2e dump. The statistics are computed in place on the host device address
+// right after the kernel is launched, the data is never copied. Every result is queued as a fixed size record in a
+// ring buffer, the names and the shape refer to tables interned once per tensor, and a background thread formats the
+// records and appends them to statistic.csv, so the execution thread neither allocates nor formats.
+class BACKEND_EXPORT TensorStatStream {
+ public:
+  static TensorStatStream &GetInstance();
+  ~TensorStatStream();
+
+  void Record(const std::string &dump_path, const std::string &op_type, const std::string &op_name, bool input,
+              size_t slot, uint64_t timestamp, TypeId type, const ShapeVector &shape, const void *data, size_t size);
+  // Wait until all the recorded statistics are written.
+  void Flush();
+
+ private:
+  struct StatName {
+    std::string dump_path;
+    std::string op_type;
+    std::string op_name;
+  };
+  struct StatRecord {
+    const StatName *name{nullptr};
+    const ShapeVector *shape{nullptr};
+    bool input{false};
+    size_t slot{0};
+    uint64_t timestamp{0};
+    TypeId type{kTypeUnknown};
+    TensorStatValues stat;
+  };
+
+  TensorStatStream() = default;
+  DISABLE_COPY_AND_ASSIGN(TensorStatStream)
+  void FlushLoop();
+  void Stop();
+  // Called with lock_ held. The interned entries are never moved or changed, so the records point to them.
+  const StatName *InternName(const std::string &dump_path, const std::string &op_type, const std::string &op_name);
+  const ShapeVector *InternShape(const ShapeVector &shape);
+
+  std::mutex lock_;
+  std::condition_variable record_cond_;
+  std::condition_variable space_cond_;
+  std::vector<StatRecord> ring_;
+  size_t head_{0};
+  size_t size_{0};
+  bool writing_{false};
+  bool stop_{false};
+  std::thread flush_thread_;
+  // Indexed by dump path, op type and op name.
+  std::map<std::string, std::map<std::string, std::map<std::string, StatName>>> names_;
+  std::set<ShapeVector> shapes_;
+};
+}  // namespace mindspore
+#endif  // MINDSPORE_MINDSPORE_CCSRC_DEBUG_DATA_DUMP_TENSOR_STAT_STREAM_H_
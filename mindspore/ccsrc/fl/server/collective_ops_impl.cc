@@ -376,14 +376,16 @@ bool CollectiveOpsImpl::Broadcast(const void *sendbuff, void *recvbuff, size_t c
     MS_LOG(ERROR) << "The group is empty.";
     return false;
   }
-  uint32_t group_rank_size = SizeToUint(group_info.group_ranks.size());
+  if (group_to_global_ranks.count(root) == 0) {
+    MS_LOG(ERROR) << "The root " << root << " is not in the group.";
+    return false;
+  }
   uint32_t global_root_rank = group_to_global_ranks[root];
 
   // Broadcast data to processes which are not the root.
   MS_LOG(DEBUG) << "Start broadcast from root to other processes.";
   if (rank_id_ == global_root_rank) {
-    for (uint32_t i = 1; i < group_rank_size; i++) {
-      uint32_t dst_rank = group_to_global_ranks[i];
+    for (uint32_t dst_rank : BroadcastDestinations(root, group_info)) {
       MS_LOG(DEBUG) << "Broadcast data to process " << dst_rank;
       auto send_req_id = node_->CollectiveSendAsync(node_role_, dst_rank, sendbuff, count * sizeof(T));
       if (!node_->Wait(send_req_id, kCollectiveCommTimeout)) {
@@ -392,7 +394,7 @@ bool CollectiveOpsImpl::Broadcast(const void *sendbuff, void *recvbuff, size_t c
       }
     }
   } else {
-    MS_LOG(DEBUG) << "Broadcast receive from rank 0.";
+    MS_LOG(DEBUG) << "Broadcast receive from rank " << global_root_rank;
     std::shared_ptr<std::vector<unsigned char>> recv_str;
     auto recv_req_id = node_->CollectiveReceiveAsync(node_role_, global_root_rank, &recv_str);
     if (!node_->CollectiveWait(recv_req_id, kCollectiveCommTimeout)) {
@@ -500,6 +502,17 @@ bool CollectiveOpsImpl::Broadcast(const void *sendbuff, void *recvbuff, size_t c
   return Broadcast<T>(sendbuff, recvbuff, count, root, group_info);
 }
 
+std::vector<uint32_t> CollectiveOpsImpl::BroadcastDestinations(uint32_t root,
+                                                               const CommunicationGroupInfo &group_info) {
+  std::vector<uint32_t> dst_ranks;
+  for (const auto &[group_rank, global_rank] : group_info.group_to_global_ranks) {
+    if (group_rank != root) {
+      dst_ranks.push_back(global_rank);
+    }
+  }
+  return dst_ranks;
+}
+
 bool CollectiveOpsImpl::ReInitForScaling() {
   // If CollectiveOpsImpl is not initialized yet but the scaling event is triggered, do not throw exception.
   if (server_node_ == nullptr) {
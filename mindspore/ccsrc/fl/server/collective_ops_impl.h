@@ -78,6 +78,9 @@ class CollectiveOpsImpl {
   // Reinitialize the ring for collective communication after scaling operations are done.
   bool ReInitForScaling();
 
+  // The global ranks the root sends to in Broadcast: all the processes of the group except the root.
+  static std::vector<uint32_t> BroadcastDestinations(uint32_t root, const CommunicationGroupInfo &group_info);
+
  private:
   CollectiveOpsImpl()
       : server_node_(nullptr),
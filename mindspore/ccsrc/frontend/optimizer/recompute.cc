@@ -21,17 +21,22 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <functional>
+#include <numeric>
 #include "utils/hash_map.h"
 #include "utils/hash_set.h"
 #include "ir/func_graph.h"
+#include "abstract/utils.h"
 #include "mindspore/core/ops/core_ops.h"
 #include "include/common/utils/utils.h"
+#include "utils/ms_context.h"
 
 namespace mindspore {
 namespace opt {
 namespace {
 constexpr auto kGradientsFlag = "Gradients";
 const int64_t fusion_id_increasement_size = 2000;
+constexpr double kGBToByte = 1024.0 * 1024.0 * 1024.0;
 bool CanNotRecomputed(const CNodePtr &node) {
   static mindspore::HashSet<PrimitivePtr> not_recomputed_op_list{
     prim::kPrimDropoutGenMask, prim::kPrimLoad, prim::kPrimTupleGetItem, prim::kPrimSend, prim::kPrimReceive};
@@ -327,6 +332,184 @@ void SetRecomputedAttr(const FuncGraphPtr &graph, const std::vector<CNodePtr> &o
   }
 }
 
+double GetAbstractBytes(const abstract::AbstractBasePtr &abs) {
+  if (abs == nullptr) {
+    return 0.0;
+  }
+  if (abs->isa<abstract::AbstractTuple>()) {
+    double bytes = 0.0;
+    for (const auto &element : abs->cast_ptr<abstract::AbstractTuple>()->elements()) {
+      bytes += GetAbstractBytes(element);
+    }
+    return bytes;
+  }
+  auto tensor_abs = abs->cast_ptr<abstract::AbstractTensor>();
+  if (tensor_abs == nullptr || tensor_abs->element() == nullptr || tensor_abs->shape() == nullptr) {
+    return 0.0;
+  }
+  auto type = tensor_abs->element()->BuildType();
+  MS_EXCEPTION_IF_NULL(type);
+  double bytes = static_cast<double>(abstract::TypeIdSize(type->type_id()));
+  for (auto dim : tensor_abs->shape()->shape()) {
+    // The dynamic shape is unknown at compile time, it is not counted.
+    if (dim < 0) {
+      return 0.0;
+    }
+    bytes *= static_cast<double>(dim);
+  }
+  return bytes;
+}
+
+ShapeVector GetInputShape(const CNodePtr &node, size_t index) {
+  if (index >= node->size() || node->input(index)->abstract() == nullptr) {
+    return {};
+  }
+  auto shape = node->input(index)->abstract()->BuildShape();
+  if (shape == nullptr || !shape->isa<abstract::Shape>()) {
+    return {};
+  }
+  return shape->cast_ptr<abstract::Shape>()->shape();
+}
+
+// The FLOPs to recompute a node. The matmul and the convolution multiply its output by the reduced size, the other
+// operators are counted by its output elements.
+double GetRecomputeFlops(const CNodePtr &node) {
+  auto abs = node->abstract();
+  auto element_bytes = 1.0;
+  if (abs != nullptr && abs->isa<abstract::AbstractTensor>()) {
+    auto type = abs->cast_ptr<abstract::AbstractTensor>()->element()->BuildType();
+    element_bytes = static_cast<double>(std::max(abstract::TypeIdSize(type->type_id()), size_t(1)));
+  }
+  double output_elements = GetAbstractBytes(abs) / element_bytes;
+  if (IsPrimitiveCNode(node, prim::kPrimMatMul) || IsPrimitiveCNode(node, prim::kPrimBatchMatMul)) {
+    auto prim = GetCNodePrimitive(node);
+    auto transpose_a = prim->GetAttr("transpose_a");
+    bool transposed = transpose_a != nullptr && transpose_a->isa<BoolImm>() && GetValue<bool>(transpose_a);
+    auto shape = GetInputShape(node, kIndex1);
+    constexpr size_t kMatrixDims = 2;
+    if (shape.size() >= kMatrixDims) {
+      auto reduced = transposed ? shape[shape.size() - kMatrixDims] : shape.back();
+      return kIndex2 * output_elements * static_cast<double>(std::max(reduced, int64_t(1)));
+    }
+  } else if (IsPrimitiveCNode(node, prim::kPrimConv2D)) {
+    // The weight is (out_channel, in_channel / group, kernel_h, kernel_w).
+    auto shape = GetInputShape(node, kIndex2);
+    if (!shape.empty()) {
+      double reduced = std::accumulate(shape.begin() + 1, shape.end(), 1.0, std::multiplies<double>());
+      return kIndex2 * output_elements * std::max(reduced, 1.0);
+    }
+  }
+  return output_elements;
+}
+
+// The bytes of a forward node kept until the backward pass, by itself or by the tuple_getitem of its outputs.
+double GetBpropUsedBytes(const FuncGraphManagerPtr &mng, const AnfNodePtr &node) {
+  const auto &node_users = mng->node_users();
+  auto output_set_iter = node_users.find(node);
+  if (output_set_iter == node_users.end()) {
+    return 0.0;
+  }
+  double bytes = 0.0;
+  bool used_by_bprop = false;
+  for (const auto &node_index : output_set_iter->second) {
+    if (IsBpropNode(node_index.first)) {
+      used_by_bprop = true;
+    } else if (IsPrimitiveCNode(node_index.first, prim::kPrimTupleGetItem)) {
+      bytes += GetBpropUsedBytes(mng, node_index.first);
+    }
+  }
+  return used_by_bprop ? GetAbstractBytes(node->abstract()) : bytes;
+}
+
+struct AutoRecomputeCandidate {
+  CNodePtr node;
+  double bytes;
+  double flops;
+};
+
+// Select the recomputed nodes under the memory budget of the activations kept for the backward pass. The activations
+// are estimated by the abstracts, a node is freed at the cost of keeping its inputs alive until the backward pass.
+// The candidates are picked greedily by the FLOPs per freed byte, the cheapest first, until the budget is met.
+void SetAutoRecomputedAttr(const FuncGraphPtr &graph, const std::vector<CNodePtr> &origin_nodes_topological,
+                           double budget) {
+  auto mng = graph->manager();
+  MS_EXCEPTION_IF_NULL(mng);
+  mindspore::HashMap<AnfNodePtr, bool> has_grad_inputs_map;
+  mindspore::HashMap<AnfNodePtr, double> kept_bytes;
+  std::vector<AutoRecomputeCandidate> candidates;
+  double total_bytes = 0.0;
+  for (const auto &node : origin_nodes_topological) {
+    MS_EXCEPTION_IF_NULL(node);
+    if (IsBpropNode(node) || IsSetRecomputeCNodeAttr(node) || IsPrimitiveCNode(node, prim::kPrimTupleGetItem)) {
+      continue;
+    }
+    double bytes = GetBpropUsedBytes(mng, node);
+    if (bytes <= 0.0) {
+      continue;
+    }
+    (void)kept_bytes.emplace(node, bytes);
+    total_bytes += bytes;
+    if (IsSetNoRecomputeCNodeAttr(node) || CanNotRecomputed(node) || GetCNodePrimitive(node) == nullptr ||
+        !HasForwardOutput(mng, node) || HasGradInputs(node, &has_grad_inputs_map)) {
+      continue;
+    }
+    candidates.push_back({node, bytes, GetRecomputeFlops(node)});
+  }
+  MS_LOG(INFO) << "The activations kept for the backward pass are estimated to " << total_bytes / kGBToByte
+               << "GB, the recompute memory budget is " << budget / kGBToByte << "GB.";
+  if (total_bytes <= budget) {
+    return;
+  }
+  std::stable_sort(candidates.begin(), candidates.end(),
+                   [](const AutoRecomputeCandidate &a, const AutoRecomputeCandidate &b) {
+                     return a.flops * b.bytes < b.flops * a.bytes;
+                   });
+  mindspore::HashSet<AnfNodePtr> recomputed_nodes;
+  double added_flops = 0.0;
+  for (const auto &candidate : candidates) {
+    if (total_bytes <= budget) {
+      break;
+    }
+    // The inputs computed in the forward pass stay alive for the recomputation, unless they are recomputed too.
+    std::vector<AnfNodePtr> extended_inputs;
+    double freed_bytes = candidate.bytes;
+    for (const auto &input : candidate.node->inputs()) {
+      if (!input->isa<CNode>() || IsPrimitiveCNode(input, prim::kPrimLoad) || kept_bytes.count(input) != 0 ||
+          recomputed_nodes.count(input) != 0) {
+        continue;
+      }
+      (void)extended_inputs.emplace_back(input);
+      freed_bytes -= GetAbstractBytes(input->abstract());
+    }
+    if (freed_bytes <= 0.0) {
+      continue;
+    }
+    for (const auto &input : extended_inputs) {
+      kept_bytes[input] = GetAbstractBytes(input->abstract());
+    }
+    (void)kept_bytes.erase(candidate.node);
+    (void)recomputed_nodes.insert(candidate.node);
+    total_bytes -= freed_bytes;
+    added_flops += candidate.flops;
+    candidate.node->AddAttr(kAttrRecompute, MakeValue(true));
+    std::vector<AnfNodePtr> tuple_getitem_output_nodes;
+    GetTupleGetItemOutputNodes(mng, candidate.node, &tuple_getitem_output_nodes);
+    for (const auto &output_node : tuple_getitem_output_nodes) {
+      output_node->cast_ptr<CNode>()->AddAttr(kAttrRecompute, MakeValue(true));
+    }
+    MS_LOG(INFO) << "Recompute " << candidate.node->fullname_with_scope() << ", which frees "
+                 << freed_bytes / kGBToByte << "GB at " << candidate.flops << " FLOPs.";
+  }
+  MS_LOG(INFO) << "Recompute " << recomputed_nodes.size() << " nodes automatically, which adds " << added_flops
+               << " FLOPs, the activations kept for the backward pass are estimated to " << total_bytes / kGBToByte
+               << "GB.";
+  if (total_bytes > budget) {
+    MS_LOG(WARNING) << "The activations kept for the backward pass are estimated to " << total_bytes / kGBToByte
+                    << "GB after recomputing, which still exceed the recompute memory budget "
+                    << budget / kGBToByte << "GB.";
+  }
+}
+
 CNodePtr CreateNewRecomputedNode(const FuncGraphPtr &graph, const CNodePtr &origin_node,
                                  const std::vector<AnfNodePtr> &new_inputs) {
   auto recomputed_node = graph->NewCNode(new_inputs);
@@ -459,6 +642,12 @@ void InsertRecomputedNodes(const FuncGraphPtr &graph) {
   std::list<CNodePtr> orders = graph->GetOrderedCnodes();
   std::vector<CNodePtr> origin_nodes_topological(orders.cbegin(), orders.cend());
   SetRecomputedAttr(graph, origin_nodes_topological);
+  auto context = MsContext::GetInstance();
+  MS_EXCEPTION_IF_NULL(context);
+  auto budget = context->get_param<float>(MS_CTX_RECOMPUTE_MEMORY_BUDGET);
+  if (budget > 0.0f) {
+    SetAutoRecomputedAttr(graph, origin_nodes_topological, static_cast<double>(budget) * kGBToByte);
+  }
   // Get candidate origin recomputed nodes which have no grad inputs and output to at least one grad node directly.
   std::vector<CNodePtr> candidate_recomputed_nodes = FindCandidateRecomputedNodes(mng, origin_nodes_topological);
   mindspore::HashSet<CNodePtr> visited_nodes;
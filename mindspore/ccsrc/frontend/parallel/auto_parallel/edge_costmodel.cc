@@ -20,6 +20,9 @@
 #include <functional>
 #include <iterator>
 #include <utility>
+#include <vector>
+#include "include/common/thread_pool.h"
+#include "utils/ms_exception.h"
 #include "frontend/parallel/auto_parallel/costmodel.h"
 #include "frontend/parallel/auto_parallel/graph_costmodel.h"
 #include "frontend/parallel/tensor_layout/tensor_redistribution.h"
@@ -27,6 +30,11 @@
 
 namespace mindspore {
 namespace parallel {
+namespace {
+// An edge with fewer strategy pairs per task is not worth dispatching to the thread pool.
+constexpr size_t kParallelEdgeCostMinPairs = 64;
+}  // namespace
+
 Status Edge::InitEdgeCost() {
   bool has_available_cost = false;
   pre_op_output_.clear();
@@ -64,32 +72,52 @@ Status Edge::InitEdgeCost() {
       }
     }
   } else {
-    for (auto &target_output : pre_op_output_) {
-      auto target_output_lyt = target_output.second[prev_op_output_index_].tensor_layout();
-      auto target_output_str = target_output.first;
-      auto type_length = prev_op_->GetOutputTypeLengths()[prev_op_output_index_];
-      auto type = prev_op_->outputs_type()[prev_op_output_index_];
-      for (auto &target_input : next_op_input_) {
-        auto target_input_lyt = target_input.second[next_op_input_index_].tensor_layout();
-        auto target_input_str = target_input.first;
-        CostPtr cost;
-        if (GetRedistributionCost(target_output_lyt, target_input_lyt, type_length, type, &cost) != SUCCESS) {
+    auto type_length = prev_op_->GetOutputTypeLengths()[prev_op_output_index_];
+    auto type = prev_op_->outputs_type()[prev_op_output_index_];
+    // The redistribution costs of the strategy pairs are independent, they are computed by the thread pool and then
+    // added to the cost map in order.
+    size_t input_num = next_op_input_.size();
+    size_t pair_num = pre_op_output_.size() * input_num;
+    std::vector<CostPtr> costs(pair_num);
+    auto compute_costs = [&](size_t start, size_t end) {
+      for (size_t i = start; i < end; ++i) {
+        auto target_output_lyt = pre_op_output_[i / input_num].second[prev_op_output_index_].tensor_layout();
+        auto target_input_lyt = next_op_input_[i % input_num].second[next_op_input_index_].tensor_layout();
+        if (GetRedistributionCost(target_output_lyt, target_input_lyt, type_length, type, &costs[i]) != SUCCESS) {
           MS_LOG(EXCEPTION) << "Failure: redistribution cost calculation failed";
         }
-        MS_EXCEPTION_IF_NULL(cost);
-        MS_LOG(DEBUG) << "The redistribution cost: computation_cost: " << cost->computation_cost_
-                      << ", communication_cost: " << cost->communication_cost_
-                      << ", communication_without_parameter_: " << cost->communication_without_parameter_
-                      << ", communication_with_partial_para_: " << cost->communication_with_partial_para_ << ".";
-        // refine communication cost calculation for practice
-        RefineForPracticalCost(cost, true);
-        cost->communication_forward_ = cost->communication_redis_forward_;
-        CostPtrKey ck = {target_output_str, target_input_str};
-        CostPtrList cl;
-        cl.push_back(cost);
-        (void)cost_map_.emplace(std::make_pair(ck, cl));
-        has_available_cost = true;
       }
+      return common::SUCCESS;
+    };
+    auto &thread_pool = common::ThreadPool::GetInstance();
+    size_t task_num = std::min(thread_pool.GetSyncRunThreadNum(), pair_num / kParallelEdgeCostMinPairs);
+    if (task_num > 1) {
+      std::vector<common::Task> tasks;
+      size_t task_size = (pair_num + task_num - 1) / task_num;
+      for (size_t start = 0; start < pair_num; start += task_size) {
+        size_t end = std::min(start + task_size, pair_num);
+        (void)tasks.emplace_back([&compute_costs, start, end]() { return compute_costs(start, end); });
+      }
+      (void)thread_pool.SyncRun(tasks);
+      MsException::Instance().CheckException();
+    } else {
+      (void)compute_costs(0, pair_num);
+    }
+    for (size_t i = 0; i < pair_num; ++i) {
+      auto &cost = costs[i];
+      MS_EXCEPTION_IF_NULL(cost);
+      MS_LOG(DEBUG) << "The redistribution cost: computation_cost: " << cost->computation_cost_
+                    << ", communication_cost: " << cost->communication_cost_
+                    << ", communication_without_parameter_: " << cost->communication_without_parameter_
+                    << ", communication_with_partial_para_: " << cost->communication_with_partial_para_ << ".";
+      // refine communication cost calculation for practice
+      RefineForPracticalCost(cost, true);
+      cost->communication_forward_ = cost->communication_redis_forward_;
+      CostPtrKey ck = {pre_op_output_[i / input_num].first, next_op_input_[i % input_num].first};
+      CostPtrList cl;
+      cl.push_back(cost);
+      (void)cost_map_.emplace(std::make_pair(ck, cl));
+      has_available_cost = true;
     }
   }
   if (!has_available_cost) {
@@ -16,12 +16,20 @@
 
 #include "frontend/parallel/auto_parallel/rec_core/rec_partition.h"
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "ir/anf.h"
+#include "include/common/thread_pool.h"
+#include "utils/ms_exception.h"
+#include "frontend/parallel/costmodel_context.h"
 #include "frontend/parallel/status.h"
 #include "frontend/parallel/ops_info/ops_utils.h"
 
@@ -204,6 +212,148 @@ StrategyRec GetOneLoopStrategy(size_t op_inputs_num, const StrategyRec &old_str,
   return new_str;
 }
 
+namespace {
+// The radius of the neighborhoods compared in the coarsening. The operators of the repeated layers are isomorphic if
+// they are farther than this from the first and the last layer.
+constexpr size_t kCoarseningRounds = 3;
+
+void AppendTensorStr(const TensorStr4D &str, std::vector<double> *signature) {
+  signature->insert(signature->end(), {str.str_n, str.str_c, str.str_h, str.str_w});
+}
+
+void AppendTensorParam(const TensorParam &tensor, std::vector<double> *signature) {
+  const auto &shape = tensor.tensor_shape;
+  signature->insert(signature->end(),
+                    {static_cast<double>(tensor.tensor_type), static_cast<double>(shape.shape_n),
+                     static_cast<double>(shape.shape_c), static_cast<double>(shape.shape_h),
+                     static_cast<double>(shape.shape_w)});
+  AppendTensorStr(tensor.tensor_str, signature);
+}
+
+// Everything PartitionNode reads from the node itself, the unused inputs keep their default values and are skipped.
+std::vector<double> GetLocalSignature(const Graph::NodeType &node) {
+  std::vector<double> signature = {static_cast<double>(node.info), static_cast<double>(node.apply.op_type),
+                                   static_cast<double>(node.node_in.size()), static_cast<double>(node.node_out.size()),
+                                   static_cast<double>(node.apply.str.cut_counter)};
+  AppendTensorParam(node.tensor_parm, &signature);
+  AppendTensorStr(node.apply.str.outputTensor, &signature);
+  std::vector<double> unused;
+  AppendTensorParam(TensorParam(), &unused);
+  AppendTensorStr(TensorStr4D(), &unused);
+  size_t input_num = MAX_INPUT_NUM;
+  while (input_num > 0) {
+    std::vector<double> input;
+    AppendTensorParam(node.apply.arguments[input_num - 1], &input);
+    AppendTensorStr(node.apply.str.inputTensor[input_num - 1], &input);
+    if (input != unused) {
+      break;
+    }
+    --input_num;
+  }
+  for (size_t i = 0; i < input_num; ++i) {
+    AppendTensorParam(node.apply.arguments[i], &signature);
+    AppendTensorStr(node.apply.str.inputTensor[i], &signature);
+  }
+  return signature;
+}
+
+// Label the nodes by refining their local signatures with the labels of their inputs and outputs in order, so the
+// nodes of a label have isomorphic neighborhoods of kCoarseningRounds hops and are partitioned alike.
+std::vector<size_t> GetIsomorphicClasses(const std::shared_ptr<Graph> &graph) {
+  size_t node_num = graph->nodes.size();
+  std::vector<size_t> labels(node_num);
+  std::map<std::vector<double>, size_t> signature_to_label;
+  for (size_t i = 0; i < node_num; ++i) {
+    auto iter = signature_to_label.emplace(GetLocalSignature(graph->nodes[i]), signature_to_label.size()).first;
+    labels[i] = iter->second;
+  }
+  size_t label_num = signature_to_label.size();
+  for (size_t round = 0; round < kCoarseningRounds; ++round) {
+    std::map<std::vector<size_t>, size_t> neighbor_to_label;
+    std::vector<size_t> new_labels(node_num);
+    for (size_t i = 0; i < node_num; ++i) {
+      const auto &node = graph->nodes[i];
+      std::vector<size_t> key = {labels[i]};
+      (void)std::transform(node.node_in.begin(), node.node_in.end(), std::back_inserter(key),
+                           [&labels](size_t in) { return labels[in]; });
+      key.push_back(SIZE_MAX);
+      (void)std::transform(node.node_out.begin(), node.node_out.end(), std::back_inserter(key),
+                           [&labels](size_t out) { return labels[out]; });
+      new_labels[i] = neighbor_to_label.emplace(std::move(key), neighbor_to_label.size()).first->second;
+    }
+    labels.swap(new_labels);
+    if (neighbor_to_label.size() == label_num) {
+      break;
+    }
+    label_num = neighbor_to_label.size();
+  }
+  return labels;
+}
+
+// Split the nodes into the connected components, keeping the order of the nodes in every component.
+std::vector<std::vector<size_t>> GetComponents(const std::vector<size_t> &nodes, const std::shared_ptr<Graph> &graph) {
+  std::vector<size_t> roots(graph->nodes.size());
+  std::iota(roots.begin(), roots.end(), 0);
+  std::function<size_t(size_t)> find_root = [&roots, &find_root](size_t index) {
+    return roots[index] == index ? index : (roots[index] = find_root(roots[index]));
+  };
+  for (size_t i = 0; i < graph->nodes.size(); ++i) {
+    for (auto out : graph->nodes[i].node_out) {
+      roots[find_root(out)] = find_root(i);
+    }
+  }
+  std::map<size_t, size_t> root_to_component;
+  std::vector<std::vector<size_t>> components;
+  for (auto index : nodes) {
+    auto iter = root_to_component.emplace(find_root(index), components.size()).first;
+    if (iter->second == components.size()) {
+      components.emplace_back();
+    }
+    components[iter->second].push_back(index);
+  }
+  return components;
+}
+
+// Partition the nodes of a component in order. With coarsening, a node whose class is searched already in this loop
+// takes the strategy of the first node of its class.
+void PartitionComponent(const std::vector<size_t> &nodes, const std::vector<size_t> &node_classes,
+                        const std::shared_ptr<Graph> &graph) {
+  // temp vector to map nodename to its strategy.
+  std::vector<std::pair<std::string, StrategyRec>> node_name_to_strategy;
+  // the strategy and the one loop strategy of every class searched.
+  std::map<size_t, std::pair<StrategyRec, StrategyRec>> class_to_strategy;
+  for (auto index : nodes) {
+    Graph::NodeType &node_ptr = graph->nodes[index];
+
+    // 2-parts partitioning StrategyRec of the last loop
+    StrategyRec old_str = node_ptr.apply.str;
+    StrategyRec one_loop_strategyrec;
+    auto class_iter = node_classes.empty() ? class_to_strategy.end() : class_to_strategy.find(node_classes[index]);
+    if (class_iter != class_to_strategy.end()) {
+      node_ptr.apply.str = class_iter->second.first;
+      one_loop_strategyrec = class_iter->second.second;
+    } else {
+      // Serch optimal strategy to cut this operator. And store the result optimal strategy in graph.
+      node_ptr.apply.str = PartitionNode(node_ptr, node_name_to_strategy, graph);
+
+      // Get Current 2-parts partitioning strategy of this loop
+      size_t op_inputs_num = node_ptr.node_in.size();
+      one_loop_strategyrec = GetOneLoopStrategy(op_inputs_num, old_str, node_ptr.apply.str);
+      if (!node_classes.empty()) {
+        class_to_strategy[node_classes[index]] = std::make_pair(node_ptr.apply.str, one_loop_strategyrec);
+      }
+    }
+
+    // Apply OP Strategy to Tensor Strategy.
+    graph->nodes[index] = ApplyStrToTensor(node_ptr);
+
+    // Note down the node name and its strategy in this loop.
+    auto node_name_to_str = std::pair<std::string, StrategyRec>(graph->nodes[index].name, one_loop_strategyrec);
+    node_name_to_strategy.push_back(node_name_to_str);
+  }
+}
+}  // namespace
+
 // Partition graph into all devices.
 Status PartitionForAllDevices(const size_t num_device, const double device_memory,
                               const std::shared_ptr<Graph> &graph) {
@@ -222,40 +372,40 @@ Status PartitionForAllDevices(const size_t num_device, const double device_memor
   if (iter_times > 10) {
     MS_LOG(EXCEPTION) << "ERROR: Number of iter_times can't be larger than 10.";
   }
+  bool coarsening = CostModelContext::GetInstance()->rec_algo_enable_coarsening();
   // N-cuts loop
   for (int64_t loop = 0; loop < iter_times; loop++) {
     // Sort by weights
     std::vector<size_t> reorder_node_list = SortByWeight(graph);
 
-    // get total node number
-    size_t iter_nodes = reorder_node_list.size();
-
-    // temp vector to map nodename to its strategy.
-    std::vector<std::pair<std::string, StrategyRec>> node_name_to_strategy;
-
-    // Loop for all the nodes
-    for (size_t i_node = 0; i_node < iter_nodes; i_node++) {
-      // get current node's index
-      size_t index = reorder_node_list[i_node];
-
-      Graph::NodeType &node_ptr = graph->nodes[index];
-
-      // 2-parts partitioning StrategyRec of the last loop
-      StrategyRec old_str = graph->nodes[index].apply.str;
-
-      // Serch optimal strategy to cut this operator. And store the result optimal strategy in graph.
-      graph->nodes[index].apply.str = PartitionNode(node_ptr, node_name_to_strategy, graph);
-
-      // Get Current 2-parts partitioning strategy of this loop
-      size_t op_inputs_num = graph->nodes[index].node_in.size();
-      StrategyRec one_loop_strategyrec = GetOneLoopStrategy(op_inputs_num, old_str, graph->nodes[index].apply.str);
-
-      // Apply OP Strategy to Tensor Strategy.
-      graph->nodes[index] = ApplyStrToTensor(node_ptr);
-
-      // Note down the node name and its strategy in this loop.
-      auto node_name_to_str = std::pair<std::string, StrategyRec>(graph->nodes[index].name, one_loop_strategyrec);
-      node_name_to_strategy.push_back(node_name_to_str);
+    // A node only reads the strategies of its neighbors, so the components are partitioned independently.
+    auto components = GetComponents(reorder_node_list, graph);
+    std::vector<size_t> node_classes;
+    if (coarsening) {
+      node_classes = GetIsomorphicClasses(graph);
+      std::set<size_t> classes;
+      (void)std::transform(reorder_node_list.begin(), reorder_node_list.end(), std::inserter(classes, classes.end()),
+                           [&node_classes](size_t index) { return node_classes[index]; });
+      MS_LOG(INFO) << "Coarsen " << reorder_node_list.size() << " operators to " << classes.size()
+                   << " isomorphic classes in the loop " << loop << ".";
+    }
+    MS_LOG(INFO) << "Partition " << components.size() << " components in the loop " << loop << ".";
+
+    auto &thread_pool = common::ThreadPool::GetInstance();
+    if (components.size() > 1 && thread_pool.GetSyncRunThreadNum() > 1) {
+      std::vector<common::Task> tasks;
+      for (const auto &component : components) {
+        (void)tasks.emplace_back([&component, &node_classes, &graph]() {
+          PartitionComponent(component, node_classes, graph);
+          return common::SUCCESS;
+        });
+      }
+      (void)thread_pool.SyncRun(tasks);
+      MsException::Instance().CheckException();
+    } else {
+      for (const auto &component : components) {
+        PartitionComponent(component, node_classes, graph);
+      }
     }
   }
 
@@ -68,6 +68,7 @@ void CostModelContext::ResetAlgoParameters() {
   triangle_star_strategy_overwrite_ = DEFAULT_TRIANGLE_STAR_STRATEGY_OVERWRITE;
   dp_algo_enable_approxi_ = DEFAULT_DP_ALGO_ENABLE_APPROX;
   dp_algo_approxi_epsilon_ = DEFAULT_DP_ALGO_APPROX_EPSILON;
+  rec_algo_enable_coarsening_ = DEFAULT_REC_ALGO_ENABLE_COARSENING;
 }
 
 void CostModelContext::PrintCostModel() {
@@ -84,6 +85,7 @@ void CostModelContext::PrintCostModel() {
   MS_LOG(INFO) << "dp_algo_enable_approxi: " << dp_algo_enable_approxi_ << ".";
   MS_LOG(INFO) << "dp_algo_approxi_epsilon: " << dp_algo_approxi_epsilon_ << ".";
   MS_LOG(INFO) << "dp_algo_single_loop: " << dp_algo_single_loop_ << ".";
+  MS_LOG(INFO) << "rec_algo_enable_coarsening: " << rec_algo_enable_coarsening_ << ".";
   MS_LOG(INFO) << "run_phase: " << run_phase_ << ".";
   MS_LOG(INFO) << "tensor_slice_alignment_enable: " << tensor_slice_alignment_enable_ << ".";
   MS_LOG(INFO) << "tensor_slice_align_size: " << tensor_slice_alignment_size_ << ".";
@@ -266,6 +268,15 @@ void CostModelContext::set_dp_algo_single_loop(bool single_loop) {
   dp_algo_single_loop_ = single_loop;
 }
 
+void CostModelContext::set_rec_algo_enable_coarsening(bool coarsening) {
+  if (coarsening) {
+    MS_LOG(INFO) << "rec_algo_enable_coarsening: true.";
+  } else {
+    MS_LOG(INFO) << "rec_algo_enable_coarsening: false.";
+  }
+  rec_algo_enable_coarsening_ = coarsening;
+}
+
 struct CostRegister {
   CostRegister() {
     MsContext::device_seter([](const std::string &device_target) {
@@ -46,6 +46,7 @@ constexpr size_t DEFAULT_TENSOR_SLICE_ALIGNMENT_SIZE = 16;
 #define DEFAULT_DP_ALGO_ENABLE_APPROX false
 constexpr float DEFAULT_DP_ALGO_APPROX_EPSILON = 0.1;
 #define DEFAULT_DP_ALGO_SINGLE_LOOP false
+#define DEFAULT_REC_ALGO_ENABLE_COARSENING false
 constexpr int64_t TRAINING_PHASE = 0;
 
 class CostModelContext {
@@ -153,6 +154,9 @@ class CostModelContext {
   void set_dp_algo_single_loop(bool single_loop);
   bool dp_algo_single_loop() const { return dp_algo_single_loop_; }
 
+  void set_rec_algo_enable_coarsening(bool coarsening);
+  bool rec_algo_enable_coarsening() const { return rec_algo_enable_coarsening_; }
+
  private:
   CostModelContext();
   static std::shared_ptr<CostModelContext> cm_context_inst_;
@@ -197,6 +201,9 @@ class CostModelContext {
   // Whether to generate a single suite of OperatorInfo for a loop.
   bool dp_algo_single_loop_;
 
+  // Whether to search the strategies of the isomorphic operators only once in the recursive programming algorithm.
+  bool rec_algo_enable_coarsening_;
+
   int64_t run_phase_;  // 0: 'training', 1: 'inference'
 
   int64_t costmodel_allreduce_fusion_algorithm_;
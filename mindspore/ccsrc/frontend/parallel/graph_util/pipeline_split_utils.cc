@@ -424,6 +424,64 @@ void ReorderForBackward(const PipelinePair &forward_start_pair, const PipelinePa
   }
 }
 
+// The unit k of the interleaved 1F1B order runs one chunk of one micro batch. The forward walks the chunks of every
+// stage_num micro batches in turn and the backward walks them in the reverse order. A pair holds the units at
+// micro * interleave_num + chunk.
+static size_t InterleaveUnitIndex(size_t k, int64_t stage_num, int64_t interleave_num, bool is_forward) {
+  auto stages = LongToSize(stage_num);
+  auto chunks = LongToSize(interleave_num);
+  auto micro = k / (stages * chunks) * stages + k % stages;
+  auto chunk = k / stages % chunks;
+  if (!is_forward) {
+    chunk = chunks - 1 - chunk;
+  }
+  return micro * chunks + chunk;
+}
+
+void ReorderForInterleave(const PipelinePair &forward_start_pair, const PipelinePair &forward_end_pair,
+                          const PipelinePair &backward_start_pair, const PipelinePair &backward_end_pair,
+                          const FuncGraphPtr &root) {
+  MS_EXCEPTION_IF_NULL(g_device_manager);
+  MS_EXCEPTION_IF_NULL(root);
+  auto manager = root->manager();
+  MS_EXCEPTION_IF_NULL(manager);
+  auto stage_num = g_device_manager->stage_num();
+  auto stage_id = g_device_manager->stage_id();
+  auto interleave_num = ParallelContext::GetInstance()->pipeline_interleave_num();
+  auto fwd = [stage_num, interleave_num](size_t k) { return InterleaveUnitIndex(k, stage_num, interleave_num, true); };
+  auto bwd = [stage_num, interleave_num](size_t k) { return InterleaveUnitIndex(k, stage_num, interleave_num, false); };
+  auto unit_num = forward_start_pair.first.size();
+  // The send of a forward unit waits for its peer, so the backward recv of the steady phase only waits for the compute.
+  std::vector<AnfNodePtr> forward_end_before;
+  for (auto &node : forward_end_pair.second) {
+    forward_end_before.push_back(IsPrimitiveCNode(node, prim::kPrimSend) ? GetActualOp(node->cast<CNodePtr>()->input(1))
+                                                                         : node);
+  }
+  auto warmup_num = std::min(LongToSize((stage_num - stage_id - 1) * 2 + (interleave_num - 1) * stage_num), unit_num);
+  // warmup: the forward units run back to back.
+  for (size_t k = 1; k <= warmup_num && k < unit_num; ++k) {
+    InsertDepend(forward_end_pair.second[fwd(k - 1)], forward_start_pair.first[fwd(k)], manager, root);
+  }
+  // steady: every forward unit is followed by the oldest backward unit.
+  for (size_t k = warmup_num; k < unit_num; ++k) {
+    auto f = fwd(k);
+    auto b = bwd(k - warmup_num);
+    if (k > warmup_num) {
+      InsertDepend(backward_end_pair.second[bwd(k - warmup_num - 1)], forward_start_pair.first[f], manager, root);
+    }
+    InsertDepend(forward_end_before[f], backward_start_pair.first[b], manager, root);
+    if (IsPrimitiveCNode(forward_end_pair.first[f], prim::kPrimSend)) {
+      InsertDepend(backward_start_pair.second[b], forward_end_pair.first[f], manager, root);
+      InsertDepend(forward_end_pair.second[f], backward_end_pair.first[b], manager, root);
+    }
+  }
+  // cooldown: the backward units left run back to back.
+  for (size_t k = unit_num - warmup_num; k < unit_num; ++k) {
+    auto prior_node = k == 0 ? forward_end_pair.second[fwd(unit_num - 1)] : backward_end_pair.second[bwd(k - 1)];
+    InsertDepend(prior_node, backward_start_pair.first[bwd(k)], manager, root);
+  }
+}
+
 void ReorderForParams(const std::vector<AnfNodePtr> &backward_params, const std::vector<AnfNodePtr> &forward_params,
                       const PipelinePair &forward_params_pair, const std::vector<AnfNodePtr> &backward_end,
                       const PipelinePair &forward_start_pair, const FuncGraphPtr &root) {
@@ -450,6 +508,18 @@ int64_t GetMicroBatch(const AnfNodePtr &node) {
   return GetValue<int64_t>(micro_value);
 }
 
+int64_t GetPipelineChunk(const AnfNodePtr &node) {
+  MS_EXCEPTION_IF_NULL(node);
+  auto cnode = node->cast<CNodePtr>();
+  MS_EXCEPTION_IF_NULL(cnode);
+  // the border nodes of the data and the parameters belong to the first chunk.
+  auto chunk_value = cnode->GetPrimalAttr(PIPELINE_CHUNK);
+  if (chunk_value == nullptr) {
+    return 0;
+  }
+  return GetValue<int64_t>(chunk_value);
+}
+
 PipelinePair Deduplicate(const std::vector<AnfNodePtr> &node_vector, const FuncGraphPtr &root, int64_t micro_max) {
   std::vector<AnfNodePtr> temp_vec;
   std::vector<AnfNodePtr> out_vec_begin;
@@ -488,6 +558,32 @@ PipelinePair Deduplicate(const std::vector<AnfNodePtr> &node_vector, const FuncG
   return std::make_pair(out_vec_begin, out_vec_end);
 }
 
+PipelinePair DeduplicateInterleave(const std::vector<AnfNodePtr> &node_vector, const FuncGraphPtr &root,
+                                   int64_t micro_max, int64_t interleave_num) {
+  std::vector<AnfNodePtr> out_vec_begin;
+  std::vector<AnfNodePtr> out_vec_end;
+  auto manager = root->manager();
+  for (int64_t i = 0; i <= micro_max; ++i) {
+    for (int64_t chunk = 0; chunk < interleave_num; ++chunk) {
+      std::vector<AnfNodePtr> temp_vec;
+      (void)std::copy_if(node_vector.begin(), node_vector.end(), std::back_inserter(temp_vec),
+                         [i, chunk](const AnfNodePtr &node) {
+                           return GetMicroBatch(node) == i && GetPipelineChunk(node) == chunk;
+                         });
+      if (temp_vec.empty()) {
+        MS_LOG(EXCEPTION) << "Can't find the border node of micro batch " << i << " chunk " << chunk;
+      }
+      std::sort(temp_vec.begin(), temp_vec.end(), CompFunc);
+      for (size_t j = 0; j < temp_vec.size() - 1; ++j) {
+        InsertDepend(temp_vec[j], temp_vec[j + 1], manager, root);
+      }
+      out_vec_begin.push_back(temp_vec.front());
+      out_vec_end.push_back(temp_vec.back());
+    }
+  }
+  return std::make_pair(out_vec_begin, out_vec_end);
+}
+
 void BroadCastMicroBatch(const CNodePtr &node, NodeUsersMap *node_users_map, const ValuePtr &value, size_t max_depth) {
   auto node_users = (*node_users_map)[node];
   if (max_depth > MAX_RECURSIVE_DEPTH) {
@@ -548,6 +644,8 @@ void InsertVirtualPipelineEndNode(const CNodePtr &cnode, const FuncGraphManagerP
   virtual_end->set_abstract(pre_cnode->abstract());
   virtual_end->AddPrimalAttr(PIPELINE_END, pre_cnode->GetPrimalAttr(MICRO));
   virtual_end->AddPrimalAttr(MICRO, pre_cnode->GetPrimalAttr(MICRO));
+  auto interleave_num = ParallelContext::GetInstance()->pipeline_interleave_num();
+  virtual_end->AddPrimalAttr(PIPELINE_CHUNK, MakeValue(interleave_num - 1));
   manager->SetEdge(cnode, SizeToInt(index), virtual_end);
 }
 
@@ -744,6 +842,17 @@ void Reorder(const FuncGraphPtr &root) {
       micro_max = GetValue<int64_t>(micro_size);
     }
   }
+  auto interleave_num = ParallelContext::GetInstance()->pipeline_interleave_num();
+  if (root->has_flag(kTraining) && interleave_num > 1) {
+    auto backward_start_pair = DeduplicateInterleave(backward_start, root, micro_max, interleave_num);
+    auto backward_end_pair = DeduplicateInterleave(backward_end, root, micro_max, interleave_num);
+    auto forward_start_pair = DeduplicateInterleave(forward_start, root, micro_max, interleave_num);
+    auto forward_end_pair = DeduplicateInterleave(forward_end, root, micro_max, interleave_num);
+    auto forward_params_pair = Deduplicate(forward_params, root, micro_max);
+    ReorderForInterleave(forward_start_pair, forward_end_pair, backward_start_pair, backward_end_pair, root);
+    ReorderForParams(backward_params, forward_params, forward_params_pair, backward_end, forward_start_pair, root);
+    return;
+  }
   auto backward_start_pair = Deduplicate(backward_start, root, micro_max);
   auto backward_end_pair = Deduplicate(backward_end, root, micro_max);
   auto forward_start_pair = Deduplicate(forward_start, root, micro_max);
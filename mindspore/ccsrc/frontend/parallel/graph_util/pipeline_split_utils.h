@@ -40,13 +40,19 @@ void ReorderForForward(const std::vector<AnfNodePtr> &forward_start, const std::
 void ReorderForBackward(const PipelinePair &forward_start_pair, const PipelinePair &forward_end_pair,
                         const PipelinePair &backward_start_pair, const PipelinePair &backward_end_pair,
                         const PipelinePair &forward_end_before_pair, const FuncGraphPtr &root);
+void ReorderForInterleave(const PipelinePair &forward_start_pair, const PipelinePair &forward_end_pair,
+                          const PipelinePair &backward_start_pair, const PipelinePair &backward_end_pair,
+                          const FuncGraphPtr &root);
 void ReorderForParams(const std::vector<AnfNodePtr> &backward_params, const std::vector<AnfNodePtr> &forward_params,
                       const PipelinePair &forward_params_pair, const std::vector<AnfNodePtr> &backward_end,
                       const PipelinePair &forward_start_pair, const FuncGraphPtr &root);
 int64_t GetMicroBatch(const AnfNodePtr &node);
+int64_t GetPipelineChunk(const AnfNodePtr &node);
 void InsertDepend(const AnfNodePtr &prior_node, const AnfNodePtr &post_node, const FuncGraphManagerPtr &manager,
                   const FuncGraphPtr &root);
 PipelinePair Deduplicate(const std::vector<AnfNodePtr> &node_vector, const FuncGraphPtr &root, int64_t micro_max);
+PipelinePair DeduplicateInterleave(const std::vector<AnfNodePtr> &node_vector, const FuncGraphPtr &root,
+                                   int64_t micro_max, int64_t interleave_num);
 AnfNodePtr GetActualOp(const AnfNodePtr &node);
 void GetBorderNode(std::vector<AnfNodePtr> *forward_start, std::vector<AnfNodePtr> *forward_end,
                    std::vector<AnfNodePtr> *backward_start, std::vector<AnfNodePtr> *backward_end,
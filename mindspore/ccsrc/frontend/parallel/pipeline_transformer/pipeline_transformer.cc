@@ -54,6 +54,18 @@ static bool IsInWhiteList(const CNodePtr &cnode) {
   return false;
 }
 
+bool PipelineTransformer::IsOwnedStage(int64_t stage) const { return stage != -1 && RankStage(stage) == stage_; }
+
+int64_t PipelineTransformer::RankStage(int64_t stage) const {
+  MS_EXCEPTION_IF_NULL(g_device_manager);
+  return stage % g_device_manager->stage_num();
+}
+
+int64_t PipelineTransformer::StageChunk(int64_t stage) const {
+  MS_EXCEPTION_IF_NULL(g_device_manager);
+  return stage / g_device_manager->stage_num();
+}
+
 void PipelineTransformer::MainGraph() {
   if (!root_->has_flag(kTraining)) {
     main_graph_ = root_;
@@ -203,7 +215,7 @@ void PipelineTransformer::LabelGenMaskFusion() {
       continue;
     }
     auto stage = (*fg)->stage();
-    if (stage != -1 && stage != stage_) {
+    if (stage != -1 && !IsOwnedStage(stage)) {
       continue;
     }
     auto nodes = (*fg)->nodes();
@@ -245,7 +257,7 @@ void PipelineTransformer::Coloring() {
           auto user_node = user_pair.first->cast<CNodePtr>();
           user_node->set_user_data<NodeStageInfo>(std::make_shared<NodeStageInfo>(graph->stage()));
           auto user_node_graph = user_node->func_graph();
-          if (graph->stage() == stage_ && user_node_graph->stage() == -1) {
+          if (IsOwnedStage(graph->stage()) && user_node_graph->stage() == -1) {
             user_node_graph->set_stage(graph->stage());
             need_coloring = true;
           }
@@ -254,10 +266,13 @@ void PipelineTransformer::Coloring() {
     }
   }
   MS_EXCEPTION_IF_NULL(g_device_manager);
-  auto stage_num = g_device_manager->stage_num();
+  auto stage_num = g_device_manager->stage_num() * interleave_num_;
   if (SizeToLong(stage_set.size()) != stage_num) {
     MS_LOG(EXCEPTION) << "Stage num is " << stage_num << " is not equal to stage used: " << stage_set.size();
   }
+  if (*stage_set.rbegin() != stage_num - 1) {
+    MS_LOG(EXCEPTION) << "The stage used should be in [0, " << stage_num << "), but got " << *stage_set.rbegin();
+  }
 }
 
 void PipelineTransformer::BroadCastColoring() {
@@ -465,7 +480,9 @@ std::vector<AnfNodePtr> PipelineTransformer::HandleSharedParameter() {
       if (IsValueNode<FuncGraph>(cnode->input(0))) {
         graph = GetValueNode<FuncGraphPtr>(cnode->input(0));
       }
-      if (graph == root_ || graph->stage() == -1 || parameter_stage.count(stage_) == 0) {
+      if (graph == root_ || graph->stage() == -1 ||
+          std::none_of(parameter_stage.begin(), parameter_stage.end(),
+                       [this](int64_t stage) { return IsOwnedStage(stage); })) {
         continue;
       }
       auto micro = cnode->GetPrimalAttr(MICRO);
@@ -473,16 +490,16 @@ std::vector<AnfNodePtr> PipelineTransformer::HandleSharedParameter() {
         MS_LOG(INFO) << "parameter: " << parameter->ToString() << " doesn't have micro batch";
         micro = MakeValue(int64_t(0));
       }
-      if (stage_ == *parameter_stage.begin()) {
+      if (IsOwnedStage(*parameter_stage.begin())) {
         auto stage_info = node->user_data<NodeStageInfo>();
-        if (graph->stage() == stage_ || stage_info == nullptr) {
+        if (IsOwnedStage(graph->stage()) || stage_info == nullptr || IsOwnedStage(stage_info->stage())) {
           continue;
         }
         auto user_stage = stage_info->stage();
         if (Reuse(parameter, user_stage, make_tuple_input, DEST_RANK)) {
           continue;
         }
-        auto send_out = InsertSend(parameter, user_stage, stage_, micro);
+        auto send_out = InsertSend(parameter, user_stage, *parameter_stage.begin(), micro);
         make_tuple_input.push_back(send_out.depend);
       } else {
         auto receive = Reuse(parameter, *parameter_stage.begin(), recvs, SRC_RANK);
@@ -531,7 +548,7 @@ void PipelineTransformer::ParameterColoring() {
     }
     MS_EXCEPTION_IF_NULL(param_info);
     auto requires_grad = param_info->requires_grad();
-    if (!parameter_stage.empty() && *parameter_stage.begin() == stage_ && !virtual_param_ && requires_grad) {
+    if (!parameter_stage.empty() && IsOwnedStage(*parameter_stage.begin()) && !virtual_param_ && requires_grad) {
       virtual_param_ = parameter;
     }
     parameter_color_map_[parameter] = parameter_stage;
@@ -552,7 +569,7 @@ void PipelineTransformer::RemoveMonadNode() {
       continue;
     }
     auto stage = stage_info->stage();
-    if (stage != stage_ && stage != -1) {
+    if (!IsOwnedStage(stage) && stage != -1) {
       auto node_users = node_users_map[node];
       for (auto &user_node : node_users) {
         auto u_node = NewValueNode(kUMonad);
@@ -604,7 +621,7 @@ AnfNodePtr PipelineTransformer::FindPipelineCareNode(const AnfNodePtr &node) con
 
 SendAttr PipelineTransformer::InsertSend(const AnfNodePtr &parameter, int64_t user_node_stage, int64_t node_stage,
                                          const ValuePtr &value) {
-  auto dest_rank = global_rank_ + (user_node_stage - node_stage) * per_stage_rank_num_;
+  auto dest_rank = global_rank_ + (RankStage(user_node_stage) - RankStage(node_stage)) * per_stage_rank_num_;
   int64_t send_tag;
   if (send_tag_map.find(dest_rank) != send_tag_map.end()) {
     send_tag = send_tag_map[dest_rank] + 1;
@@ -614,7 +631,7 @@ SendAttr PipelineTransformer::InsertSend(const AnfNodePtr &parameter, int64_t us
     send_tag_map[dest_rank] = 0;
   }
   Attr attr_tag = std::make_pair(SR_TAG, MakeValue(send_tag));
-  Attr attr_rank = std::make_pair(DEST_RANK, MakeValue(user_node_stage));
+  Attr attr_rank = std::make_pair(DEST_RANK, MakeValue(RankStage(user_node_stage)));
   Attr attr_group = std::make_pair(GROUP, MakeValue(group_[0]));
   Attr attr_group_back = std::make_pair(GROUP_BACK, MakeValue(group_[1]));
   OperatorAttrs attrs = {attr_tag, attr_rank, attr_group, attr_group_back};
@@ -656,6 +673,7 @@ SendAttr PipelineTransformer::InsertSend(const AnfNodePtr &parameter, int64_t us
     send->AddPrimalAttr(PARAM_INDEX, MakeValue(index));
   }
   send->AddPrimalAttr(MICRO, value);
+  send->AddPrimalAttr(PIPELINE_CHUNK, MakeValue(StageChunk(node_stage)));
   OperatorAttrs depend_attrs;
   auto depend_op = CreateOpInstance(depend_attrs, DEPEND, DEPEND);
   std::vector<AnfNodePtr> depend_input = {NewValueNode(depend_op), parameter, send};
@@ -674,7 +692,7 @@ AnfNodePtr PipelineTransformer::InsertReceive(const FuncGraphPtr &graph, const A
                                               const AnfNodePtr &use_node, int index, int64_t user_node_stage,
                                               int64_t node_stage, const ValuePtr &value,
                                               const AnfNodePtr &graph_param) {
-  auto src_rank = global_rank_ - (user_node_stage - node_stage) * per_stage_rank_num_;
+  auto src_rank = global_rank_ - (RankStage(user_node_stage) - RankStage(node_stage)) * per_stage_rank_num_;
   int64_t recv_tag;
   if (recv_tag_map.find(src_rank) != recv_tag_map.end()) {
     recv_tag = recv_tag_map[src_rank] + 1;
@@ -684,7 +702,7 @@ AnfNodePtr PipelineTransformer::InsertReceive(const FuncGraphPtr &graph, const A
     recv_tag_map[src_rank] = 0;
   }
   Attr attr_tag = std::make_pair(SR_TAG, MakeValue(recv_tag));
-  Attr attr_rank = std::make_pair(SRC_RANK, MakeValue(node_stage));
+  Attr attr_rank = std::make_pair(SRC_RANK, MakeValue(RankStage(node_stage)));
   std::pair<OperatorInfoPtr, int> op_info_pair;
   bool is_param = true;
   TensorInfo tensor_info;
@@ -728,6 +746,7 @@ AnfNodePtr PipelineTransformer::InsertReceive(const FuncGraphPtr &graph, const A
     recv->AddPrimalAttr(PIPELINE_BEGIN, value);
   }
   recv->AddPrimalAttr(MICRO, value);
+  recv->AddPrimalAttr(PIPELINE_CHUNK, MakeValue(StageChunk(user_node_stage)));
   auto node_abstract = node->abstract();
   if (node->isa<CNode>()) {
     auto cnode = node->cast<CNodePtr>();
@@ -768,7 +787,7 @@ AnfNodePtr PipelineTransformer::Reuse(const AnfNodePtr &node, int64_t stage, con
     if (cnode->input(1) == node) {
       auto prim = GetValueNode<PrimitivePtr>(cnode->input(0));
       auto dest_rank_send = GetValue<int64_t>(prim->GetAttr(tag));
-      if (dest_rank_send == stage) {
+      if (dest_rank_send == RankStage(stage)) {
         return input;
       }
     }
@@ -814,7 +833,7 @@ AnfNodePtr PipelineTransformer::HandleParameterGraph(const AnfNodePtr &node, con
   auto parameter = use_parameter_list.at(pos - 1);
 
   // insert receive
-  if (stage_ == user_stage) {
+  if (IsOwnedStage(user_stage)) {
     auto recv = Reuse(argument, stage, ops, SRC_RANK);
     if (recv) {
       manager_->SetEdge(use_node, SizeToInt(pos), recv);
@@ -827,7 +846,7 @@ AnfNodePtr PipelineTransformer::HandleParameterGraph(const AnfNodePtr &node, con
   if (Reuse(argument, user_stage, ops, DEST_RANK)) {
     return nullptr;
   }
-  auto send_out = InsertSend(argument, user_stage, stage_, micro);
+  auto send_out = InsertSend(argument, user_stage, stage, micro);
   send_out.depend->set_user_data<Type>(DTYPE, send_out.type);
   send_out.depend->set_user_data<ValueList>(SHAPE, send_out.shape);
   return send_out.depend;
@@ -846,7 +865,15 @@ void PipelineTransformer::CutBorderForNode(const FuncGraphPtr &graph, const AnfN
       continue;
     }
     auto user_node_stage = user_stage_info->stage();
-    if (node_stage != stage_ && user_node_stage != stage_) {
+    if (!IsOwnedStage(node_stage) && !IsOwnedStage(user_node_stage)) {
+      continue;
+    }
+    // two chunks of the same stage, the data stays on the device.
+    if (IsOwnedStage(node_stage) && IsOwnedStage(user_node_stage)) {
+      if (node_stage > user_node_stage) {
+        MS_LOG(EXCEPTION) << "node_stage: " << node_stage << " must be smaller than user_node_stage: "
+                          << user_node_stage;
+      }
       continue;
     }
     auto micro = user_node->cast<CNodePtr>()->GetPrimalAttr(MICRO);
@@ -855,7 +882,7 @@ void PipelineTransformer::CutBorderForNode(const FuncGraphPtr &graph, const AnfN
       micro = MakeValue(int64_t(0));
     }
     if (node_stage < user_node_stage) {
-      if (node_stage == stage_) {
+      if (IsOwnedStage(node_stage)) {
         if (IsParameterGraph(node)) {
           auto send_depend = HandleParameterGraph(node, user_node, node_stage, user_node_stage, micro,
                                                   IntToSize(user_pair.second), *send_ops);
@@ -909,6 +936,10 @@ std::pair<std::vector<AnfNodePtr>, std::vector<AnfNodePtr>> PipelineTransformer:
   if (root_->has_flag(kTraining) && (stage_num > micro_size_)) {
     MS_LOG(EXCEPTION) << "MicroBatch size: " << micro_size_ << " can't less than stage num: " << stage_num;
   }
+  if (root_->has_flag(kTraining) && interleave_num_ > 1 && micro_size_ % stage_num != 0) {
+    MS_LOG(EXCEPTION) << "MicroBatch size: " << micro_size_ << " should be a multiple of stage num: " << stage_num
+                      << " with interleaved pipeline.";
+  }
   for (auto &node : all_nodes) {
     auto stage_info = node->user_data<NodeStageInfo>();
     if (!node->isa<CNode>() || stage_info == nullptr || stage_info->stage() == -1 ||
@@ -931,13 +962,22 @@ void PipelineTransformer::CutGraph() {
   }
   auto send_recv_ops = CutBorder(main_graph_);
   auto send_ops = send_recv_ops.first;
-  if (IsLastStage()) {
+  if (IsLastStage() && interleave_num_ == 1) {
     return;
   }
-  if (send_ops.empty() && !root_->has_flag(kTraining)) {
+  if (send_ops.empty() && (!root_->has_flag(kTraining) || IsLastStage())) {
     return;
   }
   (void)make_tuple_inputs.insert(make_tuple_inputs.cend(), send_ops.cbegin(), send_ops.cend());
+  if (IsLastStage()) {
+    // The earlier chunks of the last stage send to the first stage, the loss stays the output.
+    auto make_tuple = main_graph_->NewCNode(make_tuple_inputs);
+    auto output = main_graph_->output();
+    auto out_node = main_graph_->NewCNode({NewValueNode(prim::kPrimDepend), output, make_tuple});
+    out_node->set_abstract(output->abstract());
+    manager_->SetEdge(main_graph_->get_return(), 1, out_node);
+    return;
+  }
   if (!send_ops.empty()) {
     type_ptr_ = send_ops.back()->user_data<Type>(DTYPE);
     shape_ = send_ops.back()->user_data<ValueList>(SHAPE);
@@ -1070,7 +1110,7 @@ bool PipelineTransformer::IsRedundancyParameter(const AnfNodePtr &parameter) {
   if (stage_set.empty()) {
     return false;
   }
-  return stage_set.count(stage_) == 0;
+  return std::none_of(stage_set.begin(), stage_set.end(), [this](int64_t stage) { return IsOwnedStage(stage); });
 }
 
 void PipelineTransformer::ElimParameter() {
@@ -26,6 +26,7 @@
 #include "ir/graph_utils.h"
 #include "base/base.h"
 #include "utils/hash_map.h"
+#include "include/common/utils/parallel_context.h"
 #include "frontend/parallel/step_parallel.h"
 #include "frontend/parallel/graph_util/generate_graph.h"
 
@@ -49,7 +50,8 @@ class PipelineTransformer {
         main_graph_(nullptr),
         virtual_dataset_(nullptr),
         global_rank_(global_rank),
-        per_stage_rank_num_(per_stage_rank_num) {}
+        per_stage_rank_num_(per_stage_rank_num),
+        interleave_num_(ParallelContext::GetInstance()->pipeline_interleave_num()) {}
   virtual ~PipelineTransformer() = default;
   void Coloring();
   void LabelGenMaskFusion();
@@ -94,6 +96,11 @@ class PipelineTransformer {
   void RedundancyNode(const AnfNodePtr &node, mindspore::HashMap<CNodePtr, std::vector<AnfNodePtr>> *make_tuple_map);
   bool IsRedundancyParameter(const AnfNodePtr &parameter);
   void ElimParameter();
+  // With interleaved pipeline, the cells are labeled with virtual stages and the virtual stage s is the chunk
+  // s / stage_num of the stage s % stage_num, so every stage owns interleave_num_ non-contiguous chunks.
+  bool IsOwnedStage(int64_t stage) const;
+  int64_t RankStage(int64_t stage) const;
+  int64_t StageChunk(int64_t stage) const;
   FuncGraphManagerPtr manager_;
   int64_t stage_;
   FuncGraphPtr root_;
@@ -101,6 +108,7 @@ class PipelineTransformer {
   AnfNodePtr virtual_dataset_;
   int64_t global_rank_;
   int64_t per_stage_rank_num_;
+  int64_t interleave_num_;
   TypePtr type_ptr_;
   ValueListPtr shape_;
   AnfNodePtr virtual_param_;
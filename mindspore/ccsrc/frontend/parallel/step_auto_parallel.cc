@@ -45,6 +45,7 @@
 #include "frontend/parallel/step_parallel.h"
 #include "frontend/parallel/parameter_manager.h"
 #include "frontend/parallel/strategy_checkpoint/parallel_strategy_checkpoint.h"
+#include "frontend/parallel/tensor_layout/tensor_redistribution.h"
 #include "ir/anf.h"
 #include "ir/param_info.h"
 #include "ir/tensor.h"
@@ -208,6 +209,7 @@ void InitCostGraph() {
   entire_costgraph->Init();
   configured_stra_ops_.clear();
   ignore_candidate_.clear();
+  TensorRedistribution::ClearCostCache();
 }
 
 void SetStrategyToOperator(const OperatorInfoPtr &operator_info, const PrimitivePtr &prim,
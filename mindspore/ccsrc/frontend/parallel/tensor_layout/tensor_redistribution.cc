@@ -18,14 +18,57 @@
 #include <functional>
 #include <numeric>
 #include <memory>
+#include <mutex>
+#include <sstream>
 #include <utility>
 #include <string>
+#include "utils/hash_map.h"
 #include "utils/ms_utils.h"
+#include "frontend/parallel/device_matrix.h"
 #include "frontend/parallel/status.h"
 #include "frontend/parallel/tensor_layout/shape_util.h"
 
 namespace mindspore {
 namespace parallel {
+namespace {
+struct RedistributionCost {
+  bool reshape_flag = false;
+  double comm_cost = 0.0;
+  double forward_comm_cost = 0.0;
+  double backward_comm_cost = 0.0;
+  double computation_cost = 0.0;
+  double memory_cost = 0.0;
+};
+
+// The edges of the cost graph are initialized by several threads, so the cache is guarded by a mutex.
+std::mutex cost_cache_mutex;
+mindspore::HashMap<std::string, RedistributionCost> cost_cache;
+}  // namespace
+
+void TensorRedistribution::ClearCostCache() {
+  std::lock_guard<std::mutex> lock(cost_cache_mutex);
+  cost_cache.clear();
+}
+
+std::string TensorRedistribution::CostCacheKey() const {
+  std::ostringstream buffer;
+  // The redistribution reads the standard layouts only, the origin fields keep the ones of the strategy before the
+  // device dimensions of size 1 are removed, so layouts which only differ in them share their cost.
+  buffer << from_origin_.StandardToString() << std::endl << "->" << to_origin_.StandardToString() << std::endl;
+  // The device list of a stage is mostly contiguous, it is keyed by its first rank and size then.
+  bool contiguous = true;
+  for (size_t i = 1; i < dev_list_.size(); ++i) {
+    contiguous = contiguous && dev_list_[i] == dev_list_[i - 1] + 1;
+  }
+  if (contiguous && !dev_list_.empty()) {
+    buffer << "devices = " << dev_list_.front() << "+" << dev_list_.size();
+  } else {
+    buffer << "devices = " << ShapeToString(dev_list_);
+  }
+  buffer << ", construct op = " << construct_op_flag_ << ", keep reshape = " << keep_reshape_;
+  return buffer.str();
+}
+
 Status TensorRedistribution::Init(const TensorLayout &from, const TensorLayout &to, const RankList &dev_list) {
   from_origin_ = from;
   to_origin_ = to;
@@ -203,6 +246,20 @@ Status TensorRedistribution::InferRedistribution(const TensorLayout &from_layout
 }
 
 Status TensorRedistribution::ComputeCost() {
+  std::string cache_key = CostCacheKey();
+  {
+    std::lock_guard<std::mutex> lock(cost_cache_mutex);
+    auto iter = cost_cache.find(cache_key);
+    if (iter != cost_cache.end()) {
+      reshape_flag_ = iter->second.reshape_flag;
+      comm_cost_ = iter->second.comm_cost;
+      forward_comm_cost_ = iter->second.forward_comm_cost;
+      backward_comm_cost_ = iter->second.backward_comm_cost;
+      computation_cost_ = iter->second.computation_cost;
+      memory_cost_ = iter->second.memory_cost;
+      return Status::SUCCESS;
+    }
+  }
   RedistributionOpListPtr redistribution_oplist_ptr = InferTensorRedistributionOperatorList(true);
   if (redistribution_oplist_ptr == nullptr) {
     MS_LOG(ERROR) << "Failure: InferTensorRedistribution failed";
@@ -239,6 +296,9 @@ Status TensorRedistribution::ComputeCost() {
     computation_cost_ += COST_FACTOR * prev_prod;
     memory_cost_ += COST_FACTOR * prev_prod;
   }
+  std::lock_guard<std::mutex> lock(cost_cache_mutex);
+  cost_cache[cache_key] = {reshape_flag_, comm_cost_, forward_comm_cost_, backward_comm_cost_, computation_cost_,
+                           memory_cost_};
   return Status::SUCCESS;
 }
 
@@ -17,6 +17,7 @@
 #ifndef MINDSPORE_CCSRC_FRONTEND_PARALLEL_TENSOR_LAYOUT_TENSOR_REDISTRIBUTION_H_
 #define MINDSPORE_CCSRC_FRONTEND_PARALLEL_TENSOR_LAYOUT_TENSOR_REDISTRIBUTION_H_
 
+#include <string>
 #include <vector>
 
 #include "ir/value.h"
@@ -52,8 +53,12 @@ class TensorRedistribution {
   double forward_comm_cost() const { return forward_comm_cost_; }
   double backward_comm_cost() const { return backward_comm_cost_; }
   double memory_cost() const { return memory_cost_; }
+  // The strategy search computes the cost of the same redistribution for many edges, the costs are memoized by the
+  // standard layouts and the device list until the next search clears them.
+  static void ClearCostCache();
 
  private:
+  std::string CostCacheKey() const;
   Status InferReshape(const TensorLayout &from_layout, const TensorLayout &to_layout,
                       OperatorVector *const operator_vector, OutPutInfoVector *const output_info_vector);
   Status InferRedistribution(const TensorLayout &from_layout, const TensorLayout &to_layout,
@@ -103,6 +103,9 @@ class COMMON_EXPORT ParallelContext {
   void set_pipeline_stage_split_num(const int64_t stage_num);
   int64_t pipeline_stage_split_num() const { return pipeline_stage_split_num_; }
 
+  void set_pipeline_interleave_num(const int64_t interleave_num);
+  int64_t pipeline_interleave_num() const { return pipeline_interleave_num_; }
+
   void set_global_rank(int64_t global_rank);
   int64_t global_rank() const { return global_rank_; }
 
@@ -206,6 +209,7 @@ class COMMON_EXPORT ParallelContext {
   std::string parallel_mode_;
   std::string strategy_search_mode_;
   int64_t pipeline_stage_split_num_;
+  int64_t pipeline_interleave_num_;
   bool parameter_broadcast_;
   bool device_num_is_set_;
   bool fusion_threshold_is_set_;
@@ -250,6 +250,9 @@ PYBIND11_MODULE(_c_expression, m) {
     .def("set_pipeline_stage_split_num", &ParallelContext::set_pipeline_stage_split_num,
          "Set pipeline stage split num.")
     .def("get_pipeline_stage_split_num", &ParallelContext::pipeline_stage_split_num, "Get pipeline stage split num.")
+    .def("set_pipeline_interleave_num", &ParallelContext::set_pipeline_interleave_num,
+         "Set pipeline interleave num.")
+    .def("get_pipeline_interleave_num", &ParallelContext::pipeline_interleave_num, "Get pipeline interleave num.")
     .def("set_full_batch", &ParallelContext::set_full_batch, "Set whether load full batch on each device.")
     .def("get_full_batch", &ParallelContext::full_batch, "Get whether load full batch on each device.")
     .def("set_dataset_strategy", &ParallelContext::set_dataset_strategy, "Set dataset sharding strategy.")
@@ -370,6 +373,10 @@ PYBIND11_MODULE(_c_expression, m) {
          "Set the flag of generating a single suite of OperatorInfos in for-loop.")
     .def("get_dp_algo_single_loop", &CostModelContext::dp_algo_single_loop,
          "Get the flag of whether or not generating a single suite of OperatorInfos in for-loop.")
+    .def("set_rec_algo_enable_coarsening", &CostModelContext::set_rec_algo_enable_coarsening,
+         "Set the flag whether searching the isomorphic operators once in the recursive programming algorithm.")
+    .def("get_rec_algo_enable_coarsening", &CostModelContext::rec_algo_enable_coarsening,
+         "Get the flag whether searching the isomorphic operators once in the recursive programming algorithm.")
     .def("reset_cost_model", &CostModelContext::ResetCostModel, "Reset the CostModelContext.")
     .def("reset_algo_parameters", &CostModelContext::ResetAlgoParameters, "Reset the AlgoParameters.");
 
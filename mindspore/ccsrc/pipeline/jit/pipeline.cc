@@ -77,6 +77,9 @@
 #include "distributed/cluster/cluster_context.h"
 #include "runtime/graph_scheduler/embedding_cache_scheduler.h"
 #endif
+#ifndef ENABLE_SECURITY
+#include "debug/data_dump/dump_file_writer.h"
+#endif
 #ifdef ENABLE_DUMP_IR
 #include "debug/rdr/graph_recorder.h"
 #include "include/common/debug/rdr/recorder_manager.h"
@@ -1729,6 +1732,10 @@ void ClearResAtexit() {
   // When the python process exits, the kernels on the device may not have finished executing.
   device::KernelRuntimeManager::Instance().WaitTaskFinishOnDevice();
   device::DeviceContextManager::GetInstance().WaitTaskFinishOnDevice();
+#ifndef ENABLE_SECURITY
+  // Write the staged dump files before the resources they depend on are released.
+  DumpFileWriter::GetInstance().Finalize();
+#endif
 
   RecordExitStatus();
 #ifdef WITH_BACKEND
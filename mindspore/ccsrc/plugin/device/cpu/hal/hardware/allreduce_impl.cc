@@ -172,6 +172,62 @@ bool AllReduceLauncher::RingAllReduce(const void *input_data, void *const output
   return true;
 }
 
+bool AllReduceLauncher::ReduceScatter(const void *input_data, void *const output_data, size_t recv_size) const {
+  MS_EXCEPTION_IF_NULL(input_data);
+  MS_EXCEPTION_IF_NULL(output_data);
+  if (node_role_ == distributed::kEnvRoleOfScheduler) {
+    return true;
+  }
+  if (rank_size_ == 1) {
+    int memcpy_ret = memcpy_s(output_data, recv_size, input_data, recv_size);
+    if (memcpy_ret != EOK) {
+      MS_LOG(ERROR) << "ReduceScatter memcpy_s input_data error, errorno(" << memcpy_ret << ")";
+      return false;
+    }
+    return true;
+  }
+  // The input is reduced in a copy, the chunk of this rank is the last one to be reduced.
+  size_t chunk_num = recv_size / sizeof(float);
+  std::vector<float> buff(chunk_num * rank_size_);
+  int memcpy_ret = memcpy_s(buff.data(), buff.size() * sizeof(float), input_data, recv_size * rank_size_);
+  if (memcpy_ret != EOK) {
+    MS_LOG(ERROR) << "ReduceScatter memcpy_s input_data error, errorno(" << memcpy_ret << ")";
+    return false;
+  }
+  uint32_t send_to_rank = SizeToUint((rank_id_ + 1) % rank_size_);
+  uint32_t rec_from_rank = SizeToUint((rank_id_ - 1 + rank_size_) % rank_size_);
+  for (size_t i = 0; i < rank_size_ - 1; i++) {
+    size_t send_chunk_index = (rank_id_ - i - 1 + rank_size_) % rank_size_;
+    auto send_req_id = abs_node_->CollectiveSendAsync(ps::core::NodeRole::WORKER, send_to_rank,
+                                                      buff.data() + send_chunk_index * chunk_num, recv_size);
+    size_t rec_chunk_index = (rank_id_ - i - 2 + rank_size_ + rank_size_) % rank_size_;
+    float *rec_chunk = buff.data() + rec_chunk_index * chunk_num;
+    MS_LOG(DEBUG) << "Ring ReduceScatter send_to_rank:" << send_to_rank << ", rec_from_rank:" << rec_from_rank
+                  << ", send chunk:" << send_chunk_index << ", rec chunk:" << rec_chunk_index << ", iteration:" << i;
+
+    std::shared_ptr<std::vector<unsigned char>> rec_ptr = nullptr;
+    auto rec_req_id = abs_node_->CollectiveReceiveAsync(ps::core::NodeRole::WORKER, rec_from_rank, &rec_ptr);
+    if (!abs_node_->CollectiveWait(rec_req_id, kWaitTimeout)) {
+      MS_LOG(ERROR) << "Ring ReduceScatter wait receiving " << rec_req_id << " failed.";
+      return false;
+    }
+    const auto *tmp_data = reinterpret_cast<float *>(rec_ptr->data());
+    for (size_t j = 0; j < chunk_num; j++) {
+      rec_chunk[j] += tmp_data[j];
+    }
+    if (!abs_node_->Wait(send_req_id, kWaitTimeout)) {
+      MS_LOG(ERROR) << "Ring ReduceScatter wait sending " << send_req_id << " failed.";
+      return false;
+    }
+  }
+  memcpy_ret = memcpy_s(output_data, recv_size, buff.data() + rank_id_ * chunk_num, recv_size);
+  if (memcpy_ret != EOK) {
+    MS_LOG(ERROR) << "ReduceScatter memcpy_s output_data error, errorno(" << memcpy_ret << ")";
+    return false;
+  }
+  return true;
+}
+
 std::shared_ptr<ps::core::CollectiveNode> AllReduceLauncher::collective_node() { return abs_node_; }
 
 bool AllReduceLauncher::ReduceBroadcastAllReduce(const void *input_data, void *const output_data,
@@ -37,6 +37,9 @@ class AllReduceLauncher {
 
   bool Execute(const void *input_data, void *const output_data, size_t data_size) const;
 
+  // Ring ReduceScatter of float data, the rank i gets the sum of the i-th chunk of recv_size bytes.
+  bool ReduceScatter(const void *input_data, void *const output_data, size_t recv_size) const;
+
   std::shared_ptr<ps::core::CollectiveNode> collective_node();
 
  private:
@@ -226,6 +226,23 @@ bool MsCollectiveCommLib::AllGather(const void *send_buff, void *recv_buff, size
   }
 }
 
+bool MsCollectiveCommLib::ReduceScatter(const void *send_buff, void *recv_buff, size_t recv_count, TypeId data_type,
+                                        CollectiveOpReduceType reduce_op, const std::string &group_name, void *) {
+  CHECK_IF_NULL(send_buff);
+  CHECK_IF_NULL(recv_buff);
+  CHECK_IF_NULL(launcher_);
+  if (data_type != TypeId::kNumberTypeFloat32) {
+    MS_LOG(EXCEPTION) << "ReduceScatter only support float32.";
+  }
+  if (reduce_op != CollectiveOpReduceType::Reduce_Sum) {
+    MS_LOG(EXCEPTION) << "ReduceScatter only support reduce sum.";
+  }
+  if (group_name != global_group_name_) {
+    MS_LOG(EXCEPTION) << "ReduceScatter only support the group " << global_group_name_ << ", but got " << group_name;
+  }
+  return launcher_->ReduceScatter(send_buff, recv_buff, recv_count * sizeof(float));
+}
+
 bool MsCollectiveCommLib::Broadcast(const void *send_buff, void *recv_buff, size_t send_count, TypeId data_type,
                                     uint32_t root_rank, const std::string &group_name, void *) {
   CHECK_IF_NULL(send_buff);
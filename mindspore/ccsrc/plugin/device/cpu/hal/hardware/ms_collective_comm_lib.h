@@ -68,9 +68,7 @@ class MsCollectiveCommLib : public CollectiveCommunicationLib {
                  const std::string &group_name, void *stream = nullptr) override;
 
   bool ReduceScatter(const void *send_buff, void *recv_buff, size_t recv_count, TypeId data_type,
-                     CollectiveOpReduceType reduce_op, const std::string &group_name, void *stream = nullptr) override {
-    return true;
-  }
+                     CollectiveOpReduceType reduce_op, const std::string &group_name, void *stream = nullptr) override;
 
  private:
   MsCollectiveCommLib();
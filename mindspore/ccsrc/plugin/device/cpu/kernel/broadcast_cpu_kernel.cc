@@ -0,0 +1,92 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/broadcast_cpu_kernel.h"
+
+#include <string>
+#include "include/common/utils/utils.h"
+
+#ifdef WITH_BACKEND
+#include "plugin/device/cpu/hal/hardware/ms_collective_comm_lib.h"
+#endif
+
+namespace mindspore {
+namespace kernel {
+#ifdef WITH_BACKEND
+using device::cpu::kMCCLGlobalGroupName;
+using device::cpu::MsCollectiveCommLib;
+#endif
+
+void BroadcastCPUKernelMod::InitKernel(const CNodePtr &kernel_node) {
+#ifdef WITH_BACKEND
+  MS_EXCEPTION_IF_NULL(kernel_node);
+  kernel_name_ = common::AnfAlgo::GetCNodeName(kernel_node);
+  auto kernel_attr = GetKernelAttrFromNode(kernel_node);
+  auto is_match = MatchKernelAttr(kernel_attr, GetOpSupport()).first;
+  if (!is_match) {
+    MS_LOG(EXCEPTION) << kernel_name_ << " does not support this kernel data type: " << kernel_attr;
+  }
+  auto group = common::AnfAlgo::GetNodeAttr<std::string>(kernel_node, GROUP);
+  if (group != kMCCLGlobalGroupName) {
+    MS_LOG(EXCEPTION) << kernel_name_ << " only support " << kMCCLGlobalGroupName << " on CPU, but got " << group;
+  }
+  auto root_rank = common::AnfAlgo::GetNodeAttr<int64_t>(kernel_node, kAttrRootRank);
+  if (root_rank < 0) {
+    MS_LOG(EXCEPTION) << kernel_name_ << " root rank should not be negative, but got " << root_rank;
+  }
+  root_rank_ = LongToUint(root_rank);
+#else
+  MS_LOG(EXCEPTION) << "The CPU kernel broadcast is only supported on linux platform.";
+#endif
+}
+
+std::vector<KernelAttr> BroadcastCPUKernelMod::GetOpSupport() {
+  static std::vector<KernelAttr> support_list = {
+    KernelAttr().AddAllSameAttr(true).AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32)};
+  return support_list;
+}
+
+bool BroadcastCPUKernelMod::Launch(const std::vector<kernel::AddressPtr> &inputs,
+                                   const std::vector<kernel::AddressPtr> &,
+                                   const std::vector<kernel::AddressPtr> &outputs) {
+#ifdef WITH_BACKEND
+  if (inputs.empty() || inputs.size() != outputs.size()) {
+    MS_LOG(EXCEPTION) << kernel_name_ << " should have the same number of inputs and outputs, but got "
+                      << inputs.size() << " inputs and " << outputs.size() << " outputs.";
+  }
+  // Every tensor is broadcast by itself, the root keeps its input as the output.
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    auto ret = memcpy_s(outputs[i]->addr, outputs[i]->size, inputs[i]->addr, inputs[i]->size);
+    if (ret != EOK) {
+      MS_LOG(ERROR) << kernel_name_ << " memcpy_s failed, errorno(" << ret << ")";
+      return false;
+    }
+    if (!MsCollectiveCommLib::GetInstance().Broadcast(inputs[i]->addr, outputs[i]->addr,
+                                                      inputs[i]->size / sizeof(float), kNumberTypeFloat32, root_rank_,
+                                                      kMCCLGlobalGroupName)) {
+      MS_LOG(ERROR) << "BroadcastCPUKernelMod launch failed.";
+      return false;
+    }
+  }
+  return true;
+#else
+  MS_LOG(EXCEPTION) << "The CPU kernel broadcast is only supported on linux platform.";
+#endif
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, Broadcast, BroadcastCPUKernelMod);
+}  // namespace kernel
+}  // namespace mindspore
@@ -0,0 +1,88 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "plugin/device/cpu/kernel/mccl_reduce_scatter_cpu_kernel.h"
+
+#include <string>
+
+#ifdef WITH_BACKEND
+#include "plugin/device/cpu/hal/hardware/ms_collective_comm_lib.h"
+#endif
+
+namespace mindspore {
+namespace kernel {
+#ifdef WITH_BACKEND
+using device::CollectiveOpReduceType::Reduce_Sum;
+using device::cpu::kMCCLGlobalGroupName;
+using device::cpu::MsCollectiveCommLib;
+#endif
+
+namespace {
+constexpr char kSupportedReduceOp[] = "sum";
+constexpr size_t kReduceScatterInputsNum = 1;
+constexpr size_t kReduceScatterOutputsNum = 1;
+}  // namespace
+
+void MCCLReduceScatterCPUKernelMod::InitKernel(const CNodePtr &kernel_node) {
+#ifdef WITH_BACKEND
+  MS_EXCEPTION_IF_NULL(kernel_node);
+  kernel_name_ = common::AnfAlgo::GetCNodeName(kernel_node);
+  auto kernel_attr = GetKernelAttrFromNode(kernel_node);
+  auto is_match = MatchKernelAttr(kernel_attr, GetOpSupport()).first;
+  if (!is_match) {
+    MS_LOG(EXCEPTION) << kernel_name_ << " does not support this kernel data type: " << kernel_attr;
+  }
+  auto group = common::AnfAlgo::GetNodeAttr<std::string>(kernel_node, GROUP);
+  if (group != kMCCLGlobalGroupName) {
+    MS_LOG(EXCEPTION) << kernel_name_ << " only support " << kMCCLGlobalGroupName << " on CPU, but got " << group;
+  }
+  auto reduce_op = common::AnfAlgo::GetNodeAttr<std::string>(kernel_node, OP);
+  if (reduce_op != kSupportedReduceOp) {
+    MS_LOG(EXCEPTION) << kernel_name_ << " only support reduce sum on CPU, but got " << reduce_op;
+  }
+#else
+  MS_LOG(EXCEPTION) << "The CPU kernel reducescatter is only supported on linux platform.";
+#endif
+}
+
+std::vector<KernelAttr> MCCLReduceScatterCPUKernelMod::GetOpSupport() {
+  static std::vector<KernelAttr> support_list = {
+    KernelAttr().AddInputAttr(kNumberTypeFloat32).AddOutputAttr(kNumberTypeFloat32)};
+  return support_list;
+}
+
+bool MCCLReduceScatterCPUKernelMod::Launch(const std::vector<kernel::AddressPtr> &inputs,
+                                           const std::vector<kernel::AddressPtr> &,
+                                           const std::vector<kernel::AddressPtr> &outputs) {
+#ifdef WITH_BACKEND
+  CHECK_KERNEL_INPUTS_NUM(inputs.size(), kReduceScatterInputsNum, kernel_name_);
+  CHECK_KERNEL_OUTPUTS_NUM(outputs.size(), kReduceScatterOutputsNum, kernel_name_);
+  // The rank i gets the reduced i-th chunk of the input along the first dimension.
+  bool ret = MsCollectiveCommLib::GetInstance().ReduceScatter(inputs[0]->addr, outputs[0]->addr,
+                                                              outputs[0]->size / sizeof(float), kNumberTypeFloat32,
+                                                              Reduce_Sum, kMCCLGlobalGroupName);
+  if (!ret) {
+    MS_LOG(ERROR) << "MCCLReduceScatterCPUKernelMod launch failed.";
+  }
+  return ret;
+#else
+  MS_LOG(EXCEPTION) << "The CPU kernel reducescatter is only supported on linux platform.";
+#endif
+}
+
+MS_KERNEL_FACTORY_REG(NativeCpuKernelMod, ReduceScatter, MCCLReduceScatterCPUKernelMod);
+}  // namespace kernel
+}  // namespace mindspore
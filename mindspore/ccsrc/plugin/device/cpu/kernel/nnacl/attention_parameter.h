@@ -37,4 +37,20 @@ typedef struct RelativePositionAttentionParameter {
   int bias_tile_;  // tile for bias pack
 } RelativePositionAttentionParameter;
 
+typedef struct FlashAttentionParameter {
+  // Primitive parameter
+  OpParameter op_parameter_;
+  // args for compute
+  int batch_;
+  int head_num_;
+  int head_size_;
+  int q_seq_;      // rows of query
+  int kv_seq_;     // valid rows of key/value, the cached rows included
+  int kv_stride_;  // rows reserved for key/value of a head, the capacity of a kv-cache
+  int q_tile_;     // rows of query computed together, which share every load of key/value
+  int kv_tile_;    // rows of key/value of one online-softmax step
+  float scale_;    // applied to q * k^T, usually 1 / sqrt(head_size)
+  bool causal_;    // query row i only attends to the key rows [0, kv_seq - q_seq + i]
+} FlashAttentionParameter;
+
 #endif  // MINDSPORE_NNACL_ATTENTION_PARAMETER_H_
@@ -0,0 +1,198 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/fp32/flash_attention_fp32.h"
+#include <float.h>
+#include <string.h>
+#include "nnacl/errorcode.h"
+#include "nnacl/fp32/exp_fp32.h"
+#include "nnacl/flash_attention_fp32_simd.h"
+
+int FlashAttentionWorkspaceSize(const FlashAttentionParameter *param) {
+  // scores, accumulators, running max and running sum
+  return param->q_tile_ * param->kv_tile_ + param->q_tile_ * param->head_size_ + C2NUM * param->q_tile_;
+}
+
+static inline float FlashAttentionDot(const float *a, const float *b, int num) {
+  float sum = 0.0f;
+  int i = 0;
+  SIMD_RUN_NO_SCALAR(FlashAttentionDot, i, a, b, &sum, num);
+  for (; i < num; ++i) {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+// dst = src * scale
+static inline void FlashAttentionScale(const float *src, float scale, float *dst, int num) {
+  int i = 0;
+  SIMD_RUN_NO_SCALAR(FlashAttentionScale, i, src, scale, dst, num);
+  for (; i < num; ++i) {
+    dst[i] = src[i] * scale;
+  }
+}
+
+// dst += src * weight
+static inline void FlashAttentionAccumulate(const float *src, float weight, float *dst, int num) {
+  int i = 0;
+  SIMD_RUN_NO_SCALAR(FlashAttentionAccumulate, i, src, weight, dst, num);
+  for (; i < num; ++i) {
+    dst[i] += src[i] * weight;
+  }
+}
+
+static void FlashAttentionBlock(const float *q, const float *k, const float *v, const float *mask, float *out,
+                                float *workspace, const FlashAttentionParameter *param, int q_start, int q_rows) {
+  const int head_size = param->head_size_;
+  const int kv_tile = param->kv_tile_;
+  float *scores = workspace;
+  float *acc = scores + param->q_tile_ * kv_tile;
+  float *row_max = acc + param->q_tile_ * head_size;
+  float *row_sum = row_max + param->q_tile_;
+  memset(acc, 0, q_rows * head_size * sizeof(float));
+  for (int i = 0; i < q_rows; ++i) {
+    row_max[i] = -FLT_MAX;
+    row_sum[i] = 0.0f;
+  }
+  // under a causal mask the rows of the block never look beyond the last key of its last row
+  const int causal_offset = param->kv_seq_ - param->q_seq_;
+  const int kv_end = param->causal_ ? MSMIN(param->kv_seq_, causal_offset + q_start + q_rows) : param->kv_seq_;
+  for (int kv_start = 0; kv_start < kv_end; kv_start += kv_tile) {
+    const int kv_rows = MSMIN(kv_tile, kv_end - kv_start);
+    for (int i = 0; i < q_rows; ++i) {
+      const float *q_row = q + (q_start + i) * head_size;
+      float *score = scores + i * kv_tile;
+      const int valid = param->causal_ ? MSMIN(kv_rows, causal_offset + q_start + i + 1 - kv_start) : kv_rows;
+      float block_max = -FLT_MAX;
+      for (int j = 0; j < valid; ++j) {
+        score[j] = FlashAttentionDot(q_row, k + (kv_start + j) * head_size, head_size) * param->scale_;
+        if (mask != NULL) {
+          score[j] += mask[(q_start + i) * param->kv_seq_ + kv_start + j];
+        }
+        block_max = MSMAX(block_max, score[j]);
+      }
+      if (valid <= 0) {
+        continue;
+      }
+      // rescale what was accumulated with the previous max, exp(old_max - new_max) is 0 for the first tile
+      const float new_max = MSMAX(row_max[i], block_max);
+      float correction = row_max[i] - new_max;
+      ExpFp32(&correction, &correction, 1);
+      row_max[i] = new_max;
+      for (int j = 0; j < valid; ++j) {
+        score[j] -= new_max;
+      }
+      ExpFp32(score, score, valid);
+      float *acc_row = acc + i * head_size;
+      float block_sum = 0.0f;
+      FlashAttentionScale(acc_row, correction, acc_row, head_size);
+      for (int j = 0; j < valid; ++j) {
+        block_sum += score[j];
+        FlashAttentionAccumulate(v + (kv_start + j) * head_size, score[j], acc_row, head_size);
+      }
+      row_sum[i] = row_sum[i] * correction + block_sum;
+    }
+  }
+  const int out_stride = param->head_num_ * head_size;
+  for (int i = 0; i < q_rows; ++i) {
+    float *out_row = out + (q_start + i) * out_stride;
+    const float *acc_row = acc + i * head_size;
+    const float inv_sum = row_sum[i] > 0.0f ? 1.0f / row_sum[i] : 0.0f;
+    FlashAttentionScale(acc_row, inv_sum, out_row, head_size);
+  }
+}
+
+int FlashAttentionFp32(const float *q, const float *k, const float *v, const float *mask, float *out,
+                       float *workspace, const FlashAttentionParameter *param, int task_id, int thread_num) {
+  NNACL_CHECK_NULL_RETURN_ERR(q);
+  NNACL_CHECK_NULL_RETURN_ERR(k);
+  NNACL_CHECK_NULL_RETURN_ERR(v);
+  NNACL_CHECK_NULL_RETURN_ERR(out);
+  NNACL_CHECK_NULL_RETURN_ERR(workspace);
+  NNACL_CHECK_NULL_RETURN_ERR(param);
+  NNACL_CHECK_ZERO_RETURN_ERR(thread_num);
+  if (param->q_tile_ <= 0 || param->kv_tile_ <= 0 || param->kv_seq_ > param->kv_stride_) {
+    return NNACL_PARAM_INVALID;
+  }
+  const int q_blocks = UP_DIV(param->q_seq_, param->q_tile_);
+  const int total = param->batch_ * param->head_num_ * q_blocks;
+  const int head_size = param->head_size_;
+  for (int index = task_id; index < total; index += thread_num) {
+    const int batch_head = index / q_blocks;
+    const int batch = batch_head / param->head_num_;
+    const int head = batch_head % param->head_num_;
+    const int q_start = (index % q_blocks) * param->q_tile_;
+    const int q_rows = MSMIN(param->q_tile_, param->q_seq_ - q_start);
+    const float *q_head = q + batch_head * param->q_seq_ * head_size;
+    const float *k_head = k + batch_head * param->kv_stride_ * head_size;
+    const float *v_head = v + batch_head * param->kv_stride_ * head_size;
+    const float *mask_batch = mask == NULL ? NULL : mask + batch * param->q_seq_ * param->kv_seq_;
+    float *out_head = out + batch * param->q_seq_ * param->head_num_ * head_size + head * head_size;
+    FlashAttentionBlock(q_head, k_head, v_head, mask_batch, out_head, workspace, param, q_start, q_rows);
+  }
+  return NNACL_OK;
+}
+
+int KVCacheAppendFp32(float *k_cache, float *v_cache, const float *k, const float *v,
+                      const FlashAttentionParameter *param, int cur_len, int new_len) {
+  NNACL_CHECK_NULL_RETURN_ERR(k_cache);
+  NNACL_CHECK_NULL_RETURN_ERR(v_cache);
+  NNACL_CHECK_NULL_RETURN_ERR(k);
+  NNACL_CHECK_NULL_RETURN_ERR(v);
+  NNACL_CHECK_NULL_RETURN_ERR(param);
+  if (cur_len < 0 || new_len < 0 || cur_len + new_len > param->kv_stride_) {
+    return NNACL_PARAM_INVALID;
+  }
+  const int head_size = param->head_size_;
+  const size_t copy_size = (size_t)new_len * head_size * sizeof(float);
+  for (int i = 0; i < param->batch_ * param->head_num_; ++i) {
+    const int dst_offset = (i * param->kv_stride_ + cur_len) * head_size;
+    const int src_offset = i * new_len * head_size;
+    memcpy(k_cache + dst_offset, k + src_offset, copy_size);
+    memcpy(v_cache + dst_offset, v + src_offset, copy_size);
+  }
+  return NNACL_OK;
+}
+
+int FlashAttentionProjectFp32(const float *x, const float *weight, const float *bias, float *out,
+                              const FlashAttentionParameter *param, int seq, int out_stride, bool split_heads,
+                              int task_id, int thread_num) {
+  NNACL_CHECK_NULL_RETURN_ERR(x);
+  NNACL_CHECK_NULL_RETURN_ERR(weight);
+  NNACL_CHECK_NULL_RETURN_ERR(out);
+  NNACL_CHECK_NULL_RETURN_ERR(param);
+  NNACL_CHECK_ZERO_RETURN_ERR(thread_num);
+  const int head_size = param->head_size_;
+  const int hidden = param->head_num_ * head_size;
+  // the output columns are split over the tasks, so that a decoding step of a single row still runs in parallel
+  const int col_step = UP_DIV(hidden, thread_num);
+  const int col_end = MSMIN(hidden, (task_id + 1) * col_step);
+  for (int col = task_id * col_step; col < col_end; ++col) {
+    const float *weight_row = weight + col * hidden;
+    const float bias_value = bias == NULL ? 0.0f : bias[col];
+    const int head = col / head_size;
+    const int d = col % head_size;
+    for (int b = 0; b < param->batch_; ++b) {
+      for (int i = 0; i < seq; ++i) {
+        const float *x_row = x + (b * seq + i) * hidden;
+        const int out_index = split_heads ? ((b * param->head_num_ + head) * out_stride + i) * head_size + d
+                                          : (b * out_stride + i) * hidden + col;
+        out[out_index] = FlashAttentionDot(x_row, weight_row, hidden) + bias_value;
+      }
+    }
+  }
+  return NNACL_OK;
+}
@@ -0,0 +1,59 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
+#define MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
+#include "nnacl/op_base.h"
+#include "nnacl/attention_parameter.h"
+
+/*
+ * Scaled dot-product attention fused into one pass, softmax(q * k^T * scale + mask) * v. The keys are visited in tiles
+ * with an online softmax: every query row keeps its running max and sum and rescales its accumulator when the max
+ * grows, so the [q_seq, kv_seq] score matrix is never materialized and the working set of a task stays in cache.
+ *
+ * q:    [batch, head_num, q_seq, head_size]
+ * k, v: [batch, head_num, kv_stride, head_size], the first kv_seq rows are valid
+ * mask: [batch, q_seq, kv_seq] added to the scores, shared by all heads, may be NULL
+ * out:  [batch, q_seq, head_num, head_size], the layout expected by the output projection
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+// float elements of the workspace of one task
+int FlashAttentionWorkspaceSize(const FlashAttentionParameter *param);
+
+// the work is split into batch * head_num * UP_DIV(q_seq, q_tile) blocks over thread_num tasks
+int FlashAttentionFp32(const float *q, const float *k, const float *v, const float *mask, float *out,
+                       float *workspace, const FlashAttentionParameter *param, int task_id, int thread_num);
+
+// Projects x, [batch, seq, hidden] with hidden = head_num * head_size, by weight, [hidden, hidden] whose row c holds
+// the weights of the output column c, and adds bias, which may be NULL. With split_heads the output is written as
+// [batch, head_num, out_stride, head_size], the layout of q, k and v above, otherwise as [batch, out_stride, hidden].
+// Every output column is a dot product of a weight row, which suits a single row, a matrix-vector product that reads
+// each weight once; more rows are packed for MatMulOpt instead.
+int FlashAttentionProjectFp32(const float *x, const float *weight, const float *bias, float *out,
+                              const FlashAttentionParameter *param, int seq, int out_stride, bool split_heads,
+                              int task_id, int thread_num);
+
+// Appends new_len rows of k and v, [batch, head_num, new_len, head_size], to the kv-cache at row cur_len, so that an
+// incremental decoding step only projects the new token instead of the whole sequence.
+int KVCacheAppendFp32(float *k_cache, float *v_cache, const float *k, const float *v,
+                      const FlashAttentionParameter *param, int cur_len, int new_len);
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_NNACL_FP32_FLASH_ATTENTION_FP32_H_
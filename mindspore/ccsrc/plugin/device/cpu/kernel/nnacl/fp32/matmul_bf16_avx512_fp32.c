@@ -0,0 +1,142 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifdef ENABLE_AVX512
+#include "nnacl/fp32/matmul_bf16_fp32.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#include "nnacl/intrinsics/avx/common_utils.h"
+
+static inline __m512 LoadBf16x16(const uint16_t *src) {
+  return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(_mm256_loadu_si256((const __m256i *)src)), 16));
+}
+
+#ifdef ENABLE_AVX512BF16
+static void Float32ToBf16Native(const float *src, uint16_t *dst, int num) {
+  int i = 0;
+  for (; i <= num - C16NUM; i += C16NUM) {
+    __m256bh value = _mm512_cvtneps_pbh(_mm512_loadu_ps(src + i));
+    memcpy(dst + i, &value, sizeof(value));
+  }
+  for (; i < num; ++i) {
+    dst[i] = Float32ToBf16Scalar(src[i]);
+  }
+}
+#endif
+
+void Float32ToBf16AVX512(const float *src, uint16_t *dst, int num) {
+#ifdef ENABLE_AVX512BF16
+  if (X86_Avx512Bf16_Support()) {
+    Float32ToBf16Native(src, dst, num);
+    return;
+  }
+#endif
+  const __m512i one = _mm512_set1_epi32(1);
+  const __m512i round_bias = _mm512_set1_epi32(0x7fff);
+  const __m512i quiet_bit = _mm512_set1_epi32(0x00400000);
+  const __m512i exp_mask = _mm512_set1_epi32(0x7f800000);
+  const __m512i sign_mask = _mm512_set1_epi32((int)0x80000000);
+  int i = 0;
+  for (; i <= num - C16NUM; i += C16NUM) {
+    __m512 value = _mm512_loadu_ps(src + i);
+    __m512i bits = _mm512_castps_si512(value);
+    __m512i lsb = _mm512_and_si512(_mm512_srli_epi32(bits, 16), one);
+    __m512i rounded = _mm512_add_epi32(bits, _mm512_add_epi32(lsb, round_bias));
+    __mmask16 nan_mask = _mm512_cmp_ps_mask(value, value, _CMP_UNORD_Q);
+    rounded = _mm512_mask_or_epi32(rounded, nan_mask, bits, quiet_bit);
+    __mmask16 denormal_mask = _mm512_testn_epi32_mask(bits, exp_mask);
+    rounded = _mm512_mask_and_epi32(rounded, denormal_mask, bits, sign_mask);
+    _mm256_storeu_si256((__m256i *)(dst + i), _mm512_cvtepi32_epi16(_mm512_srli_epi32(rounded, 16)));
+  }
+  for (; i < num; ++i) {
+    dst[i] = Float32ToBf16Scalar(src[i]);
+  }
+}
+
+void Bf16DotRow4Col2AVX512(const float *a, int deep, const uint16_t *b0, const uint16_t *b1, float *dst) {
+  const float *a0 = a;
+  const float *a1 = a0 + deep;
+  const float *a2 = a1 + deep;
+  const float *a3 = a2 + deep;
+  __m512 acc00 = _mm512_setzero_ps();
+  __m512 acc01 = _mm512_setzero_ps();
+  __m512 acc10 = _mm512_setzero_ps();
+  __m512 acc11 = _mm512_setzero_ps();
+  __m512 acc20 = _mm512_setzero_ps();
+  __m512 acc21 = _mm512_setzero_ps();
+  __m512 acc30 = _mm512_setzero_ps();
+  __m512 acc31 = _mm512_setzero_ps();
+  int d = 0;
+  for (; d <= deep - C16NUM; d += C16NUM) {
+    __m512 w0 = LoadBf16x16(b0 + d);
+    __m512 w1 = LoadBf16x16(b1 + d);
+    __m512 src = _mm512_loadu_ps(a0 + d);
+    acc00 = _mm512_fmadd_ps(src, w0, acc00);
+    acc01 = _mm512_fmadd_ps(src, w1, acc01);
+    src = _mm512_loadu_ps(a1 + d);
+    acc10 = _mm512_fmadd_ps(src, w0, acc10);
+    acc11 = _mm512_fmadd_ps(src, w1, acc11);
+    src = _mm512_loadu_ps(a2 + d);
+    acc20 = _mm512_fmadd_ps(src, w0, acc20);
+    acc21 = _mm512_fmadd_ps(src, w1, acc21);
+    src = _mm512_loadu_ps(a3 + d);
+    acc30 = _mm512_fmadd_ps(src, w0, acc30);
+    acc31 = _mm512_fmadd_ps(src, w1, acc31);
+  }
+  dst[0] = _mm512_reduce_add_ps(acc00);
+  dst[1] = _mm512_reduce_add_ps(acc01);
+  dst[C2NUM] = _mm512_reduce_add_ps(acc10);
+  dst[C3NUM] = _mm512_reduce_add_ps(acc11);
+  dst[C4NUM] = _mm512_reduce_add_ps(acc20);
+  dst[C5NUM] = _mm512_reduce_add_ps(acc21);
+  dst[C6NUM] = _mm512_reduce_add_ps(acc30);
+  dst[C7NUM] = _mm512_reduce_add_ps(acc31);
+  for (; d < deep; ++d) {
+    float w0 = Bf16ToFloat32Scalar(b0[d]);
+    float w1 = Bf16ToFloat32Scalar(b1[d]);
+    dst[0] += a0[d] * w0;
+    dst[1] += a0[d] * w1;
+    dst[C2NUM] += a1[d] * w0;
+    dst[C3NUM] += a1[d] * w1;
+    dst[C4NUM] += a2[d] * w0;
+    dst[C5NUM] += a2[d] * w1;
+    dst[C6NUM] += a3[d] * w0;
+    dst[C7NUM] += a3[d] * w1;
+  }
+}
+
+void Bf16DotRow1Col4AVX512(const float *a, int deep, const uint16_t *const *b, float *dst) {
+  __m512 acc0 = _mm512_setzero_ps();
+  __m512 acc1 = _mm512_setzero_ps();
+  __m512 acc2 = _mm512_setzero_ps();
+  __m512 acc3 = _mm512_setzero_ps();
+  int d = 0;
+  for (; d <= deep - C16NUM; d += C16NUM) {
+    __m512 src = _mm512_loadu_ps(a + d);
+    acc0 = _mm512_fmadd_ps(src, LoadBf16x16(b[0] + d), acc0);
+    acc1 = _mm512_fmadd_ps(src, LoadBf16x16(b[1] + d), acc1);
+    acc2 = _mm512_fmadd_ps(src, LoadBf16x16(b[C2NUM] + d), acc2);
+    acc3 = _mm512_fmadd_ps(src, LoadBf16x16(b[C3NUM] + d), acc3);
+  }
+  dst[0] = _mm512_reduce_add_ps(acc0);
+  dst[1] = _mm512_reduce_add_ps(acc1);
+  dst[C2NUM] = _mm512_reduce_add_ps(acc2);
+  dst[C3NUM] = _mm512_reduce_add_ps(acc3);
+  for (; d < deep; ++d) {
+    for (int j = 0; j < C4NUM; ++j) {
+      dst[j] += a[d] * Bf16ToFloat32Scalar(b[j][d]);
+    }
+  }
+}
+#endif
@@ -0,0 +1,324 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/fp32/matmul_bf16_fp32.h"
+#ifdef ENABLE_AVX
+#include "nnacl/intrinsics/avx/common_utils.h"
+#endif
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+
+typedef void (*Bf16DotRow4Col2Func)(const float *a, int deep, const uint16_t *b0, const uint16_t *b1, float *dst);
+typedef void (*Bf16DotRow1Col4Func)(const float *a, int deep, const uint16_t *const *b, float *dst);
+
+#ifdef ENABLE_AVX
+static inline __m256 LoadBf16x8(const uint16_t *src) {
+  return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i *)src)), 16));
+}
+
+static inline float ReduceAddAVX(__m256 value) {
+  __m128 sum = _mm_add_ps(_mm256_castps256_ps128(value), _mm256_extractf128_ps(value, 1));
+  sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+  sum = _mm_add_ss(sum, _mm_shuffle_ps(sum, sum, 0x55));
+  return _mm_cvtss_f32(sum);
+}
+#elif defined(ENABLE_NEON)
+static inline float32x4_t LoadBf16x4(const uint16_t *src) {
+  return vreinterpretq_f32_u32(vshll_n_u16(vld1_u16(src), 16));
+}
+
+static inline float32x4_t FmaNEON(float32x4_t acc, float32x4_t a, float32x4_t b) {
+#ifdef ENABLE_ARM64
+  return vfmaq_f32(acc, a, b);
+#else
+  return vmlaq_f32(acc, a, b);
+#endif
+}
+
+static inline float ReduceAddNEON(float32x4_t value) {
+#ifdef ENABLE_ARM64
+  return vaddvq_f32(value);
+#else
+  float32x2_t sum = vadd_f32(vget_low_f32(value), vget_high_f32(value));
+  return vget_lane_f32(vpadd_f32(sum, sum), 0);
+#endif
+}
+#endif
+
+void Float32ToBf16(const float *src, uint16_t *dst, int num) {
+#ifdef ENABLE_AVX512
+  if (X86_Avx512_Support()) {
+    Float32ToBf16AVX512(src, dst, num);
+    return;
+  }
+#endif
+  int i = 0;
+#ifdef ENABLE_AVX
+  const __m256i one = _mm256_set1_epi32(1);
+  const __m256i round_bias = _mm256_set1_epi32(0x7fff);
+  const __m256i quiet_bit = _mm256_set1_epi32(0x00400000);
+  const __m256i exp_mask = _mm256_set1_epi32(0x7f800000);
+  const __m256i sign_mask = _mm256_set1_epi32((int)0x80000000);
+  for (; i <= num - C8NUM; i += C8NUM) {
+    __m256 value = _mm256_loadu_ps(src + i);
+    __m256i bits = _mm256_castps_si256(value);
+    __m256i lsb = _mm256_and_si256(_mm256_srli_epi32(bits, 16), one);
+    __m256i rounded = _mm256_add_epi32(bits, _mm256_add_epi32(lsb, round_bias));
+    __m256i nan_mask = _mm256_castps_si256(_mm256_cmp_ps(value, value, _CMP_UNORD_Q));
+    rounded = _mm256_blendv_epi8(rounded, _mm256_or_si256(bits, quiet_bit), nan_mask);
+    __m256i denormal_mask = _mm256_cmpeq_epi32(_mm256_and_si256(bits, exp_mask), _mm256_setzero_si256());
+    rounded = _mm256_blendv_epi8(rounded, _mm256_and_si256(bits, sign_mask), denormal_mask);
+    __m256i high = _mm256_srli_epi32(rounded, 16);
+    // packus works inside the 128-bit lanes, gather the two lower quarters afterwards
+    __m256i packed = _mm256_permute4x64_epi64(_mm256_packus_epi32(high, high), 0xD8);
+    _mm_storeu_si128((__m128i *)(dst + i), _mm256_castsi256_si128(packed));
+  }
+#elif defined(ENABLE_NEON)
+  const uint32x4_t one = vdupq_n_u32(1);
+  const uint32x4_t round_bias = vdupq_n_u32(0x7fff);
+  const uint32x4_t quiet_bit = vdupq_n_u32(0x00400000);
+  const uint32x4_t exp_mask = vdupq_n_u32(0x7f800000);
+  const uint32x4_t sign_mask = vdupq_n_u32(0x80000000);
+  for (; i <= num - C4NUM; i += C4NUM) {
+    float32x4_t value = vld1q_f32(src + i);
+    uint32x4_t bits = vreinterpretq_u32_f32(value);
+    uint32x4_t lsb = vandq_u32(vshrq_n_u32(bits, 16), one);
+    uint32x4_t rounded = vaddq_u32(bits, vaddq_u32(lsb, round_bias));
+    uint32x4_t nan_mask = vmvnq_u32(vceqq_f32(value, value));
+    rounded = vbslq_u32(nan_mask, vorrq_u32(bits, quiet_bit), rounded);
+    uint32x4_t denormal_mask = vceqq_u32(vandq_u32(bits, exp_mask), vdupq_n_u32(0));
+    rounded = vbslq_u32(denormal_mask, vandq_u32(bits, sign_mask), rounded);
+    vst1_u16(dst + i, vshrn_n_u32(rounded, 16));
+  }
+#endif
+  for (; i < num; ++i) {
+    dst[i] = Float32ToBf16Scalar(src[i]);
+  }
+}
+
+void Bf16ToFloat32(const uint16_t *src, float *dst, int num) {
+  int i = 0;
+#ifdef ENABLE_AVX
+  for (; i <= num - C8NUM; i += C8NUM) {
+    _mm256_storeu_ps(dst + i, LoadBf16x8(src + i));
+  }
+#elif defined(ENABLE_NEON)
+  for (; i <= num - C4NUM; i += C4NUM) {
+    vst1q_f32(dst + i, LoadBf16x4(src + i));
+  }
+#endif
+  for (; i < num; ++i) {
+    dst[i] = Bf16ToFloat32Scalar(src[i]);
+  }
+}
+
+void PackBf16WeightColMajor(const float *src, uint16_t *dst, int deep, int col, bool transposed) {
+  if (transposed) {
+    Float32ToBf16(src, dst, deep * col);
+    return;
+  }
+  for (int d = 0; d < deep; ++d) {
+    const float *src_row = src + d * col;
+    for (int j = 0; j < col; ++j) {
+      dst[j * deep + d] = Float32ToBf16Scalar(src_row[j]);
+    }
+  }
+}
+
+static void Bf16DotRow4Col2(const float *a, int deep, const uint16_t *b0, const uint16_t *b1, float *dst) {
+  const float *a0 = a;
+  const float *a1 = a0 + deep;
+  const float *a2 = a1 + deep;
+  const float *a3 = a2 + deep;
+  int d = 0;
+#ifdef ENABLE_AVX
+  __m256 acc00 = _mm256_setzero_ps();
+  __m256 acc01 = _mm256_setzero_ps();
+  __m256 acc10 = _mm256_setzero_ps();
+  __m256 acc11 = _mm256_setzero_ps();
+  __m256 acc20 = _mm256_setzero_ps();
+  __m256 acc21 = _mm256_setzero_ps();
+  __m256 acc30 = _mm256_setzero_ps();
+  __m256 acc31 = _mm256_setzero_ps();
+  for (; d <= deep - C8NUM; d += C8NUM) {
+    __m256 w0 = LoadBf16x8(b0 + d);
+    __m256 w1 = LoadBf16x8(b1 + d);
+    __m256 src = _mm256_loadu_ps(a0 + d);
+    acc00 = _mm256_fmadd_ps(src, w0, acc00);
+    acc01 = _mm256_fmadd_ps(src, w1, acc01);
+    src = _mm256_loadu_ps(a1 + d);
+    acc10 = _mm256_fmadd_ps(src, w0, acc10);
+    acc11 = _mm256_fmadd_ps(src, w1, acc11);
+    src = _mm256_loadu_ps(a2 + d);
+    acc20 = _mm256_fmadd_ps(src, w0, acc20);
+    acc21 = _mm256_fmadd_ps(src, w1, acc21);
+    src = _mm256_loadu_ps(a3 + d);
+    acc30 = _mm256_fmadd_ps(src, w0, acc30);
+    acc31 = _mm256_fmadd_ps(src, w1, acc31);
+  }
+  dst[0] = ReduceAddAVX(acc00);
+  dst[1] = ReduceAddAVX(acc01);
+  dst[C2NUM] = ReduceAddAVX(acc10);
+  dst[C3NUM] = ReduceAddAVX(acc11);
+  dst[C4NUM] = ReduceAddAVX(acc20);
+  dst[C5NUM] = ReduceAddAVX(acc21);
+  dst[C6NUM] = ReduceAddAVX(acc30);
+  dst[C7NUM] = ReduceAddAVX(acc31);
+#elif defined(ENABLE_NEON)
+  float32x4_t acc00 = vdupq_n_f32(0.0f);
+  float32x4_t acc01 = vdupq_n_f32(0.0f);
+  float32x4_t acc10 = vdupq_n_f32(0.0f);
+  float32x4_t acc11 = vdupq_n_f32(0.0f);
+  float32x4_t acc20 = vdupq_n_f32(0.0f);
+  float32x4_t acc21 = vdupq_n_f32(0.0f);
+  float32x4_t acc30 = vdupq_n_f32(0.0f);
+  float32x4_t acc31 = vdupq_n_f32(0.0f);
+  for (; d <= deep - C4NUM; d += C4NUM) {
+    float32x4_t w0 = LoadBf16x4(b0 + d);
+    float32x4_t w1 = LoadBf16x4(b1 + d);
+    float32x4_t src = vld1q_f32(a0 + d);
+    acc00 = FmaNEON(acc00, src, w0);
+    acc01 = FmaNEON(acc01, src, w1);
+    src = vld1q_f32(a1 + d);
+    acc10 = FmaNEON(acc10, src, w0);
+    acc11 = FmaNEON(acc11, src, w1);
+    src = vld1q_f32(a2 + d);
+    acc20 = FmaNEON(acc20, src, w0);
+    acc21 = FmaNEON(acc21, src, w1);
+    src = vld1q_f32(a3 + d);
+    acc30 = FmaNEON(acc30, src, w0);
+    acc31 = FmaNEON(acc31, src, w1);
+  }
+  dst[0] = ReduceAddNEON(acc00);
+  dst[1] = ReduceAddNEON(acc01);
+  dst[C2NUM] = ReduceAddNEON(acc10);
+  dst[C3NUM] = ReduceAddNEON(acc11);
+  dst[C4NUM] = ReduceAddNEON(acc20);
+  dst[C5NUM] = ReduceAddNEON(acc21);
+  dst[C6NUM] = ReduceAddNEON(acc30);
+  dst[C7NUM] = ReduceAddNEON(acc31);
+#else
+  memset(dst, 0, C8NUM * sizeof(float));
+#endif
+  for (; d < deep; ++d) {
+    float w0 = Bf16ToFloat32Scalar(b0[d]);
+    float w1 = Bf16ToFloat32Scalar(b1[d]);
+    dst[0] += a0[d] * w0;
+    dst[1] += a0[d] * w1;
+    dst[C2NUM] += a1[d] * w0;
+    dst[C3NUM] += a1[d] * w1;
+    dst[C4NUM] += a2[d] * w0;
+    dst[C5NUM] += a2[d] * w1;
+    dst[C6NUM] += a3[d] * w0;
+    dst[C7NUM] += a3[d] * w1;
+  }
+}
+
+static void Bf16DotRow1Col4(const float *a, int deep, const uint16_t *const *b, float *dst) {
+  int d = 0;
+#ifdef ENABLE_AVX
+  __m256 acc0 = _mm256_setzero_ps();
+  __m256 acc1 = _mm256_setzero_ps();
+  __m256 acc2 = _mm256_setzero_ps();
+  __m256 acc3 = _mm256_setzero_ps();
+  for (; d <= deep - C8NUM; d += C8NUM) {
+    __m256 src = _mm256_loadu_ps(a + d);
+    acc0 = _mm256_fmadd_ps(src, LoadBf16x8(b[0] + d), acc0);
+    acc1 = _mm256_fmadd_ps(src, LoadBf16x8(b[1] + d), acc1);
+    acc2 = _mm256_fmadd_ps(src, LoadBf16x8(b[C2NUM] + d), acc2);
+    acc3 = _mm256_fmadd_ps(src, LoadBf16x8(b[C3NUM] + d), acc3);
+  }
+  dst[0] = ReduceAddAVX(acc0);
+  dst[1] = ReduceAddAVX(acc1);
+  dst[C2NUM] = ReduceAddAVX(acc2);
+  dst[C3NUM] = ReduceAddAVX(acc3);
+#elif defined(ENABLE_NEON)
+  float32x4_t acc0 = vdupq_n_f32(0.0f);
+  float32x4_t acc1 = vdupq_n_f32(0.0f);
+  float32x4_t acc2 = vdupq_n_f32(0.0f);
+  float32x4_t acc3 = vdupq_n_f32(0.0f);
+  for (; d <= deep - C4NUM; d += C4NUM) {
+    float32x4_t src = vld1q_f32(a + d);
+    acc0 = FmaNEON(acc0, src, LoadBf16x4(b[0] + d));
+    acc1 = FmaNEON(acc1, src, LoadBf16x4(b[1] + d));
+    acc2 = FmaNEON(acc2, src, LoadBf16x4(b[C2NUM] + d));
+    acc3 = FmaNEON(acc3, src, LoadBf16x4(b[C3NUM] + d));
+  }
+  dst[0] = ReduceAddNEON(acc0);
+  dst[1] = ReduceAddNEON(acc1);
+  dst[C2NUM] = ReduceAddNEON(acc2);
+  dst[C3NUM] = ReduceAddNEON(acc3);
+#else
+  memset(dst, 0, C4NUM * sizeof(float));
+#endif
+  for (; d < deep; ++d) {
+    for (int j = 0; j < C4NUM; ++j) {
+      dst[j] += a[d] * Bf16ToFloat32Scalar(b[j][d]);
+    }
+  }
+}
+
+static void StoreBf16Tile(const float *tile, int rows, int cols, int tile_cols, float *c, int stride, const float *bias,
+                          ActType act_type) {
+  for (int i = 0; i < rows; ++i) {
+    for (int j = 0; j < cols; ++j) {
+      float value = tile[i * tile_cols + j] + (bias == NULL ? 0.0f : bias[j]);
+      if (act_type == ActType_Relu || act_type == ActType_Relu6) {
+        value = MSMAX(value, 0.0f);
+      }
+      if (act_type == ActType_Relu6) {
+        value = MSMIN(value, 6.0f);
+      }
+      c[i * stride + j] = value;
+    }
+  }
+}
+
+void MatMulBf16WeightFp32(const float *a, const uint16_t *b, float *c, const float *bias, ActType act_type, int deep,
+                          int row, int col, int stride) {
+  Bf16DotRow4Col2Func dot_row4 = Bf16DotRow4Col2;
+  Bf16DotRow1Col4Func dot_row1 = Bf16DotRow1Col4;
+#ifdef ENABLE_AVX512
+  if (X86_Avx512_Support()) {
+    dot_row4 = Bf16DotRow4Col2AVX512;
+    dot_row1 = Bf16DotRow1Col4AVX512;
+  }
+#endif
+  float tile[C8NUM];
+  int r = 0;
+  // 4 rows share every weight load, the weight of a column is streamed once for the 4 rows.
+  for (; r <= row - C4NUM; r += C4NUM) {
+    const float *a_ptr = a + r * deep;
+    for (int j = 0; j < col; j += C2NUM) {
+      int cols = MSMIN(C2NUM, col - j);
+      const uint16_t *b0 = b + j * deep;
+      const uint16_t *b1 = cols > 1 ? b0 + deep : b0;
+      dot_row4(a_ptr, deep, b0, b1, tile);
+      StoreBf16Tile(tile, C4NUM, cols, C2NUM, c + r * stride + j, stride, bias == NULL ? NULL : bias + j, act_type);
+    }
+  }
+  for (; r < row; ++r) {
+    const float *a_ptr = a + r * deep;
+    for (int j = 0; j < col; j += C4NUM) {
+      int cols = MSMIN(C4NUM, col - j);
+      const uint16_t *b_ptr[C4NUM];
+      for (int k = 0; k < C4NUM; ++k) {
+        b_ptr[k] = b + (j + MSMIN(k, cols - 1)) * deep;
+      }
+      dot_row1(a_ptr, deep, b_ptr, tile);
+      StoreBf16Tile(tile, 1, cols, C4NUM, c + r * stride + j, stride, bias == NULL ? NULL : bias + j, act_type);
+    }
+  }
+}
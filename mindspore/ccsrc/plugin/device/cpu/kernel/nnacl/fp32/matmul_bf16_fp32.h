@@ -0,0 +1,75 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_FP32_MATMUL_BF16_FP32_H_
+#define MINDSPORE_NNACL_FP32_MATMUL_BF16_FP32_H_
+#include <stdint.h>
+#include <string.h>
+#include "nnacl/op_base.h"
+
+/*
+ * bfloat16 keeps the sign, the exponent and the 7 highest mantissa bits of a float32, so a weight stored as bf16 takes
+ * half of the memory traffic while the products are still accumulated in float32.
+ */
+#ifdef __cplusplus
+extern "C" {
+#endif
+static inline uint16_t Float32ToBf16Scalar(float value) {
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(bits));
+  if ((bits & 0x7fffffff) > 0x7f800000) {
+    return (uint16_t)((bits >> 16) | 0x40);  // keep nan quiet, the rounding below may turn it to inf
+  }
+  if ((bits & 0x7f800000) == 0) {
+    return (uint16_t)((bits >> 16) & 0x8000);  // a denormal becomes a signed zero, the same as vcvtneps2bf16
+  }
+  bits += 0x7fff + ((bits >> 16) & 1);
+  return (uint16_t)(bits >> 16);
+}
+
+static inline float Bf16ToFloat32Scalar(uint16_t value) {
+  uint32_t bits = (uint32_t)value << 16;
+  float result;
+  memcpy(&result, &bits, sizeof(result));
+  return result;
+}
+
+// round to nearest even, nan stays a quiet nan and a denormal is flushed to a zero of the same sign, on every path.
+void Float32ToBf16(const float *src, uint16_t *dst, int num);
+void Bf16ToFloat32(const uint16_t *src, float *dst, int num);
+
+// dst is col-major, every output column owns deep contiguous bf16 values. src is [deep, col], or [col, deep] when
+// transposed.
+void PackBf16WeightColMajor(const float *src, uint16_t *dst, int deep, int col, bool transposed);
+
+// c[row, col] = act(a[row, deep] * b + bias), a and c are row-major fp32, c has a row stride of stride.
+// b is the packed bf16 weight of PackBf16WeightColMajor, offset to the first column to compute.
+void MatMulBf16WeightFp32(const float *a, const uint16_t *b, float *c, const float *bias, ActType act_type, int deep,
+                          int row, int col, int stride);
+
+#ifdef ENABLE_AVX512
+// uses vcvtneps2bf16 when the cpu supports AVX512_BF16, otherwise emulates it, denormals included.
+void Float32ToBf16AVX512(const float *src, uint16_t *dst, int num);
+// dst[i * 2 + j] = dot(a + i * deep, bj), i in [0, 4)
+void Bf16DotRow4Col2AVX512(const float *a, int deep, const uint16_t *b0, const uint16_t *b1, float *dst);
+// dst[j] = dot(a, b[j]), j in [0, 4)
+void Bf16DotRow1Col4AVX512(const float *a, int deep, const uint16_t *const *b, float *dst);
+#endif
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_NNACL_FP32_MATMUL_BF16_FP32_H_
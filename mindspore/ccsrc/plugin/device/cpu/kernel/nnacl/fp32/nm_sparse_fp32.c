@@ -0,0 +1,83 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nnacl/fp32/nm_sparse_fp32.h"
+#include <math.h>
+
+static inline float NMSparseWeightAt(const float *weight, int d, int j, int deep, int col, bool transposed) {
+  return transposed ? weight[j * deep + d] : weight[d * col + j];
+}
+
+bool IsNMSparseWeight(const float *weight, int deep, int col, int n, int m, bool transposed) {
+  if (weight == NULL || n <= 0 || m <= n || m > NM_SPARSE_MAX_M) {
+    return false;
+  }
+  bool has_non_zero = false;
+  for (int j = 0; j < col; ++j) {
+    for (int g = 0; g < deep; g += m) {
+      int group_size = MSMIN(m, deep - g);
+      int non_zeros = 0;
+      for (int k = 0; k < group_size; ++k) {
+        non_zeros += NMSparseWeightAt(weight, g + k, j, deep, col, transposed) != 0.0f ? 1 : 0;
+      }
+      if (non_zeros > n) {
+        return false;
+      }
+      has_non_zero = has_non_zero || non_zeros > 0;
+    }
+  }
+  // an all-zero weight is not a sparse weight worth packing.
+  return has_non_zero;
+}
+
+void PackNMSparseWeight(const float *weight, float *values, uint8_t *indexes, int deep, int col, int n, int m,
+                        bool transposed) {
+  int kept = NMSparseKeptNum(deep, n, m);
+  for (int j = 0; j < col; ++j) {
+    float *col_values = values + j * kept;
+    uint8_t *col_indexes = indexes + j * kept;
+    for (int g = 0; g < deep; g += m) {
+      int group_size = MSMIN(m, deep - g);
+      float group[NM_SPARSE_MAX_M];
+      bool picked[NM_SPARSE_MAX_M] = {false};
+      for (int k = 0; k < group_size; ++k) {
+        group[k] = NMSparseWeightAt(weight, g + k, j, deep, col, transposed);
+      }
+      // the earlier one wins a tie, a group of zeros keeps its first n positions.
+      for (int s = 0; s < MSMIN(n, group_size); ++s) {
+        int best = -1;
+        for (int k = 0; k < group_size; ++k) {
+          if (!picked[k] && (best < 0 || fabsf(group[k]) > fabsf(group[best]))) {
+            best = k;
+          }
+        }
+        picked[best] = true;
+      }
+      int slot = g / m * n;
+      for (int k = 0; k < group_size; ++k) {
+        if (picked[k]) {
+          col_values[slot] = group[k];
+          col_indexes[slot] = (uint8_t)k;
+          ++slot;
+        }
+      }
+      for (; slot < (g / m + 1) * n; ++slot) {
+        col_values[slot] = 0.0f;
+        col_indexes[slot] = 0;
+      }
+    }
+  }
+}
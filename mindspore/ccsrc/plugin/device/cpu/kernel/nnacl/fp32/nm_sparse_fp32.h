@@ -0,0 +1,49 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_NNACL_FP32_NM_SPARSE_FP32_H_
+#define MINDSPORE_NNACL_FP32_NM_SPARSE_FP32_H_
+#include <stdbool.h>
+#include <stdint.h>
+#include "nnacl/op_base.h"
+
+/*
+ * N:M structured sparsity: every group of m consecutive weights along deep holds at most n non-zeros, 2:4 and 4:8 are
+ * the usual ones. A weight column is packed as the n kept values of every group and their offsets inside the group,
+ * which is how the converter stores such a weight, the runtime densifies it at load.
+ */
+#define NM_SPARSE_MAX_M 16
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+// the number of kept values of a packed column, the last group is padded when m does not divide deep.
+static inline int NMSparseKeptNum(int deep, int n, int m) { return UP_DIV(deep, m) * n; }
+
+// whether every group of m along deep has at most n non-zeros and the weight is not all zeros. weight is [deep, col],
+// or [col, deep] when transposed.
+bool IsNMSparseWeight(const float *weight, int deep, int col, int n, int m, bool transposed);
+
+// keeps the n largest magnitudes of every group in their original order, which also prunes a weight that is not N:M
+// sparse yet. values and indexes hold NMSparseKeptNum(deep, n, m) entries per column, padding is value 0 at offset 0.
+void PackNMSparseWeight(const float *weight, float *values, uint8_t *indexes, int deep, int col, int n, int m,
+                        bool transposed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // MINDSPORE_NNACL_FP32_NM_SPARSE_FP32_H_
@@ -18,16 +18,40 @@
 #include <string.h>
 #include "nnacl/int8/fixed_point.h"
 #include "nnacl/int8/common_func_int8.h"
+#ifdef ENABLE_AVX
+#include "nnacl/intrinsics/avx/common_utils.h"
+#endif
 
 /*conv depthwise int8 begin*/
 #ifndef ENABLE_ARM
 void ConvDwInt8Row(int32_t *output_ptr, const int8_t *input_ptr, const int16_t *weight_ptr, int num_pixels,
                    int output_channel, int input_step, int8_t input_zp) {
+#ifdef ENABLE_AVX
+  const __m256i zp_vec = _mm256_set1_epi16(input_zp);
+#endif
   for (int i = 0; i < num_pixels; i++) {
-    for (int c = 0; c < output_channel; c++) {
+    int c = 0;
+#ifdef ENABLE_AVX
+    for (; c <= output_channel - C16NUM; c += C16NUM) {
+      __m256i input = _mm256_sub_epi16(_mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(input_ptr + c))), zp_vec);
+      __m256i weight = _mm256_loadu_si256((const __m256i *)(weight_ptr + c));
+      // the low and high halves of the int16 products, interleaved into exact int32 products
+      __m256i mul_lo = _mm256_mullo_epi16(input, weight);
+      __m256i mul_hi = _mm256_mulhi_epi16(input, weight);
+      __m256i mul_0 = _mm256_unpacklo_epi16(mul_lo, mul_hi);
+      __m256i mul_1 = _mm256_unpackhi_epi16(mul_lo, mul_hi);
+      __m256i *out = (__m256i *)(output_ptr + c);
+      __m256i out_0 = _mm256_add_epi32(_mm256_loadu_si256(out), _mm256_permute2x128_si256(mul_0, mul_1, 0x20));
+      __m256i out_1 = _mm256_add_epi32(_mm256_loadu_si256(out + 1), _mm256_permute2x128_si256(mul_0, mul_1, 0x31));
+      _mm256_storeu_si256(out, out_0);
+      _mm256_storeu_si256(out + 1, out_1);
+    }
+#endif
+    for (; c < output_channel; c++) {
       const int16_t input = input_ptr[c] - input_zp;
-      *output_ptr++ += input * weight_ptr[c];
+      output_ptr[c] += input * weight_ptr[c];
     }
+    output_ptr += output_channel;
     input_ptr += input_step;
   }
 }
@@ -165,19 +189,32 @@ void ConvDw3x3Int8Window(int8_t *output, const int8_t *buffer, const int16_t *we
     int8_t *output_tmp = output;
     const int8_t *src_kh = buffer;
     const int16_t *weight_kh = weight;
+#ifdef ENABLE_AVX
+    __m256i acc = _mm256_setzero_si256();
+    const __m256i zp_vec = _mm256_set1_epi32(in_zp);
+#endif
     for (int kh = 0; kh < 3; kh++) {
       const int8_t *src_kw = src_kh;
       const int16_t *weight_kw = weight_kh;
       for (int kw = 0; kw < 3; kw++) {
+#ifdef ENABLE_AVX
+        __m256i src = _mm256_sub_epi32(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)src_kw)), zp_vec);
+        __m256i weight = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)weight_kw));
+        acc = _mm256_add_epi32(acc, _mm256_mullo_epi32(src, weight));
+#else
         for (int c = 0; c < 8; c++) {
           tmp_buffer[c] += (src_kw[c] - in_zp) * weight_kw[c];
         }
+#endif
         src_kw += col_size;
         weight_kw += channel;
       }
       src_kh += row_size;
       weight_kh += 3 * channel;
     }
+#ifdef ENABLE_AVX
+    _mm256_storeu_si256((__m256i *)tmp_buffer, acc);
+#endif
     if (per_channel) {
       for (int c = 0; c < C8NUM; c++) {
         tmp_buffer[c] += bias[c];
@@ -0,0 +1,149 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifdef ENABLE_AVX512
+#include <string.h>
+#include "nnacl/int8/matmul_int8.h"
+#include "nnacl/intrinsics/avx/common_utils.h"
+
+/*
+ * vpdpbusd multiplies unsigned bytes by signed bytes, so the int8 input is moved to uint8 by flipping its sign bit,
+ * that is adding 128. The extra 128 * sum(weight column) is computed once per column block and subtracted.
+ */
+#define INT8_TO_UINT8_MASK 0x80808080
+
+// Returns [sum(c0), sum(c1), sum(c2), sum(c3)], v01 holds the columns 0 | 1 and v23 the columns 2 | 3 in its lanes.
+static inline __m128i ReduceColumnPairs(__m256i v01, __m256i v23) {
+  __m256i sum = _mm256_hadd_epi32(v01, v23);
+  sum = _mm256_hadd_epi32(sum, sum);
+  return _mm_unpacklo_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+}
+
+void MatmulInt8Opt_AVX512VNNI(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                              const int32_t *a_sums, const int32_t *bias, int mini, int maxi, int out_zp,
+                              const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift,
+                              size_t stride, size_t filter_peroc, const int32_t *filter_zp) {
+  /* a: row4x16-major, b: col4x16-major, every (row, col) pair of a 4x4 tile owns 16 contiguous bytes per deep16 */
+  const __m256i sign_mask = _mm256_set1_epi32(INT8_TO_UINT8_MASK);
+  int32_t acc[C4NUM * C4NUM];
+  for (int c = 0; c < col; c += C4NUM) {
+    const int8_t *b_block = b + c * deep16;
+    __m256i comp01 = _mm256_setzero_si256();
+    __m256i comp23 = _mm256_setzero_si256();
+    for (int d = 0; d < deep16; d += C16NUM) {
+      const int8_t *b_ptr = b_block + d * C4NUM;
+      comp01 = _mm256_dpbusd_epi32(comp01, sign_mask, _mm256_loadu_si256((const __m256i *)b_ptr));
+      comp23 = _mm256_dpbusd_epi32(comp23, sign_mask, _mm256_loadu_si256((const __m256i *)(b_ptr + C32NUM)));
+    }
+    __m128i comp = ReduceColumnPairs(comp01, comp23);
+
+    for (int r = 0; r < row; r += C4NUM) {
+      const int8_t *a_block = a + r * deep16;
+      __m256i acc00 = _mm256_setzero_si256();
+      __m256i acc01 = _mm256_setzero_si256();
+      __m256i acc10 = _mm256_setzero_si256();
+      __m256i acc11 = _mm256_setzero_si256();
+      __m256i acc20 = _mm256_setzero_si256();
+      __m256i acc21 = _mm256_setzero_si256();
+      __m256i acc30 = _mm256_setzero_si256();
+      __m256i acc31 = _mm256_setzero_si256();
+      for (int d = 0; d < deep16; d += C16NUM) {
+        const int8_t *a_ptr = a_block + d * C4NUM;
+        const int8_t *b_ptr = b_block + d * C4NUM;
+        __m256i b01 = _mm256_loadu_si256((const __m256i *)b_ptr);
+        __m256i b23 = _mm256_loadu_si256((const __m256i *)(b_ptr + C32NUM));
+        // every row of 16 bytes is broadcast to both 128-bit lanes, which meet two columns of b
+        __m256i a0 = _mm256_xor_si256(_mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)a_ptr)), sign_mask);
+        acc00 = _mm256_dpbusd_epi32(acc00, a0, b01);
+        acc01 = _mm256_dpbusd_epi32(acc01, a0, b23);
+        __m256i a1 = _mm256_xor_si256(
+          _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(a_ptr + C16NUM))), sign_mask);
+        acc10 = _mm256_dpbusd_epi32(acc10, a1, b01);
+        acc11 = _mm256_dpbusd_epi32(acc11, a1, b23);
+        __m256i a2 = _mm256_xor_si256(
+          _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(a_ptr + C2NUM * C16NUM))), sign_mask);
+        acc20 = _mm256_dpbusd_epi32(acc20, a2, b01);
+        acc21 = _mm256_dpbusd_epi32(acc21, a2, b23);
+        __m256i a3 = _mm256_xor_si256(
+          _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *)(a_ptr + C3NUM * C16NUM))), sign_mask);
+        acc30 = _mm256_dpbusd_epi32(acc30, a3, b01);
+        acc31 = _mm256_dpbusd_epi32(acc31, a3, b23);
+      }
+      _mm_storeu_si128((__m128i *)acc, _mm_sub_epi32(ReduceColumnPairs(acc00, acc01), comp));
+      _mm_storeu_si128((__m128i *)(acc + C4NUM), _mm_sub_epi32(ReduceColumnPairs(acc10, acc11), comp));
+      _mm_storeu_si128((__m128i *)(acc + C2NUM * C4NUM), _mm_sub_epi32(ReduceColumnPairs(acc20, acc21), comp));
+      _mm_storeu_si128((__m128i *)(acc + C3NUM * C4NUM), _mm_sub_epi32(ReduceColumnPairs(acc30, acc31), comp));
+      MatmulInt8OptTilePost(acc, dst, r, c, row, col, a_sums, bias, mini, maxi, out_zp, multiplier, left_shift,
+                            right_shift, stride, filter_peroc, filter_zp);
+    }
+  }
+}
+
+static inline __m256i BroadcastRowUint8(const int8_t *src) {
+  int32_t value;
+  memcpy(&value, src, sizeof(int32_t));
+  return _mm256_set1_epi32(value ^ INT8_TO_UINT8_MASK);
+}
+
+void MatMulInt8_8x8_r_AVX512VNNI(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col,
+                                 size_t deep_4, size_t stride, const int32_t *input_sum, const int32_t *bias,
+                                 const int32_t *left_shift, const int32_t *right_shift, const int32_t *multiplier,
+                                 int32_t output_zp, int32_t mini, int32_t maxi, size_t per_channel) {
+  /* a: row8x4-major, b: row4x8-major, one dpbusd of a broadcast row with 32 bytes of b gives 8 columns */
+  const __m256i sign_mask = _mm256_set1_epi32(INT8_TO_UINT8_MASK);
+  int32_t acc[C8NUM * C8NUM];
+  for (size_t c = 0; c < col; c += C8NUM) {
+    const int8_t *b_block = b + c * deep_4;
+    __m256i comp = _mm256_setzero_si256();
+    for (size_t d = 0; d < deep_4; d += C4NUM) {
+      comp = _mm256_dpbusd_epi32(comp, sign_mask, _mm256_loadu_si256((const __m256i *)(b_block + d * C8NUM)));
+    }
+
+    for (size_t r = 0; r < row; r += C8NUM) {
+      const int8_t *a_block = a + r * deep_4;
+      __m256i acc0 = _mm256_setzero_si256();
+      __m256i acc1 = _mm256_setzero_si256();
+      __m256i acc2 = _mm256_setzero_si256();
+      __m256i acc3 = _mm256_setzero_si256();
+      __m256i acc4 = _mm256_setzero_si256();
+      __m256i acc5 = _mm256_setzero_si256();
+      __m256i acc6 = _mm256_setzero_si256();
+      __m256i acc7 = _mm256_setzero_si256();
+      for (size_t d = 0; d < deep_4; d += C4NUM) {
+        const int8_t *a_ptr = a_block + d * C8NUM;
+        __m256i b_src = _mm256_loadu_si256((const __m256i *)(b_block + d * C8NUM));
+        acc0 = _mm256_dpbusd_epi32(acc0, BroadcastRowUint8(a_ptr), b_src);
+        acc1 = _mm256_dpbusd_epi32(acc1, BroadcastRowUint8(a_ptr + C4NUM), b_src);
+        acc2 = _mm256_dpbusd_epi32(acc2, BroadcastRowUint8(a_ptr + C2NUM * C4NUM), b_src);
+        acc3 = _mm256_dpbusd_epi32(acc3, BroadcastRowUint8(a_ptr + C3NUM * C4NUM), b_src);
+        acc4 = _mm256_dpbusd_epi32(acc4, BroadcastRowUint8(a_ptr + C4NUM * C4NUM), b_src);
+        acc5 = _mm256_dpbusd_epi32(acc5, BroadcastRowUint8(a_ptr + C5NUM * C4NUM), b_src);
+        acc6 = _mm256_dpbusd_epi32(acc6, BroadcastRowUint8(a_ptr + C6NUM * C4NUM), b_src);
+        acc7 = _mm256_dpbusd_epi32(acc7, BroadcastRowUint8(a_ptr + C7NUM * C4NUM), b_src);
+      }
+      _mm256_storeu_si256((__m256i *)acc, _mm256_sub_epi32(acc0, comp));
+      _mm256_storeu_si256((__m256i *)(acc + C8NUM), _mm256_sub_epi32(acc1, comp));
+      _mm256_storeu_si256((__m256i *)(acc + C2NUM * C8NUM), _mm256_sub_epi32(acc2, comp));
+      _mm256_storeu_si256((__m256i *)(acc + C3NUM * C8NUM), _mm256_sub_epi32(acc3, comp));
+      _mm256_storeu_si256((__m256i *)(acc + C4NUM * C8NUM), _mm256_sub_epi32(acc4, comp));
+      _mm256_storeu_si256((__m256i *)(acc + C5NUM * C8NUM), _mm256_sub_epi32(acc5, comp));
+      _mm256_storeu_si256((__m256i *)(acc + C6NUM * C8NUM), _mm256_sub_epi32(acc6, comp));
+      _mm256_storeu_si256((__m256i *)(acc + C7NUM * C8NUM), _mm256_sub_epi32(acc7, comp));
+      MatMulInt8_8x8_rTilePost(acc, dst, r, c, row, col, stride, input_sum, bias, left_shift, right_shift, multiplier,
+                               output_zp, mini, maxi, per_channel);
+    }
+  }
+}
+#endif
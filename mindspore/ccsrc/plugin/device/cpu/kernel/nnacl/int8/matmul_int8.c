@@ -16,6 +16,10 @@
 
 #include "nnacl/int8/matmul_int8.h"
 #include "nnacl/int8/fixed_point.h"
+#ifdef ENABLE_AVX
+#include "nnacl/intrinsics/avx/common_utils.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#endif
 
 void RowMajor2Row2x16MajorInt8(const int8_t *src_ptr, int8_t *dst_ptr, int row, int col) {
   int col16 = UP_ROUND(col, C16NUM);
@@ -303,6 +307,18 @@ void MatmulInt8Opt(const int8_t *a, const int8_t *b, int8_t *dst, int row, int c
    * a_sums is  perT  : input_row_sum * filter_zp
    *            perOc : input_row_sum
    * */
+#ifdef ENABLE_AVX512
+  if (X86_Avx512Vnni_Support()) {
+    MatmulInt8Opt_AVX512VNNI(a, b, dst, row, col, deep16, a_sums, bias, mini, maxi, out_zp, multiplier, left_shift,
+                             right_shift, stride, filter_peroc, filter_zp);
+    return;
+  }
+#endif
+#ifdef ENABLE_AVX
+  MatmulInt8Opt_AVX2(a, b, dst, row, col, deep16, a_sums, bias, mini, maxi, out_zp, multiplier, left_shift,
+                     right_shift, stride, filter_peroc, filter_zp);
+  return;
+#endif
   for (int r = 0; r < row; r++) {
     for (int c = 0; c < col; c++) {
       int r4div = r / C4NUM, r4mod = r % C4NUM;
@@ -335,6 +351,18 @@ void MatMulInt8_8x8_r(const int8_t *a, const int8_t *b, int8_t *dst, size_t row,
                       const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
                       int32_t maxi, size_t per_channel) {
   /*  row8x4-major * row4x8-major => (int8)row-major  */
+#ifdef ENABLE_AVX512
+  if (X86_Avx512Vnni_Support()) {
+    MatMulInt8_8x8_r_AVX512VNNI(a, b, dst, row, col, deep_4, stride, input_sum, bias, left_shift, right_shift,
+                                multiplier, output_zp, mini, maxi, per_channel);
+    return;
+  }
+#endif
+#ifdef ENABLE_AVX
+  MatMulInt8_8x8_r_AVX2(a, b, dst, row, col, deep_4, stride, input_sum, bias, left_shift, right_shift, multiplier,
+                        output_zp, mini, maxi, per_channel);
+  return;
+#endif
   for (size_t r = 0; r < row; r++) {
     for (size_t c = 0; c < col; c++) {
       size_t r8div = r / C8NUM, r8mod = r % C8NUM;
@@ -395,6 +423,170 @@ void MatMulInt8_4x16_r(const int8_t *a, const int8_t *b, int8_t *dst, size_t row
   return;
 }
 
+#ifdef ENABLE_AVX
+void MatmulInt8OptTilePost(const int32_t *acc, int8_t *dst, int r, int c, int row, int col, const int32_t *a_sums,
+                           const int32_t *bias, int mini, int maxi, int out_zp, const int32_t *multiplier,
+                           const int32_t *left_shift, const int32_t *right_shift, size_t stride, size_t filter_peroc,
+                           const int32_t *filter_zp) {
+  int tile_row = MSMIN(C4NUM, row - r);
+  int tile_col = MSMIN(C4NUM, col - c);
+  for (int i = 0; i < tile_row; i++) {
+    for (int j = 0; j < tile_col; j++) {
+      int cur_c = c + j;
+      int32_t value = acc[i * C4NUM + j];
+      int32_t cur_input_sum = filter_peroc ? a_sums[r + i] * filter_zp[cur_c] : a_sums[r + i];
+      value -= cur_input_sum;
+      value += bias[cur_c];
+      int32_t cur_left_shift = filter_peroc ? left_shift[cur_c] : left_shift[0];
+      int32_t cur_right_shift = filter_peroc ? right_shift[cur_c] : right_shift[0];
+      int32_t cur_multiplier = filter_peroc ? multiplier[cur_c] : multiplier[0];
+      value = MultiplyByQuantizedMultiplier(value, cur_multiplier, cur_left_shift, cur_right_shift) + out_zp;
+      value = MSMIN(maxi, value);
+      value = MSMAX(mini, value);
+      dst[(int64_t)(r + i) * stride + cur_c] = (int8_t)value;
+    }
+  }
+}
+
+void MatMulInt8_8x8_rTilePost(const int32_t *acc, int8_t *dst, size_t r, size_t c, size_t row, size_t col,
+                              size_t stride, const int32_t *input_sum, const int32_t *bias, const int32_t *left_shift,
+                              const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
+                              int32_t maxi, size_t per_channel) {
+  size_t tile_row = MSMIN(C8NUM, row - r);
+  size_t tile_col = MSMIN(C8NUM, col - c);
+  size_t c8div = c / C8NUM;
+  for (size_t i = 0; i < tile_row; i++) {
+    for (size_t j = 0; j < tile_col; j++) {
+      size_t cur_c = c + j;
+      int32_t value = acc[i * C8NUM + j];
+      int32_t cur_input_sum =
+        per_channel ? input_sum[c8div * UP_ROUND(row, C8NUM) * C8NUM + (r + i) * C8NUM + j] : input_sum[r + i];
+      value -= cur_input_sum;
+      value += bias[cur_c];
+      int32_t cur_left_shift = per_channel ? left_shift[cur_c] : left_shift[0];
+      int32_t cur_right_shift = per_channel ? right_shift[cur_c] : right_shift[0];
+      int32_t cur_multiplier = per_channel ? multiplier[cur_c] : multiplier[0];
+      value = MultiplyByQuantizedMultiplier(value, cur_multiplier, cur_left_shift, cur_right_shift) + output_zp;
+      value = MSMIN(maxi, value);
+      value = MSMAX(mini, value);
+      dst[(r + i) * stride + cur_c] = (int8_t)value;
+    }
+  }
+}
+
+// Horizontal sum of each vector, returns [sum(v0), sum(v1), sum(v2), sum(v3)].
+static inline __m128i ReduceAdd4Int32(__m256i v0, __m256i v1, __m256i v2, __m256i v3) {
+  __m256i sum = _mm256_hadd_epi32(_mm256_hadd_epi32(v0, v1), _mm256_hadd_epi32(v2, v3));
+  return _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+}
+
+/*
+ * vpmaddubsw saturates its int16 pair sums, which is not exact for full range int8 data, so both sides are widened to
+ * int16 and multiplied with vpmaddwd, which accumulates pairs into int32 without saturation.
+ */
+void MatmulInt8Opt_AVX2(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                        const int32_t *a_sums, const int32_t *bias, int mini, int maxi, int out_zp,
+                        const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift, size_t stride,
+                        size_t filter_peroc, const int32_t *filter_zp) {
+  /* a: row4x16-major, b: col4x16-major, every (row, col) pair of a 4x4 tile owns 16 contiguous bytes per deep16 */
+  int32_t acc[C4NUM * C4NUM];
+  for (int r = 0; r < row; r += C4NUM) {
+    const int8_t *a_block = a + r * deep16;
+    for (int c = 0; c < col; c += C4NUM) {
+      const int8_t *b_block = b + c * deep16;
+      for (int i = 0; i < C4NUM; i += C2NUM) {
+        __m256i acc00 = _mm256_setzero_si256();
+        __m256i acc01 = _mm256_setzero_si256();
+        __m256i acc02 = _mm256_setzero_si256();
+        __m256i acc03 = _mm256_setzero_si256();
+        __m256i acc10 = _mm256_setzero_si256();
+        __m256i acc11 = _mm256_setzero_si256();
+        __m256i acc12 = _mm256_setzero_si256();
+        __m256i acc13 = _mm256_setzero_si256();
+        for (int d = 0; d < deep16; d += C16NUM) {
+          const int8_t *a_ptr = a_block + d * C4NUM + i * C16NUM;
+          const int8_t *b_ptr = b_block + d * C4NUM;
+          __m256i a0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)a_ptr));
+          __m256i a1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(a_ptr + C16NUM)));
+          __m256i b0 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)b_ptr));
+          __m256i b1 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b_ptr + C16NUM)));
+          __m256i b2 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b_ptr + C2NUM * C16NUM)));
+          __m256i b3 = _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(b_ptr + C3NUM * C16NUM)));
+          acc00 = _mm256_add_epi32(acc00, _mm256_madd_epi16(a0, b0));
+          acc01 = _mm256_add_epi32(acc01, _mm256_madd_epi16(a0, b1));
+          acc02 = _mm256_add_epi32(acc02, _mm256_madd_epi16(a0, b2));
+          acc03 = _mm256_add_epi32(acc03, _mm256_madd_epi16(a0, b3));
+          acc10 = _mm256_add_epi32(acc10, _mm256_madd_epi16(a1, b0));
+          acc11 = _mm256_add_epi32(acc11, _mm256_madd_epi16(a1, b1));
+          acc12 = _mm256_add_epi32(acc12, _mm256_madd_epi16(a1, b2));
+          acc13 = _mm256_add_epi32(acc13, _mm256_madd_epi16(a1, b3));
+        }
+        _mm_storeu_si128((__m128i *)(acc + i * C4NUM), ReduceAdd4Int32(acc00, acc01, acc02, acc03));
+        _mm_storeu_si128((__m128i *)(acc + (i + 1) * C4NUM), ReduceAdd4Int32(acc10, acc11, acc12, acc13));
+      }
+      MatmulInt8OptTilePost(acc, dst, r, c, row, col, a_sums, bias, mini, maxi, out_zp, multiplier, left_shift,
+                            right_shift, stride, filter_peroc, filter_zp);
+    }
+  }
+}
+
+void MatMulInt8_8x8_r_AVX2(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col, size_t deep_4,
+                           size_t stride, const int32_t *input_sum, const int32_t *bias, const int32_t *left_shift,
+                           const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
+                           int32_t maxi, size_t per_channel) {
+  /* a: row8x4-major, b: row4x8-major, every deep4 step of a 8x8 tile is 32 bytes of a and 32 bytes of b */
+  int32_t acc[C8NUM * C8NUM];
+  for (size_t r = 0; r < row; r += C8NUM) {
+    const int8_t *a_block = a + r * deep_4;
+    for (size_t c = 0; c < col; c += C8NUM) {
+      const int8_t *b_block = b + c * deep_4;
+      for (size_t i = 0; i < C8NUM; i += C4NUM) {
+        // lo accumulates the columns 0-3 and hi the columns 4-7, two int32 partial sums per column
+        __m256i lo0 = _mm256_setzero_si256();
+        __m256i lo1 = _mm256_setzero_si256();
+        __m256i lo2 = _mm256_setzero_si256();
+        __m256i lo3 = _mm256_setzero_si256();
+        __m256i hi0 = _mm256_setzero_si256();
+        __m256i hi1 = _mm256_setzero_si256();
+        __m256i hi2 = _mm256_setzero_si256();
+        __m256i hi3 = _mm256_setzero_si256();
+        for (size_t d = 0; d < deep_4; d += C4NUM) {
+          __m256i b_src = _mm256_loadu_si256((const __m256i *)(b_block + d * C8NUM));
+          __m256i b_lo = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(b_src));
+          __m256i b_hi = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(b_src, 1));
+          // four rows of 4 int8 each, widened to int16, and every row broadcast to all the 64-bit lanes
+          __m256i a_src =
+            _mm256_cvtepi8_epi16(_mm_loadu_si128((const __m128i *)(a_block + d * C8NUM + i * C4NUM)));
+          __m256i a0 = _mm256_permute4x64_epi64(a_src, 0x00);
+          __m256i a1 = _mm256_permute4x64_epi64(a_src, 0x55);
+          __m256i a2 = _mm256_permute4x64_epi64(a_src, 0xAA);
+          __m256i a3 = _mm256_permute4x64_epi64(a_src, 0xFF);
+          lo0 = _mm256_add_epi32(lo0, _mm256_madd_epi16(a0, b_lo));
+          hi0 = _mm256_add_epi32(hi0, _mm256_madd_epi16(a0, b_hi));
+          lo1 = _mm256_add_epi32(lo1, _mm256_madd_epi16(a1, b_lo));
+          hi1 = _mm256_add_epi32(hi1, _mm256_madd_epi16(a1, b_hi));
+          lo2 = _mm256_add_epi32(lo2, _mm256_madd_epi16(a2, b_lo));
+          hi2 = _mm256_add_epi32(hi2, _mm256_madd_epi16(a2, b_hi));
+          lo3 = _mm256_add_epi32(lo3, _mm256_madd_epi16(a3, b_lo));
+          hi3 = _mm256_add_epi32(hi3, _mm256_madd_epi16(a3, b_hi));
+        }
+        // hadd gives the columns in the order 0 1 4 5 | 2 3 6 7, the permutation restores 0-7
+        _mm256_storeu_si256((__m256i *)(acc + i * C8NUM),
+                            _mm256_permute4x64_epi64(_mm256_hadd_epi32(lo0, hi0), 0xD8));
+        _mm256_storeu_si256((__m256i *)(acc + (i + 1) * C8NUM),
+                            _mm256_permute4x64_epi64(_mm256_hadd_epi32(lo1, hi1), 0xD8));
+        _mm256_storeu_si256((__m256i *)(acc + (i + 2) * C8NUM),
+                            _mm256_permute4x64_epi64(_mm256_hadd_epi32(lo2, hi2), 0xD8));
+        _mm256_storeu_si256((__m256i *)(acc + (i + 3) * C8NUM),
+                            _mm256_permute4x64_epi64(_mm256_hadd_epi32(lo3, hi3), 0xD8));
+      }
+      MatMulInt8_8x8_rTilePost(acc, dst, r, c, row, col, stride, input_sum, bias, left_shift, right_shift, multiplier,
+                               output_zp, mini, maxi, per_channel);
+    }
+  }
+}
+#endif
+
 #ifdef ENABLE_ARM64
 void PackInput4x4AndInputSumPert_arm64(const int8_t *src_ic, int8_t *pack_ic, int32_t *input_sum_r, size_t src_stride,
                                        size_t ic_4div, size_t ic_4res, int32_t filter_zp) {
@@ -86,6 +86,36 @@ void MatmulInt8Neon32(const int8_t *a, const int8_t *b, int8_t *dst, int row, in
                       const int32_t *input_sums, const int32_t *weight_bias, int act_min, int act_max, int out_zp,
                       int32_t *multiplier, int32_t *left_shift, int32_t *right_shift, int stride, int per_channel);
 #endif
+#ifdef ENABLE_AVX
+/* x86 micro kernels, same packing and arguments as MatmulInt8Opt and MatMulInt8_8x8_r */
+void MatmulInt8Opt_AVX2(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                        const int32_t *a_sums, const int32_t *bias, int act_min, int act_max, int out_zp,
+                        const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift, size_t stride,
+                        size_t filter_peroc, const int32_t *filter_zp);
+void MatMulInt8_8x8_r_AVX2(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col, size_t deep_4,
+                           size_t stride, const int32_t *input_sum, const int32_t *bias, const int32_t *left_shift,
+                           const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
+                           int32_t maxi, size_t per_channel);
+/* requantize a 4x4 (MatmulInt8Opt) or 8x8 (MatMulInt8_8x8_r) int32 tile starting at (r, c) */
+void MatmulInt8OptTilePost(const int32_t *acc, int8_t *dst, int r, int c, int row, int col, const int32_t *a_sums,
+                           const int32_t *bias, int act_min, int act_max, int out_zp, const int32_t *multiplier,
+                           const int32_t *left_shift, const int32_t *right_shift, size_t stride, size_t filter_peroc,
+                           const int32_t *filter_zp);
+void MatMulInt8_8x8_rTilePost(const int32_t *acc, int8_t *dst, size_t r, size_t c, size_t row, size_t col,
+                              size_t stride, const int32_t *input_sum, const int32_t *bias, const int32_t *left_shift,
+                              const int32_t *right_shift, const int32_t *multiplier, int32_t output_zp, int32_t mini,
+                              int32_t maxi, size_t per_channel);
+#endif
+#ifdef ENABLE_AVX512
+void MatmulInt8Opt_AVX512VNNI(const int8_t *a, const int8_t *b, int8_t *dst, int row, int col, int deep16,
+                              const int32_t *a_sums, const int32_t *bias, int act_min, int act_max, int out_zp,
+                              const int32_t *multiplier, const int32_t *left_shift, const int32_t *right_shift,
+                              size_t stride, size_t filter_peroc, const int32_t *filter_zp);
+void MatMulInt8_8x8_r_AVX512VNNI(const int8_t *a, const int8_t *b, int8_t *dst, size_t row, size_t col,
+                                 size_t deep_4, size_t stride, const int32_t *input_sum, const int32_t *bias,
+                                 const int32_t *left_shift, const int32_t *right_shift, const int32_t *multiplier,
+                                 int32_t output_zp, int32_t mini, int32_t maxi, size_t per_channel);
+#endif
 #ifdef __cplusplus
 }
 #endif
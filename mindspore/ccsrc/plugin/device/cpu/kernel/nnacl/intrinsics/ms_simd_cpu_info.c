@@ -28,6 +28,8 @@ struct X86CpuInfoContext {
   bool sse4_1_flag_;
   bool avx2_flag_;
   bool avx512_flag_;
+  bool avx512_vnni_flag_;
+  bool avx512_bf16_flag_;
 };
 
 static struct X86CpuInfoContext g_x86_cpu_info_context_;
@@ -58,6 +60,43 @@ inline const bool X86_Avx512_Support(void) {
 #endif
 }
 
+inline const bool X86_Avx512Vnni_Support(void) {
+#ifdef ENABLE_AVX512
+  return g_x86_cpu_info_context_.avx512_vnni_flag_;
+#else
+  return false;
+#endif
+}
+
+inline const bool X86_Avx512Bf16_Support(void) {
+#ifdef ENABLE_AVX512
+  return g_x86_cpu_info_context_.avx512_bf16_flag_;
+#else
+  return false;
+#endif
+}
+
+static void ExecuteCpuIdSubCmd(DWORD cmd_code, DWORD sub_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data,
+                               DWORD *edx_data) {
+  DWORD deax, debx, decx, dedx;
+  asm volatile(
+    "movl %4, %%eax;\n"
+    "movl %5, %%ecx;\n"
+    "cpuid;\n"
+    "movl %%eax, %0;\n"
+    "movl %%ebx, %1;\n"
+    "movl %%ecx, %2;\n"
+    "movl %%edx, %3;\n"
+    : "=r"(deax), "=r"(debx), "=r"(decx), "=r"(dedx)
+    : "r"(cmd_code), "r"(sub_code)
+    : "%eax", "%ebx", "%ecx", "%edx");
+
+  *eax_data = deax;
+  *ebx_data = debx;
+  *ecx_data = decx;
+  *edx_data = dedx;
+}
+
 void ExecuteCpuIdCmd(DWORD cmd_code, DWORD *eax_data, DWORD *ebx_data, DWORD *ecx_data, DWORD *edx_data) {
   DWORD deax, debx, decx, dedx;
   asm volatile(
@@ -109,6 +148,14 @@ int IntelX86CpuInfoInit(void) {
   ExecuteCpuIdCmd(7, &eax_data, &ebx_data, &ecx_data, &edx_data);  // eax = 7, execute cpuid to get avx2/avx512 flag
   g_x86_cpu_info_context_.avx2_flag_ = (ebx_data & (1 << 5)) == 0 ? false : true;     // avx2 flag is ecx 5 bit
   g_x86_cpu_info_context_.avx512_flag_ = (ebx_data & (1 << 16)) == 0 ? false : true;  // avx512 flag is ecx 16 bit
+  bool avx512vl_flag = (ebx_data & (1u << 31)) == 0 ? false : true;                     // avx512vl flag is ebx 31 bit
+  bool vnni_flag = (ecx_data & (1 << 11)) == 0 ? false : true;                          // avx512_vnni flag is ecx 11 bit
+  g_x86_cpu_info_context_.avx512_vnni_flag_ = g_x86_cpu_info_context_.avx512_flag_ && avx512vl_flag && vnni_flag;
+  g_x86_cpu_info_context_.avx512_bf16_flag_ = false;
+  if (eax_data >= 1) {  // eax of leaf 7 is the max sub-leaf, the avx512_bf16 flag is eax 5 bit of sub-leaf 1
+    ExecuteCpuIdSubCmd(7, 1, &eax_data, &ebx_data, &ecx_data, &edx_data);
+    g_x86_cpu_info_context_.avx512_bf16_flag_ = g_x86_cpu_info_context_.avx512_flag_ && (eax_data & (1 << 5)) != 0;
+  }
 
   return NNACL_OK;
 }
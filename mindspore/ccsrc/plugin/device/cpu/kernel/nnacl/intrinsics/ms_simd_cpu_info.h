@@ -48,6 +48,10 @@ const bool X86_Fma_Support(void);
 const bool X86_Sse_Support(void);
 const bool X86_Avx_Support(void);
 const bool X86_Avx512_Support(void);
+// AVX512-VNNI together with AVX512VL, so that vpdpbusd is available on ymm registers.
+const bool X86_Avx512Vnni_Support(void);
+// AVX512_BF16, vcvtne2ps2bf16/vcvtneps2bf16 and vdpbf16ps.
+const bool X86_Avx512Bf16_Support(void);
 
 bool IsIntelX86Platform(void);
 X86CpuInfoErrorCodeEnum IntelX86InstructionSetSupportCheck(void);
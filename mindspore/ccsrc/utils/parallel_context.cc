@@ -65,6 +65,7 @@ void ParallelContext::Reset() {
   all_reduce_fusion_split_sizes_.clear();
   strategy_search_mode_ = kDynamicProgramming;
   pipeline_stage_split_num_ = 1;
+  pipeline_interleave_num_ = 1;
   grad_accumulation_step_ = 1;
   communi_parallel_mode_ = kAllGroupParallel;
   optimizer_weight_shard_size_ = -1;
@@ -137,6 +138,10 @@ void ParallelContext::set_loss_repeated_mean(bool loss_repeated_mean) { loss_rep
 
 void ParallelContext::set_pipeline_stage_split_num(const int64_t stage_num) { pipeline_stage_split_num_ = stage_num; }
 
+void ParallelContext::set_pipeline_interleave_num(const int64_t interleave_num) {
+  pipeline_interleave_num_ = interleave_num;
+}
+
 bool ParallelContext::set_parallel_mode(const std::string &parallel_mode) {
   auto iter = std::find(kParallelModeList.begin(), kParallelModeList.end(), parallel_mode);
   if (iter == kParallelModeList.end()) {
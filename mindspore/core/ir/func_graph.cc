@@ -49,7 +49,11 @@ FuncGraph::FuncGraph(GraphDebugInfoPtr &&debug_info)
       stub_(false),
       switch_input_(std::make_shared<bool>(false)),
       switch_layer_input_(std::make_shared<bool>(false)),
-      stage_(-1) {}
+      stage_(-1) {
+  if (NodeArena::Enabled()) {
+    node_arena_.Enable();
+  }
+}
 
 void FuncGraph::DoBreakLoop() {
   if (attached_mng_cnt() > 0) {
@@ -91,14 +95,14 @@ const std::vector<AnfNodePtr> FuncGraph::get_inputs() const {
 
 ParameterPtr FuncGraph::add_parameter() {
   FuncGraphPtr this_func_graph = shared_from_base<FuncGraph>();
-  ParameterPtr param = std::make_shared<Parameter>(this_func_graph);
+  ParameterPtr param = NewNode<Parameter>(this_func_graph);
   add_parameter(param);
   return param;
 }
 
 ParameterPtr FuncGraph::add_parameter(NodeDebugInfoPtr &&debug_info) {
   FuncGraphPtr this_func_graph = shared_from_base<FuncGraph>();
-  ParameterPtr param = std::make_shared<Parameter>(this_func_graph, std::move(debug_info));
+  ParameterPtr param = NewNode<Parameter>(this_func_graph, std::move(debug_info));
   add_parameter(param);
   return param;
 }
@@ -113,7 +117,7 @@ void FuncGraph::add_parameter(const ParameterPtr &param) {
 
 ParameterPtr FuncGraph::InsertFrontParameter() {
   FuncGraphPtr this_func_graph = shared_from_base<FuncGraph>();
-  ParameterPtr param = std::make_shared<Parameter>(this_func_graph);
+  ParameterPtr param = NewNode<Parameter>(this_func_graph);
   InsertFrontParameter(param);
   return param;
 }
@@ -128,7 +132,7 @@ void FuncGraph::InsertFrontParameter(const ParameterPtr &param) {
 
 ParameterPtr FuncGraph::AddFvParameter(const std::string &name, const ValuePtr &default_value) {
   FuncGraphPtr this_graph = shared_from_base<FuncGraph>();
-  ParameterPtr param = std::make_shared<Parameter>(this_graph);
+  ParameterPtr param = NewNode<Parameter>(this_graph);
   param->set_name(name);
   param->debug_info()->set_name(name);
   MS_EXCEPTION_IF_NULL(default_value);
@@ -166,11 +170,11 @@ ValuePtr FuncGraph::get_attr(const std::string &key) const {
 }
 
 CNodePtr FuncGraph::NewCNode(std::vector<AnfNodePtr> &&inputs) {
-  return std::make_shared<CNode>(std::move(inputs), shared_from_base<FuncGraph>());
+  return NewNode<CNode>(std::move(inputs), shared_from_base<FuncGraph>());
 }
 
 CNodePtr FuncGraph::NewCNode(const std::vector<AnfNodePtr> &inputs) {
-  return std::make_shared<CNode>(inputs, shared_from_base<FuncGraph>());
+  return NewNode<CNode>(inputs, shared_from_base<FuncGraph>());
 }
 
 CNodePtr FuncGraph::NewCNodeInOrder(std::vector<AnfNodePtr> &&inputs) {
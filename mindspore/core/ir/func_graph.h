@@ -39,6 +39,7 @@
 #include "ir/manager.h"
 #include "ir/func_graph_transform.h"
 #include "ir/func_graph_base.h"
+#include "ir/node_arena.h"
 #include "abstract/abstract_value.h"
 
 namespace mindspore {
@@ -377,6 +378,15 @@ class MS_CORE_API FuncGraph : public FuncGraphBase, public EffectInfoHolder {
   void set_python_obj(const ValuePtr &python_obj) { python_obj_ = python_obj; }
   ValuePtr python_obj() { return python_obj_; }
 
+  // Arena the nodes of this graph are allocated from, nullptr if nodes are allocated from the heap.
+  NodeArena *node_arena() const { return node_arena_.get(); }
+  void EnableNodeArena() { node_arena_.Enable(); }
+  // Create a node owned by this graph, from the node arena if there is one.
+  template <typename T, typename... Args>
+  std::shared_ptr<T> NewNode(Args &&... args) {
+    return NewNodeIn<T>(node_arena_.get(), std::forward<Args>(args)...);
+  }
+
  private:
   // Only used for func_graph manager to control resource free.
   int attached_mng_cnt() const { return attached_mng_cnt_; }
@@ -467,6 +477,8 @@ class MS_CORE_API FuncGraph : public FuncGraphBase, public EffectInfoHolder {
   bool is_tensor_condition_branch_ = false;
   // Corresponding python obj.
   ValuePtr python_obj_ = nullptr;
+  // Bulk storage of the nodes, see NodeArena.
+  OwnedNodeArena node_arena_;
 };
 
 inline CNodePtr NewCNode(const std::vector<AnfNodePtr> &inputs, const FuncGraphPtr &fg) {
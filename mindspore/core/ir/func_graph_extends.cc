@@ -106,7 +106,7 @@ void FuncGraph::GenerateVarParams(const FuncGraphPtr &specialized_graph, int var
   auto varg_name = specialized_graph->GetVariableArgName();
   // For python variable argument input, there is no upper limit.
   for (int i = 0; i < variable_args_count; ++i) {
-    ParameterPtr para = std::make_shared<Parameter>(specialized_graph);
+    ParameterPtr para = specialized_graph->NewNode<Parameter>(specialized_graph);
     std::string param_name = varg_name + std::to_string(i);
     para->set_name(param_name);
     MS_EXCEPTION_IF_NULL(para->debug_info());
@@ -137,7 +137,7 @@ void FuncGraph::GenerateKwParams(const FuncGraphPtr &specialized_graph,
       if (!has_kwarg()) {
         MS_LOG(EXCEPTION) << "Got unexpected keyword argument: " << kw_param_name;
       } else {
-        ParameterPtr para = std::make_shared<Parameter>(specialized_graph);
+        ParameterPtr para = specialized_graph->NewNode<Parameter>(specialized_graph);
         std::string param_name = specialized_graph->GetVariableKwargName() + "[" + kw_param_name + "]";
         MS_EXCEPTION_IF_NULL(specialized_parameter_list);
         auto find_kw_arg_in_list = std::any_of(specialized_parameter_list->begin(), specialized_parameter_list->end(),
@@ -696,7 +696,9 @@ void FuncGraphManager::OnEdgeAdded(const AnfNodePtr &node, int index, const AnfN
       auto used = GetValueNode<FuncGraphPtr>(input);
       used->AddFuncGraphCNodeIndex(std::make_shared<CNodeIndexPair>(std::make_pair(node, index)));
       if (fg->AddFuncGraphUsed(used)) {
-        signals_->InvalidateComputer();
+        bool parents_kept = func_graph_parents_total_->HasValidResult(used) &&
+                            IsKnownParents(fg, func_graph_parents_total_->func_graph_parents_total_analysis()[used]);
+        InvalidateComputers(fg, !parents_kept);
       }
     }
     if (IsPrimitiveCNode(node, prim::kPrimJ) || IsPrimitiveCNode(node, prim::kPrimVmap) ||
@@ -705,7 +707,11 @@ void FuncGraphManager::OnEdgeAdded(const AnfNodePtr &node, int index, const AnfN
     }
   } else if (fg != nullptr && fg != input->func_graph()) {
     if (fg->AddFreeVariable(input)) {
-      signals_->InvalidateComputer();
+      FuncGraphSet fv_graphs;
+      if (input->func_graph() != nullptr) {
+        fv_graphs.add(input->func_graph());
+      }
+      InvalidateComputers(fg, !IsKnownParents(fg, fv_graphs));
     }
   }
 }
@@ -718,7 +724,7 @@ void FuncGraphManager::OnEdgeRemoved(const AnfNodePtr &node, int index, const An
       auto used = GetValueNode<FuncGraphPtr>(input);
       used->DropFuncGraphCNodeIndex(std::make_shared<CNodeIndexPair>(std::make_pair(node, index)));
       if (fg->DropFuncGraphUsed(used)) {
-        signals_->InvalidateComputer();
+        InvalidateComputers(fg, true);
       }
     }
     if (IsPrimitiveCNode(node, prim::kPrimJ) || IsPrimitiveCNode(node, prim::kPrimVmap) ||
@@ -727,11 +733,62 @@ void FuncGraphManager::OnEdgeRemoved(const AnfNodePtr &node, int index, const An
     }
   } else if (fg != nullptr && fg != input->func_graph()) {
     if (fg->DropFreeVariable(input)) {
-      signals_->InvalidateComputer();
+      InvalidateComputers(fg, true);
     }
   }
 }
 
+FuncGraphSet FuncGraphManager::CallersTotal(const FuncGraphPtr &fg) const {
+  FuncGraphSet callers;
+  callers.add(fg);
+  std::vector<FuncGraphPtr> todo = {fg};
+  while (!todo.empty()) {
+    auto cur = todo.back();
+    todo.pop_back();
+    for (auto &item : cur->func_graph_cnodes_index()) {
+      auto caller = item.first->first->func_graph();
+      if (caller != nullptr && !callers.contains(caller)) {
+        callers.add(caller);
+        todo.push_back(caller);
+      }
+    }
+  }
+  return callers;
+}
+
+bool FuncGraphManager::IsKnownParents(const FuncGraphPtr &fg, const FuncGraphSet &parents) const {
+  if (!func_graph_parents_total_->HasValidResult(fg)) {
+    return false;
+  }
+  const auto &fg_parents = func_graph_parents_total_->func_graph_parents_total_analysis()[fg];
+  return std::all_of(parents.begin(), parents.end(), [&fg, &fg_parents](const FuncGraphPtr &parent) {
+    return parent == fg || fg_parents.contains(parent);
+  });
+}
+
+void FuncGraphManager::InvalidateComputers(const FuncGraphPtr &fg, bool parents_changed) {
+  // The per graph results of a graph only depend on the graphs it reaches, so only the callers of fg are affected.
+  // The parent relations are global, they are fully reset if the parents of fg may be changed.
+  auto callers = CallersTotal(fg);
+  if (callers.size() * 2 > func_graphs_.size()) {
+    signals_->InvalidateComputer();
+    return;
+  }
+  func_graphs_used_total_->Reset(callers);
+  recursive_->Reset(callers);
+  meta_fg_prim_total_->Reset(callers);
+  free_variables_total_->Reset();
+  if (parents_changed) {
+    func_graph_parents_total_->Reset(callers);
+    func_graph_parent_->Reset();
+    children_->Reset();
+    scopes_->Reset();
+  } else {
+    children_->Reset(callers);
+    scopes_->Reset(callers);
+  }
+}
+
 void FuncGraphManager::MoveAllNodes(const FuncGraphPtr &source, const FuncGraphPtr &target) {
   target->CopyNodes(source);
   target->CopyValueNodes(source);
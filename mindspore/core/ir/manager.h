@@ -94,6 +94,14 @@ class DepComputer {
     func_graphs_validate_.clear();
   }
 
+  // Reset the results of the given graphs only, used when the relations of other graphs are known to be kept.
+  void Reset(const FuncGraphSet &func_graphs) {
+    for (auto &fg : func_graphs) {
+      ExtraReset(fg);
+      (void)func_graphs_validate_.erase(fg);
+    }
+  }
+
   void OnInvalidateComputer() { Reset(); }
 
   void Recompute();
@@ -104,9 +112,17 @@ class DepComputer {
 
   bool IsValidate(const FuncGraphPtr &fg) { return func_graphs_validate_[fg]; }
 
+  // Check the result of the graph is computed, without adding it.
+  bool HasValidResult(const FuncGraphPtr &fg) const {
+    auto iter = func_graphs_validate_.find(fg);
+    return iter != func_graphs_validate_.end() && iter->second;
+  }
+
  protected:
   // subclass can reset their own member;
   virtual void ExtraReset() {}
+  // subclass with per graph results reset the result of one graph;
+  virtual void ExtraReset(const FuncGraphPtr &) {}
   // subclass do the real compute
   virtual void RealRecompute() {}
   virtual void RealRecompute(FuncGraphPtr) {}
@@ -133,6 +149,7 @@ class FuncGraphParentsTotalComputer final : public DepComputer {
 
  protected:
   void ExtraReset() override { func_graph_parents_total_analysis_.clear(); }
+  void ExtraReset(const FuncGraphPtr &fg) override { (void)func_graph_parents_total_analysis_.erase(fg); }
 
   void RealRecompute(FuncGraphPtr fg) override;
 
@@ -174,6 +191,7 @@ class ChildrenComputer final : public DepComputer {
 
  protected:
   void ExtraReset() override { children_analysis_.clear(); }
+  void ExtraReset(const FuncGraphPtr &fg) override { (void)children_analysis_.erase(fg); }
 
   void RealRecompute(FuncGraphPtr fg) override;
 };
@@ -192,6 +210,7 @@ class ScopeComputer final : public DepComputer {
 
  protected:
   void ExtraReset() override { scope_analysis_.clear(); }
+  void ExtraReset(const FuncGraphPtr &fg) override { (void)scope_analysis_.erase(fg); }
 
   void RealRecompute(FuncGraphPtr fg) override;
 };
@@ -228,6 +247,7 @@ class FuncGraphsUsedTotalComputer final : public DepComputer {
 
  protected:
   void ExtraReset() override { func_graph_used_total_analysis_.clear(); }
+  void ExtraReset(const FuncGraphPtr &fg) override { (void)func_graph_used_total_analysis_.erase(fg); }
 
   void RealRecompute(FuncGraphPtr fg) override;
 };
@@ -255,6 +275,10 @@ class RecursiveComputer final : public DepComputer {
     recursive_analysis_.clear();
     recursive_map_.clear();
   }
+  void ExtraReset(const FuncGraphPtr &fg) override {
+    (void)recursive_analysis_.erase(fg);
+    (void)recursive_map_.erase(fg);
+  }
 
   void RealRecompute(FuncGraphPtr fg) override;
 };
@@ -272,6 +296,7 @@ class FuncGraphMetaFgPrimTotalComputer final : public DepComputer {
 
  protected:
   void ExtraReset() override { meta_fg_prim_total_analysis_.clear(); }
+  void ExtraReset(const FuncGraphPtr &fg) override { (void)meta_fg_prim_total_analysis_.erase(fg); }
 
   void RealRecompute(FuncGraphPtr fg) override;
 
@@ -358,6 +383,12 @@ class MS_CORE_API FuncGraphManager : public std::enable_shared_from_this<FuncGra
   void OnEdgeAdded(const AnfNodePtr &node, int index, const AnfNodePtr &input);
   void OnEdgeRemoved(const AnfNodePtr &node, int index, const AnfNodePtr &input);
   void MoveAllNodes(const FuncGraphPtr &source, const FuncGraphPtr &target);
+  // Collect fg and all the graphs using fg directly or indirectly.
+  FuncGraphSet CallersTotal(const FuncGraphPtr &fg) const;
+  // Check the parents of fg are known to contain all the given parents, using the computed results only.
+  bool IsKnownParents(const FuncGraphPtr &fg, const FuncGraphSet &parents) const;
+  // Invalidate the dependency computers after the func graphs used or free variables of fg changed.
+  void InvalidateComputers(const FuncGraphPtr &fg, bool parents_changed);
 
   FuncGraphSet roots_;        // Managed roots.
   FuncGraphSet func_graphs_;  // Managed func graphs.
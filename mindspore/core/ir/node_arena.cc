@@ -0,0 +1,106 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ir/node_arena.h"
+
+#include <cstdint>
+#include <new>
+
+#include "utils/ms_utils.h"
+
+namespace mindspore {
+namespace {
+// Chunks are aligned to their size, so a block finds its chunk by masking its address.
+constexpr size_t kNodeArenaChunkSize = 16 * 1024;
+constexpr size_t kNodeArenaAlignment = alignof(std::max_align_t);
+
+std::atomic<size_t> live_chunks{0};
+
+size_t AlignSize(size_t size) { return (size + kNodeArenaAlignment - 1) / kNodeArenaAlignment * kNodeArenaAlignment; }
+}  // namespace
+
+struct NodeArena::Chunk {
+  // The live blocks, plus one while the chunk is the current chunk of its arena.
+  std::atomic<size_t> refs{1};
+};
+
+namespace {
+constexpr size_t kChunkHeaderSize = (sizeof(std::atomic<size_t>) + kNodeArenaAlignment - 1) / kNodeArenaAlignment *
+                                    kNodeArenaAlignment;
+// Larger blocks are allocated from the heap.
+constexpr size_t kMaxBlockSize = kNodeArenaChunkSize - kChunkHeaderSize;
+}  // namespace
+
+NodeArena::~NodeArena() {
+  if (cur_ != nullptr) {
+    Release(cur_);
+  }
+}
+
+bool NodeArena::Enabled() {
+  static const bool enabled = (common::GetEnv("MS_DEV_GRAPH_NODE_ARENA") == "1");
+  return enabled;
+}
+
+size_t NodeArena::LiveChunks() { return live_chunks.load(std::memory_order_relaxed); }
+
+void NodeArena::Release(Chunk *chunk) {
+  if (chunk->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    chunk->~Chunk();
+    ::operator delete(static_cast<void *>(chunk), std::align_val_t(kNodeArenaChunkSize));
+    (void)live_chunks.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+void *NodeArena::Allocate(size_t size) {
+  static_assert(sizeof(Chunk) <= kChunkHeaderSize);
+  size = AlignSize(size);
+  if (size > kMaxBlockSize) {
+    return ::operator new(size);
+  }
+  std::lock_guard<std::mutex> lock(lock_);
+  if (size > remain_) {
+    // The tail of the old chunk is dropped, it is at most one node.
+    auto memory = ::operator new(kNodeArenaChunkSize, std::align_val_t(kNodeArenaChunkSize));
+    auto chunk = new (memory) Chunk();
+    (void)live_chunks.fetch_add(1, std::memory_order_relaxed);
+    (void)allocated_bytes_.fetch_add(kNodeArenaChunkSize, std::memory_order_relaxed);
+    if (cur_ != nullptr) {
+      Release(cur_);
+    }
+    cur_ = chunk;
+    top_ = static_cast<char *>(memory) + kChunkHeaderSize;
+    remain_ = kMaxBlockSize;
+  }
+  (void)cur_->refs.fetch_add(1, std::memory_order_relaxed);
+  auto block = top_;
+  top_ += size;
+  remain_ -= size;
+  return block;
+}
+
+void NodeArena::Deallocate(void *ptr, size_t size) {
+  if (ptr == nullptr) {
+    return;
+  }
+  if (AlignSize(size) > kMaxBlockSize) {
+    ::operator delete(ptr);
+    return;
+  }
+  auto address = reinterpret_cast<uintptr_t>(ptr) & ~static_cast<uintptr_t>(kNodeArenaChunkSize - 1);
+  Release(reinterpret_cast<Chunk *>(address));
+}
+}  // namespace mindspore
@@ -0,0 +1,131 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_CORE_IR_NODE_ARENA_H_
+#define MINDSPORE_CORE_IR_NODE_ARENA_H_
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "utils/macros.h"
+
+namespace mindspore {
+/// \brief NodeArena is a chunked bump allocator for the nodes of a func graph.
+///
+/// Nodes are allocated together with their shared_ptr control blocks, so the public shared_ptr based API is kept.
+/// The arena is owned by its graph. Allocation takes a lock, as the evaluators of the static analysis may create the
+/// nodes of a shared graph on several threads. A chunk counts its live blocks and is released as soon as it is full
+/// or its arena is gone, and its last block is freed. Nodes may be freed on any thread and may outlive the
+/// arena, a surviving node keeps only its own chunk alive.
+class MS_CORE_API NodeArena {
+ public:
+  NodeArena() = default;
+  ~NodeArena();
+  NodeArena(const NodeArena &) = delete;
+  NodeArena &operator=(const NodeArena &) = delete;
+
+  /// \brief Whether func graphs allocate their nodes from an arena, set by environment MS_DEV_GRAPH_NODE_ARENA=1.
+  static bool Enabled();
+  /// \brief The number of chunks of all arenas not released yet.
+  static size_t LiveChunks();
+
+  void *Allocate(size_t size);
+  static void Deallocate(void *ptr, size_t size);
+
+  /// \brief The bytes of the chunks this arena has allocated.
+  size_t allocated_bytes() const { return allocated_bytes_.load(std::memory_order_relaxed); }
+
+ private:
+  struct Chunk;
+  static void Release(Chunk *chunk);
+
+  std::mutex lock_;
+  Chunk *cur_ = nullptr;
+  char *top_ = nullptr;
+  size_t remain_ = 0;
+  std::atomic<size_t> allocated_bytes_{0};
+};
+
+/// \brief The optional arena of a func graph. A copied graph gets a new arena of its own, the arena belongs to one
+/// graph and is not shared between graphs.
+class OwnedNodeArena {
+ public:
+  OwnedNodeArena() = default;
+  ~OwnedNodeArena() = default;
+  OwnedNodeArena(const OwnedNodeArena &other) : arena_(other.arena_ == nullptr ? nullptr : new NodeArena()) {}
+  OwnedNodeArena &operator=(const OwnedNodeArena &other) {
+    if (this != &other) {
+      arena_.reset(other.arena_ == nullptr ? nullptr : new NodeArena());
+    }
+    return *this;
+  }
+  OwnedNodeArena(OwnedNodeArena &&other) = default;
+  OwnedNodeArena &operator=(OwnedNodeArena &&other) = default;
+
+  NodeArena *get() const { return arena_.get(); }
+  void Enable() {
+    if (arena_ == nullptr) {
+      arena_ = std::make_unique<NodeArena>();
+    }
+  }
+
+ private:
+  std::unique_ptr<NodeArena> arena_;
+};
+
+/// \brief Standard allocator on top of NodeArena, used with std::allocate_shared. It only refers to the arena, the
+/// blocks are freed through their chunks, so a node does not keep the arena alive.
+template <typename T>
+class NodeArenaAllocator {
+ public:
+  using value_type = T;
+
+  explicit NodeArenaAllocator(NodeArena *arena) : arena_(arena) {}
+  template <typename U>
+  NodeArenaAllocator(const NodeArenaAllocator<U> &other) : arena_(other.arena()) {}  // NOLINT
+
+  T *allocate(size_t n) { return static_cast<T *>(arena_->Allocate(n * sizeof(T))); }
+  void deallocate(T *ptr, size_t n) { NodeArena::Deallocate(ptr, n * sizeof(T)); }
+
+  NodeArena *arena() const { return arena_; }
+
+  template <typename U>
+  bool operator==(const NodeArenaAllocator<U> &) const {
+    // Any allocator can free the blocks of any arena.
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const NodeArenaAllocator<U> &) const {
+    return false;
+  }
+
+ private:
+  NodeArena *arena_;
+};
+
+/// \brief Create a node from the arena if given, otherwise from the heap.
+template <typename T, typename... Args>
+std::shared_ptr<T> NewNodeIn(NodeArena *arena, Args &&... args) {
+  if (arena == nullptr) {
+    return std::make_shared<T>(std::forward<Args>(args)...);
+  }
+  return std::allocate_shared<T>(NodeArenaAllocator<T>(arena), std::forward<Args>(args)...);
+}
+}  // namespace mindspore
+#endif  // MINDSPORE_CORE_IR_NODE_ARENA_H_
@@ -16,10 +16,30 @@
  */
 
 #include "ops/attention.h"
+#include "ops/op_utils.h"
 #include "ops/primitive_c.h"
 #include "mindapi/src/helper.h"
 
 namespace mindspore::ops {
+void Attention::Init(const int64_t head_num, const bool causal) {
+  this->set_head_num(head_num);
+  this->set_causal(causal);
+}
+
+void Attention::set_head_num(const int64_t head_num) { (void)this->AddAttr(kHeadNum, api::MakeValue(head_num)); }
+
+void Attention::set_causal(const bool causal) { (void)this->AddAttr(kCausal, api::MakeValue(causal)); }
+
+int64_t Attention::get_head_num() const {
+  auto value_ptr = GetAttr(kHeadNum);
+  return GetValue<int64_t>(value_ptr);
+}
+
+bool Attention::get_causal() const {
+  auto value_ptr = GetAttr(kCausal);
+  return GetValue<bool>(value_ptr);
+}
+
 MIND_API_OPERATOR_IMPL(Attention, BaseOperator);
 REGISTER_PRIMITIVE_C(kNameAttention, Attention);
 }  // namespace mindspore::ops
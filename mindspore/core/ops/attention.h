@@ -37,7 +37,22 @@ class MIND_API Attention : public BaseOperator {
       {"output"});
   }
   /// \brief Initialize Attention op.
-  void Init() const {}
+  ///
+  /// \param[in] head_num Define the number of the heads, the hidden size of q, k and v is split into head_num heads.
+  /// \param[in] causal Define whether a query row only attends to the key rows up to its own position.
+  void Init(const int64_t head_num = 1, const bool causal = false);
+  /// \brief Set head_num.
+  void set_head_num(const int64_t head_num);
+  /// \brief Set causal.
+  void set_causal(const bool causal);
+  /// \brief Get head_num.
+  ///
+  /// \return head_num.
+  int64_t get_head_num() const;
+  /// \brief Get causal.
+  ///
+  /// \return causal.
+  bool get_causal() const;
 };
 }  // namespace ops
 }  // namespace mindspore
@@ -99,6 +99,8 @@ constexpr auto kGroups = "groups";
 constexpr auto kDeformableGroups = "deformable_groups";
 constexpr auto kHasBias = "has_bias";
 constexpr auto kAttentionHasMask = "attention_has_mask";
+constexpr auto kHeadNum = "head_num";
+constexpr auto kCausal = "causal";
 constexpr auto kHiddenSize = "hidden_size";
 constexpr auto kId = "id";
 constexpr auto kImageSizeH = "image_size_h";
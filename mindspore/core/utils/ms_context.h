@@ -107,6 +107,7 @@ enum MsCtxParam : unsigned {
   MS_CTX_TYPE_FLOAT_BEGIN = MS_CTX_TYPE_UINT32_END,
   MS_CTX_MAX_DEVICE_MEMORY = MS_CTX_TYPE_FLOAT_BEGIN,
   MS_CTX_MEMPOOL_BLOCK_SIZE,
+  MS_CTX_RECOMPUTE_MEMORY_BUDGET,
   MS_CTX_TYPE_FLOAT_END,
 
   // parameter of type string
@@ -35,6 +35,7 @@ set(IR_HEADER
         ${CORE_DIR}/ir/manager.h
         ${CORE_DIR}/ir/meta_tensor.h
         ${CORE_DIR}/ir/named.h
+        ${CORE_DIR}/ir/node_arena.h
         ${CORE_DIR}/ir/param_info.h
         ${CORE_DIR}/ir/primal_attr.h
         ${CORE_DIR}/ir/primal_debug_info.h
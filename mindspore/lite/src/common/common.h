@@ -68,6 +68,34 @@ static const char *const kMSCacheSerializePath = "serialize_path";
 // weight path
 static const char *const kWeight = "weight";
 static const char *const kWeightPath = "weight_path";
+static const char *const kMmapModel = "mmap_model";
+static const char *const kBf16Weight = "bf16_weight";
+static const char *const kShareWeight = "share_weight";
+static const char *const kSharedWeightFiles = "shared_weight_files";
+// operator level parallel
+static const char *const kOperatorParallel = "operator_parallel";
+static const char *const kMaxBranchNum = "max_branch_num";
+// thread cost calibration
+static const char *const kThreadCost = "thread_cost";
+static const char *const kCalibrationFile = "calibration_file";
+static const char *const kCalibrationWarmupNum = "warmup_num";
+// static memory plan of the runtime allocator, on by default on arm64
+static const char *const kMemoryPlan = "memory_plan";
+static const char *const kStaticMemoryPlan = "static_plan";
+// per layer kernel algorithm tuning
+static const char *const kKernelTuning = "kernel_tuning";
+static const char *const kTuningFile = "tuning_file";
+static const char *const kTuneMode = "tune";
+static const char *const kTuneRunNum = "run_num";
+// attention kv-cache for incremental decoding
+static const char *const kAttention = "attention";
+static const char *const kKVCacheSize = "kv_cache_size";
+// a new value starts a new sequence in the kv-cache
+static const char *const kKVCacheSequence = "kv_cache_sequence";
+// forward activations recomputed in backward by the train session
+static const char *const kRecompute = "recompute";
+static const char *const kRecomputeNodes = "nodes";
+static const char *const kAutoRecompute = "auto";
 
 static const char *const kIsOptimized = "isOptimized";
 }  // namespace lite
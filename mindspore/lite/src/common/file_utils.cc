@@ -23,6 +23,7 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <dirent.h>
+#include <sys/mman.h>
 #endif
 
 #include <cstdlib>
@@ -187,6 +188,48 @@ char *ReadFile(const char *file, size_t *size) {
   return buf;
 }
 
+char *ReadFileByMmap(const std::string &file, size_t *size) {
+  MS_ASSERT(size != nullptr);
+#ifdef _WIN32
+  MS_LOG(INFO) << "mmap is not supported on windows, file: " << file;
+  return nullptr;
+#else
+  std::string real_path = RealPath(file.c_str());
+  if (real_path.empty()) {
+    MS_LOG(DEBUG) << "File path not regular: " << file;
+    return nullptr;
+  }
+  auto fd = open(real_path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    MS_LOG(ERROR) << "Open file " << real_path << " failed.";
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 || file_stat.st_size <= 0) {
+    MS_LOG(ERROR) << "Get size of file " << real_path << " failed.";
+    (void)close(fd);
+    return nullptr;
+  }
+  *size = static_cast<size_t>(file_stat.st_size);
+  auto buf = mmap(nullptr, *size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  // the mapping keeps its own reference to the file
+  (void)close(fd);
+  if (buf == MAP_FAILED) {
+    MS_LOG(ERROR) << "mmap file " << real_path << " failed.";
+    return nullptr;
+  }
+  return static_cast<char *>(buf);
+#endif
+}
+
+void UnmapMmapBuffer(void *buffer, size_t size) {
+#ifndef _WIN32
+  if (buffer != nullptr && munmap(buffer, size) != 0) {
+    MS_LOG(ERROR) << "munmap model buffer failed.";
+  }
+#endif
+}
+
 std::string RealPath(const char *path) {
   if (path == nullptr) {
     MS_LOG(ERROR) << "path is nullptr";
@@ -51,6 +51,12 @@ char *ReadFileSegment(const std::string &file, int64_t offset, int64_t len);
 
 char *ReadFile(const char *file, size_t *size);
 
+// Map the file as a private writable mapping. Clean pages are shared with every other mapping of the file through the
+// page cache, a write only copies the touched page. Returns nullptr if mmap is not supported.
+char *ReadFileByMmap(const std::string &file, size_t *size);
+
+void UnmapMmapBuffer(void *buffer, size_t size);
+
 std::string RealPath(const char *path);
 
 int CreateOutputDir(std::string *file_path);
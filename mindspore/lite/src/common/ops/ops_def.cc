@@ -389,6 +389,8 @@ OP_ATTR(axis, long)
 OP_SCHEMA_DEF_END(Concat)
 
 OP_SCHEMA_DEF(Attention)
+OP_ATTR(head_num, long)
+OP_ATTR_WITH_VALUE(causal, bool, false)
 OP_SCHEMA_DEF_END(Attention)
 
 OP_SCHEMA_DEF(Conv2DBackpropFilterFusion)
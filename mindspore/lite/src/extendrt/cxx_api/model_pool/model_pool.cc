@@ -106,6 +106,21 @@ int GetDefaultThreadNum() {
     return kDefaultThreadsNum;
   }
 }
+
+// The model file is only mapped when the "weight" section of the config sets "mmap_model" to "true", the same switch
+// as the lite session, otherwise it is read onto the heap.
+bool IsMmapModel(const std::shared_ptr<RunnerConfig> &runner_config) {
+  if (runner_config == nullptr) {
+    return false;
+  }
+  auto config_info = runner_config->GetConfigInfo();
+  auto weight = config_info.find(lite::kWeight);
+  if (weight == config_info.end()) {
+    return false;
+  }
+  auto mmap_iter = weight->second.find(lite::kMmapModel);
+  return mmap_iter != weight->second.end() && mmap_iter->second == "true";
+}
 }  // namespace
 
 Status ModelPool::DistinguishPhysicalAndLogicalByNuma(const std::vector<int> &physical_core_list,
@@ -751,7 +766,9 @@ Status ModelPool::CreateWorkers(const char *graph_buf, size_t size, const ModelP
   for (size_t i = 0; i < model_pool_info_[strategy].all_workers_num_; i++) {
     model_pool_config[i]->strategy = strategy;
     int numa_node_id = model_pool_config[i]->numa_id;
-    auto ret = lite::PackWeightManager::GetInstance()->InitPackWeight(graph_buf, size, numa_node_id);
+    // the workers not bound to a numa node use the mapped model file in place, the others copy it to their node.
+    bool copy_buf = graph_buf != mmap_model_buf_ || numa_node_id >= 0;
+    auto ret = lite::PackWeightManager::GetInstance()->InitPackWeight(graph_buf, size, numa_node_id, copy_buf);
     MS_CHECK_FALSE_MSG(ret != kSuccess, kLiteError, "InitWeightManagerByBuf failed.");
     auto new_model_buf = lite::PackWeightManager::GetInstance()->GetNumaModelBuf(graph_buf, numa_node_id);
     MS_CHECK_TRUE_MSG(new_model_buf != nullptr, kLiteError, "get model buf is nullptr from PackWeightManager");
@@ -887,6 +904,14 @@ Status ModelPool::InitAdvancedStrategy(const char *model_buf, size_t size, int b
   if (size == 0) {
     return kLiteError;
   }
+  if (model_buf == mmap_model_buf_) {
+    status = CreateModelPoolWorker(model_buf, size, model_pool_config, ADVANCED);
+    if (status != kSuccess) {
+      MS_LOG(ERROR) << "CreateModelPoolWorker failed in InitAdvancedStrategy";
+      return kLiteError;
+    }
+    return kSuccess;
+  }
   void *copy_buf = malloc(size);
   if (copy_buf == nullptr) {
     return kLiteNullptr;
@@ -949,22 +974,31 @@ Status ModelPool::InitByBuf(const char *model_data, size_t size, const std::shar
 
 Status ModelPool::InitByPath(const std::string &model_path, const std::shared_ptr<RunnerConfig> &runner_config) {
   size_t size = 0;
-  auto model_buf = lite::ReadFile(model_path.c_str(), &size);
+  char *model_buf = nullptr;
+  if (IsMmapModel(runner_config)) {
+    // the mapped model file is kept for the workers to use in place, it is unmapped with the model pool.
+    model_buf = lite::ReadFileByMmap(model_path, &size);
+    if (model_buf != nullptr) {
+      mmap_model_buf_ = model_buf;
+      mmap_model_size_ = size;
+    }
+  }
+  if (model_buf == nullptr) {
+    model_buf = lite::ReadFile(model_path.c_str(), &size);
+  }
   if (model_buf == nullptr) {
     MS_LOG(ERROR) << "read ms model failed, model path: " << model_path;
     return kLiteNullptr;
   }
   auto status = Init(model_buf, size, runner_config);
+  if (model_buf != mmap_model_buf_) {
+    delete[] model_buf;
+  }
+  model_buf = nullptr;
   if (status != kSuccess) {
     MS_LOG(ERROR) << "init failed.";
-    delete[] model_buf;
-    model_buf = nullptr;
     return kLiteError;
   }
-  if (model_buf != nullptr) {
-    delete[] model_buf;
-    model_buf = nullptr;
-  }
   return kSuccess;
 }
 
@@ -1090,6 +1124,16 @@ Status ModelPool::Predict(const std::vector<MSTensor> &inputs, std::vector<MSTen
   return kSuccess;
 }
 
+size_t ModelPool::GetMaxMergedBatch() {
+  size_t max_merged_batch = 0;
+  for (auto &item : all_workers_) {
+    for (auto &worker_info : item.second) {
+      max_merged_batch = std::max(max_merged_batch, worker_info->worker->max_merged_batch());
+    }
+  }
+  return max_merged_batch;
+}
+
 ModelPool::~ModelPool() {
   for (auto &item : model_pool_info_) {
     auto strategy = item.first;
@@ -1106,5 +1150,12 @@ ModelPool::~ModelPool() {
       th.join();
     }
   }
+  if (mmap_model_buf_ != nullptr) {
+    // the models of the workers refer to the mapped model file.
+    all_workers_.clear();
+    lite::PackWeightManager::GetInstance()->FreeModelBuf(mmap_model_buf_);
+    lite::UnmapMmapBuffer(mmap_model_buf_, mmap_model_size_);
+    mmap_model_buf_ = nullptr;
+  }
 }
 }  // namespace mindspore
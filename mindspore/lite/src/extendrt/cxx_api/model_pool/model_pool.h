@@ -70,6 +70,9 @@ class ModelPool {
   Status Predict(const std::vector<MSTensor> &inputs, std::vector<MSTensor> *outputs,
                  const MSKernelCallBack &before = nullptr, const MSKernelCallBack &after = nullptr);
 
+  // the largest batch the workers have run by dynamic batching
+  size_t GetMaxMergedBatch();
+
  private:
   ModelPoolConfig CreateBaseStrategyModelPoolConfig(const std::shared_ptr<RunnerConfig> &runner_config,
                                                     Strategy strategy);
@@ -164,6 +167,10 @@ class ModelPool {
   // numa id -> core id
   std::vector<std::vector<int>> numa_physical_cores_;
   std::vector<std::vector<int>> numa_logical_cores_;
+
+  // the model file mapped by InitByPath
+  char *mmap_model_buf_ = nullptr;
+  size_t mmap_model_size_ = 0;
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_LITE_SRC_EXTENDRT_CXX_API_MODEL_POOL_MODEL_POOL_H_
@@ -14,11 +14,21 @@
  * limitations under the License.
  */
 #include "src/extendrt/cxx_api/model_pool/model_worker.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include "src/common/log_adapter.h"
 #include "src/extendrt/numa_adapter.h"
 #include "src/common/common.h"
+#include "src/common/utils.h"
 #include "nnacl/op_base.h"
 namespace mindspore {
+namespace {
+constexpr auto kDynamicBatchSection = "dynamic_batch";
+constexpr auto kMaxBatchSize = "max_batch_size";
+constexpr auto kMaxQueueDelayUs = "max_queue_delay_us";
+}  // namespace
+
 void ModelWorker::PrintWorkerInfo() {
   MS_LOG(ERROR) << "worker id: " << worker_config_->worker_id << " | strategy: " << worker_config_->strategy
                 << " | bind core mode: " << worker_config_->context->GetThreadAffinityMode()
@@ -80,21 +90,203 @@ void ModelWorker::Run() {
       continue;
     }
     available_ = false;
-    auto inputs = task->inputs;
-    auto *outputs = task->outputs;
-    auto before = task->before;
-    auto after = task->after;
-    auto status = Predict(*inputs, outputs, before, after);
-    if (status != kSuccess) {
-      PrintWorkerInfo();
-      MS_LOG(ERROR) << "model predict failed.";
-      task->ready = true;
-      predict_task_queue_->ActiveTask(task);
+    if (max_batch_size_ > 1) {
+      RunBatch(task);
+    } else {
+      RunTask(task);
+    }
+  }
+}
+
+void ModelWorker::RunTask(PredictTask *task) {
+  auto inputs = task->inputs;
+  auto *outputs = task->outputs;
+  auto before = task->before;
+  auto after = task->after;
+  auto status = Predict(*inputs, outputs, before, after);
+  if (status != kSuccess) {
+    PrintWorkerInfo();
+    MS_LOG(ERROR) << "model predict failed.";
+  }
+  task->ready = true;
+  predict_task_queue_->ActiveTask(task);
+}
+
+void ModelWorker::RunBatch(PredictTask *first_task) {
+  std::vector<PredictTask *> tasks = {first_task};
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(max_queue_delay_us_);
+  while (tasks.size() < max_batch_size_) {
+    auto task = predict_task_queue_->GetPredictTaskUntil(worker_config_->task_queue_id, deadline);
+    if (task == nullptr) {
+      break;
+    }
+    tasks.push_back(task);
+  }
+  // bucket the tasks by input shape, the tasks of a bucket differ only in the batch dimension
+  std::vector<std::vector<PredictTask *>> buckets;
+  for (auto task : tasks) {
+    bool merged = false;
+    if (CanMergeTask(task)) {
+      for (auto &bucket : buckets) {
+        if (CanMergeTask(bucket.front()) && IsSameBatchBucket(bucket.front(), task)) {
+          bucket.push_back(task);
+          merged = true;
+          break;
+        }
+      }
+    }
+    if (!merged) {
+      buckets.push_back({task});
+    }
+  }
+  for (auto &bucket : buckets) {
+    if (bucket.size() > 1 && PredictBatch(bucket) == kSuccess) {
+      for (auto task : bucket) {
+        task->ready = true;
+        predict_task_queue_->ActiveTask(task);
+      }
       continue;
     }
-    task->ready = true;
-    predict_task_queue_->ActiveTask(task);
+    // the tasks run one by one if they can not be merged, or the model does not support the merged batch
+    for (auto task : bucket) {
+      RunTask(task);
+    }
+  }
+}
+
+bool ModelWorker::CanMergeTask(const PredictTask *task) const {
+  if (task->before != nullptr || task->after != nullptr || task->inputs == nullptr || task->inputs->empty()) {
+    return false;
+  }
+  for (auto &output : *task->outputs) {
+    if (output.Data() != nullptr) {
+      // user set graph-output-tensor from outside
+      return false;
+    }
+  }
+  auto batch = task->inputs->front().Shape().empty() ? 0 : task->inputs->front().Shape().front();
+  for (auto &input : *task->inputs) {
+    if (input.Shape().empty() || input.Shape().front() != batch || batch <= 0 || input.Data() == nullptr) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ModelWorker::IsSameBatchBucket(const PredictTask *left, const PredictTask *right) const {
+  if (left->inputs->size() != right->inputs->size()) {
+    return false;
+  }
+  for (size_t i = 0; i < left->inputs->size(); i++) {
+    auto &left_input = left->inputs->at(i);
+    auto &right_input = right->inputs->at(i);
+    auto left_shape = left_input.Shape();
+    auto right_shape = right_input.Shape();
+    if (left_input.DataType() != right_input.DataType() || left_shape.size() != right_shape.size() ||
+        !std::equal(left_shape.begin() + 1, left_shape.end(), right_shape.begin() + 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+Status ModelWorker::PredictBatch(const std::vector<PredictTask *> &tasks) {
+  int64_t total_batch = 0;
+  for (auto task : tasks) {
+    total_batch += task->inputs->front().Shape().front();
+  }
+  // concat the inputs along the batch dimension
+  auto &first_inputs = *tasks.front()->inputs;
+  std::vector<MSTensor> batch_inputs;
+  for (size_t i = 0; i < first_inputs.size(); i++) {
+    auto shape = first_inputs[i].Shape();
+    shape[0] = total_batch;
+    size_t data_size = 0;
+    for (auto task : tasks) {
+      data_size += task->inputs->at(i).DataSize();
+    }
+    auto batch_tensor =
+      mindspore::MSTensor::CreateTensor(first_inputs[i].Name(), first_inputs[i].DataType(), shape, nullptr, data_size);
+    if (batch_tensor == nullptr) {
+      MS_LOG(ERROR) << "create batch input tensor failed.";
+      return kLiteNullptr;
+    }
+    batch_inputs.push_back(*batch_tensor);
+    delete batch_tensor;
+    auto dst = static_cast<uint8_t *>(batch_inputs.back().MutableData());
+    MS_CHECK_TRUE_MSG(dst != nullptr, kLiteNullptr, "batch input data is nullptr.");
+    size_t offset = 0;
+    for (auto task : tasks) {
+      auto &input = task->inputs->at(i);
+      (void)memcpy(dst + offset, input.Data().get(), input.DataSize());
+      offset += input.DataSize();
+    }
+  }
+  std::vector<MSTensor> batch_outputs;
+  auto status = Predict(batch_inputs, &batch_outputs);
+  if (status != kSuccess) {
+    MS_LOG(WARNING) << "predict merged batch of " << tasks.size() << " tasks failed, run the tasks one by one.";
+    return status;
+  }
+  for (auto &output : batch_outputs) {
+    if (output.Shape().empty() || output.Shape().front() != total_batch) {
+      MS_LOG(WARNING) << "output " << output.Name() << " is not batched along the first dimension, dynamic batch "
+                      << "is not supported by this model, run the tasks one by one.";
+      return kLiteNotSupport;
+    }
+  }
+  if (static_cast<size_t>(total_batch) > max_merged_batch_) {
+    max_merged_batch_ = static_cast<size_t>(total_batch);
+  }
+  // scatter the outputs back to the tasks
+  std::vector<size_t> offsets(batch_outputs.size(), 0);
+  for (auto task : tasks) {
+    auto batch = task->inputs->front().Shape().front();
+    task->outputs->clear();
+    for (size_t i = 0; i < batch_outputs.size(); i++) {
+      auto &output = batch_outputs[i];
+      auto shape = output.Shape();
+      shape[0] = batch;
+      auto data_size = output.DataSize() / static_cast<size_t>(total_batch) * static_cast<size_t>(batch);
+      auto src = static_cast<const uint8_t *>(output.Data().get()) + offsets[i];
+      auto task_output = mindspore::MSTensor::CreateTensor(output.Name(), output.DataType(), shape, src, data_size);
+      if (task_output == nullptr) {
+        MS_LOG(ERROR) << "create output tensor of merged batch failed.";
+        return kLiteNullptr;
+      }
+      task->outputs->push_back(*task_output);
+      delete task_output;
+      offsets[i] += data_size;
+    }
   }
+  return kSuccess;
+}
+
+Status ModelWorker::ParseDynamicBatchConfig() {
+  auto section = worker_config_->config_info.find(kDynamicBatchSection);
+  if (section == worker_config_->config_info.end()) {
+    return kSuccess;
+  }
+  auto &configs = section->second;
+  auto batch_iter = configs.find(kMaxBatchSize);
+  if (batch_iter != configs.end()) {
+    int max_batch_size = 0;
+    if (!lite::ConvertStrToInt(batch_iter->second, &max_batch_size) || max_batch_size <= 0) {
+      MS_LOG(ERROR) << kMaxBatchSize << " should be a positive integer, but got " << batch_iter->second;
+      return kLiteParamInvalid;
+    }
+    max_batch_size_ = static_cast<size_t>(max_batch_size);
+  }
+  auto delay_iter = configs.find(kMaxQueueDelayUs);
+  if (delay_iter != configs.end()) {
+    if (!lite::ConvertStrToInt(delay_iter->second, &max_queue_delay_us_) || max_queue_delay_us_ < 0) {
+      MS_LOG(ERROR) << kMaxQueueDelayUs << " should be a non-negative integer, but got " << delay_iter->second;
+      return kLiteParamInvalid;
+    }
+  }
+  MS_LOG(INFO) << "worker dynamic batch max batch size: " << max_batch_size_
+               << " | max queue delay us: " << max_queue_delay_us_;
+  return kSuccess;
 }
 
 Status ModelWorker::Init(const char *model_buf, size_t size) {
@@ -105,6 +297,11 @@ Status ModelWorker::Init(const char *model_buf, size_t size) {
     return kLiteNullptr;
   }
   mindspore::ModelType model_type = kMindIR;
+  auto ret = ParseDynamicBatchConfig();
+  if (ret != kSuccess) {
+    MS_LOG(ERROR) << "parse dynamic batch config failed.";
+    return ret;
+  }
   for (auto &section : worker_config_->config_info) {
     for (auto &config : section.second) {
       auto status = model_->UpdateConfig(section.first, std::make_pair(config.first, config.second));
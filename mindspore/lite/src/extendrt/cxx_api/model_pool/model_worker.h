@@ -28,6 +28,7 @@
 #include "src/extendrt/cxx_api/model_pool/predict_task_queue.h"
 namespace mindspore {
 class PredictTaskQueue;
+struct PredictTask;
 enum Strategy { BASE = 0, ADVANCED = 1 };
 
 struct WorkerConfig {
@@ -60,12 +61,28 @@ class ModelWorker {
 
   bool IsAvailable();
 
+  // the largest batch run by merging the queued tasks, 0 if no task has been merged
+  size_t max_merged_batch() const { return max_merged_batch_; }
+
   void CreateThreadWorker(const char *model_buf, size_t size, const std::shared_ptr<WorkerConfig> &worker_config,
                           const std::shared_ptr<PredictTaskQueue> &predict_task_queue, bool *create_success);
 
  private:
   void Run();
 
+  void RunTask(PredictTask *task);
+
+  // Dynamic batching: gather the queued tasks, merge the compatible ones along the batch dimension and run them once.
+  void RunBatch(PredictTask *first_task);
+
+  bool CanMergeTask(const PredictTask *task) const;
+
+  bool IsSameBatchBucket(const PredictTask *left, const PredictTask *right) const;
+
+  Status PredictBatch(const std::vector<PredictTask *> &tasks);
+
+  Status ParseDynamicBatchConfig();
+
   std::pair<std::vector<std::vector<int64_t>>, bool> GetModelResize(const std::vector<MSTensor> &model_inputs,
                                                                     const std::vector<MSTensor> &inputs);
 
@@ -86,6 +103,10 @@ class ModelWorker {
   // run
   std::mutex mtx_worker_;
   std::atomic_bool available_ = true;
+  // dynamic batch, disabled when the max batch size is 1
+  size_t max_batch_size_ = 1;
+  int max_queue_delay_us_ = 0;
+  std::atomic<size_t> max_merged_batch_ = 0;
 };
 }  // namespace mindspore
 #endif  // MINDSPORE_LITE_SRC_EXTENDRT_CXX_API_MODEL_POOL_MODEL_WORKER_H_
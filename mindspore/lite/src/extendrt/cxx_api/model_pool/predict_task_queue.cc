@@ -15,6 +15,7 @@
  */
 
 #include "src/extendrt/cxx_api/model_pool/predict_task_queue.h"
+#include <thread>
 #include "src/common/log_adapter.h"
 namespace mindspore {
 PredictTaskQueue::~PredictTaskQueue() {
@@ -85,11 +86,17 @@ void PredictTaskQueue::ActiveTask(PredictTask *task) { task->task_done_condition
 
 void PredictTaskQueue::PushPredictTask(PredictTask *task, int node_id) {
   idle_worker_num_[node_id] -= 1;
+  // The workers check the queue under mtx_predict_task_, push and notify under it as well, otherwise a worker may see
+  // an empty queue, miss the notification and sleep with a task queued.
+  std::unique_lock<std::mutex> task_lock(mtx_predict_task_);
 #ifdef USE_HQUEUE
   while (!predict_task_[node_id].Enqueue(task)) {
+    // the queue is full, let the workers take the lock and drain it
+    task_lock.unlock();
+    std::this_thread::yield();
+    task_lock.lock();
   }
 #else
-  std::unique_lock<std::mutex> task_lock(mtx_predict_task_);
   predict_task_[node_id].push(task);
 #endif
   task_push_cond_.notify_all();
@@ -114,4 +121,32 @@ PredictTask *PredictTaskQueue::GetPredictTask(int node_id, ModelWorker *worker)
   return predict_task;
 #endif
 }
+
+PredictTask *PredictTaskQueue::GetPredictTaskUntil(int node_id,
+                                                   const std::chrono::steady_clock::time_point &deadline) {
+  std::unique_lock<std::mutex> task_lock(mtx_predict_task_);
+#ifdef USE_HQUEUE
+  while (predict_task_[node_id].Empty() && (!predict_task_done_)) {
+    if (task_push_cond_.wait_until(task_lock, deadline) == std::cv_status::timeout) {
+      break;
+    }
+  }
+  if (predict_task_done_ || predict_task_[node_id].Empty()) {
+    return nullptr;
+  }
+  return predict_task_[node_id].Dequeue();
+#else
+  while (predict_task_[node_id].empty() && (!predict_task_done_)) {
+    if (task_push_cond_.wait_until(task_lock, deadline) == std::cv_status::timeout) {
+      break;
+    }
+  }
+  if (predict_task_done_ || predict_task_[node_id].empty()) {
+    return nullptr;
+  }
+  auto predict_task = predict_task_[node_id].front();
+  predict_task_[node_id].pop();
+  return predict_task;
+#endif
+}
 }  // namespace mindspore
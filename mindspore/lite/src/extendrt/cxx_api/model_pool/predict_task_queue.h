@@ -18,6 +18,7 @@
 
 #include <queue>
 #include <mutex>
+#include <chrono>
 #include <memory>
 #include <vector>
 #include <condition_variable>
@@ -51,6 +52,8 @@ class PredictTaskQueue {
   void PushPredictTask(PredictTask *task, int node_id);
   void WaitUntilPredictActive(PredictTask *task, int node_id);
   PredictTask *GetPredictTask(int node_id, ModelWorker *worker);
+  // Get a task without checking the worker, used to gather a dynamic batch. Returns nullptr at the deadline.
+  PredictTask *GetPredictTaskUntil(int node_id, const std::chrono::steady_clock::time_point &deadline);
   void ActiveTask(PredictTask *task);
   void ActiveTaskQueue() { task_push_cond_.notify_all(); }
   Status InitTaskQueue(size_t num, size_t max_queue_size);
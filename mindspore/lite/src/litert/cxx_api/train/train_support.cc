@@ -14,7 +14,9 @@
  * limitations under the License.
  */
 
+#include <map>
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <algorithm>
 #include "include/api/types.h"
@@ -40,8 +42,9 @@
 #include "src/train/static_allocator.h"
 
 namespace mindspore {
-std::shared_ptr<lite::LiteSession> CreateTrainSession(std::shared_ptr<Graph::GraphData> graph_data,
-                                                      std::shared_ptr<TrainCfg> cfg, lite::InnerContext *context) {
+std::shared_ptr<lite::LiteSession> CreateTrainSession(
+  std::shared_ptr<Graph::GraphData> graph_data, std::shared_ptr<TrainCfg> cfg, lite::InnerContext *context,
+  const std::map<std::string, std::map<std::string, std::string>> *config_info) {
   MS_CHECK_TRUE_MSG(graph_data != nullptr, nullptr, "graph data cannot be nullptr");
   bool is_train_session = graph_data->IsTrainModel();
   if (is_train_session) {
@@ -57,6 +60,7 @@ std::shared_ptr<lite::LiteSession> CreateTrainSession(std::shared_ptr<Graph::Gra
       return nullptr;
     }
     shared_session.reset(session);
+    session->SetConfigInfo(config_info);
 
     context->allocator = std::make_shared<StaticAllocator>();
     if (context->allocator == nullptr) {
@@ -0,0 +1,224 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/inter_op_executor.h"
+#include <algorithm>
+#include <unordered_map>
+#include "include/errorcode.h"
+#include "src/litert/inner_context.h"
+#include "src/litert/thread_cost_model.h"
+#include "nnacl/activation_parameter.h"
+#include "nnacl/arithmetic.h"
+
+namespace mindspore::lite {
+namespace {
+int InterOpRun(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+  auto executor = reinterpret_cast<InterOpExecutor *>(cdata);
+  return executor->RunBranch();
+}
+
+// The cost table of the thread cost model is keyed by the activation type as well for the kernels it tells apart.
+int32_t KernelCostType(const kernel::KernelExec *kernel) {
+  auto type = kernel->type();
+  auto op_parameter = kernel->op_parameter();
+  if (op_parameter == nullptr) {
+    return TC_PTYPE(type);
+  }
+  switch (type) {
+    case schema::PrimitiveType_Activation:
+      return TC_TYPE(type, reinterpret_cast<ActivationParameter *>(op_parameter)->type_);
+    case schema::PrimitiveType_AddFusion:
+    case schema::PrimitiveType_SubFusion:
+    case schema::PrimitiveType_MulFusion:
+    case schema::PrimitiveType_DivFusion:
+    case schema::PrimitiveType_RealDiv:
+      return TC_TYPE(type, reinterpret_cast<ArithmeticParameter *>(op_parameter)->activation_type_);
+    default:
+      return TC_PTYPE(type);
+  }
+}
+
+// The number of threads the kernel can use before the thread startup cost outweighs the work, by the thread cost
+// model. The shape is unknown before the first resize, the kernel is not capped then.
+int ProfitableThreadNum(const kernel::KernelExec *kernel, int thread_num) {
+  int64_t in_num = 0;
+  int64_t out_num = 0;
+  for (auto tensor : kernel->in_tensors()) {
+    in_num += MSMAX(tensor->ElementsNum(), 0);
+  }
+  for (auto tensor : kernel->out_tensors()) {
+    auto elements_num = tensor->ElementsNum();
+    if (elements_num < 0) {
+      return thread_num;
+    }
+    out_num += elements_num;
+  }
+  if (out_num == 0) {
+    return thread_num;
+  }
+  ThreadCostContext cost_context;
+  cost_context.total_unit_num_ = out_num;
+  cost_context.per_unit_load_num_ = MSMAX(1, in_num / out_num);
+  cost_context.per_unit_store_num_ = 1;
+  cost_context.per_unit_compute_cost_ = GetKernelComputeCost(KernelCostType(kernel), out_num);
+  return MSMIN(ThreadCostModel::ThreadNum(&cost_context), thread_num);
+}
+}  // namespace
+
+int InterOpExecutor::Prepare(const std::vector<kernel::KernelExec *> &kernels, const std::vector<Tensor *> &inputs,
+                             const std::vector<Tensor *> &outputs, lite::InnerContext *ctx) {
+  CHECK_NULL_RETURN(ctx);
+  RestoreThreads();
+  ctx_ = ctx;
+  kernels_ = kernels;
+  branch_num_ = 1;
+  levels_.clear();
+
+  std::unordered_map<const kernel::KernelExec *, size_t> indexes;
+  for (size_t i = 0; i < kernels_.size(); ++i) {
+    indexes[kernels_[i]] = i;
+  }
+  // depth is the longest path from a source node, the nodes of the same depth never depend on each other.
+  std::vector<int> depths(kernels_.size(), 0);
+  int max_depth = 0;
+  for (size_t i = 0; i < kernels_.size(); ++i) {
+    for (auto in_kernel : kernels_[i]->in_kernels()) {
+      auto iter = indexes.find(in_kernel);
+      if (iter == indexes.end()) {
+        continue;
+      }
+      auto pre = iter->second;
+      if (pre >= i) {
+        MS_LOG(INFO) << "Kernels of the subgraph are not in topological order, run them sequentially.";
+        return RET_OK;
+      }
+      depths[i] = std::max(depths[i], depths[pre] + 1);
+    }
+    max_depth = std::max(max_depth, depths[i]);
+  }
+  std::vector<int> widths(max_depth + 1, 0);
+  for (auto depth : depths) {
+    ++widths[depth];
+  }
+  levels_.resize(max_depth + 1);
+  for (size_t i = 0; i < kernels_.size(); ++i) {
+    levels_[depths[i]].push_back(i);
+  }
+  auto max_width = *std::max_element(widths.begin(), widths.end());
+  branch_num_ = std::min({max_width, max_branch_num_, ctx_->thread_num_});
+  if (branch_num_ < C2NUM) {
+    branch_num_ = 1;
+    return RET_OK;
+  }
+  SplitThreads(depths, widths);
+  MS_LOG(INFO) << "Run " << kernels_.size() << " kernels in " << branch_num_ << " branches at most.";
+  return RET_OK;
+}
+
+InterOpExecutor::~InterOpExecutor() { RestoreThreads(); }
+
+// The kernels of a depth run side by side, they share the threads. A kernel of a chain keeps all the threads.
+void InterOpExecutor::SplitThreads(const std::vector<int> &depths, const std::vector<int> &widths) {
+  split_kernels_.clear();
+  origin_thread_nums_.clear();
+  branch_thread_nums_.clear();
+  for (size_t i = 0; i < kernels_.size(); ++i) {
+    auto width = std::min(widths[depths[i]], branch_num_);
+    auto op_parameter = kernels_[i]->op_parameter();
+    if (width < C2NUM || op_parameter == nullptr) {
+      continue;
+    }
+    auto thread_budget = std::max(1, ctx_->thread_num_ / width);
+    split_kernels_.push_back(kernels_[i]);
+    origin_thread_nums_.push_back(op_parameter->thread_num_);
+    branch_thread_nums_.push_back(std::max(1, ProfitableThreadNum(kernels_[i], thread_budget)));
+  }
+  SetThreadNums(branch_thread_nums_);
+}
+
+void InterOpExecutor::SetThreadNums(const std::vector<int> &thread_nums) {
+  for (size_t i = 0; i < split_kernels_.size(); ++i) {
+    split_kernels_[i]->op_parameter()->thread_num_ = thread_nums[i];
+  }
+}
+
+// gives the kernels back the thread num they had before the split.
+void InterOpExecutor::RestoreThreads() {
+  SetThreadNums(origin_thread_nums_);
+  split_kernels_.clear();
+  origin_thread_nums_.clear();
+  branch_thread_nums_.clear();
+}
+
+int InterOpExecutor::Run(const std::vector<Tensor *> &in_tensors, const std::vector<Tensor *> &out_tensors,
+                         const std::vector<kernel::KernelExec *> &kernels, const KernelCallBack &before,
+                         const KernelCallBack &after) {
+  // the callbacks expect the kernels one by one in the execution order.
+  // The kernels run one by one then and get all the threads back for the Run.
+  if (branch_num_ < C2NUM || before != nullptr || after != nullptr) {
+    SetThreadNums(origin_thread_nums_);
+    int ret = RET_OK;
+    for (auto kernel : kernels) {
+      MS_ASSERT(kernel != nullptr);
+      ret = kernel->Execute(before, after);
+      if (ret != RET_OK) {
+        MS_LOG(ERROR) << "run kernel failed, name: " << kernel->name();
+        break;
+      }
+    }
+    SetThreadNums(branch_thread_nums_);
+    return ret;
+  }
+
+  for (auto &level : levels_) {
+    // a single kernel runs on the calling thread, its ParallelLaunch finds every worker of the pool idle
+    if (level.size() < C2NUM) {
+      for (auto index : level) {
+        auto ret = kernels_[index]->Execute();
+        if (ret != RET_OK) {
+          MS_LOG(ERROR) << "run kernel failed, name: " << kernels_[index]->name();
+          return ret;
+        }
+      }
+      continue;
+    }
+    running_level_ = &level;
+    next_node_ = 0;
+    status_ = RET_OK;
+    auto ret = ParallelLaunch(ctx_, InterOpRun, this, std::min(static_cast<int>(level.size()), branch_num_));
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "run inter-op branches failed: " << ret;
+      return status_ != RET_OK ? static_cast<int>(status_) : RET_ERROR;
+    }
+  }
+  return RET_OK;
+}
+
+// A branch takes the next kernel of the level until the level is done. It never waits for another branch, so the
+// worker is free for the nested ParallelLaunch of the other kernels as soon as the level has no kernel left for it.
+int InterOpExecutor::RunBranch() {
+  for (auto i = next_node_++; i < running_level_->size() && status_ == RET_OK; i = next_node_++) {
+    auto kernel = kernels_[running_level_->at(i)];
+    auto ret = kernel->Execute();
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "run kernel failed, name: " << kernel->name();
+      status_ = ret;
+      return ret;
+    }
+  }
+  return RET_OK;
+}
+}  // namespace mindspore::lite
@@ -0,0 +1,70 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_INTER_OP_EXECUTOR_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_INTER_OP_EXECUTOR_H_
+
+#include <atomic>
+#include <vector>
+#include "src/litert/executor.h"
+
+namespace mindspore::lite {
+// Runs the kernels of a cpu subgraph level by level instead of in one sequential chain. A level holds the kernels of
+// the same dependency depth, which never depend on each other. The kernel of a narrow level runs on the calling thread
+// and keeps the whole thread pool for its own ParallelLaunch; the kernels of a wide level are taken by up to
+// branch_num pool tasks, which never wait, so that the workers they leave free serve the nested launches of the
+// branches. The threads are split between the kernels of a wide level at Prepare, so Prepare must be called before
+// the kernels are prepared. The kernels get their own thread num back when the executor is destroyed or prepared
+// again.
+class InterOpExecutor : public Executor {
+ public:
+  explicit InterOpExecutor(int max_branch_num) : max_branch_num_(max_branch_num) {}
+  ~InterOpExecutor() override;
+
+  int Prepare(const std::vector<kernel::KernelExec *> &kernels, const std::vector<Tensor *> &inputs,
+              const std::vector<Tensor *> &outputs, lite::InnerContext *ctx) override;
+
+  int Run(const std::vector<Tensor *> &in_tensors, const std::vector<Tensor *> &out_tensors,
+          const std::vector<kernel::KernelExec *> &kernels, const KernelCallBack &before = nullptr,
+          const KernelCallBack &after = nullptr) override;
+
+  // 1 means the kernels form a single chain and are run sequentially.
+  int branch_num() const { return branch_num_; }
+
+  int RunBranch();
+
+ private:
+  void SplitThreads(const std::vector<int> &depths, const std::vector<int> &widths);
+  void SetThreadNums(const std::vector<int> &thread_nums);
+  void RestoreThreads();
+
+  int max_branch_num_ = 1;
+  int branch_num_ = 1;
+  std::vector<kernel::KernelExec *> kernels_;
+  // the indexes of the kernels of every depth
+  std::vector<std::vector<size_t>> levels_;
+  // kernels whose thread num is lowered to share the threads with the kernels of the same depth
+  std::vector<kernel::KernelExec *> split_kernels_;
+  std::vector<int> origin_thread_nums_;
+  std::vector<int> branch_thread_nums_;
+
+  // state of the wide level being run
+  const std::vector<size_t> *running_level_ = nullptr;
+  std::atomic_size_t next_node_ = {0};
+  std::atomic_int status_ = {RET_OK};
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_INTER_OP_EXECUTOR_H_
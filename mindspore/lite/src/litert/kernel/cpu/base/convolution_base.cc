@@ -179,6 +179,7 @@ int ConvolutionBaseCPUKernel::InitConvWeightBias() {
     }
     if (origin_weight_ != nullptr) {
       PackWeight();
+      lite::PackWeightManager::GetInstance()->PackDone(packed_weight_);
     } else {
       is_repack_ = true;
       MS_LOG(WARNING) << "The weight is nullptr, will pack in runtime.";
@@ -205,6 +206,9 @@ int ConvolutionBaseCPUKernel::RepackWeight() {
       is_repack_ = false;
     }
     PackWeight();
+    if (!op_parameter_->is_train_session_) {
+      lite::PackWeightManager::GetInstance()->PackDone(packed_weight_);
+    }
   }
   return RET_OK;
 }
@@ -15,6 +15,10 @@
  */
 
 #include "src/litert/kernel/cpu/fp32/convolution_delegate_fp32.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <sstream>
 #include "src/litert/kernel_registry.h"
 #include "src/litert/kernel/cpu/fp32/convolution_fp32.h"
 #include "src/litert/kernel/cpu/fp32/convolution_1x1_fp32.h"
@@ -48,6 +52,14 @@ using mindspore::schema::PrimitiveType_Conv2DFusion;
 namespace mindspore::kernel {
 namespace {
 constexpr int kMaxDwConvSWSize = 32;
+// the algorithms are recorded in the kernel tuning file, the values must not change.
+enum ConvFp32Algorithm : int {
+  kConvFp32Im2Col = 0,
+  kConvFp32Conv1x1 = 1,
+  kConvFp32Winograd = 2,
+  kConvFp32SW1x1 = 3,
+  kConvFp32SWAVX = 4,
+};
 }  // namespace
 
 float *ConvolutionDelegateCPUKernel::CopyData(const lite::Tensor *tensor) {
@@ -289,12 +301,184 @@ kernel::LiteKernel *ConvolutionDelegateCPUKernel::CpuConvFp32NHWCKernelSelect()
   return kernel;
 }
 
+std::string ConvolutionDelegateCPUKernel::TuningKey() const {
+  auto conv_param = reinterpret_cast<const ConvParameter *>(op_parameter_);
+  std::ostringstream key;
+  key << lite::KernelTuner::GetInstance()->host_identity() << "|" << name_ << "|" << conv_param->input_batch_ << "x"
+      << conv_param->input_h_ << "x" << conv_param->input_w_ << "x" << conv_param->input_channel_ << "|"
+      << conv_param->output_channel_ << "|k" << conv_param->kernel_h_ << "x" << conv_param->kernel_w_ << "|s"
+      << conv_param->stride_h_ << "x" << conv_param->stride_w_ << "|d" << conv_param->dilation_h_ << "x"
+      << conv_param->dilation_w_ << "|p" << conv_param->pad_u_ << "," << conv_param->pad_d_ << ","
+      << conv_param->pad_l_ << "," << conv_param->pad_r_ << "|t" << op_parameter_->thread_num_;
+  return key.str();
+}
+
+std::vector<lite::TunedAlgorithm> ConvolutionDelegateCPUKernel::ConvFp32Candidates() {
+  auto conv_param = reinterpret_cast<ConvParameter *>(op_parameter_);
+  std::vector<lite::TunedAlgorithm> candidates = {{kConvFp32Im2Col, 0}};
+  bool is_1x1 = conv_param->kernel_h_ == 1 && conv_param->kernel_w_ == 1;
+  if (is_1x1) {
+    candidates.push_back({kConvFp32Conv1x1, 0});
+  }
+  // every output unit winograd supports for the kernel size is a tile to time, not only the one of the cost model.
+  if (!is_1x1 && conv_param->kernel_h_ == conv_param->kernel_w_ && conv_param->dilation_h_ == 1 &&
+      conv_param->dilation_w_ == 1 && conv_param->stride_h_ == 1 && conv_param->stride_w_ == 1 &&
+      conv_param->input_channel_ != 1) {
+    for (int unit = C2NUM; unit < C8NUM; ++unit) {
+      if (CheckWinogradInputOutputUnit(unit + conv_param->kernel_w_ - 1, unit)) {
+        candidates.push_back({kConvFp32Winograd, unit});
+      }
+    }
+  }
+#ifdef ENABLE_AVX
+  if (CheckAvxUseSW1x1Conv(conv_param)) {
+    candidates.push_back({kConvFp32SW1x1, 0});
+  }
+  if (CheckAvxUseSWConv(conv_param)) {
+    candidates.push_back({kConvFp32SWAVX, 0});
+  }
+#endif
+  return candidates;
+}
+
+kernel::LiteKernel *ConvolutionDelegateCPUKernel::CreateConvFp32Kernel(const lite::TunedAlgorithm &algorithm) {
+  auto ctx = static_cast<const lite::InnerContext *>(this->ms_context_);
+  switch (algorithm.algorithm) {
+    case kConvFp32Im2Col:
+      return new (std::nothrow)
+        kernel::ConvolutionCPUKernel(op_parameter_, in_tensors_, out_tensors_, ctx, origin_weight_, origin_bias_);
+    case kConvFp32Conv1x1:
+      return new (std::nothrow)
+        kernel::Convolution1x1CPUKernel(op_parameter_, in_tensors_, out_tensors_, ctx, origin_weight_, origin_bias_);
+    case kConvFp32Winograd:
+      return new (std::nothrow) kernel::ConvolutionWinogradCPUKernel(op_parameter_, in_tensors_, out_tensors_, ctx,
+                                                                     algorithm.tile, origin_weight_, origin_bias_);
+#ifdef ENABLE_AVX
+    case kConvFp32SW1x1:
+      return CreateConv1x1MatmulKernel();
+    case kConvFp32SWAVX:
+      return new (std::nothrow)
+        kernel::ConvolutionSWAVXCPUKernel(op_parameter_, in_tensors_, out_tensors_, ctx, origin_weight_, origin_bias_);
+#endif
+    default:
+      MS_LOG(ERROR) << "Unsupported convolution algorithm " << algorithm.algorithm << " of " << name_;
+      return nullptr;
+  }
+}
+
+void ConvolutionDelegateCPUKernel::ReleaseConvFp32Kernel(kernel::LiteKernel *kernel) {
+  // the conv parameter stays with the delegate, the matmul parameter of the sliding window 1x1 goes with the kernel.
+  if (kernel->op_parameter() == op_parameter_) {
+    kernel->set_parameter(nullptr);
+  } else {
+    matmul_param_ = nullptr;
+  }
+  delete kernel;
+}
+
+int ConvolutionDelegateCPUKernel::TimeConvFp32Algorithm(const lite::TunedAlgorithm &algorithm, int run_num,
+                                                        int64_t *cost_ns) {
+  auto kernel = CreateConvFp32Kernel(algorithm);
+  CHECK_NULL_RETURN(kernel);
+  kernel->set_name("act_" + name_);
+  auto ret = kernel->Prepare();
+  if (ret == RET_OK) {
+    ret = kernel->ReSize();
+  }
+  // the first run packs the buffers initialized lazily, it is not timed.
+  if (ret == RET_OK) {
+    ret = kernel->Run();
+  }
+  *cost_ns = std::numeric_limits<int64_t>::max();
+  for (int i = 0; i < run_num && ret == RET_OK; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    ret = kernel->Run();
+    auto end = std::chrono::steady_clock::now();
+    *cost_ns = std::min<int64_t>(*cost_ns, std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  }
+  ReleaseConvFp32Kernel(kernel);
+  return ret;
+}
+
+int ConvolutionDelegateCPUKernel::TuneConvFp32Algorithm(const std::vector<lite::TunedAlgorithm> &candidates,
+                                                        lite::TunedAlgorithm *best) {
+  // the graph is not allocated yet, the candidates run on zeroed scratch data which is released after timing.
+  std::vector<lite::Tensor *> scratch_tensors;
+  int ret = RET_OK;
+  for (auto tensor : {in_tensors_.at(kInputIndex), out_tensors_.at(kOutputIndex)}) {
+    if (tensor->data() != nullptr) {
+      continue;
+    }
+    ret = tensor->MallocData();
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "Malloc the tuning data of " << name_ << " failed.";
+      break;
+    }
+    scratch_tensors.push_back(tensor);
+    (void)memset(tensor->data(), 0, tensor->Size());
+  }
+  auto run_num = lite::KernelTuner::GetInstance()->run_num();
+  int64_t best_cost_ns = std::numeric_limits<int64_t>::max();
+  for (size_t i = 0; i < candidates.size() && ret == RET_OK; ++i) {
+    int64_t cost_ns = 0;
+    if (TimeConvFp32Algorithm(candidates[i], run_num, &cost_ns) != RET_OK) {
+      MS_LOG(WARNING) << "Run convolution algorithm " << candidates[i].algorithm << " of " << name_ << " failed.";
+      continue;
+    }
+    MS_LOG(INFO) << "Convolution " << name_ << " algorithm " << candidates[i].algorithm << " tile "
+                 << candidates[i].tile << " costs " << cost_ns << " ns.";
+    if (cost_ns < best_cost_ns) {
+      best_cost_ns = cost_ns;
+      *best = candidates[i];
+    }
+  }
+  for (auto tensor : scratch_tensors) {
+    tensor->FreeData();
+  }
+  if (ret != RET_OK) {
+    return ret;
+  }
+  return best_cost_ns == std::numeric_limits<int64_t>::max() ? RET_ERROR : RET_OK;
+}
+
+kernel::LiteKernel *ConvolutionDelegateCPUKernel::CpuConvFp32TunedKernelSelect() {
+  auto tuner = lite::KernelTuner::GetInstance();
+  auto candidates = ConvFp32Candidates();
+  auto key = TuningKey();
+  lite::TunedAlgorithm algorithm;
+  if (tuner->GetAlgorithm(key, &algorithm)) {
+    // the file may come from another build or cpu, which lacks the algorithm.
+    if (std::find(candidates.begin(), candidates.end(), algorithm) != candidates.end()) {
+      return CreateConvFp32Kernel(algorithm);
+    }
+    MS_LOG(WARNING) << "Tuned convolution algorithm " << algorithm.algorithm << " of " << name_ << " is invalid.";
+  }
+  // a train session packs the weight into the workspace, which is not allocated before the graph.
+  if (!tuner->tune() || candidates.size() < C2NUM || op_parameter_->is_train_session_ || origin_weight_ == nullptr) {
+    return nullptr;
+  }
+  if (TuneConvFp32Algorithm(candidates, &algorithm) != RET_OK) {
+    MS_LOG(WARNING) << "Tune the convolution algorithm of " << name_ << " failed, select it by the heuristics.";
+    return nullptr;
+  }
+  MS_LOG(INFO) << "Tuned convolution " << name_ << " to algorithm " << algorithm.algorithm << " tile "
+               << algorithm.tile;
+  tuner->Record(key, algorithm);
+  return CreateConvFp32Kernel(algorithm);
+}
+
 kernel::LiteKernel *ConvolutionDelegateCPUKernel::CpuConvFp32KernelSelect() {
   kernel::LiteKernel *kernel = nullptr;
   if (out_tensors().front()->format() == NC4HW4) {
+    // not tuned, see CpuConvFp32TunedKernelSelect.
     kernel = CpuConvFp32NC4KernelSelect();
   } else {
-    kernel = CpuConvFp32NHWCKernelSelect();
+    if (lite::KernelTuner::GetInstance()->enabled()) {
+      kernel = CpuConvFp32TunedKernelSelect();
+    }
+    if (kernel == nullptr) {
+      kernel = CpuConvFp32NHWCKernelSelect();
+    }
   }
 
   if (kernel != nullptr) {
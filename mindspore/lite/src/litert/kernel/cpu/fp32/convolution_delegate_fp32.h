@@ -16,8 +16,10 @@
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_CONVOLUTION_DELEGATE_FP32_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_CONVOLUTION_DELEGATE_FP32_H_
 
+#include <string>
 #include <vector>
 #include "src/litert/lite_kernel.h"
+#include "src/litert/kernel_tuner.h"
 #include "nnacl/conv_parameter.h"
 #include "nnacl/matmul_parameter.h"
 #include "nnacl/op_base.h"
@@ -91,6 +93,15 @@ class ConvolutionDelegateCPUKernel : public LiteKernel {
   kernel::LiteKernel *CreateConv1x1MatmulKernel();
   bool CheckAvxUseSW1x1Conv(const ConvParameter *conv_param);
   bool CheckAvxUseSWConv(const ConvParameter *conv_param);
+  // tuned selection of the nhwc algorithms, nullptr falls back to the heuristics of CpuConvFp32NHWCKernelSelect.
+  // The NC4HW4 layout keeps its heuristics, the depthwise and fp16 convolutions are other kernels and are not tuned.
+  kernel::LiteKernel *CpuConvFp32TunedKernelSelect();
+  std::string TuningKey() const;
+  std::vector<lite::TunedAlgorithm> ConvFp32Candidates();
+  kernel::LiteKernel *CreateConvFp32Kernel(const lite::TunedAlgorithm &algorithm);
+  void ReleaseConvFp32Kernel(kernel::LiteKernel *kernel);
+  int TuneConvFp32Algorithm(const std::vector<lite::TunedAlgorithm> &candidates, lite::TunedAlgorithm *best);
+  int TimeConvFp32Algorithm(const lite::TunedAlgorithm &algorithm, int run_num, int64_t *cost_ns);
   // If inferShape process can't complete in Init part, initialization of weight and bis will be implemented in runtime
   // via Resize() API. However,data of const tensor(weight and bias) doesn't exist anymore in runtime stage.Thus,
   // copying data of const tensor is necessary. Otherwise, just pass origin raw pointer of data.
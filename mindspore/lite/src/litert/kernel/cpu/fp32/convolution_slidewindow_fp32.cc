@@ -207,7 +207,8 @@ int ConvolutionSWCPUKernel::MallocWeightBiasData() {
   if (!op_parameter_->is_train_session_) {
     CHECK_LESS_RETURN(MAX_MALLOC_SIZE, pack_weight_size * sizeof(float));
     packed_weight_ = lite::PackWeightManager::GetInstance()->GetPackData(
-      in_tensors_[1]->data(), pack_weight_size * sizeof(float), &weight_is_packed_);
+      in_tensors_[1]->data(), pack_weight_size * sizeof(float), &weight_is_packed_,
+      {op_parameter_->type_, "conv_sw_nxhwcx", filter_tensor->shape()});
     if (packed_weight_ == nullptr) {
       MS_LOG(ERROR) << "malloc packed weight failed.";
       return RET_NULL_PTR;
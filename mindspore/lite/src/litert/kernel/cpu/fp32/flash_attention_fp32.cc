@@ -0,0 +1,521 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/kernel/cpu/fp32/flash_attention_fp32.h"
+#include <cmath>
+#include <cstring>
+#include "include/errorcode.h"
+#include "nnacl/errorcode.h"
+#include "nnacl/fp32/matmul_fp32.h"
+#include "nnacl/fp32/pack_fp32.h"
+#include "src/common/common.h"
+#include "src/common/utils.h"
+#include "src/litert/kernel_registry.h"
+
+using mindspore::lite::KernelRegistrar;
+using mindspore::lite::RET_ERROR;
+using mindspore::lite::RET_INPUT_PARAM_INVALID;
+using mindspore::lite::RET_OK;
+using mindspore::schema::PrimitiveType_Attention;
+
+namespace mindspore::kernel {
+namespace {
+constexpr size_t kInputQIndex = 0;
+constexpr size_t kInputKIndex = 1;
+constexpr size_t kInputVIndex = 2;
+constexpr size_t kWeightQKVIndex = 3;
+constexpr size_t kWeightOIndex = 4;
+constexpr size_t kBiasQKVIndex = 5;
+constexpr size_t kBiasOIndex = 6;
+constexpr size_t kMaskIndex = 7;
+constexpr size_t kMinInputSize = 7;
+constexpr int kQKVNum = 3;
+constexpr int kKVNum = 2;
+// the rows of key/value of one online-softmax step stay in L1 with the running state of the query rows
+constexpr int kQTile = C4NUM;
+constexpr int kKVTile = C64NUM;
+#ifdef ENABLE_AVX
+constexpr int kRowTile = C6NUM;
+constexpr int kColTile = C16NUM;
+#elif defined(ENABLE_SSE)
+constexpr int kRowTile = C4NUM;
+constexpr int kColTile = C8NUM;
+#elif defined(ENABLE_ARM32)
+constexpr int kRowTile = C12NUM;
+constexpr int kColTile = C4NUM;
+#else
+constexpr int kRowTile = C12NUM;
+constexpr int kColTile = C8NUM;
+#endif
+
+int GetSeqShape(const lite::Tensor *tensor, int *batch, int *seq, int *hidden) {
+  auto shape = tensor->shape();
+  if (shape.size() != C2NUM && shape.size() != C3NUM) {
+    MS_LOG(ERROR) << "The input of attention must be 2D or 3D, but got " << shape.size() << "D.";
+    return RET_INPUT_PARAM_INVALID;
+  }
+  *batch = shape.size() == C3NUM ? shape.at(0) : 1;
+  *seq = shape.at(shape.size() - C2NUM);
+  *hidden = shape.back();
+  return RET_OK;
+}
+
+// packs the [row, deep] input of a projection as the left matrix of MatMulOpt
+void PackMatmulInput(const float *src, float *dst, int row, int deep) {
+#ifdef ENABLE_AVX
+  RowMajor2Col6Major(src, dst, row, deep);
+#elif defined(ENABLE_SSE)
+  RowMajor2Col4Major(src, dst, row, deep);
+#else
+  RowMajor2Col12Major(src, dst, row, deep);
+#endif
+}
+
+// packs a [col, deep] weight, one output column per row, as the right matrix of MatMulOpt
+void PackMatmulWeight(const float *src, float *dst, int col, int deep) {
+#ifdef ENABLE_AVX
+  RowMajor2Col16Major(src, dst, col, deep);
+#elif defined(ENABLE_ARM32)
+  RowMajor2Col4Major(src, dst, col, deep);
+#else
+  RowMajor2Col8Major(src, dst, col, deep);
+#endif
+}
+}  // namespace
+
+FlashAttentionCPUKernel::~FlashAttentionCPUKernel() {
+  for (int i = 0; i < kProjectNum; ++i) {
+    free(packed_weight_[i]);
+    packed_weight_[i] = nullptr;
+    free(packed_bias_[i]);
+    packed_bias_[i] = nullptr;
+  }
+  free(k_cache_);
+  k_cache_ = nullptr;
+  free(v_cache_);
+  v_cache_ = nullptr;
+}
+
+int FlashAttentionCPUKernel::Prepare() {
+  CHECK_LESS_RETURN(in_tensors_.size(), kMinInputSize);
+  CHECK_LESS_RETURN(out_tensors_.size(), 1);
+  CHECK_NULL_RETURN(param_);
+  for (auto tensor : in_tensors_) {
+    CHECK_NULL_RETURN(tensor);
+    if (tensor->data_type() != kNumberTypeFloat32) {
+      MS_LOG(ERROR) << "The inputs of attention must be float32, but got " << tensor->data_type();
+      return RET_ERROR;
+    }
+  }
+  auto attention_config = GetConfig(lite::kAttention);
+  auto iter = attention_config.find(lite::kKVCacheSize);
+  if (iter != attention_config.end() &&
+      (!lite::ConvertStrToInt(iter->second, &kv_cache_size_) || kv_cache_size_ < 0)) {
+    MS_LOG(ERROR) << "Invalid " << lite::kKVCacheSize << ": " << iter->second;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  auto ret = InitWeight();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Init the weights of attention failed.";
+    return ret;
+  }
+  if (!InferShapeDone()) {
+    return RET_OK;
+  }
+  return ReSize();
+}
+
+int FlashAttentionCPUKernel::InitWeight() {
+  auto weight_shape = in_tensors_.at(kWeightQKVIndex)->shape();
+  if (weight_shape.size() != C2NUM || weight_shape.at(1) <= 0) {
+    MS_LOG(ERROR) << "The weight of q, k and v of attention must be 2D.";
+    return RET_INPUT_PARAM_INVALID;
+  }
+  hidden_ = weight_shape.at(1);
+  // the cross-attention form has a [hidden, hidden] weight of q followed by a [2 * hidden, hidden] weight of k and v
+  cross_ = weight_shape.at(0) == hidden_;
+  size_t offset = cross_ ? 1 : 0;
+  weight_o_index_ = kWeightOIndex + offset;
+  bias_qkv_index_ = kBiasQKVIndex + offset;
+  bias_o_index_ = kBiasOIndex + offset;
+  mask_index_ = kMaskIndex + offset;
+  CHECK_LESS_RETURN(in_tensors_.size(), bias_o_index_ + 1);
+  auto weight_kv = in_tensors_.at(kWeightQKVIndex + offset);
+  if ((!cross_ && weight_shape != std::vector<int>{kQKVNum * hidden_, hidden_}) ||
+      (cross_ && weight_kv->shape() != std::vector<int>{kKVNum * hidden_, hidden_}) ||
+      in_tensors_.at(weight_o_index_)->shape() != std::vector<int>{hidden_, hidden_} ||
+      in_tensors_.at(bias_qkv_index_)->ElementsNum() != kQKVNum * hidden_ ||
+      in_tensors_.at(bias_o_index_)->ElementsNum() != hidden_) {
+    MS_LOG(ERROR) << "The weights or biases of attention do not match the hidden size " << hidden_;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  for (size_t i = kWeightQKVIndex; i <= bias_o_index_; ++i) {
+    if (!in_tensors_.at(i)->IsConst() || in_tensors_.at(i)->data() == nullptr) {
+      MS_LOG(ERROR) << "The weights and biases of attention must be const.";
+      return RET_INPUT_PARAM_INVALID;
+    }
+  }
+  auto weight_q = reinterpret_cast<float *>(in_tensors_.at(kWeightQKVIndex)->data());
+  auto weight_k = cross_ ? reinterpret_cast<float *>(weight_kv->data()) : weight_q + hidden_ * hidden_;
+  auto bias = reinterpret_cast<float *>(in_tensors_.at(bias_qkv_index_)->data());
+  weight_[kProjectQ] = weight_q;
+  weight_[kProjectK] = weight_k;
+  weight_[kProjectV] = weight_k + hidden_ * hidden_;
+  weight_[kProjectO] = reinterpret_cast<float *>(in_tensors_.at(weight_o_index_)->data());
+  bias_[kProjectQ] = bias;
+  bias_[kProjectK] = bias + hidden_;
+  bias_[kProjectV] = bias + C2NUM * hidden_;
+  bias_[kProjectO] = reinterpret_cast<float *>(in_tensors_.at(bias_o_index_)->data());
+  for (int i = 0; i < kProjectNum; ++i) {
+    auto ret = PackWeight(i, weight_[i], bias_[i]);
+    if (ret != RET_OK) {
+      return ret;
+    }
+  }
+  return RET_OK;
+}
+
+int FlashAttentionCPUKernel::PackWeight(int index, const float *weight, const float *bias) {
+  size_t col_align = UP_ROUND(hidden_, kColTile);
+  free(packed_weight_[index]);
+  free(packed_bias_[index]);
+  packed_weight_[index] = reinterpret_cast<float *>(malloc(col_align * hidden_ * sizeof(float)));
+  packed_bias_[index] = reinterpret_cast<float *>(malloc(col_align * sizeof(float)));
+  if (packed_weight_[index] == nullptr || packed_bias_[index] == nullptr) {
+    MS_LOG(ERROR) << "Malloc packed weight of attention failed.";
+    return RET_ERROR;
+  }
+  memset(packed_weight_[index], 0, col_align * hidden_ * sizeof(float));
+  PackMatmulWeight(weight, packed_weight_[index], hidden_, hidden_);
+  memset(packed_bias_[index], 0, col_align * sizeof(float));
+  memcpy(packed_bias_[index], bias, hidden_ * sizeof(float));
+  return RET_OK;
+}
+
+int FlashAttentionCPUKernel::ReSize() {
+  int batch = 0;
+  int q_seq = 0;
+  int q_hidden = 0;
+  int kv_batch = 0;
+  int kv_hidden = 0;
+  auto ret = GetSeqShape(in_tensors_.at(kInputQIndex), &batch, &q_seq, &q_hidden);
+  if (ret != RET_OK) {
+    return ret;
+  }
+  ret = GetSeqShape(in_tensors_.at(kInputKIndex), &kv_batch, &kv_rows_, &kv_hidden);
+  if (ret != RET_OK) {
+    return ret;
+  }
+  if (q_hidden != hidden_ || kv_batch != batch || kv_hidden != hidden_ ||
+      in_tensors_.at(kInputVIndex)->shape() != in_tensors_.at(kInputKIndex)->shape()) {
+    MS_LOG(ERROR) << "The shapes of q, k and v of attention do not match.";
+    return RET_INPUT_PARAM_INVALID;
+  }
+  if (param_->head_num_ <= 0 || hidden_ % param_->head_num_ != 0) {
+    MS_LOG(ERROR) << "The hidden size " << hidden_ << " can not be split into " << param_->head_num_ << " heads.";
+    return RET_INPUT_PARAM_INVALID;
+  }
+  if (kv_cache_size_ > 0 && kv_rows_ != q_seq) {
+    MS_LOG(ERROR) << "The kv-cache only supports self-attention, but got " << q_seq << " rows of q and " << kv_rows_
+                  << " rows of k.";
+    return RET_INPUT_PARAM_INVALID;
+  }
+  param_->batch_ = batch;
+  param_->head_size_ = hidden_ / param_->head_num_;
+  param_->q_seq_ = q_seq;
+  param_->kv_seq_ = kv_rows_;
+  param_->kv_stride_ = kv_cache_size_ > 0 ? kv_cache_size_ : kv_rows_;
+  param_->q_tile_ = kQTile;
+  param_->kv_tile_ = kKVTile;
+  param_->scale_ = 1.0f / std::sqrt(static_cast<float>(param_->head_size_));
+  return RET_OK;
+}
+
+int FlashAttentionCPUKernel::InitKVCache() {
+  // a new kv_cache_sequence starts a new sequence, and so does a new batch size
+  auto attention_config = GetConfig(lite::kAttention);
+  auto iter = attention_config.find(lite::kKVCacheSequence);
+  std::string sequence = iter == attention_config.end() ? "" : iter->second;
+  if (k_cache_ != nullptr && kv_cache_batch_ == param_->batch_) {
+    if (sequence != kv_cache_sequence_) {
+      kv_cache_sequence_ = sequence;
+      kv_cache_len_ = 0;
+    }
+    return RET_OK;
+  }
+  free(k_cache_);
+  free(v_cache_);
+  size_t cache_size = static_cast<size_t>(param_->batch_) * hidden_ * kv_cache_size_ * sizeof(float);
+  k_cache_ = reinterpret_cast<float *>(malloc(cache_size));
+  v_cache_ = reinterpret_cast<float *>(malloc(cache_size));
+  if (k_cache_ == nullptr || v_cache_ == nullptr) {
+    MS_LOG(ERROR) << "Malloc kv-cache failed.";
+    free(k_cache_);
+    k_cache_ = nullptr;
+    free(v_cache_);
+    v_cache_ = nullptr;
+    return RET_ERROR;
+  }
+  kv_cache_batch_ = param_->batch_;
+  kv_cache_sequence_ = sequence;
+  kv_cache_len_ = 0;
+  return RET_OK;
+}
+
+int FlashAttentionCPUKernel::MallocRunBuffer() {
+  auto allocator = ms_context_->allocator;
+  CHECK_NULL_RETURN(allocator);
+  int q_rows = param_->batch_ * param_->q_seq_;
+  int kv_rows = param_->batch_ * kv_rows_;
+  size_t q_size = static_cast<size_t>(q_rows) * hidden_ * sizeof(float);
+  size_t kv_size = static_cast<size_t>(kv_rows) * hidden_ * sizeof(float);
+  size_t workspace_size =
+    static_cast<size_t>(op_parameter_->thread_num_) * FlashAttentionWorkspaceSize(param_) * sizeof(float);
+  q_buffer_ = reinterpret_cast<float *>(allocator->Malloc(q_size));
+  k_buffer_ = reinterpret_cast<float *>(allocator->Malloc(kv_size));
+  v_buffer_ = reinterpret_cast<float *>(allocator->Malloc(kv_size));
+  attn_buffer_ = reinterpret_cast<float *>(allocator->Malloc(q_size));
+  project_buffer_ = reinterpret_cast<float *>(allocator->Malloc(MSMAX(q_size, kv_size)));
+  workspace_ = reinterpret_cast<float *>(allocator->Malloc(workspace_size));
+  if (q_buffer_ == nullptr || k_buffer_ == nullptr || v_buffer_ == nullptr || attn_buffer_ == nullptr ||
+      project_buffer_ == nullptr || workspace_ == nullptr) {
+    MS_LOG(ERROR) << "Malloc run buffer of attention failed.";
+    FreeRunBuffer();
+    return RET_ERROR;
+  }
+  // a single row is projected without packing
+  if (q_rows > 1) {
+    packed_q_ = reinterpret_cast<float *>(allocator->Malloc(UP_ROUND(q_rows, kRowTile) * hidden_ * sizeof(float)));
+    if (packed_q_ == nullptr) {
+      MS_LOG(ERROR) << "Malloc packed q of attention failed.";
+      FreeRunBuffer();
+      return RET_ERROR;
+    }
+  }
+  if (kv_rows > 1) {
+    auto same_k = in_tensors_.at(kInputKIndex) == in_tensors_.at(kInputQIndex);
+    packed_k_ = same_k ? packed_q_
+                       : reinterpret_cast<float *>(
+                           allocator->Malloc(UP_ROUND(kv_rows, kRowTile) * hidden_ * sizeof(float)));
+    auto same_v = in_tensors_.at(kInputVIndex) == in_tensors_.at(kInputKIndex);
+    packed_v_ = same_v ? packed_k_
+                       : reinterpret_cast<float *>(
+                           allocator->Malloc(UP_ROUND(kv_rows, kRowTile) * hidden_ * sizeof(float)));
+    if (packed_k_ == nullptr || packed_v_ == nullptr) {
+      MS_LOG(ERROR) << "Malloc packed k and v of attention failed.";
+      FreeRunBuffer();
+      return RET_ERROR;
+    }
+  }
+  return RET_OK;
+}
+
+void FlashAttentionCPUKernel::FreeRunBuffer() {
+  auto allocator = ms_context_->allocator;
+  allocator->Free(q_buffer_);
+  q_buffer_ = nullptr;
+  allocator->Free(k_buffer_);
+  k_buffer_ = nullptr;
+  allocator->Free(v_buffer_);
+  v_buffer_ = nullptr;
+  allocator->Free(attn_buffer_);
+  attn_buffer_ = nullptr;
+  allocator->Free(project_buffer_);
+  project_buffer_ = nullptr;
+  allocator->Free(workspace_);
+  workspace_ = nullptr;
+  if (packed_v_ != packed_k_) {
+    allocator->Free(packed_v_);
+  }
+  packed_v_ = nullptr;
+  if (packed_k_ != packed_q_) {
+    allocator->Free(packed_k_);
+  }
+  packed_k_ = nullptr;
+  allocator->Free(packed_q_);
+  packed_q_ = nullptr;
+}
+
+int FlashAttentionCPUKernel::Project(int index, const float *x, const float *packed_x, int seq, float *out,
+                                     bool split_heads, int task_id) {
+  int thread_num = op_parameter_->thread_num_;
+  if (packed_x == nullptr) {
+    // a single row is a matrix-vector product bound by reading the weight, which needs no packing
+    auto ret = FlashAttentionProjectFp32(x, weight_[index], bias_[index], out, param_, seq, seq, split_heads, task_id,
+                                         thread_num);
+    return ret == NNACL_OK ? RET_OK : RET_ERROR;
+  }
+  // the output columns are split over the tasks in whole column tiles of the packed weight
+  int col_step = UP_ROUND(UP_DIV(hidden_, thread_num), kColTile);
+  int col_start = task_id * col_step;
+  int cols = MSMIN(col_step, hidden_ - col_start);
+  if (cols <= 0) {
+    return RET_OK;
+  }
+  int rows = param_->batch_ * seq;
+  float *dst = split_heads ? project_buffer_ : out;
+  MatMulOpt(packed_x, packed_weight_[index] + col_start * hidden_, dst + col_start, packed_bias_[index] + col_start,
+            ActType_No, hidden_, rows, cols, hidden_, OutType_Nhwc);
+  if (!split_heads) {
+    return RET_OK;
+  }
+  // split the columns of this task into [batch, head_num, seq, head_size]
+  int head_size = param_->head_size_;
+  int col_end = col_start + cols;
+  for (int r = 0; r < rows; ++r) {
+    int b = r / seq;
+    int i = r % seq;
+    const float *src = project_buffer_ + r * hidden_;
+    for (int col = col_start; col < col_end;) {
+      int head = col / head_size;
+      int d = col % head_size;
+      int len = MSMIN(head_size - d, col_end - col);
+      memcpy(out + ((b * param_->head_num_ + head) * seq + i) * head_size + d, src + col, len * sizeof(float));
+      col += len;
+    }
+  }
+  return RET_OK;
+}
+
+int FlashAttentionCPUKernel::DoProject(int task_id) {
+  auto q = reinterpret_cast<float *>(in_tensors_.at(kInputQIndex)->data());
+  auto k = reinterpret_cast<float *>(in_tensors_.at(kInputKIndex)->data());
+  auto v = reinterpret_cast<float *>(in_tensors_.at(kInputVIndex)->data());
+  auto ret = Project(kProjectQ, q, packed_q_, param_->q_seq_, q_buffer_, true, task_id);
+  if (ret != RET_OK) {
+    return ret;
+  }
+  ret = Project(kProjectK, k, packed_k_, kv_rows_, k_buffer_, true, task_id);
+  if (ret != RET_OK) {
+    return ret;
+  }
+  return Project(kProjectV, v, packed_v_, kv_rows_, v_buffer_, true, task_id);
+}
+
+int FlashAttentionCPUKernel::DoAttention(int task_id) {
+  const float *k = kv_cache_size_ > 0 ? k_cache_ : k_buffer_;
+  const float *v = kv_cache_size_ > 0 ? v_cache_ : v_buffer_;
+  const float *mask = nullptr;
+  if (in_tensors_.size() > mask_index_) {
+    mask = reinterpret_cast<float *>(in_tensors_.at(mask_index_)->data());
+  }
+  float *workspace = workspace_ + task_id * FlashAttentionWorkspaceSize(param_);
+  auto ret = FlashAttentionFp32(q_buffer_, k, v, mask, attn_buffer_, workspace, param_, task_id,
+                                op_parameter_->thread_num_);
+  return ret == NNACL_OK ? RET_OK : RET_ERROR;
+}
+
+int FlashAttentionCPUKernel::DoOutput(int task_id) {
+  auto output = reinterpret_cast<float *>(out_tensors_.at(0)->data());
+  return Project(kProjectO, attn_buffer_, packed_q_, param_->q_seq_, output, false, task_id);
+}
+
+int FlashAttentionProjectRun(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+  auto kernel = reinterpret_cast<FlashAttentionCPUKernel *>(cdata);
+  CHECK_NULL_RETURN(kernel);
+  return kernel->DoProject(task_id);
+}
+
+int FlashAttentionRun(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+  auto kernel = reinterpret_cast<FlashAttentionCPUKernel *>(cdata);
+  CHECK_NULL_RETURN(kernel);
+  return kernel->DoAttention(task_id);
+}
+
+int FlashAttentionOutputRun(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+  auto kernel = reinterpret_cast<FlashAttentionCPUKernel *>(cdata);
+  CHECK_NULL_RETURN(kernel);
+  return kernel->DoOutput(task_id);
+}
+
+int FlashAttentionCPUKernel::Run() {
+  auto q = reinterpret_cast<float *>(in_tensors_.at(kInputQIndex)->data());
+  auto k = reinterpret_cast<float *>(in_tensors_.at(kInputKIndex)->data());
+  auto v = reinterpret_cast<float *>(in_tensors_.at(kInputVIndex)->data());
+  CHECK_NULL_RETURN(q);
+  CHECK_NULL_RETURN(k);
+  CHECK_NULL_RETURN(v);
+  CHECK_NULL_RETURN(out_tensors_.at(0)->data());
+  if (kv_cache_size_ > 0) {
+    auto ret = InitKVCache();
+    if (ret != RET_OK) {
+      return ret;
+    }
+    if (kv_cache_len_ + kv_rows_ > kv_cache_size_) {
+      MS_LOG(ERROR) << "The sequence of " << (kv_cache_len_ + kv_rows_) << " rows exceeds the kv-cache of "
+                    << kv_cache_size_ << " rows, start a new one with a new " << lite::kKVCacheSequence;
+      return RET_ERROR;
+    }
+  }
+  int kv_seq = kv_cache_size_ > 0 ? kv_cache_len_ + kv_rows_ : kv_rows_;
+  if (in_tensors_.size() > mask_index_) {
+    CHECK_NULL_RETURN(in_tensors_.at(mask_index_)->data());
+    if (in_tensors_.at(mask_index_)->ElementsNum() != param_->batch_ * param_->q_seq_ * kv_seq) {
+      MS_LOG(ERROR) << "The mask of attention must be [" << param_->batch_ << ", " << param_->q_seq_ << ", " << kv_seq
+                    << "].";
+      return RET_INPUT_PARAM_INVALID;
+    }
+  }
+  auto ret = MallocRunBuffer();
+  if (ret != RET_OK) {
+    return ret;
+  }
+  if (packed_q_ != nullptr) {
+    PackMatmulInput(q, packed_q_, param_->batch_ * param_->q_seq_, hidden_);
+  }
+  if (packed_k_ != nullptr && packed_k_ != packed_q_) {
+    PackMatmulInput(k, packed_k_, param_->batch_ * kv_rows_, hidden_);
+  }
+  if (packed_v_ != nullptr && packed_v_ != packed_k_) {
+    PackMatmulInput(v, packed_v_, param_->batch_ * kv_rows_, hidden_);
+  }
+  ret = ParallelLaunch(this->ms_context_, FlashAttentionProjectRun, this, op_parameter_->thread_num_);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Project q, k and v of attention failed.";
+    FreeRunBuffer();
+    return ret;
+  }
+  if (kv_cache_size_ > 0) {
+    // the projection of this Run is appended to the cache, and the attention reads the whole cached sequence
+    ret = KVCacheAppendFp32(k_cache_, v_cache_, k_buffer_, v_buffer_, param_, kv_cache_len_, kv_rows_);
+    if (ret != NNACL_OK) {
+      MS_LOG(ERROR) << "Append to the kv-cache failed.";
+      FreeRunBuffer();
+      return RET_ERROR;
+    }
+    kv_cache_len_ += kv_rows_;
+  }
+  param_->kv_seq_ = kv_seq;
+  ret = ParallelLaunch(this->ms_context_, FlashAttentionRun, this, op_parameter_->thread_num_);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Flash attention failed.";
+    FreeRunBuffer();
+    return ret;
+  }
+  // the attention output has the rows of q, so it reuses the packed buffer of q
+  if (packed_q_ != nullptr) {
+    PackMatmulInput(attn_buffer_, packed_q_, param_->batch_ * param_->q_seq_, hidden_);
+  }
+  ret = ParallelLaunch(this->ms_context_, FlashAttentionOutputRun, this, op_parameter_->thread_num_);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Project the output of attention failed.";
+  }
+  FreeRunBuffer();
+  return ret;
+}
+
+REG_KERNEL(kCPU, kNumberTypeFloat32, PrimitiveType_Attention, LiteKernelCreator<FlashAttentionCPUKernel>)
+}  // namespace mindspore::kernel
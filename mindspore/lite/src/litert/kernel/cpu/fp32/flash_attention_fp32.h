@@ -0,0 +1,92 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_FLASH_ATTENTION_FP32_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_FLASH_ATTENTION_FP32_H_
+
+#include <string>
+#include <vector>
+#include "src/litert/lite_kernel.h"
+#include "nnacl/fp32/flash_attention_fp32.h"
+
+namespace mindspore::kernel {
+// inputs of the self-attention form: 0:Q 1:K 2:V [batch, seq, hidden] 3:WQKV [3 * hidden, hidden]
+// 4:WO [hidden, hidden] 5:BQKV [3 * hidden] 6:BO [hidden] 7:mask [batch, q_seq, kv_seq], optional.
+// The cross-attention form has a separate 3:WQ [hidden, hidden] and 4:WKV [2 * hidden, hidden], which shifts WO, BQKV,
+// BO and mask by one. The weights are const and hold one output column per row.
+// With [attention] kv_cache_size=n in the config, the projected keys and values of every Run are appended to a cache
+// of n rows and the attention reads the whole cached sequence, so that a decoding step only projects its own token. A
+// new sequence is started explicitly by a new value of [attention] kv_cache_sequence, e.g. through
+// Model::UpdateConfig, or by a new batch size; a prompt may be fed in several chunks.
+class FlashAttentionCPUKernel : public LiteKernel {
+ public:
+  FlashAttentionCPUKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                          const std::vector<lite::Tensor *> &outputs, const lite::InnerContext *ctx)
+      : LiteKernel(parameter, inputs, outputs, ctx) {
+    param_ = reinterpret_cast<FlashAttentionParameter *>(op_parameter_);
+  }
+  ~FlashAttentionCPUKernel() override;
+
+  int Prepare() override;
+  int ReSize() override;
+  int Run() override;
+  int DoProject(int task_id);
+  int DoAttention(int task_id);
+  int DoOutput(int task_id);
+
+ private:
+  enum ProjectIndex { kProjectQ = 0, kProjectK, kProjectV, kProjectO, kProjectNum };
+  int InitWeight();
+  int PackWeight(int index, const float *weight, const float *bias);
+  int Project(int index, const float *x, const float *packed_x, int seq, float *out, bool split_heads, int task_id);
+  int InitKVCache();
+  int MallocRunBuffer();
+  void FreeRunBuffer();
+
+  FlashAttentionParameter *param_ = nullptr;
+  bool cross_ = false;
+  size_t weight_o_index_ = 0;
+  size_t bias_qkv_index_ = 0;
+  size_t bias_o_index_ = 0;
+  size_t mask_index_ = 0;
+  int hidden_ = 0;
+  int kv_rows_ = 0;  // rows of key/value of this Run
+  // the weights and biases as they are, for the matrix-vector product of a single row
+  const float *weight_[kProjectNum] = {nullptr};
+  const float *bias_[kProjectNum] = {nullptr};
+  // the weights packed for MatMulOpt and the biases padded to its column tile
+  float *packed_weight_[kProjectNum] = {nullptr};
+  float *packed_bias_[kProjectNum] = {nullptr};
+  int kv_cache_size_ = 0;  // rows of the kv-cache, 0 if the cache is disabled
+  int kv_cache_len_ = 0;   // valid rows of the kv-cache
+  int kv_cache_batch_ = 0;
+  std::string kv_cache_sequence_;
+  float *k_cache_ = nullptr;
+  float *v_cache_ = nullptr;
+  // run buffers
+  float *q_buffer_ = nullptr;        // [batch, head_num, q_seq, head_size]
+  float *k_buffer_ = nullptr;        // [batch, head_num, kv_rows, head_size]
+  float *v_buffer_ = nullptr;        // [batch, head_num, kv_rows, head_size]
+  float *attn_buffer_ = nullptr;     // [batch, q_seq, hidden]
+  float *packed_q_ = nullptr;        // q, then the attention output, packed for MatMulOpt
+  float *packed_k_ = nullptr;        // k packed for MatMulOpt, packed_q_ if k is q
+  float *packed_v_ = nullptr;        // v packed for MatMulOpt, packed_k_ if v is k
+  float *project_buffer_ = nullptr;  // [batch, max(q_seq, kv_rows), hidden], a projection before it is split into heads
+  float *workspace_ = nullptr;       // FlashAttentionWorkspaceSize floats of every task
+};
+}  // namespace mindspore::kernel
+
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_FLASH_ATTENTION_FP32_H_
@@ -28,6 +28,9 @@ int FullconnectionCPUKernel::Prepare() {
   CHECK_NULL_RETURN(matmul_base_);
   matmul_base_->set_name(name_);
   matmul_base_->set_workspace(workspace());
+  auto weight_config = GetConfig(lite::kWeight);
+  auto bf16_weight = weight_config.find(lite::kBf16Weight);
+  matmul_base_->SetBf16Weight(bf16_weight != weight_config.end() && bf16_weight->second == "true");
   return matmul_base_->FullConnectionPrepare();
 }
 
@@ -17,6 +17,7 @@
 #include "src/litert/kernel/cpu/fp32/matmul_fp32_base.h"
 #include <algorithm>
 #include "nnacl/fp32/matmul_fp32.h"
+#include "nnacl/fp32/matmul_bf16_fp32.h"
 #include "nnacl/fp32/pack_fp32.h"
 #include "nnacl/fp32/pack_fp32_opt.h"
 
@@ -29,6 +30,11 @@ using mindspore::lite::RET_OK;
 using mindspore::schema::PrimitiveType_MatMulFusion;
 
 namespace mindspore::kernel {
+namespace {
+// the bf16 weight kernel reads every weight once per row of matrix-a, beyond a few rows the packed fp32 kernels win.
+constexpr int kBf16WeightMaxRow = 4;
+}  // namespace
+
 int MatmulRun(void *cdata, int task_id, float, float) {
   CHECK_NULL_RETURN(cdata);
   auto op = reinterpret_cast<const MatmulFp32BaseCPUKernel *>(cdata);
@@ -55,6 +61,7 @@ MatmulFp32BaseCPUKernel::~MatmulFp32BaseCPUKernel() {
   }
   if (params_->b_const_) {
     lite::PackWeightManager::GetInstance()->Free(matrix_b_.pack_ptr);
+    lite::PackWeightManager::GetInstance()->Free(bf16_pack_b_);
   }
 }
 
@@ -133,6 +140,27 @@ int MatmulFp32BaseCPUKernel::ParallelRunByOC(int task_id) const {
   return RET_OK;
 }
 
+int MatmulFp32BaseCPUKernel::ParallelRunBf16WeightByOC(int task_id) const {
+  int start_oc = split_points_[task_id];
+  int end_oc = params_->col_;
+  if (task_id < (thread_count_ - 1)) {
+    end_oc = split_points_[task_id + 1];
+  }
+  int compute_oc = end_oc - start_oc;
+  if (compute_oc <= 0) {
+    return RET_OK;
+  }
+  auto b = bf16_pack_b_ + start_oc * params_->deep_;
+  auto bias = (matrix_c_.pack_ptr == nullptr) ? nullptr : matrix_c_.pack_ptr + start_oc;
+  for (int i = 0; i < params_->batch; ++i) {
+    auto a = matrix_a_.pack_ptr + a_offset_[i] * params_->row_align_ * params_->deep_;
+    auto c = output_data_ + i * params_->row_ * params_->col_ + start_oc;
+    MatMulBf16WeightFp32(a, b, c, bias, params_->act_type_, params_->deep_, params_->row_, compute_oc,
+                         params_->col_);
+  }
+  return RET_OK;
+}
+
 bool MatmulFp32BaseCPUKernel::CheckThreadCuttingByRow() { return false; }
 
 int MatmulFp32BaseCPUKernel::BackupConstMatrix(MatrixInfo *matrix_info, int index) {
@@ -163,7 +191,8 @@ int MatmulFp32BaseCPUKernel::PackMatrixA() {
   } else {
     bool is_packed = false;
     void *data = lite::PackWeightManager::GetInstance()->GetPackData(
-      in_tensors()[FIRST_INPUT]->data(), static_cast<size_t>(matrix_a_.pack_size) * sizeof(float), &is_packed);
+      in_tensors()[FIRST_INPUT]->data(), static_cast<size_t>(matrix_a_.pack_size) * sizeof(float), &is_packed,
+      {op_parameter_->type_, "matmul_a", {a_batch_, params_->row_, params_->deep_, params_->a_transpose_}});
     matrix_a_.pack_ptr = reinterpret_cast<float *>(data);
     if (matrix_a_.pack_ptr == nullptr) {
       MS_LOG(ERROR) << "matrix a pack ptr is nullptr.";
@@ -172,6 +201,11 @@ int MatmulFp32BaseCPUKernel::PackMatrixA() {
     if (is_packed) {
       return RET_OK;
     }
+    auto ret = pack_opt_ ? PackMatrixAImplOpt() : PackMatrixAImpl();
+    if (ret == RET_OK) {
+      lite::PackWeightManager::GetInstance()->PackDone(matrix_a_.pack_ptr);
+    }
+    return ret;
   }
   if (pack_opt_) {
     return PackMatrixAImplOpt();  // currently, only arm64 support.
@@ -219,7 +253,8 @@ int MatmulFp32BaseCPUKernel::PackMatrixB() {
   } else {
     bool is_packed = false;
     void *data = lite::PackWeightManager::GetInstance()->GetPackData(
-      in_tensors()[SECOND_INPUT]->data(), static_cast<size_t>(matrix_b_.pack_size) * sizeof(float), &is_packed);
+      in_tensors()[SECOND_INPUT]->data(), static_cast<size_t>(matrix_b_.pack_size) * sizeof(float), &is_packed,
+      {op_parameter_->type_, "matmul_b", {b_batch_, params_->deep_, params_->col_, params_->b_transpose_}});
     matrix_b_.pack_ptr = reinterpret_cast<float *>(data);
     if (matrix_b_.pack_ptr == nullptr) {
       MS_LOG(ERROR) << "matrix b pack ptr is nullptr.";
@@ -228,6 +263,11 @@ int MatmulFp32BaseCPUKernel::PackMatrixB() {
     if (is_packed) {
       return RET_OK;
     }
+    auto ret = PackMatrixBImpl();
+    if (ret == RET_OK) {
+      lite::PackWeightManager::GetInstance()->PackDone(matrix_b_.pack_ptr);
+    }
+    return ret;
   }
   return PackMatrixBImpl();
 }
@@ -252,6 +292,33 @@ int MatmulFp32BaseCPUKernel::PackMatrixBImpl() {
   return RET_OK;
 }
 
+bool MatmulFp32BaseCPUKernel::CheckBf16WeightConditions() const {
+  // only a constant matrix-b without batch, a column vector keeps the GemmIsNotPack path. The weight is packed at
+  // prepare, so matrix-a has to be known by then and have a few rows at most, the memory bound decode-like shapes.
+  if (!bf16_weight_ || !params_->b_const_ || params_->a_const_ || b_batch_ != 1 || params_->col_ <= 1 ||
+      conv1x1_origin_weight_ != nullptr || !InferShapeDone()) {
+    return false;
+  }
+  return a_batch_ * params_->row_ <= kBf16WeightMaxRow;
+}
+
+int MatmulFp32BaseCPUKernel::PackMatrixBToBf16() {
+  bool is_packed = false;
+  void *data = lite::PackWeightManager::GetInstance()->GetPackData(
+    in_tensors()[SECOND_INPUT]->data(), static_cast<size_t>(matrix_b_.pack_size) * sizeof(uint16_t), &is_packed,
+    {op_parameter_->type_, "matmul_b_bf16", {params_->deep_, params_->col_, params_->b_transpose_}});
+  bf16_pack_b_ = reinterpret_cast<uint16_t *>(data);
+  MS_CHECK_TRUE_MSG(bf16_pack_b_ != nullptr, RET_ERROR, "matrix-b bf16 pack ptr is a nullptr.");
+  if (is_packed) {
+    return RET_OK;
+  }
+  auto src_ptr = reinterpret_cast<float *>(in_tensors_[SECOND_INPUT]->data());
+  MS_CHECK_TRUE_MSG(src_ptr != nullptr, RET_ERROR, "matrix-b source ptr is a nullptr.");
+  PackBf16WeightColMajor(src_ptr, bf16_pack_b_, params_->deep_, params_->col_, params_->b_transpose_);
+  lite::PackWeightManager::GetInstance()->PackDone(bf16_pack_b_);
+  return RET_OK;
+}
+
 void MatmulFp32BaseCPUKernel::FreePackedMatrixB() {
   if (matrix_b_.need_pack && !op_parameter_->is_train_session_ && matrix_b_.pack_ptr != nullptr) {
     ms_context_->allocator->Free(matrix_b_.pack_ptr);
@@ -335,6 +402,7 @@ int MatmulFp32BaseCPUKernel::Prepare() {
     MS_LOG(ERROR) << "matmul don't support the act-type: " << act_type;
     return RET_ERROR;
   }
+  use_bf16_weight_ = CheckBf16WeightConditions();
   auto ret = InitParameter();
   MS_CHECK_TRUE_MSG(ret == RET_OK, RET_ERROR, "Init parameters failed.");
   if (params_->a_const_) {
@@ -343,7 +411,7 @@ int MatmulFp32BaseCPUKernel::Prepare() {
     matrix_a_.has_packed = true;
   }
   if (params_->b_const_) {
-    ret = PackMatrixB();
+    ret = use_bf16_weight_ ? PackMatrixBToBf16() : PackMatrixB();
     MS_CHECK_TRUE_MSG(ret == RET_OK, RET_ERROR, "pack const-matrix b failed.");
     matrix_b_.has_packed = true;
   }
@@ -631,6 +699,21 @@ int MatmulFp32BaseCPUKernel::InitParameter() {
     matrix_b_.need_pack = false;
     pack_opt_ = false;
   }
+  if (use_bf16_weight_ && a_batch_ * params_->row_ > kBf16WeightMaxRow) {
+    // the fp32 weight may be released once packed, a resize to more rows keeps the slower bf16 kernel.
+    MS_LOG(WARNING) << name_ << " is resized to " << a_batch_ * params_->row_ << " rows, more than the "
+                    << kBf16WeightMaxRow << " rows the bf16 weight was chosen for.";
+  }
+  if (use_bf16_weight_) {
+    // matrix-a stays row-major fp32 and is multiplied with the column-major bf16 matrix-b.
+    out_need_aligned_ = false;
+    row_tile_ = 1;
+    col_tile_ = 1;
+    matrix_a_pack_fun_ = params_->a_transpose_ ? RowMajor2ColMajor : RowMajor2RowMajor;
+    matrix_a_.need_pack = params_->a_transpose_ && params_->row_ != 1;
+    matrix_b_.need_pack = false;
+    pack_opt_ = false;
+  }
   params_->row_align_ = UP_ROUND(params_->row_, row_tile_);
   params_->col_align_ = UP_ROUND(params_->col_, col_tile_);
   MS_CHECK_INT_MUL_NOT_OVERFLOW(a_batch_, params_->row_align_, RET_ERROR);
@@ -674,6 +757,18 @@ int MatmulFp32BaseCPUKernel::InitTmpOutBuffer() {
 }
 
 int MatmulFp32BaseCPUKernel::GetThreadCuttingPolicy() {
+  if (use_bf16_weight_) {
+    int total_col_unit = UP_DIV(params_->col_, col_min_unit_);
+    thread_count_ = MSMIN(op_parameter_->thread_num_, total_col_unit);
+    int block_col_unit = UP_DIV(total_col_unit, thread_count_);
+    split_points_.clear();
+    for (int split_point = 0; split_point < total_col_unit; split_point += block_col_unit) {
+      split_points_.push_back(split_point * col_min_unit_);
+    }
+    thread_count_ = split_points_.size();
+    parallel_fun_ = &MatmulFp32BaseCPUKernel::ParallelRunBf16WeightByOC;
+    return RET_OK;
+  }
   if ((a_batch_ >= op_parameter_->thread_num_ && (b_batch_ == a_batch_ || !SupportMulBatchCuttingByRow())) ||
       params_->col_ == 1) {
     thread_count_ = op_parameter_->thread_num_;
@@ -743,7 +838,8 @@ int MatmulFp32BaseCPUKernel::Run() {
     MS_CHECK_TRUE_MSG(ret == RET_OK, RET_ERROR, "pack const-matrix b failed.");
   }
   MS_CHECK_TRUE_MSG(matrix_a_.pack_ptr != nullptr, RET_ERROR, "matrix-a pack ptr is a nullptr.");
-  MS_CHECK_TRUE_MSG(matrix_b_.pack_ptr != nullptr, RET_ERROR, "matrix-b pack ptr is a nullptr.");
+  MS_CHECK_TRUE_MSG(matrix_b_.pack_ptr != nullptr || bf16_pack_b_ != nullptr, RET_ERROR,
+                    "matrix-b pack ptr is a nullptr.");
 
   auto ret = ParallelLaunch(this->ms_context_, MatmulRun, this, thread_count_);
   if (ret != RET_OK) {
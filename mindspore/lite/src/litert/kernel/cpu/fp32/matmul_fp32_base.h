@@ -47,6 +47,8 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
   void SetConv1x1OriginWeight(float *conv1x1_origin_weight) { conv1x1_origin_weight_ = conv1x1_origin_weight; }
   void SetConv1x1OriginBias(float *conv1x1_origin_bias) { conv1x1_origin_bias_ = conv1x1_origin_bias; }
   int Conv1x1Prepare();
+  // Keep a constant 2D matrix-b as bfloat16 and accumulate in fp32, which halves the weight memory traffic.
+  void SetBf16Weight(bool bf16_weight) { bf16_weight_ = bf16_weight; }
   int ReSize() override;
   int FullConnectionReSize();
   int MatmulReSize();
@@ -70,12 +72,15 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
   virtual int ParallelRunByOC(int task_id) const;
   virtual int ParallelRunByBatch(int task_id) const;
   int ParallelRunIsNotPackByBatch(int task_id) const;
+  int ParallelRunBf16WeightByOC(int task_id) const;
   int BackupConstMatrix(MatrixInfo *matrix_info, int index);
   virtual void InitGlobalVariable();
   int PackMatrixA();
   int PackMatrixB();
   int PackMatrixAImpl();
   int PackMatrixBImpl();
+  int PackMatrixBToBf16();
+  bool CheckBf16WeightConditions() const;
   virtual int PackMatrixAImplOpt();
   bool CheckRow1OptimalConditions();
   virtual bool SupportMulBatchCuttingByRow() { return false; }
@@ -118,6 +123,9 @@ class MatmulFp32BaseCPUKernel : public LiteKernel {
   MatrixPackFun matrix_b_pack_fun_ = nullptr;
   float *conv1x1_origin_weight_ = nullptr;
   float *conv1x1_origin_bias_ = nullptr;
+  bool bf16_weight_{false};
+  bool use_bf16_weight_{false};
+  uint16_t *bf16_pack_b_{nullptr};
 };
 }  // namespace mindspore::kernel
 #endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_CPU_FP32_MATMUL_FP32_BASE_H_
@@ -87,6 +87,9 @@ kernel::LiteKernel *CpuConvInt8KernelSelect(const std::vector<lite::Tensor *> &i
     } else {
       kernel = new (std::nothrow) Convolution3x3Int8CPUKernel(op_parameter, inputs, outputs, ctx);
     }
+#elif defined(ENABLE_AVX)
+    // the im2col gemm runs on the AVX2/VNNI int8 kernels, which beats the int16 winograd path
+    kernel = new (std::nothrow) ConvolutionInt8CPUKernel(op_parameter, inputs, outputs, ctx);
 #else
     kernel = new (std::nothrow) kernel::Convolution3x3Int8CPUKernel(op_parameter, inputs, outputs, ctx);
 #endif
@@ -0,0 +1,139 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "src/litert/kernel_tuner.h"
+#include <fstream>
+#include <sstream>
+#include "include/errorcode.h"
+#include "src/common/log_util.h"
+#include "src/litert/thread_cost_model.h"
+
+namespace mindspore::lite {
+KernelTuner *KernelTuner::GetInstance() {
+  static KernelTuner instance;
+  return &instance;
+}
+
+int KernelTuner::Init(const std::string &tuning_file, bool tune, int run_num) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (enabled_) {
+    if (tuning_file != tuning_file_) {
+      MS_LOG(WARNING) << "Kernels are tuned with tuning file " << tuning_file_ << " already, ignore " << tuning_file;
+    }
+    return RET_OK;
+  }
+  if (tuning_file.empty()) {
+    MS_LOG(ERROR) << "Kernel tuning file should not be empty.";
+    return RET_INPUT_PARAM_INVALID;
+  }
+  if (tune && run_num < 1) {
+    MS_LOG(ERROR) << "Kernel tuning run num should be positive, but got " << run_num;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  tuning_file_ = tuning_file;
+  tune_ = tune;
+  run_num_ = run_num;
+  host_identity_ = HostIdentity();
+  if (Load() != RET_OK) {
+    MS_LOG(WARNING) << "Load kernel tuning file " << tuning_file_ << " failed, tune from scratch.";
+    algorithms_.clear();
+  }
+  MS_LOG(INFO) << "Select kernel algorithms by tuning file " << tuning_file_ << ", " << algorithms_.size()
+               << " layers tuned already.";
+  enabled_ = true;
+  return RET_OK;
+}
+
+std::string KernelTuner::host_identity() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return host_identity_;
+}
+
+bool KernelTuner::GetAlgorithm(const std::string &layer_key, TunedAlgorithm *algorithm) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!enabled_) {
+    return false;
+  }
+  auto iter = algorithms_.find(layer_key);
+  if (iter == algorithms_.end()) {
+    return false;
+  }
+  *algorithm = iter->second;
+  return true;
+}
+
+void KernelTuner::Record(const std::string &layer_key, const TunedAlgorithm &algorithm) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!enabled_) {
+    return;
+  }
+  algorithms_[layer_key] = algorithm;
+  updated_ = true;
+}
+
+int KernelTuner::SaveIfUpdated() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!updated_) {
+    return RET_OK;
+  }
+  std::ofstream ofs(tuning_file_, std::ios::out | std::ios::trunc);
+  if (!ofs.is_open()) {
+    MS_LOG(ERROR) << "Open kernel tuning file " << tuning_file_ << " failed.";
+    return RET_ERROR;
+  }
+  // the layer key goes last, it is the rest of the line.
+  for (auto &item : algorithms_) {
+    ofs << item.second.algorithm << " " << item.second.tile << " " << item.first << "\n";
+  }
+  ofs.close();
+  updated_ = false;
+  return RET_OK;
+}
+
+void KernelTuner::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  enabled_ = false;
+  tune_ = false;
+  updated_ = false;
+  run_num_ = 0;
+  tuning_file_.clear();
+  host_identity_.clear();
+  algorithms_.clear();
+}
+
+int KernelTuner::Load() {
+  std::ifstream ifs(tuning_file_);
+  if (!ifs.is_open()) {
+    MS_LOG(INFO) << "Kernel tuning file " << tuning_file_ << " does not exist, tune from scratch.";
+    return RET_OK;
+  }
+  std::string line;
+  while (std::getline(ifs, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    std::istringstream iss(line);
+    TunedAlgorithm algorithm;
+    std::string layer_key;
+    if (!(iss >> algorithm.algorithm >> algorithm.tile) || !std::getline(iss >> std::ws, layer_key) ||
+        layer_key.empty()) {
+      return RET_ERROR;
+    }
+    algorithms_[layer_key] = algorithm;
+  }
+  return RET_OK;
+}
+}  // namespace mindspore::lite
@@ -0,0 +1,75 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef MINDSPORE_LITE_SRC_RUNTIME_KERNEL_TUNER_H_
+#define MINDSPORE_LITE_SRC_RUNTIME_KERNEL_TUNER_H_
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+
+namespace mindspore::lite {
+// the algorithm of a layer and its tile, e.g. the output unit of winograd. The values are defined by the kernel.
+struct TunedAlgorithm {
+  int algorithm = 0;
+  int tile = 0;
+
+  bool operator==(const TunedAlgorithm &other) const { return algorithm == other.algorithm && tile == other.tile; }
+};
+
+// Picks the algorithm of every layer by timing the candidates on the host cpu, the static heuristics of the kernels
+// are tuned for one platform only. A layer is keyed by the host identity, its name and shapes, so a tuning file shared
+// by several cpus keeps the winners of each. The winners are persisted to a tuning file, so later processes build the
+// tuned algorithms at CompileGraph without timing them again. Only the fp32 NHWC convolutions are tuned, the depthwise,
+// fp16 and NC4HW4 convolutions keep their heuristics.
+class KernelTuner {
+ public:
+  static KernelTuner *GetInstance();
+
+  // Loads the tuning file if it exists. With tune set, a layer missing in the file times every candidate run_num times
+  // and keeps the fastest, otherwise it falls back to the heuristics.
+  int Init(const std::string &tuning_file, bool tune, int run_num);
+  bool enabled() const { return enabled_; }
+  bool tune() const { return tune_; }
+  int run_num() const { return run_num_; }
+  // lite::HostIdentity() of the process, the prefix of the layer keys.
+  std::string host_identity();
+  bool GetAlgorithm(const std::string &layer_key, TunedAlgorithm *algorithm);
+  void Record(const std::string &layer_key, const TunedAlgorithm &algorithm);
+  // Writes the tuning file if a layer is tuned since the last save.
+  int SaveIfUpdated();
+  // Drops the tuned algorithms and disables the tuner, so the next Init loads a tuning file again.
+  void Reset();
+
+ private:
+  KernelTuner() = default;
+  ~KernelTuner() = default;
+  int Load();
+
+  // the kernels of several sessions query the tuner while another session inits or resets it, the flags are atomic
+  // and the rest is guarded by mutex_. enabled_ is set last, once the other members are ready.
+  std::mutex mutex_;
+  std::atomic_bool enabled_ = {false};
+  std::atomic_bool tune_ = {false};
+  std::atomic_int run_num_ = {0};
+  bool updated_ = false;
+  std::string tuning_file_;
+  std::string host_identity_;
+  std::map<std::string, TunedAlgorithm> algorithms_;
+};
+}  // namespace mindspore::lite
+#endif  // MINDSPORE_LITE_SRC_RUNTIME_KERNEL_TUNER_H_
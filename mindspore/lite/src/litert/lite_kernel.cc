@@ -16,6 +16,7 @@
 
 #include "src/litert/lite_kernel.h"
 #include <algorithm>
+#include <chrono>
 #include "src/tensor.h"
 #include "src/common/utils.h"
 #include "src/litert/infer_manager.h"
@@ -90,6 +91,11 @@ int LiteKernel::UpdateThreadNumProcess(int32_t kernel_type, int64_t per_unit_loa
 int LiteKernel::UpdateThreadNumPass(int32_t kernel_type, int64_t per_unit_load_num, int64_t per_unit_store_num,
                                     int64_t unit_num) {
 #ifdef DYNAMIC_THREAD_DISTRIBUTE
+  cost_kernel_type_ = kernel_type;
+  cost_context_.per_unit_load_num_ = per_unit_load_num;
+  cost_context_.per_unit_store_num_ = per_unit_store_num;
+  cost_context_.total_unit_num_ = unit_num;
+  cost_calibrated_ = lite::ThreadCostCalibrator::GetInstance()->IsCalibrated(kernel_type, unit_num);
   if (UpdateThreadNumProcess(kernel_type, per_unit_load_num, per_unit_store_num, unit_num) != lite::RET_OK) {
     MS_LOG(ERROR) << "update thread num failed";
     return lite::RET_ERROR;
@@ -101,6 +107,26 @@ int LiteKernel::UpdateThreadNumPass(int32_t kernel_type, int64_t per_unit_load_n
   return lite::RET_OK;
 }
 
+#ifdef DYNAMIC_THREAD_DISTRIBUTE
+// The kernel is timed until its type and size are calibrated. It keeps the thread split of its last
+// UpdateThreadNumPass for the rest of the run, the buffers of a running graph are never re-split; the calibrated cost
+// picks the thread num from the next Prepare or ReSize on, or from the cache file in a later session.
+int LiteKernel::CalibrateRun() {
+  auto calibrator = lite::ThreadCostCalibrator::GetInstance();
+  if (cost_calibrated_ || !calibrator->enabled() || cost_context_.total_unit_num_ <= 0) {
+    return Run();
+  }
+  auto start = std::chrono::steady_clock::now();
+  auto ret = Run();
+  auto cost_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+  if (ret == lite::RET_OK) {
+    calibrator->Record(cost_kernel_type_, &cost_context_, thread_num_, cost_ns.count());
+    cost_calibrated_ = calibrator->IsCalibrated(cost_kernel_type_, cost_context_.total_unit_num_);
+  }
+  return ret;
+}
+#endif
+
 int LiteKernel::Execute() {
   auto ret = PreProcess();
   if (lite::RET_OK != ret) {
@@ -109,7 +135,11 @@ int LiteKernel::Execute() {
   }
 
   if (op_parameter_->is_zero_shape_ == false) {
+#ifdef DYNAMIC_THREAD_DISTRIBUTE
+    ret = CalibrateRun();
+#else
     ret = Run();
+#endif
     if (lite::RET_OK != ret) {
       MS_LOG(ERROR) << "run kernel failed, name: " << this->name();
       return ret;
@@ -206,6 +206,15 @@ class LiteKernel : public Abstractkernel {
   const lite::Context *ms_context_ = nullptr;
 
   int thread_num_ = 1;
+
+ private:
+#ifdef DYNAMIC_THREAD_DISTRIBUTE
+  int CalibrateRun();
+#endif
+  // the arguments of the last UpdateThreadNumPass, the kernel is timed with them to calibrate the thread cost
+  int32_t cost_kernel_type_ = 0;
+  lite::ThreadCostContext cost_context_ = {0, 0, 0, 0.0f};
+  bool cost_calibrated_ = false;
 };
 }  // namespace mindspore::kernel
 
@@ -15,6 +15,8 @@
  */
 
 #include "src/litert/lite_session.h"
+#include <algorithm>
+#include <memory>
 #include <set>
 #include "src/litert/pack_weight_manager.h"
 #include "src/litert/runtime_pass.h"
@@ -36,6 +38,8 @@
 #include "src/litert/lite_model.h"
 #include "src/litert/weight_decoder.h"
 #include "src/litert/runtime_allocator.h"
+#include "src/litert/thread_cost_model.h"
+#include "src/litert/kernel_tuner.h"
 #include "src/litert/kernel_exec_util.h"
 #ifndef CUSTOM_KERNEL_REGISTRY_CLIP
 #include "src/registry/register_kernel_impl.h"
@@ -65,6 +69,9 @@ extern void mindspore_log_init();
 #endif
 namespace lite {
 namespace {
+constexpr int kDefaultCalibrationWarmupNum = 10;
+constexpr int kDefaultTuneRunNum = 5;
+
 bool ExistCustomCpuKernel() {
 #ifndef CUSTOM_KERNEL_REGISTRY_CLIP
   const std::string kArchCPU = "CPU";
@@ -84,6 +91,41 @@ bool ExistCustomCpuKernel() {
 #endif
   return false;
 }
+
+// An elementwise kernel writes every output element right after it reads the input elements of the same index, so its
+// output can take over the buffer of an input of the same shape that no later kernel reads.
+Tensor *FindInPlaceInput(const kernel::KernelExec *kernel, const Tensor *output,
+                         const RuntimeAllocatorPtr &runtime_allocator,
+                         const std::unordered_map<Tensor *, int> &tensor_ref_count,
+                         const std::unordered_map<size_t, int> &data_ref_count) {
+  static const std::set<schema::PrimitiveType> kElementwiseTypes = {
+    schema::PrimitiveType_Activation, schema::PrimitiveType_LeakyRelu, schema::PrimitiveType_AddFusion,
+    schema::PrimitiveType_SubFusion,  schema::PrimitiveType_MulFusion, schema::PrimitiveType_DivFusion,
+    schema::PrimitiveType_Abs,        schema::PrimitiveType_Neg,       schema::PrimitiveType_Sqrt,
+    schema::PrimitiveType_Rsqrt,      schema::PrimitiveType_Square,    schema::PrimitiveType_ExpFusion,
+    schema::PrimitiveType_Log,        schema::PrimitiveType_Sin,       schema::PrimitiveType_Cos,
+    schema::PrimitiveType_Floor,      schema::PrimitiveType_Ceil,      schema::PrimitiveType_Round};
+  if (kElementwiseTypes.find(kernel->type()) == kElementwiseTypes.end()) {
+    return nullptr;
+  }
+  const auto &in_tensors = kernel->in_tensors();
+  for (auto input : in_tensors) {
+    if (input->allocator() != runtime_allocator || input->IsGraphOutput() ||
+        input->data_type() != output->data_type() || input->format() != output->format() ||
+        input->shape() != output->shape()) {
+      continue;
+    }
+    auto read_num = std::count(in_tensors.begin(), in_tensors.end(), input);
+    auto tensor_iter = tensor_ref_count.find(input);
+    auto data_iter = data_ref_count.find(runtime_allocator->GetBufferId(input));
+    // this kernel is the last reader of the tensor and of every other tensor on the same buffer
+    if (tensor_iter != tensor_ref_count.end() && tensor_iter->second == read_num &&
+        data_iter != data_ref_count.end() && data_iter->second == read_num) {
+      return input;
+    }
+  }
+  return nullptr;
+}
 }  // namespace
 
 LiteSession::LiteSession() {
@@ -536,11 +578,34 @@ int LiteSession::CompileGraph(Model *model) {
   InitGraphInputTensors(model);
   InitGraphOutputTensors(model);
 
+  ret = InitThreadCostCalibrator();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Init thread cost calibrator failed: " << ret;
+    is_running_.store(false);
+    return ret;
+  }
+
+  ret = InitKernelTuner();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Init kernel tuner failed: " << ret;
+    is_running_.store(false);
+    return ret;
+  }
+
+  bool share_weight = false;
+  ret = InitSharedWeight(&share_weight);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Init shared weight failed: " << ret;
+    is_running_.store(false);
+    return ret;
+  }
+
   // scheduler kernels
   Scheduler scheduler(context_, ms_context_, model, &tensors_, &inputs_, &outputs_, is_train_session_, &is_infershape_,
                       &is_control_flow_, execution_plan_, delegate_, delegate_device_type_);
   scheduler.SetupSchedulerCb(std::move(sched_cb_));
   scheduler.SetConfig(config_info_);
+  scheduler.SetShareWeight(share_weight);
   ret = scheduler.Schedule(&kernels_);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "Schedule kernels failed: " << ret;
@@ -558,6 +623,12 @@ int LiteSession::CompileGraph(Model *model) {
     return ret;
   }
 
+  // the kernels pick their algorithms when they are prepared, the tuned ones are kept for the next process.
+  auto tuner = KernelTuner::GetInstance();
+  if (tuner->enabled() && tuner->SaveIfUpdated() != RET_OK) {
+    MS_LOG(WARNING) << "Save the kernel tuning file failed.";
+  }
+
   if (is_train_session_) {
     is_running_.store(false);
     return RET_OK;
@@ -630,6 +701,7 @@ int LiteSession::PrepareKernels(const Model *model) {
     return ret;
   }
 
+  auto max_branch_num = ParseMaxBranchNum();
   for (auto kernel : this->kernels_) {
     if (kernel->desc().arch == kernel::kDelegate) {
       ret = SetAllocatorForDelegateKernels(kernel);
@@ -645,6 +717,15 @@ int LiteSession::PrepareKernels(const Model *model) {
         MS_LOG(ERROR) << "kernel: " << kernel->name() << " not is subgraph kernel.";
         return RET_ERROR;
       }
+      auto subgraph_type = subgraph_kernel->subgraph_type();
+      bool is_cpu_subgraph = subgraph_type == kernel::kCpuFP32SubGraph || subgraph_type == kernel::kCpuFP16SubGraph;
+      if (max_branch_num > 1 && is_cpu_subgraph) {
+        ret = static_cast<kernel::CpuSubGraph *>(subgraph_kernel)->InitInterOpExecutor(context_, max_branch_num);
+        if (ret != RET_OK) {
+          MS_LOG(ERROR) << "Init inter-op executor of " << kernel->name() << " failed: " << ret;
+          return ret;
+        }
+      }
       for (auto &node : subgraph_kernel->nodes()) {
         ret = node->Prepare();
         if (ret != RET_OK) {
@@ -727,6 +808,15 @@ int LiteSession::RunGraph(const KernelCallBack &before, const KernelCallBack &af
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "RunGraph failed : " << ret;
   }
+  auto calibrator = ThreadCostCalibrator::GetInstance();
+  if (calibrator->enabled() && calibrator->SaveIfUpdated() != RET_OK) {
+    MS_LOG(WARNING) << "Save the calibrated thread cost failed.";
+  }
+  // a layer of unknown shape at CompileGraph is tuned in its first run.
+  auto tuner = KernelTuner::GetInstance();
+  if (tuner->enabled() && tuner->SaveIfUpdated() != RET_OK) {
+    MS_LOG(WARNING) << "Save the kernel tuning file failed.";
+  }
   is_running_.store(false);
   return ret;
 }
@@ -1288,6 +1378,10 @@ int LiteSession::RuntimeAllocatorValid() {
     MS_LOG(DEBUG) << "Not support runtime allocator in subgraph parallel.";
     return RET_ERROR;
   }
+  if (ParseMaxBranchNum() > 1) {
+    MS_LOG(DEBUG) << "Not support runtime allocator in operator parallel.";
+    return RET_ERROR;
+  }
   if (is_train_session_ == true) {
     MS_LOG(DEBUG) << "Not support runtime allocator in train session.";
     return RET_ERROR;
@@ -1304,11 +1398,16 @@ int LiteSession::RuntimeAllocatorValid() {
   MS_LOG(DEBUG) << "support runtime allocator.";
   return RET_OK;
 #endif
+  if (ParseStaticMemoryPlan()) {
+    MS_LOG(DEBUG) << "support runtime allocator by config.";
+    return RET_OK;
+  }
   return RET_ERROR;
 }
 
 void LiteSession::RuntimeAllocatorInitGraphOutput() {
   AllocatorPtr default_allocator = context_->allocator;
+  runtime_allocator_->NextStep();
   for (auto graph_out : isolate_graph_output_map_) {
     auto cal_t = graph_out.first;
     auto out_t = graph_out.second;
@@ -1338,15 +1437,15 @@ void RuntimeAllocatorInitSubgraphInputs(const kernel::KernelExec *subgraph, cons
       in_tensor->set_allocator(src_t->allocator());
       if (src_t->allocator() == runtime_allocator) {
         (*tensor_ref_count)[in_tensor] = in_tensor->init_ref_count();
-        (*data_ref_count)[runtime_allocator->GetOffsetMap().at(src_t)] += in_tensor->init_ref_count();
-        runtime_allocator->SetDataOffset(in_tensor, runtime_allocator->GetOffsetMap().at(src_t));
+        (*data_ref_count)[runtime_allocator->GetBufferId(src_t)] += in_tensor->init_ref_count();
+        runtime_allocator->ShareTensorData(in_tensor, src_t);
       }
     } else {
       if (in_tensor->allocator() == default_allocator) {
         in_tensor->set_allocator(runtime_allocator);
         runtime_allocator->MallocTensorData(in_tensor);
         (*tensor_ref_count)[in_tensor] = in_tensor->init_ref_count();
-        (*data_ref_count)[runtime_allocator->GetOffsetMap().at(in_tensor)] = in_tensor->init_ref_count();
+        (*data_ref_count)[runtime_allocator->GetBufferId(in_tensor)] = in_tensor->init_ref_count();
       }
     }
 
@@ -1355,10 +1454,10 @@ void RuntimeAllocatorInitSubgraphInputs(const kernel::KernelExec *subgraph, cons
     }
 
     (*tensor_ref_count)[src_t]--;
-    (*data_ref_count)[runtime_allocator->GetOffsetMap().at(src_t)]--;
+    (*data_ref_count)[runtime_allocator->GetBufferId(src_t)]--;
 
     if ((*tensor_ref_count)[src_t] <= 0) {
-      if ((*data_ref_count)[runtime_allocator->GetOffsetMap().at(src_t)] <= 0) {
+      if ((*data_ref_count)[runtime_allocator->GetBufferId(src_t)] <= 0) {
         runtime_allocator->FreeTensorData(src_t);
       }
     }
@@ -1375,20 +1474,32 @@ void LiteSession::RuntimeAllocatorInitSubgraph() {
       continue;
     }
 
+    runtime_allocator_->NextStep();
     RuntimeAllocatorInitSubgraphInputs(subgraph, default_allocator, runtime_allocator_, isolate_input_map_,
                                        &tensor_ref_count, &data_ref_count);
 
     auto kernel_list = reinterpret_cast<kernel::SubGraphKernel *>(subgraph)->nodes();
     for (auto kernel : kernel_list) {
+      runtime_allocator_->NextStep();
       /* malloc for output */
       for (auto tensor : kernel->out_tensors()) {
         if (tensor->allocator() != default_allocator) {
           continue;
         }
         tensor->set_allocator(runtime_allocator_);
-        runtime_allocator_->MallocTensorData(tensor);
+        Tensor *in_place_input = nullptr;
+        if (!tensor->IsGraphOutput() && tensor->init_ref_count() > 0 &&
+            isolate_graph_output_map_.find(tensor) == isolate_graph_output_map_.end()) {
+          in_place_input = FindInPlaceInput(kernel, tensor, runtime_allocator_, tensor_ref_count, data_ref_count);
+        }
         tensor_ref_count[tensor] = tensor->init_ref_count();
-        data_ref_count[runtime_allocator_->GetOffsetMap().at(tensor)] = tensor->init_ref_count();
+        if (in_place_input != nullptr) {
+          runtime_allocator_->ShareTensorData(tensor, in_place_input);
+          data_ref_count[runtime_allocator_->GetBufferId(tensor)] += tensor->init_ref_count();
+        } else {
+          runtime_allocator_->MallocTensorData(tensor);
+          data_ref_count[runtime_allocator_->GetBufferId(tensor)] = tensor->init_ref_count();
+        }
       }
 
       /* free input after run */
@@ -1397,10 +1508,10 @@ void LiteSession::RuntimeAllocatorInitSubgraph() {
           continue;
         }
         tensor_ref_count[tensor]--;
-        data_ref_count[runtime_allocator_->GetOffsetMap().at(tensor)]--;
+        data_ref_count[runtime_allocator_->GetBufferId(tensor)]--;
 
         if (tensor_ref_count[tensor] <= 0 && tensor->allocator() == runtime_allocator_) {
-          if (data_ref_count[runtime_allocator_->GetOffsetMap().at(tensor)] <= 0) {
+          if (data_ref_count[runtime_allocator_->GetBufferId(tensor)] <= 0) {
             runtime_allocator_->FreeTensorData(tensor);
           }
         }
@@ -1431,6 +1542,10 @@ int LiteSession::RuntimeAllocatorInit() {
 
   RuntimeAllocatorInitGraphOutput();
 
+  runtime_allocator_->Plan();
+  MS_LOG(INFO) << "Static memory plan: arena " << runtime_allocator_->total_size() << " bytes, live peak "
+               << runtime_allocator_->LivePeak() << " bytes.";
+
   auto ret = RuntimeAllocatorSetData();
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "using optimize allocator failed.";
@@ -1665,27 +1780,201 @@ int lite::LiteSession::LoadModelAndCompileByBuf(const char *model_buf, mindspore
   return RET_OK;
 }
 
+bool lite::LiteSession::ParseMmapModel() {
+  if (config_info_ == nullptr) {
+    return false;
+  }
+  auto ms_weight = config_info_->find(kWeight);
+  if (ms_weight == config_info_->end()) {
+    return false;
+  }
+  auto mmap_iter = ms_weight->second.find(kMmapModel);
+  return mmap_iter != ms_weight->second.end() && mmap_iter->second == "true";
+}
+
+bool lite::LiteSession::ParseStaticMemoryPlan() {
+  if (config_info_ == nullptr) {
+    return false;
+  }
+  auto memory_plan = config_info_->find(kMemoryPlan);
+  if (memory_plan == config_info_->end()) {
+    return false;
+  }
+  auto iter = memory_plan->second.find(kStaticMemoryPlan);
+  return iter != memory_plan->second.end() && iter->second == "true";
+}
+
+int lite::LiteSession::ParseMaxBranchNum() {
+  if (config_info_ == nullptr || is_control_flow_ || context_->enable_parallel_ ||
+      context_->inter_op_parallel_num_ > 1) {
+    return 1;
+  }
+  auto operator_parallel = config_info_->find(kOperatorParallel);
+  if (operator_parallel == config_info_->end()) {
+    return 1;
+  }
+  auto iter = operator_parallel->second.find(kMaxBranchNum);
+  if (iter == operator_parallel->second.end()) {
+    return 1;
+  }
+  int max_branch_num = 1;
+  if (!ConvertStrToInt(iter->second, &max_branch_num) || max_branch_num < 1) {
+    MS_LOG(WARNING) << "Invalid " << kMaxBranchNum << ": " << iter->second << ", run the kernels sequentially.";
+    return 1;
+  }
+  return max_branch_num;
+}
+
+int lite::LiteSession::InitThreadCostCalibrator() {
+  if (config_info_ == nullptr) {
+    return RET_OK;
+  }
+  auto thread_cost = config_info_->find(kThreadCost);
+  if (thread_cost == config_info_->end()) {
+    return RET_OK;
+  }
+  auto file_iter = thread_cost->second.find(kCalibrationFile);
+  if (file_iter == thread_cost->second.end()) {
+    return RET_OK;
+  }
+  int warmup_num = kDefaultCalibrationWarmupNum;
+  auto warmup_iter = thread_cost->second.find(kCalibrationWarmupNum);
+  if (warmup_iter != thread_cost->second.end() && !ConvertStrToInt(warmup_iter->second, &warmup_num)) {
+    MS_LOG(ERROR) << "Invalid " << kCalibrationWarmupNum << ": " << warmup_iter->second;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  return ThreadCostCalibrator::GetInstance()->Init(file_iter->second, warmup_num, context_);
+}
+
+// [kernel_tuning] tuning_file=path selects the algorithms of the tuned layers from the file, tune=true times the
+// candidates of the other layers run_num times and records the fastest to the file.
+int lite::LiteSession::InitKernelTuner() {
+  if (config_info_ == nullptr) {
+    return RET_OK;
+  }
+  auto kernel_tuning = config_info_->find(kKernelTuning);
+  if (kernel_tuning == config_info_->end()) {
+    return RET_OK;
+  }
+  auto file_iter = kernel_tuning->second.find(kTuningFile);
+  if (file_iter == kernel_tuning->second.end()) {
+    return RET_OK;
+  }
+  auto tune_iter = kernel_tuning->second.find(kTuneMode);
+  bool tune = tune_iter != kernel_tuning->second.end() && tune_iter->second == "true";
+  int run_num = kDefaultTuneRunNum;
+  auto run_num_iter = kernel_tuning->second.find(kTuneRunNum);
+  if (run_num_iter != kernel_tuning->second.end() && !ConvertStrToInt(run_num_iter->second, &run_num)) {
+    MS_LOG(ERROR) << "Invalid " << kTuneRunNum << ": " << run_num_iter->second;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  return KernelTuner::GetInstance()->Init(file_iter->second, tune, run_num);
+}
+
+// [weight] share_weight=true shares the weights with the other sessions of the process through the shared weight store,
+// shared_weight_files=a.ms;b.ms keeps the decoded weights of the files in the store even if no session holds them. The
+// weights a session casts to fp16 are shared by the sessions but not kept.
+int lite::LiteSession::InitSharedWeight(bool *share_weight) {
+  *share_weight = false;
+  if (config_info_ == nullptr || is_train_session_) {
+    return RET_OK;
+  }
+  auto ms_weight = config_info_->find(kWeight);
+  if (ms_weight == config_info_->end()) {
+    return RET_OK;
+  }
+  auto share_iter = ms_weight->second.find(kShareWeight);
+  *share_weight = share_iter != ms_weight->second.end() && share_iter->second == "true";
+  auto files_iter = ms_weight->second.find(kSharedWeightFiles);
+  if (files_iter == ms_weight->second.end()) {
+    return RET_OK;
+  }
+  *share_weight = true;
+  for (auto &file : StrSplit(files_iter->second, ";")) {
+    if (file.empty() || !PackWeightManager::GetInstance()->AddSharedWeightFile(file)) {
+      continue;
+    }
+    auto model = LiteImportFromPath(file.c_str());
+    if (model == nullptr) {
+      MS_LOG(ERROR) << "Import shared weight file " << file << " failed.";
+      return RET_INPUT_PARAM_INVALID;
+    }
+    // the store is keyed by the data the kernels hold, that is after the weights are decoded
+    size_t weight_size = 0;
+    for (size_t i = 0; i < model->graph_.all_tensors_.size(); ++i) {
+      auto schema_tensor = model->GetSchemaTensor(i);
+      if (schema_tensor == nullptr || schema_tensor->data() == nullptr || schema_tensor->length() == 0) {
+        continue;
+      }
+      std::unique_ptr<Tensor> tensor(ConvertTensor(*model->graph_.all_tensors_[i]));
+      if (tensor == nullptr || !tensor->IsConst() || tensor->data_type() == kObjectTypeTensorType) {
+        continue;
+      }
+      if (ConvertTensorsData(model, i, tensor.get()) != RET_OK || tensor->data() == nullptr ||
+          PackWeightManager::GetInstance()->PinSharedWeight(tensor->data(), tensor->Size()) != RET_OK) {
+        MS_LOG(WARNING) << "Tensor " << i << " of " << file << " is not shared.";
+        continue;
+      }
+      weight_size += tensor->Size();
+    }
+    MS_LOG(INFO) << "Registered " << weight_size << " bytes shared weight of " << file;
+    delete model;
+  }
+  return RET_OK;
+}
+
+const char *lite::LiteSession::LoadModelByMmap(const std::string &file, mindspore::ModelType model_type,
+                                               size_t *size) {
+  size_t buf_size = 0;
+  auto model_buf = lite::ReadFileByMmap(file, &buf_size);
+  if (model_buf == nullptr) {
+    return nullptr;
+  }
+  // only a ms lite model is used in place, the other models are converted into a new buffer
+  flatbuffers::Verifier verify(reinterpret_cast<const uint8_t *>(model_buf), buf_size);
+  if ((model_type != mindspore::ModelType::kMindIR_Lite && model_type != mindspore::ModelType::kMindIR) ||
+      lite::LiteModel::VersionVerify(&verify) == SCHEMA_INVALID) {
+    lite::UnmapMmapBuffer(model_buf, buf_size);
+    return nullptr;
+  }
+  *size = buf_size;
+  return model_buf;
+}
+
 int lite::LiteSession::LoadModelAndCompileByPath(const std::string &model_path, mindspore::ModelType model_type) {
   size_t model_size;
-  auto model_buf = LoadModelByPath(model_path, model_type, &model_size);
+  // with mmap, the weights are used in place from the page cache and shared by all the processes loading the model
+  const char *model_buf = ParseMmapModel() ? LoadModelByMmap(model_path, model_type, &model_size) : nullptr;
+  bool by_mmap = model_buf != nullptr;
+  if (!by_mmap) {
+    model_buf = LoadModelByPath(model_path, model_type, &model_size);
+  }
   if (model_buf == nullptr) {
     MS_LOG(ERROR) << "Read model file failed";
     return RET_ERROR;
   }
+  auto free_model_buf = [by_mmap, model_size](const char *buf) {
+    if (by_mmap) {
+      lite::UnmapMmapBuffer(const_cast<char *>(buf), model_size);
+    } else {
+      delete[] buf;
+    }
+  };
   auto *model = lite::ImportFromBuffer(model_buf, model_size, true, model_type, model_path);
   if (model == nullptr) {
     MS_LOG(ERROR) << "Import model failed";
-    delete[] model_buf;
+    free_model_buf(model_buf);
     return RET_ERROR;
   }
   auto status = lite::PackWeightManager::GetInstance()->InitPackWeightByBuf(model_buf, model_size);
   MS_CHECK_FALSE_MSG(status != RET_OK, RET_ERROR, "InitPackWeightByBuf failed.");
 
   (reinterpret_cast<lite::LiteModel *>(model))->set_keep_model_buf(true);
+  (reinterpret_cast<lite::LiteModel *>(model))->set_model_buf_by_mmap(by_mmap);
   auto ret = CompileGraph(model);
   if (ret != lite::RET_OK) {
     MS_LOG(ERROR) << "Compile model failed";
-    delete[] model_buf;
+    free_model_buf(model_buf);
     model->buf = nullptr;
     delete model;
     return RET_ERROR;
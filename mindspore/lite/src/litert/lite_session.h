@@ -132,6 +132,13 @@ class LiteSession {
     const std::unordered_map<Tensor *, Tensor *> &isolate_input_map = std::unordered_map<Tensor *, Tensor *>());
   static void FreePackOpWeight(const std::vector<kernel::KernelExec *> &kernels);
   std::string ParseWeightPath();
+  bool ParseMmapModel();
+  bool ParseStaticMemoryPlan();
+  int ParseMaxBranchNum();
+  int InitThreadCostCalibrator();
+  int InitKernelTuner();
+  int InitSharedWeight(bool *share_weight);
+  const char *LoadModelByMmap(const std::string &file, mindspore::ModelType model_type, size_t *size);
 
  private:
   int PreCheck(Model *model);
@@ -19,7 +19,6 @@
 namespace mindspore::lite {
 STATUS PackWeight::InitWeightManagerByBuf(const char *model_buf, size_t model_size, int numa_id, bool copy_buf) {
   MS_CHECK_TRUE_MSG(model_buf != nullptr, RET_ERROR, "model buf is nullptr in pack weight manager.");
-  copy_buf_ = copy_buf;
   if (model_buf_map_.find(model_buf) != model_buf_map_.end() &&
       find(numa_model_buf_[model_buf].begin(), numa_model_buf_[model_buf].end(), numa_id) !=
         numa_model_buf_[model_buf].end()) {
@@ -42,7 +41,7 @@ STATUS PackWeight::InitWeightManagerByBuf(const char *model_buf, size_t model_si
     MS_LOG(ERROR) << "model const weight is nullptr.";
     return RET_ERROR;
   }
-  if (copy_buf_) {
+  if (copy_buf) {
     auto new_model_buf = static_cast<char *>(allocator->Malloc(model_size));
     if (new_model_buf == nullptr) {
       MS_LOG(ERROR) << "new model buf is nullptr in pack weight manager.";
@@ -56,6 +55,7 @@ STATUS PackWeight::InitWeightManagerByBuf(const char *model_buf, size_t model_si
       numa_model_buf_[model_buf].push_back(numa_id);
       model_buf_map_[model_buf].push_back(new_model_buf);
     }
+    (void)copied_bufs_.insert(new_model_buf);
     buf_model_weight_[new_model_buf] = model_const_weight;
     buf_model_weight_[new_model_buf]->allocator = allocator;
     model_const_weight->numa_id = numa_id;
@@ -66,6 +66,26 @@ STATUS PackWeight::InitWeightManagerByBuf(const char *model_buf, size_t model_si
   return RET_OK;
 }
 
+STATUS PackWeight::InitWeightManagerInPlace(const char *model_buf, int numa_id) {
+  MS_CHECK_TRUE_MSG(model_buf != nullptr, RET_ERROR, "model buf is nullptr in pack weight manager.");
+  std::lock_guard<std::mutex> lock(mtx_weight_);
+  auto iter = numa_model_buf_.find(model_buf);
+  if (iter != numa_model_buf_.end()) {
+    if (find(iter->second.begin(), iter->second.end(), numa_id) == iter->second.end()) {
+      iter->second.push_back(numa_id);
+      model_buf_map_[model_buf].push_back(const_cast<char *>(model_buf));
+    }
+    return RET_OK;
+  }
+  auto *model_const_weight = new (std::nothrow) ModelConstWeight();
+  MS_CHECK_TRUE_MSG(model_const_weight != nullptr, RET_ERROR, "model const weight is nullptr.");
+  model_const_weight->allocator = std::make_shared<DefaultAllocator>();
+  numa_model_buf_[model_buf] = {numa_id};
+  model_buf_map_[model_buf] = {const_cast<char *>(model_buf)};
+  buf_model_weight_[model_buf] = model_const_weight;
+  return RET_OK;
+}
+
 char *PackWeight::GetNumaModelBuf(const char *model_buf, int numa_id) {
   if (model_buf_map_.find(model_buf) == model_buf_map_.end() ||
       find(numa_model_buf_[model_buf].begin(), numa_model_buf_[model_buf].end(), numa_id) ==
@@ -225,25 +245,51 @@ void PackWeight::FreeFp16ToFp32Data(ModelConstWeight *weight) {
   weight->fp16_fp32_data.clear();
 }
 
-PackWeight::~PackWeight() {
-  std::lock_guard<std::mutex> lock(mtx_weight_);
-  for (auto &item : buf_model_weight_) {
-    FreePackedWeight(item.second);
-    FreeFp16ToFp32Data(item.second);
-    FreeTensorData(item.second);
+void PackWeight::FreeModelConstWeight(const char *model_buf) {
+  auto iter = buf_model_weight_.find(model_buf);
+  if (iter == buf_model_weight_.end()) {
+    return;
   }
-  // free model buf
-  if (copy_buf_) {
-    for (auto &item : buf_model_weight_) {
-      auto model_buf = const_cast<char *>(item.first);
-      if (item.second != nullptr) {
-        auto &allocator = item.second->allocator;
-        allocator->Free(model_buf);
-        delete item.second;
-        item.second = nullptr;
-      }
+  auto weight = iter->second;
+  if (weight == nullptr) {
+    buf_model_weight_.erase(iter);
+    return;
+  }
+  for (auto &data : weight->fp16_fp32_data) {
+    for (auto pair = fp16_fp32_data_pair_.begin(); pair != fp16_fp32_data_pair_.end();) {
+      pair = pair->second == data ? fp16_fp32_data_pair_.erase(pair) : std::next(pair);
     }
-    buf_model_weight_.clear();
+  }
+  FreePackedWeight(weight);
+  FreeFp16ToFp32Data(weight);
+  FreeTensorData(weight);
+  if (copied_bufs_.erase(model_buf) > 0) {
+    weight->allocator->Free(const_cast<char *>(model_buf));
+  }
+  delete weight;
+  buf_model_weight_.erase(iter);
+}
+
+void PackWeight::FreeModelBuf(const char *model_buf) {
+  std::lock_guard<std::mutex> lock(mtx_weight_);
+  auto iter = model_buf_map_.find(model_buf);
+  if (iter == model_buf_map_.end()) {
+    FreeModelConstWeight(model_buf);
+    return;
+  }
+  // the model buf used in place appears once per numa node
+  std::set<char *> bufs(iter->second.begin(), iter->second.end());
+  for (auto buf : bufs) {
+    FreeModelConstWeight(buf);
+  }
+  model_buf_map_.erase(iter);
+  numa_model_buf_.erase(model_buf);
+}
+
+PackWeight::~PackWeight() {
+  std::lock_guard<std::mutex> lock(mtx_weight_);
+  while (!buf_model_weight_.empty()) {
+    FreeModelConstWeight(buf_model_weight_.begin()->first);
   }
 }
 }  // namespace mindspore::lite
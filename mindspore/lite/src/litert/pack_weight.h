@@ -42,7 +42,11 @@ class PackWeight {
   PackWeight() = default;
   ~PackWeight();
   STATUS InitWeightManagerByBuf(const char *model_buf, size_t model_size, int numa_id = -1, bool copy_buf = false);
+  // the workers of the numa node use model_buf in place, the caller keeps it alive until FreeModelBuf.
+  STATUS InitWeightManagerInPlace(const char *model_buf, int numa_id);
   char *GetNumaModelBuf(const char *model_buf, int numa_id);
+  // release the weights of model_buf and its copies, after the models built from them are released.
+  void FreeModelBuf(const char *model_buf);
   STATUS StoreOriginTensorData(const char *model_buf, const void *origin_tensor_data);
   void *GetPackData(const void *tensor_data, const size_t size, bool *is_packed);
   STATUS ReplaceOriginTensorData(const char *model_buf, std::vector<Tensor *> *tensors, int tensor_index);
@@ -53,8 +57,11 @@ class PackWeight {
   void FreeTensorData(ModelConstWeight *weight);
   void FreeFp16ToFp32Data(ModelConstWeight *weight);
 
-  bool copy_buf_ = false;
+  void FreeModelConstWeight(const char *model_buf);
+
   std::mutex mtx_weight_;
+  // the model bufs copied by the pack weight, the others are owned by the caller.
+  std::set<const char *> copied_bufs_;
   std::unordered_map<const char *, ModelConstWeight *> buf_model_weight_;
   std::unordered_map<const char *, std::vector<int>> numa_model_buf_;
   std::unordered_map<const char *, std::vector<char *>> model_buf_map_;
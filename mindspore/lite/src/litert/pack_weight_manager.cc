@@ -14,14 +14,236 @@
  * limitations under the License.
  */
 #include "src/litert/pack_weight_manager.h"
+#include <string.h>
+#include <functional>
+#include <string_view>
 #include <vector>
+#include "nnacl/op_base.h"
 #include "src/common/graph_util.h"
 namespace mindspore::lite {
 namespace {
 #ifndef __ANDROID__
 constexpr size_t kMemAlignSize = 64;
 #endif
+constexpr uint64_t kFnvOffsetBasis = 14695981039346656037ULL;
+constexpr uint64_t kFnvPrime = 1099511628211ULL;
+
+void *MallocData(size_t size) {
+  if (size > MAX_MALLOC_SIZE || size == 0) {
+    MS_LOG(ERROR) << "malloc size is wrong.";
+    return nullptr;
+  }
+  void *data = nullptr;
+#ifdef _WIN32
+  size_t round_size = (size + kMemAlignSize - 1) & (~(kMemAlignSize - 1));
+  data = _aligned_malloc(round_size, kMemAlignSize);
+#elif defined(__ANDROID__)
+  data = malloc(size);
+#else
+  size_t round_size = (size + kMemAlignSize - 1) & (~(kMemAlignSize - 1));
+  auto ret = posix_memalign(&data, kMemAlignSize, round_size);
+  if (ret != 0) {
+    MS_LOG(ERROR) << "posix_memalign failed.";
+    return nullptr;
+  }
+#endif
+  return data;
+}
+
+void FreeData(void *tensor_data) {
+  if (tensor_data != nullptr) {
+#ifdef _WIN32
+    _aligned_free(tensor_data);
+#else
+    free(tensor_data);
+#endif
+    tensor_data = nullptr;
+  }
+}
+
+// two independent 64 bits hashes, the packed data are found by the hashes of the origin data only.
+void HashContent(const void *data, size_t size, uint64_t *hash) {
+  auto bytes = static_cast<const char *>(data);
+  hash[0] = std::hash<std::string_view>()(std::string_view(bytes, size));
+  uint64_t fnv = kFnvOffsetBasis;
+  size_t i = 0;
+  for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+    uint64_t word;
+    memcpy(&word, bytes + i, sizeof(uint64_t));
+    fnv = (fnv ^ word) * kFnvPrime;
+  }
+  for (; i < size; ++i) {
+    fnv = (fnv ^ static_cast<uint8_t>(bytes[i])) * kFnvPrime;
+  }
+  hash[1] = fnv;
+}
 }  // namespace
+
+SharedWeightAllocator::~SharedWeightAllocator() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  for (auto &item : buffers_) {
+    FreeData(item.second.data);
+  }
+  buffers_.clear();
+  buffer_keys_.clear();
+}
+
+void *SharedWeightAllocator::NewBuffer(const ContentKey &key, size_t size) {
+  auto data = MallocData(size);
+  if (data == nullptr) {
+    return nullptr;
+  }
+  Buffer buffer;
+  buffer.data = data;
+  buffer.ref_count = 1;
+  buffers_[key] = buffer;
+  buffer_keys_[data] = key;
+  return data;
+}
+
+void *SharedWeightAllocator::GetSharedData(const void *data, size_t size) {
+  MS_CHECK_TRUE_RET(data != nullptr && size != 0, nullptr);
+  ContentKey key;
+  HashContent(data, size, key.hash);
+  key.size = size;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = buffers_.find(key);
+  if (iter != buffers_.end()) {
+    if (memcmp(iter->second.data, data, size) != 0) {
+      MS_LOG(INFO) << "Hash collision of " << size << " bytes weight, do not share it.";
+      return nullptr;
+    }
+    ++iter->second.ref_count;
+    return iter->second.data;
+  }
+  auto shared_data = NewBuffer(key, size);
+  if (shared_data != nullptr) {
+    memcpy(shared_data, data, size);
+  }
+  return shared_data;
+}
+
+void *SharedWeightAllocator::GetPackData(const void *origin_data, size_t size, const PackFormat &format,
+                                         bool *is_packed) {
+  if (format.kernel_type < 0) {
+    return nullptr;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto key_iter = buffer_keys_.find(origin_data);
+  if (key_iter == buffer_keys_.end() || key_iter->second.pack_size != 0) {
+    return nullptr;
+  }
+  auto key = key_iter->second;
+  key.pack_size = size;
+  key.kernel_type = format.kernel_type;
+  key.layout = format.layout;
+  key.dims = format.dims;
+  auto iter = buffers_.find(key);
+  if (iter == buffers_.end()) {
+    *is_packed = false;
+    auto data = NewBuffer(key, size);
+    if (data != nullptr) {
+      buffers_[key].ready = false;
+    }
+    return data;
+  }
+  // the reference keeps the buffer in the map while waiting
+  auto &buffer = iter->second;
+  ++buffer.ref_count;
+  ready_cond_.wait(lock, [&buffer]() { return buffer.ready || buffer.abandoned; });
+  if (!buffer.ready) {
+    MS_LOG(INFO) << "The packer of " << size << " bytes weight released it before packing, pack it again.";
+    buffer.abandoned = false;
+    *is_packed = false;
+    return buffer.data;
+  }
+  *is_packed = true;
+  return buffer.data;
+}
+
+void SharedWeightAllocator::PackDone(void *pack_data) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto key_iter = buffer_keys_.find(pack_data);
+    if (key_iter == buffer_keys_.end()) {
+      return;
+    }
+    auto &buffer = buffers_[key_iter->second];
+    buffer.ready = true;
+    buffer.abandoned = false;
+  }
+  ready_cond_.notify_all();
+}
+
+bool SharedWeightAllocator::IsShared(const void *ptr) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return buffer_keys_.find(ptr) != buffer_keys_.end();
+}
+
+int SharedWeightAllocator::RefCount(void *ptr) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto key_iter = buffer_keys_.find(ptr);
+  return key_iter == buffer_keys_.end() ? 0 : buffers_[key_iter->second].ref_count;
+}
+
+int SharedWeightAllocator::SetRefCount(void *ptr, int ref_count) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto key_iter = buffer_keys_.find(ptr);
+  if (key_iter == buffer_keys_.end()) {
+    return -1;
+  }
+  auto &buffer = buffers_[key_iter->second];
+  buffer.ref_count = ref_count;
+  return buffer.ref_count;
+}
+
+int SharedWeightAllocator::IncRefCount(void *ptr, int ref_count) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto key_iter = buffer_keys_.find(ptr);
+  if (key_iter == buffer_keys_.end()) {
+    return -1;
+  }
+  auto &buffer = buffers_[key_iter->second];
+  buffer.ref_count += ref_count;
+  return buffer.ref_count;
+}
+
+int SharedWeightAllocator::DecRefCount(void *ptr, int ref_count) {
+  int left_count = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto key_iter = buffer_keys_.find(ptr);
+    if (key_iter == buffer_keys_.end()) {
+      return -1;
+    }
+    auto &buffer = buffers_[key_iter->second];
+    buffer.ref_count -= ref_count;
+    left_count = buffer.ref_count;
+    if (buffer.ready) {
+      return left_count;
+    }
+    // a waiter takes over the packing
+    buffer.abandoned = true;
+  }
+  ready_cond_.notify_all();
+  return left_count;
+}
+
+void SharedWeightAllocator::Free(void *ptr) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto key_iter = buffer_keys_.find(ptr);
+  if (key_iter == buffer_keys_.end()) {
+    return;
+  }
+  auto iter = buffers_.find(key_iter->second);
+  if (iter->second.ref_count > 0) {
+    return;
+  }
+  FreeData(iter->second.data);
+  buffers_.erase(iter);
+  buffer_keys_.erase(key_iter);
+}
+
 PackWeightManager *PackWeightManager::GetInstance() {
   static PackWeightManager instance;
   return &instance;
@@ -53,7 +275,7 @@ STATUS PackWeightManager::InitPackWeightByBuf(const char *model_buf, size_t mode
   return RET_OK;
 }
 
-STATUS PackWeightManager::InitPackWeight(const char *model_buf, size_t model_size, int numa_id) {
+STATUS PackWeightManager::InitPackWeight(const char *model_buf, size_t model_size, int numa_id, bool copy_buf) {
 #ifdef SHARING_MODEL_WEIGHT
   if (pack_weight_ == nullptr) {
     pack_weight_ = std::make_shared<PackWeight>();
@@ -62,7 +284,8 @@ STATUS PackWeightManager::InitPackWeight(const char *model_buf, size_t model_siz
       return RET_ERROR;
     }
   }
-  auto status = pack_weight_->InitWeightManagerByBuf(model_buf, model_size, numa_id, true);
+  auto status = copy_buf ? pack_weight_->InitWeightManagerByBuf(model_buf, model_size, numa_id, true)
+                         : pack_weight_->InitWeightManagerInPlace(model_buf, numa_id);
   if (status != RET_OK) {
     MS_LOG(ERROR) << "InitWeightManagerByBuf failed.";
     return RET_ERROR;
@@ -72,6 +295,14 @@ STATUS PackWeightManager::InitPackWeight(const char *model_buf, size_t model_siz
   return RET_OK;
 }
 
+void PackWeightManager::FreeModelBuf(const char *model_buf) {
+#ifdef SHARING_MODEL_WEIGHT
+  if (pack_weight_ != nullptr) {
+    pack_weight_->FreeModelBuf(model_buf);
+  }
+#endif
+}
+
 char *PackWeightManager::GetNumaModelBuf(const char *model_buf, int numa_id) {
 #ifdef SHARING_MODEL_WEIGHT
   return pack_weight_->GetNumaModelBuf(model_buf, numa_id);
@@ -124,29 +355,38 @@ void *PackWeightManager::ReplaceFp16Data(void *origin_fp16_data, size_t size, bo
   return nullptr;
 }
 
-void *PackWeightManager::MallocData(size_t size) {
-  if (size > MAX_MALLOC_SIZE || size == 0) {
-    MS_LOG(ERROR) << "malloc size is wrong.";
-    return nullptr;
+STATUS PackWeightManager::ShareTensorData(Tensor *tensor) {
+  MS_CHECK_TRUE_RET(tensor != nullptr, RET_ERROR);
+  if (tensor->data() == nullptr || shared_weight_->IsShared(tensor->data())) {
+    return RET_OK;
   }
-  void *data = nullptr;
-#ifdef _WIN32
-  size_t round_size = (size + kMemAlignSize - 1) & (~(kMemAlignSize - 1));
-  data = _aligned_malloc(round_size, kMemAlignSize);
-#elif defined(__ANDROID__)
-  data = malloc(size);
-#else
-  size_t round_size = (size + kMemAlignSize - 1) & (~(kMemAlignSize - 1));
-  auto ret = posix_memalign(&data, kMemAlignSize, round_size);
-  if (ret != 0) {
-    MS_LOG(ERROR) << "posix_memalign failed.";
-    return nullptr;
+  auto shared_data = shared_weight_->GetSharedData(tensor->data(), tensor->Size());
+  if (shared_data == nullptr) {
+    return RET_NOT_SUPPORT;
   }
-#endif
-  return data;
+  tensor->FreeData();
+  tensor->set_data(shared_data);
+  tensor->set_allocator(shared_weight_);
+  tensor->set_own_data(true);
+  return RET_OK;
 }
 
-void *PackWeightManager::GetPackData(const void *tensor_data, const size_t size, bool *is_packed) {
+STATUS PackWeightManager::PinSharedWeight(const void *data, size_t size) {
+  // the reference is never released
+  return shared_weight_->GetSharedData(data, size) == nullptr ? RET_ERROR : RET_OK;
+}
+
+bool PackWeightManager::AddSharedWeightFile(const std::string &file) {
+  std::lock_guard<std::mutex> lock(shared_file_mutex_);
+  return shared_weight_files_.insert(file).second;
+}
+
+void *PackWeightManager::GetPackData(const void *tensor_data, const size_t size, bool *is_packed,
+                                     const PackFormat &format) {
+  auto shared_pack_data = shared_weight_->GetPackData(tensor_data, size, format, is_packed);
+  if (shared_pack_data != nullptr) {
+    return shared_pack_data;
+  }
 #ifdef SHARING_MODEL_WEIGHT
   if (pack_weight_ == nullptr) {
     void *data = MallocData(size);
@@ -160,18 +400,15 @@ void *PackWeightManager::GetPackData(const void *tensor_data, const size_t size,
   return data;
 }
 
-void PackWeightManager::FreeData(void *tensor_data) {
-  if (tensor_data != nullptr) {
-#ifdef _WIN32
-    _aligned_free(tensor_data);
-#else
-    free(tensor_data);
-#endif
-    tensor_data = nullptr;
-  }
-}
+void PackWeightManager::PackDone(void *pack_data) { shared_weight_->PackDone(pack_data); }
 
 void PackWeightManager::Free(void *tensor_data) {
+  if (shared_weight_->IsShared(tensor_data)) {
+    if (shared_weight_->DecRefCount(tensor_data, 1) <= 0) {
+      shared_weight_->Free(tensor_data);
+    }
+    return;
+  }
 #ifdef SHARING_MODEL_WEIGHT
   if (pack_weight_ == nullptr) {
     FreeData(tensor_data);
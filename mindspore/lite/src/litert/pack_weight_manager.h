@@ -16,7 +16,14 @@
 
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_PACK_WEIGHT_MANAGER_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_PACK_WEIGHT_MANAGER_H_
+#include <condition_variable>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 #include "include/model.h"
 #include "include/errorcode.h"
@@ -25,24 +32,95 @@
 #include "src/litert/pack_weight.h"
 #endif
 namespace mindspore::lite {
+// What a kernel packs a weight into. The packs of one weight are told apart by the kernel type, the layout and the
+// dims the layout depends on, such as the shape and the transpose flags. A kernel_type of -1 never shares the pack.
+struct PackFormat {
+  int32_t kernel_type = -1;
+  std::string layout;
+  std::vector<int> dims;
+};
+
+// A process-wide store of constant tensor data keyed by the content: the sessions holding identical weights, of the
+// same model or not, share one copy, and so do the kernels packing them into the same format. The tensors release
+// their copy through the allocator interface, the kernels release the packed data through PackWeightManager::Free.
+class SharedWeightAllocator : public Allocator {
+ public:
+  SharedWeightAllocator() = default;
+  ~SharedWeightAllocator() override;
+  void *Malloc(size_t size) override { return nullptr; }
+  void Free(void *ptr) override;
+  int RefCount(void *ptr) override;
+  int SetRefCount(void *ptr, int ref_count) override;
+  int IncRefCount(void *ptr, int ref_count) override;
+  int DecRefCount(void *ptr, int ref_count) override;
+
+  // the shared copy of data, nullptr if the copy can not be made.
+  void *GetSharedData(const void *data, size_t size);
+  // the packed data of a shared copy origin_data, nullptr if origin_data is not from the store. The first caller of a
+  // format gets is_packed false and packs the data, the others wait until it calls PackDone, or take over the packing
+  // if it releases the data before.
+  void *GetPackData(const void *origin_data, size_t size, const PackFormat &format, bool *is_packed);
+  void PackDone(void *pack_data);
+  bool IsShared(const void *ptr);
+
+ private:
+  struct ContentKey {
+    uint64_t hash[2] = {0, 0};
+    size_t size = 0;
+    size_t pack_size = 0;
+    int32_t kernel_type = -1;
+    std::string layout;
+    std::vector<int> dims;
+    bool operator<(const ContentKey &other) const {
+      return std::tie(hash[0], hash[1], size, pack_size, kernel_type, layout, dims) <
+             std::tie(other.hash[0], other.hash[1], other.size, other.pack_size, other.kernel_type, other.layout,
+                      other.dims);
+    }
+  };
+  struct Buffer {
+    void *data = nullptr;
+    int ref_count = 0;
+    bool ready = true;      // false until the packed data is written
+    bool abandoned = false;  // the packer released the data before it is written
+  };
+  void *NewBuffer(const ContentKey &key, size_t size);
+  void Release(void *ptr, int ref_count);
+
+  std::mutex mutex_;
+  std::condition_variable ready_cond_;
+  std::map<ContentKey, Buffer> buffers_;
+  std::unordered_map<const void *, ContentKey> buffer_keys_;
+};
+
 class PackWeightManager {
  public:
   static PackWeightManager *GetInstance();
   ~PackWeightManager() = default;
-  STATUS InitPackWeight(const char *model_buf, size_t model_size, int numa_id = -1);
+  // with copy_buf false, the workers use model_buf in place and the caller releases it after FreeModelBuf.
+  STATUS InitPackWeight(const char *model_buf, size_t model_size, int numa_id = -1, bool copy_buf = true);
+  void FreeModelBuf(const char *model_buf);
   STATUS InitPackWeightByBuf(const char *model_buf, size_t model_size);
   char *GetNumaModelBuf(const char *model_buf, int numa_id);
   STATUS StoreOriginTensorData(Model *model, std::vector<Tensor *> *all_tensors);
-  void *GetPackData(const void *tensor_data, const size_t size, bool *is_packed);
+  void *GetPackData(const void *tensor_data, const size_t size, bool *is_packed, const PackFormat &format = {});
+  // called by the kernel which got is_packed false once it has written the packed data.
+  void PackDone(void *pack_data);
   void Free(void *tensor_data);
   bool IsCopyTensor(int op_type);
   void *ReplaceFp16Data(void *origin_fp16_data, size_t size, bool *replace);
+  // replaces the data of the const tensor with the copy from the shared weight store.
+  STATUS ShareTensorData(Tensor *tensor);
+  // keeps data in the shared weight store for the life of the process.
+  STATUS PinSharedWeight(const void *data, size_t size);
+  // false if the file is registered already.
+  bool AddSharedWeightFile(const std::string &file);
 
  private:
-  void *MallocData(size_t size);
-  void FreeData(void *tensor_data);
-  PackWeightManager() = default;
+  PackWeightManager() : shared_weight_(std::make_shared<SharedWeightAllocator>()) {}
   bool is_parallel_ = false;
+  std::shared_ptr<SharedWeightAllocator> shared_weight_ = nullptr;
+  std::mutex shared_file_mutex_;
+  std::set<std::string> shared_weight_files_;
 #ifdef SHARING_MODEL_WEIGHT
   std::shared_ptr<PackWeight> pack_weight_ = nullptr;
 #endif
@@ -15,6 +15,9 @@
  */
 
 #include "src/litert/runtime_allocator.h"
+#include <algorithm>
+#include <map>
+#include "nnacl/op_base.h"
 
 namespace mindspore {
 RuntimeAllocator::RuntimeAllocator(size_t aligned_size) {
@@ -36,52 +39,80 @@ void *RuntimeAllocator::MallocOptData() {
   return data_;
 }
 
-size_t RuntimeAllocator::FindMinFree(size_t size) {
-  size_t min_size = total_size_ + 1;
-  size_t min_addr = total_size_ + 1;
-  for (auto const &itr : free_list_) {
-    if (itr.second >= size && min_size > itr.second) {
-      min_size = itr.second;
-      min_addr = itr.first;
-    }
-  }
-  return min_addr;
+void RuntimeAllocator::MallocTensorData(lite::Tensor *tensor) {
+  Buffer buffer;
+  buffer.size = UP_ROUND(tensor->Size(), aligned_size_);
+  buffer.first_step = step_;
+  buffer_map_[tensor] = buffers_.size();
+  buffers_.push_back(buffer);
 }
 
-void RuntimeAllocator::FreeTensorData(lite::Tensor *tensor) {
-  size_t offset = offset_map_[tensor];
-  free_list_[offset] = used_list_[offset];
-  used_list_.erase(offset);
+void RuntimeAllocator::FreeTensorData(lite::Tensor *tensor) { buffers_.at(buffer_map_.at(tensor)).last_step = step_; }
 
-  size_t length = free_list_[offset];
+void RuntimeAllocator::ShareTensorData(lite::Tensor *tensor, lite::Tensor *src) {
+  buffer_map_[tensor] = buffer_map_.at(src);
+}
 
-  size_t post_offset = offset + length;
-  auto post_iter = free_list_.find(post_offset);
-  if (post_iter != free_list_.end()) {
-    size_t post_length = post_iter->second;
-    free_list_[offset] = length + post_length;
-    free_list_.erase(post_offset);
+void RuntimeAllocator::Plan() {
+  std::vector<size_t> order(buffers_.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
   }
+  std::stable_sort(order.begin(), order.end(),
+                   [this](size_t lhs, size_t rhs) { return buffers_[lhs].size > buffers_[rhs].size; });
 
-  auto pre_iter = free_list_.lower_bound(offset);
-  if (pre_iter != free_list_.begin()) {
-    pre_iter--;
-    size_t pre_offset = pre_iter->first;
-    if ((pre_offset + free_list_[pre_offset]) == offset) {
-      free_list_[pre_offset] = free_list_[pre_offset] + length;
-      free_list_.erase(offset);
+  total_size_ = 0;
+  std::vector<size_t> placed;
+  for (auto id : order) {
+    auto &buffer = buffers_[id];
+    std::map<size_t, size_t> conflicts; /* offset, end */
+    for (auto other_id : placed) {
+      auto &other = buffers_[other_id];
+      if (other.first_step <= buffer.last_step && buffer.first_step <= other.last_step) {
+        auto &end = conflicts[other.offset];
+        end = std::max(end, other.offset + other.size);
+      }
     }
+    // the lowest gap between the overlapped buffers that the buffer fits in
+    size_t offset = 0;
+    for (auto &conflict : conflicts) {
+      if (conflict.first >= offset + buffer.size) {
+        break;
+      }
+      offset = std::max(offset, conflict.second);
+    }
+    buffer.offset = offset;
+    total_size_ = std::max(total_size_, offset + buffer.size);
+    placed.push_back(id);
+  }
+
+  offset_map_.clear();
+  for (auto &iter : buffer_map_) {
+    offset_map_[iter.first] = buffers_[iter.second].offset;
   }
 }
 
-void RuntimeAllocator::SetDataOffset(lite::Tensor *tensor, size_t offset) {
-  offset_map_[tensor] = offset;
-  return;
+size_t RuntimeAllocator::LivePeak() const {
+  std::map<size_t, int64_t> deltas; /* step, bytes */
+  for (auto &buffer : buffers_) {
+    deltas[buffer.first_step] += static_cast<int64_t>(buffer.size);
+    if (buffer.last_step != SIZE_MAX) {
+      deltas[buffer.last_step + 1] -= static_cast<int64_t>(buffer.size);
+    }
+  }
+  int64_t live = 0;
+  int64_t peak = 0;
+  for (auto &delta : deltas) {
+    live += delta.second;
+    peak = std::max(peak, live);
+  }
+  return static_cast<size_t>(peak);
 }
 
 void RuntimeAllocator::Clear(AllocatorPtr default_allocator) {
   total_size_ = 0;
-  for (auto iter : offset_map_) {
+  step_ = 0;
+  for (auto iter : buffer_map_) {
     iter.first->set_allocator(default_allocator);
     iter.first->set_data(nullptr);
   }
@@ -89,35 +120,8 @@ void RuntimeAllocator::Clear(AllocatorPtr default_allocator) {
     free(data_);
     data_ = nullptr;
   }
+  buffers_.clear();
+  buffer_map_.clear();
   offset_map_.clear();
-  free_list_.clear();
-  used_list_.clear();
-}
-
-void RuntimeAllocator::MallocTensorData(lite::Tensor *tensor) {
-  size_t size = tensor->Size();
-  size_t offset = FindMinFree(size);
-
-  if (offset > total_size_) {
-    if (free_list_.empty()) {
-      offset = total_size_;
-    } else {
-      offset = free_list_.rbegin()->first;
-      if (offset + free_list_[offset] < total_size_) {
-        offset = total_size_;
-      } else {
-        free_list_.erase(offset);
-      }
-    }
-    total_size_ = offset + size;
-  } else {
-    if (free_list_[offset] > size) {
-      free_list_[offset + size] = free_list_[offset] - size;
-    }
-    free_list_.erase(offset);
-  }
-
-  used_list_[offset] = size;
-  offset_map_[tensor] = offset;
 }
 }  // namespace mindspore
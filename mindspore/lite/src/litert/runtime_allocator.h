@@ -17,9 +17,10 @@
 #ifndef MINDSPORE_LITE_SRC_RUNTIME_RUNTIME_ALLOCATOR_H_
 #define MINDSPORE_LITE_SRC_RUNTIME_RUNTIME_ALLOCATOR_H_
 
+#include <cstdint>
 #include <memory>
-#include <map>
 #include <unordered_map>
+#include <vector>
 #include "include/api/allocator.h"
 #include "include/errorcode.h"
 #include "src/tensor.h"
@@ -39,22 +40,39 @@ class RuntimeAllocator : public Allocator {
   int DecRefCount(void *ptr, int ref_count) override { return 0; }
 
  public:
-  void SetDataOffset(lite::Tensor *tensor, size_t offset);
+  // The tensor lifetimes are recorded in execution order first: a buffer lives from the step of its MallocTensorData
+  // to the step of its FreeTensorData. Plan then packs all the buffers into one arena, largest first, each at the
+  // lowest offset free of the buffers whose lifetimes overlap with its own.
+  void NextStep() { ++step_; }
   void MallocTensorData(lite::Tensor *tensor);
   void FreeTensorData(lite::Tensor *tensor);
+  // the tensor uses the buffer of src in place.
+  void ShareTensorData(lite::Tensor *tensor, lite::Tensor *src);
+  size_t GetBufferId(lite::Tensor *tensor) const { return buffer_map_.at(tensor); }
+  void Plan();
   void *MallocOptData();
   const std::unordered_map<lite::Tensor *, size_t> &GetOffsetMap() const { return offset_map_; }
+  // the arena size, valid after Plan.
+  size_t total_size() const { return total_size_; }
+  // the most bytes alive at the same time, the lower bound of the arena size.
+  size_t LivePeak() const;
   void Clear(AllocatorPtr default_allocator);
 
  private:
-  size_t FindMinFree(size_t size);
+  struct Buffer {
+    size_t size = 0;
+    size_t first_step = 0;
+    size_t last_step = SIZE_MAX;
+    size_t offset = 0;
+  };
 
  private:
   void *data_ = nullptr;
   size_t total_size_ = 0;
+  size_t step_ = 0;
+  std::vector<Buffer> buffers_;
+  std::unordered_map<lite::Tensor *, size_t> buffer_map_; /* tensor, buffer id */
   std::unordered_map<lite::Tensor *, size_t> offset_map_;
-  std::map<size_t, size_t> free_list_; /* offset, size */
-  std::map<size_t, size_t> used_list_; /* offset, size */
 };
 
 using RuntimeAllocatorPtr = std::shared_ptr<RuntimeAllocator>;
@@ -158,6 +158,28 @@ int CastKernelWeight(const kernel::SubGraphType &belong_subgraph_type, const ker
   return RET_OK;
 }
 
+// the copies of the weights come from the shared weight store, the packed data of them are shared too.
+int ShareConstTensorData(const std::vector<Tensor *> &tensors) {
+  for (auto *tensor : tensors) {
+    if (!tensor->IsConst() || tensor->data() == nullptr || tensor->data_type() == kObjectTypeTensorType) {
+      continue;
+    }
+    auto ret = lite::PackWeightManager::GetInstance()->ShareTensorData(tensor);
+    if (ret == RET_NOT_SUPPORT && !tensor->own_data()) {
+      auto copy_tensor = Tensor::CopyTensor(*tensor, true);
+      MS_CHECK_TRUE_MSG(copy_tensor != nullptr, RET_ERROR, "Copy tensor failed");
+      tensor->set_data(copy_tensor->data());
+      tensor->set_own_data(true);
+      copy_tensor->set_data(nullptr);
+      delete (copy_tensor);
+    } else if (ret != RET_OK && ret != RET_NOT_SUPPORT) {
+      MS_LOG(ERROR) << "Share tensor data failed: " << tensor->tensor_name();
+      return ret;
+    }
+  }
+  return RET_OK;
+}
+
 int CopyConstTensorData(const std::vector<Tensor *> &tensors, int op_type) {
   // packed kernels such as conv don't need to copy because weight will be packed in kernel
   if (lite::PackWeightManager::GetInstance()->IsCopyTensor(op_type)) {
@@ -211,7 +233,8 @@ int Scheduler::HandleBuildinCpuKernelWeight(const kernel::SubGraphType &belong_s
   if (!(reinterpret_cast<LiteModel *>(src_model_)->keep_model_buf())) {
     // we don't need to restore tensor for copy data
     MS_CHECK_TRUE_RET(kernel->op_parameter() != nullptr, RET_ERROR);
-    ret = CopyConstTensorData(kernel->in_tensors(), kernel->op_parameter()->type_);
+    ret = share_weight_ ? ShareConstTensorData(kernel->in_tensors())
+                        : CopyConstTensorData(kernel->in_tensors(), kernel->op_parameter()->type_);
     if (ret != RET_OK) {
       MS_LOG(DEBUG) << "CopyConstTensorsData failed: " << ret;
       return RET_NOT_SUPPORT;
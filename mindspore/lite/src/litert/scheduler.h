@@ -59,6 +59,7 @@ class Scheduler {
   void SetConfig(const std::map<std::string, std::map<std::string, std::string>> *config_info) {
     config_info_ = config_info;
   }
+  void SetShareWeight(bool share_weight) { share_weight_ = share_weight; }
   std::vector<kernel::KernelExec *> NonTailCallNodes();
 
  private:
@@ -170,6 +171,7 @@ class Scheduler {
   int schema_version_ = SCHEMA_VERSION::SCHEMA_CUR;
   std::map<std::string, TypeId> *execution_plan_ = nullptr;
   const std::map<std::string, std::map<std::string, std::string>> *config_info_ = nullptr;
+  bool share_weight_ = false;
   std::shared_ptr<ShapeFusionPass> shape_fusion_pass_ = nullptr;
 };
 }  // namespace mindspore::lite
@@ -28,6 +28,7 @@
 #include "src/common/utils.h"
 #include "src/common/prim_inner.h"
 #include "src/litert/kernel_exec_util.h"
+#include "src/litert/inter_op_executor.h"
 
 namespace mindspore::kernel {
 using mindspore::lite::RET_ERROR;
@@ -434,8 +435,34 @@ int CpuSubGraph::Prepare() {
   return RET_OK;
 }
 
+int CpuSubGraph::InitInterOpExecutor(lite::InnerContext *ctx, int max_branch_num) {
+  // the old executor gives the kernels their thread num back, drop it before the threads are split again
+  delete executor_;
+  executor_ = nullptr;
+  auto executor = new (std::nothrow) lite::InterOpExecutor(max_branch_num);
+  if (executor == nullptr) {
+    MS_LOG(ERROR) << "new InterOpExecutor failed.";
+    return RET_ERROR;
+  }
+  auto ret = executor->Prepare(nodes_, in_tensors(), out_tensors(), ctx);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Prepare InterOpExecutor failed: " << ret;
+    delete executor;
+    return ret;
+  }
+  if (executor->branch_num() < C2NUM) {
+    delete executor;
+    return RET_OK;
+  }
+  executor_ = executor;
+  return RET_OK;
+}
+
 int CpuSubGraph::Execute(const KernelCallBack &before, const KernelCallBack &after) {
   MS_ASSERT(this->Context()->allocator.get() != nullptr);
+  if (executor_ != nullptr) {
+    return executor_->Run(in_tensors(), out_tensors(), nodes_, before, after);
+  }
 
   for (auto *kernel : nodes_) {
     MS_ASSERT(kernel != nullptr);
@@ -152,6 +152,8 @@ class CpuSubGraph : public SubGraphKernel {
   }
 
   ~CpuSubGraph() override { delete this->executor_; }
+  // Run the independent kernels concurrently, at most max_branch_num at a time. Called before the kernels are prepared.
+  int InitInterOpExecutor(lite::InnerContext *ctx, int max_branch_num);
   int Prepare() override;
   int SetFp16Attr() override { return SubGraphKernel::SetFp16Attr(); }
   int Execute() override { return Execute(nullptr, nullptr); }
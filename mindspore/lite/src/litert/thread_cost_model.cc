@@ -15,12 +15,34 @@
  */
 
 #include "src/litert/thread_cost_model.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
 #include <map>
+#include <sstream>
+#include <thread>
+#include <vector>
+#ifndef _WIN32
+#include <unistd.h>
+#endif
 #include "src/common/log_util.h"
 #include "src/litert/inner_context.h"
 #include "thread/threadpool.h"
 
 namespace mindspore::lite {
+// the kernels out of the map are mostly the compute intensive ones, such as convolution and matmul
+constexpr float kDefaultKernelComputeCost = 100.0f;
+constexpr int kStartupMeasureLoop = 32;
+constexpr int kEfficiencyMeasureLoop = 8;
+constexpr int kEfficiencyTaskSize = 16 * 1024;  // floats every task sums, 64KB fits the L2 cache
+constexpr int kEfficiencyTaskPass = 16;
+constexpr char kIdentityCacheKey[] = "identity";
+constexpr char kStartupCacheKey[] = "startup_ns";
+constexpr char kEfficiencyCacheKey[] = "parallel_efficiency";
+
 const std::map<int32_t, float> kernel_compute_cost_map_ = {
   {TC_TYPE(schema::PrimitiveType_Activation, schema::ActivationType_RELU), 1.806f},        // dataNum about 100k
   {TC_TYPE(schema::PrimitiveType_Activation, schema::ActivationType_RELU6), 1.806f},       // dataNum about 100k
@@ -103,6 +125,11 @@ int ThreadCostModel::GetOptimalThreadNum(const ThreadCostContext *thread_cost_co
   return block_count;
 }
 
+float GetKernelComputeCost(int32_t kernel_type) {
+  auto iter = kernel_compute_cost_map_.find(kernel_type);
+  return iter == kernel_compute_cost_map_.end() ? kDefaultKernelComputeCost : iter->second;
+}
+
 int ThreadNumUpdateStrategy(const ThreadCostContext *thread_cost_context, int task_num) {
   if (task_num <= 1) {
     return task_num;
@@ -119,16 +146,332 @@ int ThreadNumUpdateStrategy(const ThreadCostContext *thread_cost_context, int ta
   return task_num;
 }
 
+float GetKernelComputeCost(int32_t kernel_type, int64_t unit_num) {
+  float compute_cost = 0.0f;
+  if (ThreadCostCalibrator::GetInstance()->GetComputeCost(kernel_type, unit_num, &compute_cost)) {
+    return compute_cost;
+  }
+  return GetKernelComputeCost(kernel_type);
+}
+
+namespace {
+std::string CpuModelName() {
+  std::ifstream ifs("/proc/cpuinfo");
+  std::string line;
+  while (ifs.is_open() && std::getline(ifs, line)) {
+    // "model name" on x86, "Hardware" or "CPU part" on arm
+    if (line.compare(0, sizeof("model name") - 1, "model name") == 0 ||
+        line.compare(0, sizeof("Hardware") - 1, "Hardware") == 0 ||
+        line.compare(0, sizeof("CPU part") - 1, "CPU part") == 0) {
+      auto pos = line.find(':');
+      return pos == std::string::npos ? "" : line.substr(pos + 1);
+    }
+  }
+  return "";
+}
+
+std::string HostName() {
+#ifdef _WIN32
+  auto name = std::getenv("COMPUTERNAME");
+  return name == nullptr ? "" : name;
+#else
+  constexpr size_t kHostNameLen = 256;
+  char name[kHostNameLen] = {0};
+  return gethostname(name, kHostNameLen - 1) == 0 ? name : "";
+#endif
+}
+
+struct EfficiencyTask {
+  std::vector<std::vector<float>> buffers;
+  std::vector<float> sums;
+};
+
+int EfficiencyRun(void *cdata, int task_id, float, float) {
+  auto task = static_cast<EfficiencyTask *>(cdata);
+  float sum = 0.0f;
+  for (int i = 0; i < kEfficiencyTaskPass; ++i) {
+    for (auto value : task->buffers[task_id]) {
+      sum = sum * 0.5f + value;
+    }
+  }
+  task->sums[task_id] = sum;
+  return 0;
+}
+}  // namespace
+
+std::string HostIdentity() {
+  auto identity = HostName() + "," + CpuModelName() + "," + std::to_string(std::thread::hardware_concurrency());
+  // the cache files are split by blanks
+  std::replace_if(
+    identity.begin(), identity.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); }, '_');
+  return identity;
+}
+
+ThreadCostCalibrator *ThreadCostCalibrator::GetInstance() {
+  static ThreadCostCalibrator instance;
+  return &instance;
+}
+
+int ThreadCostCalibrator::Init(const std::string &cache_file, int warmup_num, const InnerContext *ctx) {
+  if (warmup_num < 1) {
+    MS_LOG(ERROR) << "Thread cost calibration warm-up num should be positive, but got " << warmup_num;
+    return RET_INPUT_PARAM_INVALID;
+  }
+  auto thread_num = ctx == nullptr ? 1 : ctx->thread_num_;
+  auto identity = HostIdentity() + "," + std::to_string(thread_num);
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (initialized_) {
+    if (cache_file == cache_file_ && warmup_num == warmup_num_ && identity == identity_) {
+      return RET_OK;
+    }
+    // last writer wins, the sessions that Init before share the new setup
+    MS_LOG(WARNING) << "Thread cost is calibrated for " << identity_ << " with cache file " << cache_file_
+                    << " already, calibrate again for " << identity << " with cache file " << cache_file
+                    << ", the sessions of the former setup use the new one as well.";
+    if (Save() != RET_OK) {
+      MS_LOG(WARNING) << "Save the calibrated thread cost to " << cache_file_ << " failed.";
+    }
+    Clear();
+  }
+  initialized_ = true;
+  cache_file_ = cache_file;
+  warmup_num_ = warmup_num;
+  identity_ = identity;
+  if (!cache_file_.empty() && Load() != RET_OK) {
+    MS_LOG(WARNING) << "Load thread cost cache file " << cache_file_ << " failed, calibrate from scratch.";
+    samples_.clear();
+    startup_ns_ = 0.0;
+    parallel_efficiency_ = 1.0;
+  }
+  if (startup_ns_ <= 0.0) {
+    startup_ns_ = MeasureStartupNs(ctx);
+    parallel_efficiency_ = MeasureParallelEfficiency(ctx);
+  }
+  if (startup_ns_ <= 0.0) {
+    MS_LOG(INFO) << "Kernels run in a single thread, the thread cost is not calibrated.";
+    return RET_OK;
+  }
+  MS_LOG(INFO) << "Calibrate thread cost with thread pool startup time " << startup_ns_ << " ns, parallel efficiency "
+               << parallel_efficiency_ << ", " << samples_.size() << " kernels calibrated already.";
+  enabled_ = true;
+  return RET_OK;
+}
+
+void ThreadCostCalibrator::Reset() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Clear();
+}
+
+void ThreadCostCalibrator::Clear() {
+  enabled_ = false;
+  initialized_ = false;
+  updated_ = false;
+  warmup_num_ = 0;
+  startup_ns_ = 0.0;
+  parallel_efficiency_ = 1.0;
+  cache_file_.clear();
+  identity_.clear();
+  samples_.clear();
+}
+
+bool ThreadCostCalibrator::IsCalibrated(int32_t kernel_type, int64_t unit_num) {
+  float compute_cost = 0.0f;
+  return GetComputeCost(kernel_type, unit_num, &compute_cost);
+}
+
+bool ThreadCostCalibrator::GetComputeCost(int32_t kernel_type, int64_t unit_num, float *compute_cost) {
+  if (!enabled_ || unit_num <= 0) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto iter = samples_.find({kernel_type, SizeBucket(unit_num)});
+  if (iter == samples_.end() || iter->second.sample_num < warmup_num_) {
+    return false;
+  }
+  *compute_cost = ToComputeCost(iter->second);
+  return true;
+}
+
+void ThreadCostCalibrator::Record(int32_t kernel_type, const ThreadCostContext *thread_cost_context, int thread_num,
+                                  int64_t cost_ns) {
+  if (!enabled_ || thread_cost_context->total_unit_num_ <= 0) {
+    return;
+  }
+  // the startup time is paid once a kernel is split, the rest is shared by the threads at the measured efficiency
+  double parallel_ns = thread_num > 1 ? static_cast<double>(cost_ns) - startup_ns_ : static_cast<double>(cost_ns);
+  double speedup = thread_num > 1 ? thread_num * parallel_efficiency_ : 1.0;
+  double unit_ns = std::max(parallel_ns, 0.0) * speedup / thread_cost_context->total_unit_num_;
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto &sample = samples_[{kernel_type, SizeBucket(thread_cost_context->total_unit_num_)}];
+  if (sample.sample_num >= warmup_num_) {
+    return;
+  }
+  // the fastest run is the one least disturbed by the other processes
+  sample.min_unit_ns = sample.sample_num == 0 ? unit_ns : std::min(sample.min_unit_ns, unit_ns);
+  sample.load_num = thread_cost_context->per_unit_load_num_;
+  sample.store_num = thread_cost_context->per_unit_store_num_;
+  if (++sample.sample_num == warmup_num_) {
+    updated_ = true;
+  }
+}
+
+int ThreadCostCalibrator::SaveIfUpdated() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return Save();
+}
+
+int ThreadCostCalibrator::Save() {
+  if (!updated_ || cache_file_.empty() || startup_ns_ <= 0.0) {
+    return RET_OK;
+  }
+  std::ofstream ofs(cache_file_, std::ios::out | std::ios::trunc);
+  if (!ofs.is_open()) {
+    MS_LOG(ERROR) << "Open thread cost cache file " << cache_file_ << " failed.";
+    return RET_ERROR;
+  }
+  ofs.precision(std::numeric_limits<double>::max_digits10);
+  ofs << kIdentityCacheKey << " " << identity_ << "\n";
+  ofs << kStartupCacheKey << " " << startup_ns_ << "\n";
+  ofs << kEfficiencyCacheKey << " " << parallel_efficiency_ << "\n";
+  for (auto &item : samples_) {
+    if (item.second.sample_num < warmup_num_) {
+      continue;
+    }
+    ofs << item.first.first << " " << item.first.second << " " << item.second.load_num << " "
+        << item.second.store_num << " " << item.second.min_unit_ns << "\n";
+  }
+  ofs.close();
+  updated_ = false;
+  return RET_OK;
+}
+
+int ThreadCostCalibrator::SizeBucket(int64_t unit_num) {
+  int bucket = 0;
+  while (unit_num > 1) {
+    unit_num >>= 1;
+    ++bucket;
+  }
+  return bucket;
+}
+
+float ThreadCostCalibrator::ToComputeCost(const CostSample &sample) const {
+  auto cost_per_ns = ThreadCostModel::thread_startup_cost_ / startup_ns_;
+  auto compute_cost = sample.min_unit_ns * cost_per_ns - ThreadCostModel::per_unit_load_cost_ * sample.load_num -
+                      ThreadCostModel::per_unit_store_cost_ * sample.store_num;
+  return static_cast<float>(std::max(compute_cost, 0.0));
+}
+
+double ThreadCostCalibrator::MeasureStartupNs(const InnerContext *ctx) const {
+  if (ctx == nullptr || ctx->thread_num_ < C2NUM) {
+    return 0.0;
+  }
+  auto empty_task = [](void *, int, float, float) { return 0; };
+  double startup_ns = std::numeric_limits<double>::max();
+  for (int i = 0; i < kStartupMeasureLoop; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    if (ParallelLaunch(ctx, empty_task, nullptr, ctx->thread_num_) != RET_OK) {
+      MS_LOG(WARNING) << "Launch the thread pool failed.";
+      return 0.0;
+    }
+    auto end = std::chrono::steady_clock::now();
+    auto cost_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+    startup_ns = std::min(startup_ns, static_cast<double>(cost_ns));
+  }
+  return startup_ns;
+}
+
+// The time of one task run alone over the time of thread_num such tasks run side by side, without the startup time.
+// The threads slow down each other on the shared caches, the memory bandwidth and the frequency.
+double ThreadCostCalibrator::MeasureParallelEfficiency(const InnerContext *ctx) const {
+  if (ctx == nullptr || ctx->thread_num_ < C2NUM || startup_ns_ <= 0.0) {
+    return 1.0;
+  }
+  EfficiencyTask task;
+  task.buffers.assign(ctx->thread_num_, std::vector<float>(kEfficiencyTaskSize, 1.0f));
+  task.sums.assign(ctx->thread_num_, 0.0f);
+  auto measure = [ctx, &task](int task_num) {
+    double min_ns = std::numeric_limits<double>::max();
+    for (int i = 0; i < kEfficiencyMeasureLoop; ++i) {
+      auto start = std::chrono::steady_clock::now();
+      if (ParallelLaunch(ctx, EfficiencyRun, &task, task_num) != RET_OK) {
+        return 0.0;
+      }
+      auto end = std::chrono::steady_clock::now();
+      min_ns = std::min(min_ns, static_cast<double>(
+                                  std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count()));
+    }
+    return min_ns;
+  };
+  auto single_ns = measure(1);
+  auto parallel_ns = measure(ctx->thread_num_) - startup_ns_;
+  if (single_ns <= 0.0 || parallel_ns <= 0.0) {
+    return 1.0;
+  }
+  return std::min(std::max(single_ns / parallel_ns, 1.0 / ctx->thread_num_), 1.0);
+}
+
+int ThreadCostCalibrator::Load() {
+  std::ifstream ifs(cache_file_);
+  if (!ifs.is_open()) {
+    MS_LOG(INFO) << "Thread cost cache file " << cache_file_ << " does not exist, calibrate from scratch.";
+    return RET_OK;
+  }
+  std::string line;
+  bool identity_matched = false;
+  while (std::getline(ifs, line)) {
+    if (line.empty()) {
+      continue;
+    }
+    std::istringstream iss(line);
+    std::string key;
+    if (line.compare(0, sizeof(kIdentityCacheKey) - 1, kIdentityCacheKey) == 0) {
+      std::string identity;
+      if (!(iss >> key >> identity) || identity != identity_) {
+        MS_LOG(WARNING) << "Thread cost cache file " << cache_file_ << " is calibrated for " << identity
+                        << ", but this is " << identity_;
+        return RET_ERROR;
+      }
+      identity_matched = true;
+      continue;
+    }
+    if (line.compare(0, sizeof(kStartupCacheKey) - 1, kStartupCacheKey) == 0) {
+      if (!(iss >> key >> startup_ns_)) {
+        return RET_ERROR;
+      }
+      continue;
+    }
+    if (line.compare(0, sizeof(kEfficiencyCacheKey) - 1, kEfficiencyCacheKey) == 0) {
+      if (!(iss >> key >> parallel_efficiency_) || parallel_efficiency_ <= 0.0) {
+        return RET_ERROR;
+      }
+      continue;
+    }
+    CostKey cost_key;
+    CostSample sample;
+    if (!(iss >> cost_key.first >> cost_key.second >> sample.load_num >> sample.store_num >> sample.min_unit_ns)) {
+      return RET_ERROR;
+    }
+    sample.sample_num = warmup_num_;
+    samples_[cost_key] = sample;
+  }
+  return identity_matched && startup_ns_ > 0.0 ? RET_OK : RET_ERROR;
+}
+
+#ifdef DYNAMIC_THREAD_DISTRIBUTE
 int UpdateThreadNum(int32_t kernel_type, int64_t per_unit_load_num, int64_t per_unit_store_num, int64_t unit_num,
                     int thread_num) {
-  if (kernel_compute_cost_map_.count(kernel_type) > 0) {
-    lite::ThreadCostContext thread_cost_context;
+  lite::ThreadCostContext thread_cost_context;
+  if (!ThreadCostCalibrator::GetInstance()->GetComputeCost(kernel_type, unit_num,
+                                                           &thread_cost_context.per_unit_compute_cost_)) {
+    if (kernel_compute_cost_map_.count(kernel_type) == 0) {
+      return thread_num;
+    }
     thread_cost_context.per_unit_compute_cost_ = kernel_compute_cost_map_.at(kernel_type);
-    thread_cost_context.per_unit_load_num_ = per_unit_load_num;
-    thread_cost_context.per_unit_store_num_ = per_unit_store_num;
-    thread_cost_context.total_unit_num_ = unit_num;
-    return ThreadNumUpdateStrategy(&thread_cost_context, thread_num);
   }
-  return thread_num;
+  thread_cost_context.per_unit_load_num_ = per_unit_load_num;
+  thread_cost_context.per_unit_store_num_ = per_unit_store_num;
+  thread_cost_context.total_unit_num_ = unit_num;
+  return ThreadNumUpdateStrategy(&thread_cost_context, thread_num);
 }
+#endif
 }  // namespace mindspore::lite
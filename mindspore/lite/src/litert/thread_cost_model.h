@@ -18,11 +18,18 @@
 #define MINDSPORE_LITE_SRC_RUNTIME_THREAD_COST_MODEL_H_
 
 #include <stdint.h>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
 #include "nnacl/op_base.h"
 #include "include/api/context.h"
 #include "schema/ops_generated.h"
 
 namespace mindspore::lite {
+struct InnerContext;
+
 typedef struct ThreadCostContext {
   int64_t total_unit_num_;
   int64_t per_unit_load_num_;
@@ -71,8 +78,70 @@ struct ThreadCostModel {
 };
 
 float GetKernelComputeCost(int32_t kernel_type);
+// the calibrated cost of the kernel with unit_num units if there is one, otherwise GetKernelComputeCost(kernel_type)
+float GetKernelComputeCost(int32_t kernel_type, int64_t unit_num);
 int ThreadNumUpdateStrategy(const ThreadCostContext *thread_cost_context, int task_num);
 
+// The host name, the cpu model and the core num, the measurements persisted to a file hold on this host only.
+std::string HostIdentity();
+
+// Fits the per unit compute cost of every kernel type and size on the host cpu from the kernels timed in warm-up,
+// the static costs of ThreadCostModel are tuned for one platform only. The time is converted to the cost unit by the
+// measured thread pool startup time, which stands for thread_startup_cost_, and a multi-thread run is scaled by the
+// measured parallel efficiency of the pool instead of a linear speedup. The fitted costs are persisted to a cache
+// file together with the host identity and the thread num, so later processes on the same setup pick the thread num
+// by the measurements from the start.
+class ThreadCostCalibrator {
+ public:
+  static ThreadCostCalibrator *GetInstance();
+
+  // Loads the cache file if it matches the host and the thread num of ctx. Every kernel type and size is timed
+  // warmup_num times before it is fitted. An Init with another file, warm-up num or thread num saves the costs fitted
+  // so far and calibrates again.
+  // The calibrator is shared by the process and its setup is last-writer-wins: a session that Inits it with another
+  // setup replaces the one of the sessions before it, whose kernels are then timed and fitted for the new setup too.
+  // Sessions of the same process should use the same [thread_cost] config and thread num.
+  int Init(const std::string &cache_file, int warmup_num, const InnerContext *ctx);
+  // Drops all the measurements without saving them.
+  void Reset();
+  bool enabled() const { return enabled_; }
+  bool IsCalibrated(int32_t kernel_type, int64_t unit_num);
+  bool GetComputeCost(int32_t kernel_type, int64_t unit_num, float *compute_cost);
+  void Record(int32_t kernel_type, const ThreadCostContext *thread_cost_context, int thread_num, int64_t cost_ns);
+  // Writes the cache file if a kernel is fitted since the last save.
+  int SaveIfUpdated();
+
+ private:
+  struct CostSample {
+    double min_unit_ns = 0.0;
+    int sample_num = 0;
+    int64_t load_num = 0;
+    int64_t store_num = 0;
+  };
+  using CostKey = std::pair<int32_t, int>;
+
+  ThreadCostCalibrator() = default;
+  ~ThreadCostCalibrator() = default;
+  static int SizeBucket(int64_t unit_num);
+  float ToComputeCost(const CostSample &sample) const;
+  double MeasureStartupNs(const InnerContext *ctx) const;
+  double MeasureParallelEfficiency(const InnerContext *ctx) const;
+  int Load();
+  int Save();
+  void Clear();
+
+  std::mutex mutex_;
+  std::atomic_bool enabled_ = {false};
+  bool initialized_ = false;
+  bool updated_ = false;
+  int warmup_num_ = 0;
+  double startup_ns_ = 0.0;
+  double parallel_efficiency_ = 1.0;
+  std::string cache_file_;
+  std::string identity_;
+  std::map<CostKey, CostSample> samples_;
+};
+
 #ifdef DYNAMIC_THREAD_DISTRIBUTE
 int UpdateThreadNum(int32_t kernel_type, int64_t per_unit_load_num, int64_t per_unit_store_num, int64_t unit_num,
                     int thread_num);
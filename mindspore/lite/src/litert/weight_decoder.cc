@@ -364,6 +364,63 @@ STATUS WeightDecoder::IndexingDecompress(const SchemaTensorWrapper &src_tensor,
   return RET_OK;
 }
 
+// The kept values of every group of m along the last axis, then their offsets in the group, behind an n and m header.
+// The format only shrinks the model file, the weight is densified here once and multiplied by the dense matmul.
+STATUS WeightDecoder::NMSparseDecompress(const SchemaTensorWrapper &src_tensor, Tensor *dst_tensor) {
+  MS_ASSERT(src_tensor.handler() != nullptr);
+  MS_ASSERT(src_tensor.data() != nullptr);
+  return NMSparseDecompress(static_cast<const uint8_t *>(src_tensor.data()), src_tensor.length(), dst_tensor);
+}
+
+STATUS WeightDecoder::NMSparseDecompress(const uint8_t *src, size_t src_size, Tensor *dst_tensor) {
+  MS_CHECK_TRUE_MSG(src != nullptr && dst_tensor != nullptr, RET_NULL_PTR, "N:M sparse weight is nullptr.");
+  MS_LOG(DEBUG) << "densify N:M sparse weight";
+  MS_CHECK_TRUE_MSG(dst_tensor->data_type() == kNumberTypeFloat32, RET_ERROR, "N:M sparse weight must be float32.");
+  auto shape = dst_tensor->shape();
+  MS_CHECK_TRUE_MSG(!shape.empty() && shape.back() > 0, RET_ERROR, "N:M sparse weight shape is invalid.");
+  auto header_size = kNMSparseHeaderNum * sizeof(int32_t);
+  MS_CHECK_TRUE_MSG(src_size >= header_size, RET_ERROR, "N:M sparse weight misses its header.");
+  int32_t header[kNMSparseHeaderNum];
+  (void)memcpy(header, src, header_size);
+  auto n = header[0];
+  auto m = header[1];
+  MS_CHECK_TRUE_MSG(n > 0 && m > n && m <= UINT8_MAX + 1, RET_ERROR, "N:M sparsity is invalid.");
+  auto deep = shape.back();
+  auto lines = dst_tensor->ElementsNum() / deep;
+  auto kept = UP_DIV(deep, m) * n;
+  auto kept_num = static_cast<size_t>(kept) * static_cast<size_t>(lines);
+  if (src_size != header_size + kept_num * (sizeof(float) + sizeof(uint8_t))) {
+    MS_LOG(ERROR) << "N:M sparse weight size " << src_size << " does not match its shape.";
+    return RET_ERROR;
+  }
+  MS_CHECK_FALSE_MSG(dst_tensor->data() != nullptr, RET_ERROR, "data_c not null");
+  if (dst_tensor->MallocData() != RET_OK) {
+    MS_LOG(ERROR) << "Malloc tensor data failed";
+    return RET_NULL_PTR;
+  }
+  auto dst_data = static_cast<float *>(dst_tensor->data());
+  (void)memset(dst_data, 0, dst_tensor->Size());
+  const uint8_t *values = src + header_size;
+  const uint8_t *indexes = values + kept_num * sizeof(float);
+  for (int line = 0; line < lines; ++line) {
+    float *dst_line = dst_data + line * deep;
+    for (int k = 0; k < kept; ++k) {
+      auto index = static_cast<size_t>(line) * kept + k;
+      auto offset = k / n * m + indexes[index];
+      if (offset >= deep) {
+        MS_LOG(ERROR) << "N:M sparse weight index is out of range.";
+        return RET_ERROR;
+      }
+      float value;
+      (void)memcpy(&value, values + index * sizeof(float), sizeof(float));
+      if (value != 0.0f) {
+        dst_line[offset] = value;
+      }
+    }
+  }
+  return RET_OK;
+}
+
 int WeightDecoder::DequantTensor(Tensor *tensor, int preferred_dim, TypeId dst_data_type) {
   MS_ASSERT(tensor != nullptr);
   if (!tensor->IsConst() ||
@@ -519,6 +576,8 @@ int WeightDecoder::DecompressTensor(const SchemaTensorWrapper &src_tensor, lite:
     return IndexingDecompress(src_tensor, dst_tensor);
   } else if (src_tensor.handler()->weightQuantCompressType() == schema::WeightQuantCompressType_SPARSE) {
     return SparseDecompress(src_tensor, dst_tensor);
+  } else if (src_tensor.handler()->weightQuantCompressType() == schema::WeightQuantCompressType_NM_SPARSE) {
+    return NMSparseDecompress(src_tensor, dst_tensor);
   }
   if (!NeedBitUppackCheck(src_tensor)) {
     return RET_NO_CHANGE;
@@ -37,6 +37,7 @@ static constexpr int kBitNum1 = 1;
 static constexpr int kBitNum8 = 8;
 static constexpr int kBitNum16 = 16;
 static constexpr int kBitNum32 = 32;
+static constexpr int kNMSparseHeaderNum = 2;
 
 namespace mindspore::lite {
 
@@ -46,6 +47,9 @@ class WeightDecoder {
                          const std::string &model_version, bool float_mode);
   static int DecompressTensor(const SchemaTensorWrapper &src_tensor, lite::Tensor *dst_tensor);
 
+  // densifies the NM_SPARSE buffer of src_size bytes into dst_tensor, whose data is not allocated yet.
+  static STATUS NMSparseDecompress(const uint8_t *src, size_t src_size, Tensor *dst_tensor);
+
   template <typename T>
   static int GetPreferredDim(const std::vector<T *> &in_tensors, const OpParameter *op_parameter, int index,
                              const std::vector<int> &dims, const std::string &model_version) {
@@ -111,6 +115,8 @@ class WeightDecoder {
 
   static STATUS IndexingDecompress(const SchemaTensorWrapper &src_tensor, Tensor *dst_tensor);
 
+  static STATUS NMSparseDecompress(const SchemaTensorWrapper &src_tensor, Tensor *dst_tensor);
+
   static bool IsChannelFirst(int index, const OpParameter *op_parameter);
 
   // A * stride_a + bucket_index * stride_b + C
@@ -21,6 +21,7 @@
 #include <vector>
 #include <iostream>
 #include <fstream>
+#include <functional>
 #include <memory>
 #include <queue>
 #include <map>
@@ -30,6 +31,7 @@
 #include "src/litert/kernel_exec_util.h"
 #include "src/tensor.h"
 #include "src/litert/kernel_registry.h"
+#include "src/common/common.h"
 #include "src/common/prim_util.h"
 #include "src/common/tensor_util.h"
 #include "src/common/utils.h"
@@ -259,14 +261,42 @@ int TrainSession::UpdateWeights(std::vector<lite::Tensor *> modify_tensors) {
   return ret;
 }
 
-int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels) {
-  if (!IS_STATIC_ALLOCATOR(allocator_)) return RET_OK;
+// A kernel listed more than once is recomputed, every run writes a new instance of its outputs which lives from the
+// run to the last read before the next run, so the forward instance is released once the forward readers are done.
+size_t TrainSession::PlanTensors(const std::vector<kernel::KernelExec *> &kernels,
+                                 std::vector<std::vector<size_t>> *offsets) {
+  std::vector<std::vector<int>> reads(kernels.size());
+  std::unordered_map<lite::Tensor *, std::pair<size_t, size_t>> producer;
+  std::unordered_map<lite::Tensor *, int> first_run_reads;
+  std::set<kernel::KernelExec *> visited;
+  for (size_t i = 0; i < kernels.size(); i++) {
+    auto kernel = kernels[i];
+    bool first_run = visited.insert(kernel).second;
+    for (auto tensor : kernel->in_tensors()) {
+      if (tensor->category() != lite::Category::VAR) continue;
+      if (first_run) first_run_reads[tensor]++;
+      auto iter = producer.find(tensor);
+      if (iter != producer.end()) reads[iter->second.first][iter->second.second]++;
+    }
+    reads[i].assign(kernel->out_tensors().size(), 0);
+    for (size_t j = 0; j < kernel->out_tensors().size(); j++) {
+      producer[kernel->out_tensors().at(j)] = std::make_pair(i, j);
+    }
+  }
+  // the last instance also keeps the references beyond the kernels, e.g. of the graph outputs
+  for (auto &item : producer) {
+    auto extra = item.first->init_ref_count() - first_run_reads[item.first];
+    reads[item.second.first][item.second.second] += std::max(extra, 0);
+  }
+
   OptAllocator allocator;
   std::unordered_map<lite::Tensor *, int> ref_count;
   std::unordered_map<lite::Tensor *, size_t> offset_map;
+  offsets->assign(kernels.size(), {});
   int counter = 0;
   uint32_t input_idx = 0;
-  for (auto &kernel : kernels) {
+  for (size_t k = 0; k < kernels.size(); k++) {
+    auto kernel = kernels[k];
     for (size_t i = 0; i < kernel->out_tensors().size(); i++) {
       auto tensor = kernel->out_tensors().at(i);
       bool in_place = false;
@@ -282,7 +312,8 @@ int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels)
         offset = allocator.Malloc(size);
       }
       offset_map[tensor] = offset;
-      ref_count[tensor] = tensor->init_ref_count();
+      ref_count[tensor] = reads[k][i];
+      offsets->at(k).push_back(offset);
     }
     for (auto tensor : kernel->in_tensors()) {
       if (tensor->category() == lite::Category::VAR) {
@@ -293,9 +324,22 @@ int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels)
         }
       }
     }
+    // an instance nobody reads before the kernel runs again
+    for (size_t i = 0; i < kernel->out_tensors().size(); i++) {
+      auto tensor = kernel->out_tensors().at(i);
+      if (reads[k][i] == 0 && producer.at(tensor).first != k) {
+        allocator.Free(offset_map[tensor]);
+      }
+    }
   }
+  return allocator.total_size();
+}
+
+int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels) {
+  if (!IS_STATIC_ALLOCATOR(allocator_)) return RET_OK;
+  std::vector<std::vector<size_t>> offsets;
+  auto size = PlanTensors(kernels, &offsets);
   // Set Tensor data
-  auto size = allocator.total_size();
   if (size > tensors_data_size_) {
     free(tensors_data_);
     tensors_data_ = nullptr;
@@ -311,17 +355,28 @@ int TrainSession::AllocTensors(const std::vector<kernel::KernelExec *> &kernels)
     tensors_data_ = buf;
     tensors_data_size_ = size;
   }
-  for (auto kernel : train_kernels_) {
-    for (auto tensor : kernel->out_tensors()) {
-      auto it = offset_map.find(tensor);
-      if (it != offset_map.end()) {
-        tensor->set_data(reinterpret_cast<void *>(reinterpret_cast<uint8_t *>(tensors_data_) + it->second));
-      }
+  for (size_t k = 0; k < kernels.size(); k++) {
+    for (size_t i = 0; i < kernels[k]->out_tensors().size(); i++) {
+      auto tensor = kernels[k]->out_tensors().at(i);
+      tensor->set_data(reinterpret_cast<void *>(reinterpret_cast<uint8_t *>(tensors_data_) + offsets[k][i]));
     }
   }
+  if (&kernels == &recompute_kernels_) {
+    recompute_offsets_ = std::move(offsets);
+  }
   return RET_OK;
 }
 
+// The outputs of a recomputed kernel move to the instance of this run.
+void TrainSession::BindRecomputeData(const std::vector<kernel::KernelExec *> &run_kernels, size_t index) {
+  if (&run_kernels != &recompute_kernels_ || index >= recompute_offsets_.size()) return;
+  auto &out_tensors = run_kernels[index]->out_tensors();
+  for (size_t i = 0; i < out_tensors.size(); i++) {
+    out_tensors[i]->set_data(
+      reinterpret_cast<void *>(reinterpret_cast<uint8_t *>(tensors_data_) + recompute_offsets_[index][i]));
+  }
+}
+
 int TrainSession::CompileGraph(lite::Model *model) { return lite::RET_ERROR; }
 
 int TrainSession::CompileTrainGraph(std::shared_ptr<Model> model) {
@@ -356,12 +411,17 @@ int TrainSession::CompileTrainGraph(std::shared_ptr<Model> model) {
     MS_LOG(ERROR) << "CompileInferenceKernels failed.";
     return RET_ERROR;
   }
+  ret = CompileRecomputeKernels();
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "CompileRecomputeKernels failed.";
+    return RET_ERROR;
+  }
   ret = AllocWorkSpace();
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "failed to allocate space";
     return RET_ERROR;
   }
-  ret = AllocTensors(train_kernels_);
+  ret = AllocTensors(train_run_kernels());
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "failed to allocate space";
     return RET_ERROR;
@@ -379,8 +439,10 @@ TrainSession::~TrainSession() {
 
 int TrainSession::ExecKernels(const KernelCallBack &before, const KernelCallBack &after,
                               const std::vector<kernel::KernelExec *> &run_kernels) {
-  for (auto *kernel : run_kernels) {
+  for (size_t i = 0; i < run_kernels.size(); i++) {
+    auto *kernel = run_kernels[i];
     MS_ASSERT(kernel != nullptr);
+    BindRecomputeData(run_kernels, i);
     auto ret = kernel->Execute(before, after);
     if (RET_OK != ret) {
       MS_LOG(ERROR) << "Execute kernel failed, name: " << kernel->name();
@@ -498,8 +560,10 @@ int TrainSession::MixPrecisionPostProcess(kernel::KernelExec *kernel) {
 int TrainSession::MixPrecisionExecKernels(const KernelCallBack &before, const KernelCallBack &after,
                                           const std::vector<kernel::KernelExec *> &run_kernels) {
   float scale = cfg_.mix_precision_cfg_.loss_scale_;
-  for (auto *kernel : run_kernels) {
+  for (size_t i = 0; i < run_kernels.size(); i++) {
+    auto *kernel = run_kernels[i];
     MS_ASSERT(kernel != nullptr);
+    BindRecomputeData(run_kernels, i);
     auto ret = MixPrecisionPreProcess(kernel, scale);
     if (ret != RET_OK) {
       MS_LOG(ERROR) << "MixPrecisionPreProcess failed.";
@@ -562,7 +626,7 @@ int TrainSession::RunGraph(const KernelCallBack &before, const KernelCallBack &a
     MS_LOG(ERROR) << "context is null";
     return lite::RET_NULL_PTR;
   }
-  auto &run_kernels = (train_mode_) ? train_kernels_ : inference_kernels_;
+  auto &run_kernels = (train_mode_) ? train_run_kernels() : inference_kernels_;
   if (context_->IsCpuFloat16Enabled()) {
     ret = MixPrecisionExecKernels(before, after, run_kernels);
   } else {
@@ -611,7 +675,7 @@ int TrainSession::Train() {
     }
   }
   // allocate tensors
-  auto ret = AllocTensors(train_kernels_);
+  auto ret = AllocTensors(train_run_kernels());
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "failed to allocate tensor space";
     return RET_ERROR;
@@ -1087,7 +1151,7 @@ int TrainSession::Resize(const std::vector<lite::Tensor *> &inputs, const std::v
     MS_LOG(ERROR) << "failed to allocate space";
     return RET_ERROR;
   }
-  ret = AllocTensors(train_kernels_);
+  ret = AllocTensors(train_run_kernels());
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "train alloc failed after resize.";
     return RET_ERROR;
@@ -1292,8 +1356,7 @@ bool TrainSession::IsInPlaceTensor(kernel::KernelExec *kernel, uint32_t idx,
     for (size_t i = 0; i < kernel->in_tensors().size(); i++) {
       auto tensor = kernel->in_tensors().at(i);
       if ((tensor->category() == lite::Category::VAR) && (ref_count.find(tensor) != ref_count.end()) &&
-          (tensor->init_ref_count() == 1 || (tensor->init_ref_count() > 1 && ref_count.at(tensor) == 1)) &&
-          (out_tensor->Size() == tensor->Size())) {
+          (ref_count.at(tensor) == 1) && (out_tensor->Size() == tensor->Size())) {
         *input_idx = static_cast<uint32_t>(i);
         return true;
       }
@@ -1309,6 +1372,177 @@ size_t TrainSession::GetInplaceTensorOffset(kernel::KernelExec *kernel,
   ref_count->at(tensor) = ref_count->at(tensor) + 1;
   return offset_map.at(tensor);
 }
+
+// Reruns must give the values of the forward run: stateful or random kernels and the kernels producing outputs of the
+// session are never recomputed, neither are kernels whose outputs no backward kernel reads.
+bool TrainSession::IsRecomputable(kernel::KernelExec *kernel) const {
+  if (IsGradKernel(kernel) || IsLossKernel(kernel) || IsMaskOutput(kernel) || IsBN(kernel) ||
+      kernel->desc().arch != kernel::kCPU) {
+    return false;
+  }
+  static const std::set<int> random_types = {schema::PrimitiveType_Dropout, schema::PrimitiveType_RandomStandardNormal,
+                                             schema::PrimitiveType_RandomNormal, schema::PrimitiveType_UniformReal};
+  if (random_types.find(kernel->type()) != random_types.end()) {
+    return false;
+  }
+  if (eval_output_node_map_.find(kernel->name()) != eval_output_node_map_.end() ||
+      train_output_node_map_.find(kernel->name()) != train_output_node_map_.end()) {
+    return false;
+  }
+  for (auto tensor : kernel->out_tensors()) {
+    if (tensor->IsGraphOutput()) {
+      return false;
+    }
+  }
+  return std::any_of(kernel->out_kernels().begin(), kernel->out_kernels().end(),
+                     [this](const kernel::KernelExec *out_kernel) { return IsGradKernel(out_kernel); });
+}
+
+// The recomputed kernels linked by a tensor form a segment, a segment runs again in its forward order right before
+// the first backward kernel reading one of its outputs, the inputs of the segment stay alive until then.
+std::vector<kernel::KernelExec *> TrainSession::BuildRecomputeKernels(
+  const std::set<kernel::KernelExec *> &recompute) const {
+  std::unordered_map<kernel::KernelExec *, size_t> index;
+  for (size_t i = 0; i < train_kernels_.size(); i++) {
+    index[train_kernels_[i]] = i;
+  }
+  std::unordered_map<kernel::KernelExec *, kernel::KernelExec *> parent;
+  std::function<kernel::KernelExec *(kernel::KernelExec *)> find_root = [&](kernel::KernelExec *kernel) {
+    auto root = parent.at(kernel);
+    return root == kernel ? kernel : (parent[kernel] = find_root(root));
+  };
+  std::vector<kernel::KernelExec *> roots;
+  for (auto kernel : train_kernels_) {
+    if (recompute.find(kernel) == recompute.end()) continue;
+    parent[kernel] = kernel;
+    roots.push_back(kernel);
+    for (auto in_kernel : kernel->in_kernels()) {
+      if (parent.find(in_kernel) != parent.end()) {
+        parent[find_root(in_kernel)] = kernel;
+      }
+    }
+  }
+  std::map<kernel::KernelExec *, std::vector<kernel::KernelExec *>> segments;
+  for (auto kernel : roots) {
+    segments[find_root(kernel)].push_back(kernel);
+  }
+
+  std::map<size_t, std::vector<kernel::KernelExec *>> reruns;
+  for (auto &segment : segments) {
+    size_t insert_idx = train_kernels_.size();
+    std::set<lite::Tensor *> weights;
+    for (auto kernel : segment.second) {
+      for (auto out_kernel : kernel->out_kernels()) {
+        if (IsGradKernel(out_kernel) && index.find(out_kernel) != index.end()) {
+          insert_idx = std::min(insert_idx, index.at(out_kernel));
+        }
+      }
+      for (auto tensor : kernel->in_tensors()) {
+        if (tensor->IsConst()) weights.insert(tensor);
+      }
+    }
+    if (insert_idx == train_kernels_.size()) continue;
+    // a weight updated before the rerun would change the recomputed activations
+    auto is_update = [this, &weights](kernel::KernelExec *k) {
+      return IsOptimizer(k) && !k->in_tensors().empty() && weights.find(k->in_tensors().at(0)) != weights.end();
+    };
+    if (std::any_of(train_kernels_.begin(), train_kernels_.begin() + insert_idx, is_update)) {
+      MS_LOG(WARNING) << "Weights of " << segment.second.front()->name()
+                      << " are updated before its backward, its activations are kept.";
+      continue;
+    }
+    auto &rerun = reruns[insert_idx];
+    rerun.insert(rerun.end(), segment.second.begin(), segment.second.end());
+  }
+  std::vector<kernel::KernelExec *> run_kernels;
+  for (size_t i = 0; i < train_kernels_.size(); i++) {
+    auto iter = reruns.find(i);
+    if (iter != reruns.end()) {
+      std::sort(iter->second.begin(), iter->second.end(),
+                [&index](kernel::KernelExec *a, kernel::KernelExec *b) { return index.at(a) < index.at(b); });
+      run_kernels.insert(run_kernels.end(), iter->second.begin(), iter->second.end());
+    }
+    run_kernels.push_back(train_kernels_[i]);
+  }
+  return run_kernels;
+}
+
+void TrainSession::ParseRecomputeConfig(std::vector<std::string> *node_names, bool *auto_recompute) const {
+  node_names->clear();
+  *auto_recompute = false;
+  if (config_info_ == nullptr) {
+    return;
+  }
+  auto recompute = config_info_->find(kRecompute);
+  if (recompute == config_info_->end()) {
+    return;
+  }
+  auto nodes = recompute->second.find(kRecomputeNodes);
+  if (nodes != recompute->second.end()) {
+    for (auto &name : StrSplit(nodes->second, ",")) {
+      if (!name.empty()) node_names->push_back(name);
+    }
+  }
+  auto auto_iter = recompute->second.find(kAutoRecompute);
+  *auto_recompute = auto_iter != recompute->second.end() && auto_iter->second == "true";
+}
+
+// The nodes named in the [recompute] config section are recomputed, with auto recompute the cheap element-wise kernels
+// are added one by one as long as each shrinks the planned arena of the train run.
+int TrainSession::CompileRecomputeKernels() {
+  recompute_kernels_.clear();
+  recompute_offsets_.clear();
+  std::vector<std::string> node_names;
+  bool auto_recompute = false;
+  ParseRecomputeConfig(&node_names, &auto_recompute);
+  if (node_names.empty() && !auto_recompute) {
+    return RET_OK;
+  }
+  if (!IS_STATIC_ALLOCATOR(allocator_)) {
+    MS_LOG(WARNING) << "Recompute works on the static allocation of the train session only, it is disabled.";
+    return RET_OK;
+  }
+  std::set<kernel::KernelExec *> recompute;
+  for (auto &name : node_names) {
+    auto kernel = TSFindKernel(train_kernels_, name);
+    if (kernel == nullptr) {
+      MS_LOG(ERROR) << "cannot find recompute node " << name;
+      return RET_ERROR;
+    }
+    if (!IsRecomputable(kernel)) {
+      MS_LOG(WARNING) << "Node " << name << " cannot be recomputed, its activations are kept.";
+      continue;
+    }
+    recompute.insert(kernel);
+  }
+  std::vector<std::vector<size_t>> offsets;
+  auto origin_size = PlanTensors(train_kernels_, &offsets);
+  auto size = recompute.empty() ? origin_size : PlanTensors(BuildRecomputeKernels(recompute), &offsets);
+  if (auto_recompute) {
+    for (auto kernel : train_kernels_) {
+      if (recompute.find(kernel) != recompute.end() ||
+          inPlaceSupportedKernels.find(kernel->type()) == inPlaceSupportedKernels.end() || !IsRecomputable(kernel)) {
+        continue;
+      }
+      recompute.insert(kernel);
+      auto new_size = PlanTensors(BuildRecomputeKernels(recompute), &offsets);
+      if (new_size < size) {
+        size = new_size;
+      } else {
+        recompute.erase(kernel);
+      }
+    }
+  }
+  auto run_kernels = BuildRecomputeKernels(recompute);
+  if (run_kernels.size() == train_kernels_.size()) {
+    return RET_OK;
+  }
+  recompute_kernels_ = run_kernels;
+  MS_LOG(INFO) << "Recompute " << (recompute_kernels_.size() - train_kernels_.size())
+               << " kernels in backward, train activations " << size << " bytes instead of " << origin_size
+               << " bytes.";
+  return RET_OK;
+}
 }  // namespace lite
 
 lite::LiteSession *lite::TrainSession::CreateTrainSession(const std::string &fn, const lite::Context *context,
@@ -21,6 +21,7 @@
 #include <unordered_map>
 #include <memory>
 #include <map>
+#include <set>
 #include "include/train/train_cfg.h"
 #include "src/litert/lite_session.h"
 
@@ -106,6 +107,9 @@ class TrainSession : virtual public lite::LiteSession {
   int FindExportKernels(std::vector<kernel::KernelExec *> *export_kernels,
                         const std::vector<std::string> &export_output_tensor_names,
                         const std::vector<kernel::KernelExec *> &inference_kernels);
+  size_t GetRecomputeKernelNum() const {
+    return recompute_kernels_.empty() ? 0 : recompute_kernels_.size() - train_kernels_.size();
+  }
 
  protected:
   int AllocWorkSpace();
@@ -158,6 +162,15 @@ class TrainSession : virtual public lite::LiteSession {
   bool AllInputsNeedScale(kernel::KernelExec *kernel);
   void FreeWorkSpace();
   int AllocTensors(const std::vector<kernel::KernelExec *> &kernels);
+  size_t PlanTensors(const std::vector<kernel::KernelExec *> &kernels, std::vector<std::vector<size_t>> *offsets);
+  void ParseRecomputeConfig(std::vector<std::string> *node_names, bool *auto_recompute) const;
+  int CompileRecomputeKernels();
+  bool IsRecomputable(kernel::KernelExec *kernel) const;
+  std::vector<kernel::KernelExec *> BuildRecomputeKernels(const std::set<kernel::KernelExec *> &recompute) const;
+  void BindRecomputeData(const std::vector<kernel::KernelExec *> &run_kernels, size_t index);
+  const std::vector<kernel::KernelExec *> &train_run_kernels() const {
+    return recompute_kernels_.empty() ? train_kernels_ : recompute_kernels_;
+  }
   bool IsInPlaceKernel(kernel::KernelExec *kernel);
   bool IsInPlaceTensor(kernel::KernelExec *kernel, uint32_t idx,
                        const std::unordered_map<lite::Tensor *, int> &ref_count, uint32_t *input_idx);
@@ -175,6 +188,10 @@ class TrainSession : virtual public lite::LiteSession {
   void *tensors_data_ = nullptr;
   size_t tensors_data_size_ = 0;
   std::shared_ptr<Allocator> allocator_;
+  // train kernels with the recomputed forward kernels run again before their backward readers, and the arena offsets
+  // of the outputs of every run
+  std::vector<kernel::KernelExec *> recompute_kernels_;
+  std::vector<std::vector<size_t>> recompute_offsets_;
 };
 
 }  // namespace lite
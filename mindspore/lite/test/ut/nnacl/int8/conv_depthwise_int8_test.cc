@@ -0,0 +1,155 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/int8/conv_depthwise_int8.h"
+#include "nnacl/int8/fixed_point.h"
+
+namespace mindspore {
+class ConvDwInt8Test : public mindspore::CommonTest {
+ public:
+  ConvDwInt8Test() {}
+};
+
+namespace {
+struct DwQuantParam {
+  QuantArg input_arg = {0.1f, 5};
+  QuantArg output_arg = {0.1f, -3};
+  int32_t multiplier = 1518500250;
+  int32_t left_shift = 0;
+  int32_t right_shift = -12;
+  int32_t act_min = INT8_MIN;
+  int32_t act_max = INT8_MAX;
+};
+
+void InitConvParam(ConvParameter *conv_param, DwQuantParam *quant, int in_h, int in_w, int channel, int stride,
+                   int pad) {
+  conv_param->input_batch_ = 1;
+  conv_param->input_h_ = in_h;
+  conv_param->input_w_ = in_w;
+  conv_param->input_channel_ = channel;
+  conv_param->kernel_h_ = 3;
+  conv_param->kernel_w_ = 3;
+  conv_param->stride_h_ = stride;
+  conv_param->stride_w_ = stride;
+  conv_param->dilation_h_ = 1;
+  conv_param->dilation_w_ = 1;
+  conv_param->pad_u_ = pad;
+  conv_param->pad_l_ = pad;
+  conv_param->output_batch_ = 1;
+  conv_param->output_h_ = (in_h + 2 * pad - 3) / stride + 1;
+  conv_param->output_w_ = (in_w + 2 * pad - 3) / stride + 1;
+  conv_param->output_channel_ = channel;
+  conv_param->thread_num_ = 1;
+  conv_param->conv_quant_arg_.input_quant_args_ = &quant->input_arg;
+  conv_param->conv_quant_arg_.output_quant_args_ = &quant->output_arg;
+  conv_param->conv_quant_arg_.quant_multiplier_ = &quant->multiplier;
+  conv_param->conv_quant_arg_.left_shift_ = &quant->left_shift;
+  conv_param->conv_quant_arg_.right_shift_ = &quant->right_shift;
+  conv_param->conv_quant_arg_.out_act_min_ = &quant->act_min;
+  conv_param->conv_quant_arg_.out_act_max_ = &quant->act_max;
+}
+
+void InitData(std::vector<int8_t> *input, std::vector<int16_t> *weight, std::vector<int32_t> *bias) {
+  for (size_t i = 0; i < input->size(); i++) {
+    (*input)[i] = static_cast<int8_t>((i * 29 + 17) % 256);
+  }
+  for (size_t i = 0; i < weight->size(); i++) {
+    (*weight)[i] = static_cast<int16_t>(i * 61 % 255 - 127);
+  }
+  for (size_t c = 0; c < bias->size(); c++) {
+    (*bias)[c] = static_cast<int32_t>(c) * 100 - 1000;
+  }
+}
+
+// the 3x3 depthwise convolution of the nhwc input, the weight is 3x3 x channel
+void CheckConvDwInt8(const std::vector<int8_t> &output, const std::vector<int8_t> &input,
+                     const std::vector<int16_t> &weight, const std::vector<int32_t> &bias,
+                     const ConvParameter &conv_param, const DwQuantParam &quant) {
+  int channel = conv_param.output_channel_;
+  for (int oh = 0; oh < conv_param.output_h_; oh++) {
+    for (int ow = 0; ow < conv_param.output_w_; ow++) {
+      for (int c = 0; c < channel; c++) {
+        int32_t value = bias[c];
+        for (int kh = 0; kh < 3; kh++) {
+          for (int kw = 0; kw < 3; kw++) {
+            int ih = oh * conv_param.stride_h_ - conv_param.pad_u_ + kh;
+            int iw = ow * conv_param.stride_w_ - conv_param.pad_l_ + kw;
+            if (ih < 0 || ih >= conv_param.input_h_ || iw < 0 || iw >= conv_param.input_w_) {
+              continue;
+            }
+            value += (input[(ih * conv_param.input_w_ + iw) * channel + c] - quant.input_arg.zp_) *
+                     weight[(kh * 3 + kw) * channel + c];
+          }
+        }
+        value = MultiplyByQuantizedMultiplier(value, quant.multiplier, quant.left_shift, quant.right_shift) +
+                quant.output_arg.zp_;
+        value = MSMAX(quant.act_min, MSMIN(quant.act_max, value));
+        ASSERT_EQ(output[(oh * conv_param.output_w_ + ow) * channel + c], static_cast<int8_t>(value));
+      }
+    }
+  }
+}
+}  // namespace
+
+/// Feature: int8 depthwise convolution.
+/// Description: run ConvDwInt8 on 37 channels with stride 2 and padding, ConvDwInt8Row accumulates 16 channels per
+/// AVX2 step on x86 and the channels left one by one.
+/// Expectation: the output is bit-exact with the reference convolution.
+TEST_F(ConvDwInt8Test, ConvDwInt8) {
+  const int in_h = 7;
+  const int in_w = 9;
+  const int channel = 37;
+  ConvParameter conv_param = {};
+  DwQuantParam quant;
+  InitConvParam(&conv_param, &quant, in_h, in_w, channel, 2, 1);
+  std::vector<int8_t> input(in_h * in_w * channel);
+  std::vector<int16_t> weight(3 * 3 * channel);
+  std::vector<int32_t> bias(channel);
+  InitData(&input, &weight, &bias);
+
+  std::vector<int8_t> output(conv_param.output_h_ * conv_param.output_w_ * channel);
+  std::vector<int32_t> row_buffer(conv_param.output_w_ * channel);
+  ConvDwInt8(output.data(), row_buffer.data(), input.data(), weight.data(), bias.data(), &conv_param, 0);
+  CheckConvDwInt8(output, input, weight, bias, conv_param, quant);
+}
+
+/// Feature: int8 3x3 depthwise convolution.
+/// Description: run ConvDw3x3Int8 on 24 channels, the windows of 8 channels use AVX2 on x86.
+/// Expectation: the output is bit-exact with the reference convolution.
+TEST_F(ConvDwInt8Test, ConvDw3x3Int8) {
+  const int in_h = 5;
+  const int in_w = 6;
+  const int channel = 24;
+  ConvParameter conv_param = {};
+  DwQuantParam quant;
+  InitConvParam(&conv_param, &quant, in_h, in_w, channel, 1, 0);
+  std::vector<int8_t> input(in_h * in_w * channel);
+  std::vector<int16_t> weight(3 * 3 * channel);
+  std::vector<int32_t> bias(channel);
+  InitData(&input, &weight, &bias);
+  SlidingWindowParam sliding = {};
+  sliding.top_ = 0;
+  sliding.bottom_ = conv_param.output_h_;
+  sliding.left_ = 0;
+  sliding.right_ = conv_param.output_w_;
+
+  // with at most 64 channels and a narrow input, the windows read the input directly and the buffer is not used
+  std::vector<int8_t> output(conv_param.output_h_ * conv_param.output_w_ * channel);
+  ConvDw3x3Int8(output.data(), nullptr, input.data(), weight.data(), bias.data(), &conv_param, &sliding, 0);
+  CheckConvDwInt8(output, input, weight, bias, conv_param, quant);
+}
+}  // namespace mindspore
@@ -15,8 +15,11 @@
  */
 #include "include/api/model_parallel_runner.h"
 #include <memory>
+#include <thread>
+#include <vector>
 #include "common/common_test.h"
 #include "src/common/file_utils.h"
+#include "src/extendrt/cxx_api/model_pool/model_pool.h"
 
 namespace mindspore {
 namespace {
@@ -240,4 +243,104 @@ TEST_F(ModelParallelRunnerTest, RunnerInitByBuf) {
     tensor.SetData(nullptr);
   }
 }
+
+TEST_F(ModelParallelRunnerTest, RunnerPredictWithMmapModel) {
+  // predict with the model read onto the heap and with the mapped model, the outputs must be the same
+  auto predict = [](bool mmap_model, std::vector<float> *result) {
+    auto config = std::make_shared<RunnerConfig>();
+    ASSERT_NE(nullptr, config);
+    auto context = std::make_shared<Context>();
+    ASSERT_NE(nullptr, context);
+    auto &device_list = context->MutableDeviceInfo();
+    auto device_info = std::make_shared<mindspore::CPUDeviceInfo>();
+    ASSERT_NE(nullptr, device_info);
+    device_list.push_back(device_info);
+    config->SetContext(context);
+    config->SetWorkersNum(2);
+    if (mmap_model) {
+      config->SetConfigInfo("weight", {{"mmap_model", "true"}});
+    }
+    ModelPool runner;
+    auto status = runner.InitByPath(model_path, config);
+    ASSERT_EQ(status, kSuccess);
+    for (size_t i = 0; i < 2; i++) {
+      auto inputs = runner.GetInputs();
+      SetInputTensorData(&inputs);
+      std::vector<MSTensor> outputs;
+      status = runner.Predict(inputs, &outputs);
+      for (auto &tensor : inputs) {
+        char *data = static_cast<char *>(tensor.MutableData());
+        delete[] data;
+        tensor.SetData(nullptr);
+      }
+      ASSERT_EQ(status, kSuccess);
+      ASSERT_EQ(outputs.size(), 1);
+      ASSERT_EQ(outputs.front().DataSize(), kOutputDataSize);
+      auto output_data = outputs.front().Data();
+      auto data = static_cast<const float *>(output_data.get());
+      ASSERT_NE(nullptr, data);
+      result->assign(data, data + kOutputDataSize / sizeof(float));
+    }
+  };
+  std::vector<float> heap_result;
+  predict(false, &heap_result);
+  std::vector<float> mmap_result;
+  predict(true, &mmap_result);
+  ASSERT_EQ(heap_result.size(), mmap_result.size());
+  for (size_t i = 0; i < heap_result.size(); i++) {
+    ASSERT_FLOAT_EQ(heap_result[i], mmap_result[i]);
+  }
+}
+
+TEST_F(ModelParallelRunnerTest, RunnerPredictWithDynamicBatch) {
+  auto config = std::make_shared<RunnerConfig>();
+  ASSERT_NE(nullptr, config);
+
+  auto context = std::make_shared<Context>();
+  ASSERT_NE(nullptr, context);
+  auto &device_list = context->MutableDeviceInfo();
+  auto device_info = std::make_shared<mindspore::CPUDeviceInfo>();
+  ASSERT_NE(nullptr, device_info);
+  device_list.push_back(device_info);
+  config->SetContext(context);
+  config->SetWorkersNum(1);
+  config->SetConfigInfo("dynamic_batch", {{"max_batch_size", "4"}, {"max_queue_delay_us", "100000"}});
+  // use the model pool behind ModelParallelRunner to check the merged batch
+  ModelPool runner;
+  auto status = runner.InitByPath(model_path, config);
+  ASSERT_EQ(status, kSuccess);
+
+  constexpr size_t kRequestNum = 4;
+  std::vector<Status> results(kRequestNum, kLiteError);
+  std::vector<size_t> output_sizes(kRequestNum, 0);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kRequestNum; i++) {
+    threads.emplace_back([&runner, &results, &output_sizes, i]() {
+      auto inputs = runner.GetInputs();
+      SetInputTensorData(&inputs);
+      std::vector<MSTensor> outputs;
+      results[i] = runner.Predict(inputs, &outputs);
+      if (!outputs.empty()) {
+        output_sizes[i] = outputs.front().DataSize();
+      }
+      for (auto &tensor : inputs) {
+        char *data = static_cast<char *>(tensor.MutableData());
+        delete[] data;
+        tensor.SetData(nullptr);
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  for (size_t i = 0; i < kRequestNum; i++) {
+    ASSERT_EQ(results[i], kSuccess);
+    ASSERT_EQ(output_sizes[i], kOutputDataSize);
+  }
+  // the requests queued while the worker is busy are merged, how many of them depends on the thread timing, so only
+  // check that some were merged and that a batch never exceeds max_batch_size
+  constexpr size_t kMaxBatchSize = 4;
+  ASSERT_GT(runner.GetMaxMergedBatch(), 1U);
+  ASSERT_LE(runner.GetMaxMergedBatch(), kMaxBatchSize);
+}
 }  // namespace mindspore
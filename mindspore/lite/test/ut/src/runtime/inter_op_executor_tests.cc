@@ -0,0 +1,277 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "src/litert/inner_context.h"
+#include "src/litert/inter_op_executor.h"
+#include "src/litert/kernel_exec.h"
+#include "src/litert/lite_kernel.h"
+
+namespace mindspore {
+class InterOpExecutorTest : public mindspore::CommonTest {
+ public:
+  InterOpExecutorTest() = default;
+};
+
+namespace {
+constexpr int kThreadNum = 4;
+constexpr int kElementNum = 1024;
+
+// out = sum(inputs) over op_parameter thread_num tasks, the order the kernel finished in and the threads its tasks ran
+// on.
+class AddNTestKernel : public kernel::LiteKernel {
+ public:
+  AddNTestKernel(OpParameter *parameter, const std::vector<lite::Tensor *> &inputs,
+                 const std::vector<lite::Tensor *> &outputs, const lite::Context *ctx, std::atomic_int *finish_count)
+      : LiteKernel(parameter, inputs, outputs, ctx), finish_count_(finish_count) {}
+  int Prepare() override { return lite::RET_OK; }
+  int ReSize() override { return lite::RET_OK; }
+  int Run() override {
+    task_threads_.clear();
+    auto ret = lite::ParallelLaunch(ms_context_, AddNRun, this, op_parameter_->thread_num_);
+    finish_order_ = (*finish_count_)++;
+    return ret;
+  }
+  int DoAdd(int task_id) {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      task_threads_.insert(std::this_thread::get_id());
+    }
+    int step = UP_DIV(kElementNum, op_parameter_->thread_num_);
+    auto out = static_cast<float *>(out_tensors_.front()->data());
+    for (int i = task_id * step; i < MSMIN(kElementNum, (task_id + 1) * step); ++i) {
+      out[i] = 0.0f;
+      for (auto in_tensor : in_tensors_) {
+        out[i] += static_cast<float *>(in_tensor->data())[i];
+      }
+      // long enough for the other tasks to be taken by the idle workers
+      std::this_thread::sleep_for(std::chrono::microseconds(1));
+    }
+    return lite::RET_OK;
+  }
+  int finish_order() const { return finish_order_; }
+  size_t task_thread_num() const { return task_threads_.size(); }
+
+ private:
+  static int AddNRun(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+    return reinterpret_cast<AddNTestKernel *>(cdata)->DoAdd(task_id);
+  }
+
+  std::atomic_int *finish_count_ = nullptr;
+  int finish_order_ = -1;
+  std::mutex mutex_;
+  std::set<std::thread::id> task_threads_;
+};
+
+class TestGraph {
+ public:
+  explicit TestGraph(const lite::InnerContext *ctx) : ctx_(ctx) {}
+  ~TestGraph() {
+    for (auto kernel : kernels_) {
+      delete kernel;
+    }
+    for (auto tensor : tensors_) {
+      delete tensor;
+    }
+  }
+
+  lite::Tensor *AddTensor(lite::Category category = lite::VAR) {
+    auto tensor = new lite::Tensor(kNumberTypeFloat32, {kElementNum}, NHWC, category);
+    tensors_.push_back(tensor);
+    return tensor;
+  }
+
+  kernel::KernelExec *AddKernel(const std::vector<kernel::KernelExec *> &in_kernels,
+                                const std::vector<lite::Tensor *> &inputs, lite::Tensor *output) {
+    auto parameter = reinterpret_cast<OpParameter *>(malloc(sizeof(OpParameter)));
+    memset(parameter, 0, sizeof(OpParameter));
+    parameter->type_ = schema::PrimitiveType_AddN;
+    parameter->thread_num_ = ctx_->thread_num_;
+    auto lite_kernel = std::make_shared<AddNTestKernel>(parameter, inputs, std::vector<lite::Tensor *>{output}, ctx_,
+                                                        &finish_count_);
+    lite_kernels_.push_back(lite_kernel.get());
+    auto kernel = new kernel::KernelExec(lite_kernel);
+    for (auto in_kernel : in_kernels) {
+      kernel->AddInKernel(in_kernel);
+      in_kernel->AddOutKernel(kernel);
+    }
+    for (auto input : inputs) {
+      if (!input->IsGraphInput()) {
+        input->set_init_ref_count(input->init_ref_count() + 1);
+      }
+    }
+    kernels_.push_back(kernel);
+    return kernel;
+  }
+
+  const std::vector<kernel::KernelExec *> &kernels() const { return kernels_; }
+  int finish_order(size_t index) const { return lite_kernels_[index]->finish_order(); }
+  size_t task_thread_num(size_t index) const { return lite_kernels_[index]->task_thread_num(); }
+
+ private:
+  const lite::InnerContext *ctx_ = nullptr;
+  std::vector<lite::Tensor *> tensors_;
+  std::vector<kernel::KernelExec *> kernels_;
+  std::vector<AddNTestKernel *> lite_kernels_;
+  std::atomic_int finish_count_ = {0};
+};
+}  // namespace
+
+TEST_F(InterOpExecutorTest, RunDiamond) {
+  lite::InnerContext ctx;
+  ctx.thread_num_ = kThreadNum;
+  ASSERT_EQ(lite::RET_OK, ctx.Init());
+  TestGraph graph(&ctx);
+  // in -> k0 -> (k1, k2) -> k3 -> out, out = 2 * in
+  auto in = graph.AddTensor(lite::GRAPH_INPUT);
+  auto t0 = graph.AddTensor();
+  auto t1 = graph.AddTensor();
+  auto t2 = graph.AddTensor();
+  auto out = graph.AddTensor(lite::GRAPH_OUTPUT);
+  auto k0 = graph.AddKernel({}, {in}, t0);
+  auto k1 = graph.AddKernel({k0}, {t0}, t1);
+  auto k2 = graph.AddKernel({k0}, {t0}, t2);
+  (void)graph.AddKernel({k1, k2}, {t1, t2}, out);
+
+  lite::InterOpExecutor executor(kThreadNum);
+  ASSERT_EQ(lite::RET_OK, executor.Prepare(graph.kernels(), {in}, {out}, &ctx));
+  ASSERT_EQ(executor.branch_num(), 2);
+  // the branches share the threads, the kernels of the chain keep all of them
+  ASSERT_EQ(graph.kernels()[0]->op_parameter()->thread_num_, kThreadNum);
+  ASSERT_LE(graph.kernels()[1]->op_parameter()->thread_num_, kThreadNum / 2);
+  ASSERT_LE(graph.kernels()[2]->op_parameter()->thread_num_, kThreadNum / 2);
+  ASSERT_EQ(graph.kernels()[3]->op_parameter()->thread_num_, kThreadNum);
+
+  auto in_data = static_cast<float *>(in->MutableData());
+  ASSERT_NE(in_data, nullptr);
+  for (int i = 0; i < kElementNum; ++i) {
+    in_data[i] = static_cast<float>(i);
+  }
+  ASSERT_EQ(lite::RET_OK, executor.Run({in}, {out}, graph.kernels()));
+  ASSERT_EQ(graph.finish_order(0), 0);
+  ASSERT_EQ(graph.finish_order(3), 3);
+  auto out_data = static_cast<float *>(out->data());
+  ASSERT_NE(out_data, nullptr);
+  for (int i = 0; i < kElementNum; ++i) {
+    ASSERT_EQ(out_data[i], 2.0f * i);
+  }
+}
+
+/// Feature: the inter-op executor with as many branches as threads.
+/// Description: in -> k0 -> (k1, k2, k3, k4) -> k5 -> out with 4 threads and 4 branches, so that the wide level takes
+/// every worker of the pool.
+/// Expectation: k0, which is ready while the branches are not, runs its tasks on more than one thread, so no branch
+/// holds a worker while it runs, and out = 4 * in.
+TEST_F(InterOpExecutorTest, ChainKernelUsesThreadPool) {
+  lite::InnerContext ctx;
+  ctx.thread_num_ = kThreadNum;
+  ASSERT_EQ(lite::RET_OK, ctx.Init());
+  TestGraph graph(&ctx);
+  auto in = graph.AddTensor(lite::GRAPH_INPUT);
+  auto t0 = graph.AddTensor();
+  auto out = graph.AddTensor(lite::GRAPH_OUTPUT);
+  auto k0 = graph.AddKernel({}, {in}, t0);
+  std::vector<kernel::KernelExec *> branches;
+  std::vector<lite::Tensor *> branch_outputs;
+  for (int i = 0; i < kThreadNum; ++i) {
+    branch_outputs.push_back(graph.AddTensor());
+    branches.push_back(graph.AddKernel({k0}, {t0}, branch_outputs.back()));
+  }
+  (void)graph.AddKernel(branches, branch_outputs, out);
+
+  lite::InterOpExecutor executor(kThreadNum);
+  ASSERT_EQ(lite::RET_OK, executor.Prepare(graph.kernels(), {in}, {out}, &ctx));
+  ASSERT_EQ(executor.branch_num(), kThreadNum);
+  ASSERT_EQ(graph.kernels().front()->op_parameter()->thread_num_, kThreadNum);
+  ASSERT_EQ(graph.kernels().back()->op_parameter()->thread_num_, kThreadNum);
+
+  auto in_data = static_cast<float *>(in->MutableData());
+  ASSERT_NE(in_data, nullptr);
+  for (int i = 0; i < kElementNum; ++i) {
+    in_data[i] = static_cast<float>(i);
+  }
+  // the workers of a new pool start busy, let them go idle before k0 looks for them
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  ASSERT_EQ(lite::RET_OK, executor.Run({in}, {out}, graph.kernels()));
+  ASSERT_GT(graph.task_thread_num(0), 1U);
+  auto out_data = static_cast<float *>(out->data());
+  ASSERT_NE(out_data, nullptr);
+  for (int i = 0; i < kElementNum; ++i) {
+    ASSERT_EQ(out_data[i], static_cast<float>(kThreadNum * i));
+  }
+}
+
+TEST_F(InterOpExecutorTest, ChainRunsSequentially) {
+  lite::InnerContext ctx;
+  ctx.thread_num_ = kThreadNum;
+  ASSERT_EQ(lite::RET_OK, ctx.Init());
+  TestGraph graph(&ctx);
+  auto in = graph.AddTensor(lite::GRAPH_INPUT);
+  auto t0 = graph.AddTensor();
+  auto out = graph.AddTensor(lite::GRAPH_OUTPUT);
+  auto k0 = graph.AddKernel({}, {in}, t0);
+  (void)graph.AddKernel({k0}, {t0}, out);
+
+  lite::InterOpExecutor executor(kThreadNum);
+  ASSERT_EQ(lite::RET_OK, executor.Prepare(graph.kernels(), {in}, {out}, &ctx));
+  ASSERT_EQ(executor.branch_num(), 1);
+  ASSERT_EQ(graph.kernels()[1]->op_parameter()->thread_num_, kThreadNum);
+}
+TEST_F(InterOpExecutorTest, RestoreThreadNum) {
+  lite::InnerContext ctx;
+  ctx.thread_num_ = kThreadNum;
+  ASSERT_EQ(lite::RET_OK, ctx.Init());
+  TestGraph graph(&ctx);
+  auto in = graph.AddTensor(lite::GRAPH_INPUT);
+  auto out0 = graph.AddTensor(lite::GRAPH_OUTPUT);
+  auto out1 = graph.AddTensor(lite::GRAPH_OUTPUT);
+  (void)graph.AddKernel({}, {in}, out0);
+  (void)graph.AddKernel({}, {in}, out1);
+  ASSERT_NE(in->MutableData(), nullptr);
+
+  {
+    lite::InterOpExecutor executor(kThreadNum);
+    ASSERT_EQ(lite::RET_OK, executor.Prepare(graph.kernels(), {in}, {out0, out1}, &ctx));
+    ASSERT_EQ(executor.branch_num(), 2);
+    auto branch_thread_num = graph.kernels()[0]->op_parameter()->thread_num_;
+    ASSERT_LE(branch_thread_num, kThreadNum / 2);
+
+    // the callbacks run the kernels one by one with all the threads, the split is kept for the next Run
+    std::vector<int> callback_thread_nums;
+    lite::KernelCallBack before = [&graph, &callback_thread_nums](std::vector<lite::Tensor *>,
+                                                                   std::vector<lite::Tensor *>,
+                                                                   const MSCallBackParam &) {
+      callback_thread_nums.push_back(graph.kernels()[callback_thread_nums.size()]->op_parameter()->thread_num_);
+      return true;
+    };
+    ASSERT_EQ(lite::RET_OK, executor.Run({in}, {out0, out1}, graph.kernels(), before, nullptr));
+    ASSERT_EQ(callback_thread_nums, std::vector<int>({kThreadNum, kThreadNum}));
+    ASSERT_EQ(graph.kernels()[0]->op_parameter()->thread_num_, branch_thread_num);
+
+    // prepare again splits the thread num of the kernels, not the one of the branches
+    ASSERT_EQ(lite::RET_OK, executor.Prepare(graph.kernels(), {in}, {out0, out1}, &ctx));
+    ASSERT_EQ(graph.kernels()[0]->op_parameter()->thread_num_, branch_thread_num);
+  }
+  ASSERT_EQ(graph.kernels()[0]->op_parameter()->thread_num_, kThreadNum);
+  ASSERT_EQ(graph.kernels()[1]->op_parameter()->thread_num_, kThreadNum);
+}
+}  // namespace mindspore
@@ -13,7 +13,9 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <cstring>
 #include <memory>
+#include <vector>
 #include "common/common_test.h"
 #include "include/api/model.h"
 #include "include/api/context.h"
@@ -223,6 +225,46 @@ TEST_F(TestCxxApiLiteModel, test_fp16_SUCCESS) {
   ASSERT_TRUE(model.Build(GraphCell(graph), context, train_cfg) == kSuccess);
 }
 
+TEST_F(TestCxxApiLiteModel, test_auto_recompute_SUCCESS) {
+  auto context = std::make_shared<Context>();
+  context->SetThreadNum(kNumThreads);
+  auto cpu_context = std::make_shared<mindspore::CPUDeviceInfo>();
+  context->MutableDeviceInfo().push_back(cpu_context);
+  // the recomputed activations must give the losses of the run keeping them
+  std::vector<float> losses[2];
+  for (int recompute = 0; recompute < 2; recompute++) {
+    Model model;
+    Graph graph;
+    auto train_cfg = std::make_shared<TrainCfg>();
+    if (recompute == 1) {
+      ASSERT_TRUE(model.UpdateConfig("recompute", {"auto", "true"}) == kSuccess);
+    }
+    ASSERT_TRUE(Serialization::Load("./nets/conv_train_model.ms", ModelType::kMindIR, &graph) == kSuccess);
+    ASSERT_TRUE(model.Build(GraphCell(graph), context, train_cfg) == kSuccess);
+    ASSERT_TRUE(model.SetTrainMode(true) == kSuccess);
+    for (auto &input : model.GetInputs()) {
+      auto data = input.MutableData();
+      ASSERT_NE(data, nullptr);
+      memset(data, 0, input.DataSize());
+      if (input.DataType() == DataType::kNumberTypeFloat32) {
+        for (int64_t i = 0; i < input.ElementNum(); i++) {
+          static_cast<float *>(data)[i] = static_cast<float>(i % 7) * 0.1f;
+        }
+      }
+    }
+    for (int step = 0; step < 2; step++) {
+      ASSERT_TRUE(model.RunStep() == kSuccess);
+      auto outputs = model.GetOutputs();
+      ASSERT_GT(outputs.size(), 0);
+      losses[recompute].push_back(static_cast<float *>(outputs.front().MutableData())[0]);
+    }
+  }
+  ASSERT_EQ(losses[0].size(), losses[1].size());
+  for (size_t i = 0; i < losses[0].size(); i++) {
+    ASSERT_NEAR(losses[0][i], losses[1][i], 1e-5);
+  }
+}
+
 #define NUM_OF_CLASSES 10
 #define FEATURE_SIZE 10
 TEST_F(TestCxxApiLiteModel, set_weights_FAILURE) {
@@ -14,9 +14,15 @@
  * limitations under the License.
  */
 #include <iostream>
+#include <map>
+#include <memory>
+#include <string>
 #include "common/common_test.h"
 #include "nnacl/matmul_parameter.h"
+#include "src/common/common.h"
 #include "src/litert/kernel/cpu/fp32/convolution_1x1_fp32.h"
+#include "src/litert/kernel_registry.h"
+#include "src/litert/tensor_category.h"
 
 namespace mindspore {
 using mindspore::lite::Tensor;
@@ -135,4 +141,68 @@ TEST_F(TestConv1x1Fp32, Input1x1PrePack4) {
   EXPECT_EQ(0, CompareOutputData(out, correct, 54));
   delete conv_param;
 }
+
+TEST_F(TestConv1x1Fp32, Conv1x1IgnoresBf16Weight) {
+  constexpr int kBatch = 2;
+  constexpr int kPlane = 3 * 5;
+  constexpr int kInChannel = 12;
+  constexpr int kOutChannel = 7;
+  std::vector<float> in(kBatch * kPlane * kInChannel);
+  for (size_t i = 0; i < in.size(); ++i) {
+    in[i] = static_cast<float>(i % 9) * 0.25f - 1.0f;
+  }
+  std::vector<float> weight(kOutChannel * kInChannel);
+  for (size_t i = 0; i < weight.size(); ++i) {
+    weight[i] = 0.1f * static_cast<float>(i % 11) - 0.45f;
+  }
+  std::vector<float> bias = {0.5, -0.5, 1, -1, 1.5, -1.5, 2};
+  std::vector<lite::Tensor *> inputs = {
+    CreateTensor<float>(kNumberTypeFloat32, {kBatch, 3, 5, kInChannel}, in),
+    CreateTensor<float>(kNumberTypeFloat32, {kOutChannel, 1, 1, kInChannel}, weight, mindspore::NHWC,
+                        lite::Category::CONST_TENSOR),
+    CreateTensor<float>(kNumberTypeFloat32, {kOutChannel}, bias, mindspore::NHWC, lite::Category::CONST_TENSOR)};
+  std::vector<lite::Tensor *> outputs = {CreateTensor<float>(kNumberTypeFloat32, {kBatch, 3, 5, kOutChannel}, {})};
+
+  auto conv_param = static_cast<ConvParameter *>(malloc(sizeof(ConvParameter)));
+  memset(conv_param, 0, sizeof(ConvParameter));
+  conv_param->kernel_h_ = 1;
+  conv_param->kernel_w_ = 1;
+  conv_param->stride_h_ = 1;
+  conv_param->stride_w_ = 1;
+  conv_param->dilation_h_ = 1;
+  conv_param->dilation_w_ = 1;
+  conv_param->group_ = 1;
+  conv_param->input_channel_ = kInChannel;
+  conv_param->output_channel_ = kOutChannel;
+  conv_param->act_type_ = ActType_No;
+  auto ctx = std::make_shared<lite::InnerContext>();
+  ctx->thread_num_ = 2;
+  ASSERT_EQ(ctx->Init(), lite::RET_OK);
+  conv_param->op_parameter_.thread_num_ = ctx->thread_num_;
+
+  kernel::KernelKey desc = {kernel::KERNEL_ARCH::kCPU, kNumberTypeFloat32, NHWC, schema::PrimitiveType_Conv2DFusion};
+  auto creator = lite::KernelRegistry::GetInstance()->GetCreator(desc);
+  ASSERT_NE(creator, nullptr);
+  auto *kernel = creator(inputs, outputs, reinterpret_cast<OpParameter *>(conv_param), ctx.get(), desc);
+  ASSERT_NE(kernel, nullptr);
+  std::map<std::string, std::map<std::string, std::string>> config = {{lite::kWeight, {{lite::kBf16Weight, "true"}}}};
+  kernel->SetConfig(&config);
+  ASSERT_EQ(kernel->Prepare(), lite::RET_OK);
+  ASSERT_EQ(kernel->Run(), lite::RET_OK);
+
+  // bf16_weight only applies to the few-row matmuls, the 1x1 convolution keeps the fp32 weights.
+  auto out = static_cast<float *>(outputs[0]->data());
+  for (int p = 0; p < kBatch * kPlane; ++p) {
+    for (int oc = 0; oc < kOutChannel; ++oc) {
+      float expect = bias[oc];
+      for (int ic = 0; ic < kInChannel; ++ic) {
+        expect += in[p * kInChannel + ic] * weight[oc * kInChannel + ic];
+      }
+      ASSERT_NEAR(out[p * kOutChannel + oc], expect, 1e-5);
+    }
+  }
+  delete kernel;
+  DestroyTensors(inputs);
+  DestroyTensors(outputs);
+}
 }  // namespace mindspore
@@ -0,0 +1,439 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/errorcode.h"
+#include "nnacl/fp32/flash_attention_fp32.h"
+#include "src/common/common.h"
+#include "src/litert/kernel_registry.h"
+#include "src/litert/tensor_category.h"
+
+namespace mindspore {
+class TestFlashAttentionFp32 : public mindspore::CommonTest {
+ public:
+  TestFlashAttentionFp32() {}
+};
+
+namespace {
+FlashAttentionParameter InitParam(int batch, int head_num, int head_size, int q_seq, int kv_seq, int kv_stride,
+                                  bool causal) {
+  FlashAttentionParameter param = {};
+  param.batch_ = batch;
+  param.head_num_ = head_num;
+  param.head_size_ = head_size;
+  param.q_seq_ = q_seq;
+  param.kv_seq_ = kv_seq;
+  param.kv_stride_ = kv_stride;
+  param.q_tile_ = C4NUM;
+  param.kv_tile_ = C3NUM;
+  param.scale_ = 1.0f / std::sqrt(static_cast<float>(head_size));
+  param.causal_ = causal;
+  return param;
+}
+
+// softmax(q * k^T * scale + mask) * v of a single head, q_seq rows against the first kv_seq rows, the mask is
+// [q_seq, kv_seq] or nullptr.
+std::vector<float> ReferenceAttention(const float *q, const float *k, const float *v, const float *mask, int q_seq,
+                                      int kv_seq, int head_size, float scale, bool causal) {
+  std::vector<float> out(q_seq * head_size, 0.0f);
+  for (int i = 0; i < q_seq; ++i) {
+    int last = causal ? kv_seq - q_seq + i : kv_seq - 1;
+    std::vector<float> score(last + 1);
+    float max_score = -1e30f;
+    for (int j = 0; j <= last; ++j) {
+      float dot = 0.0f;
+      for (int d = 0; d < head_size; ++d) {
+        dot += q[i * head_size + d] * k[j * head_size + d];
+      }
+      score[j] = dot * scale + (mask == nullptr ? 0.0f : mask[i * kv_seq + j]);
+      max_score = std::max(max_score, score[j]);
+    }
+    float sum = 0.0f;
+    for (int j = 0; j <= last; ++j) {
+      score[j] = std::exp(score[j] - max_score);
+      sum += score[j];
+    }
+    for (int j = 0; j <= last; ++j) {
+      for (int d = 0; d < head_size; ++d) {
+        out[i * head_size + d] += score[j] / sum * v[j * head_size + d];
+      }
+    }
+  }
+  return out;
+}
+
+// x * weight^T + bias, x is [row, col] and weight is [col, col].
+std::vector<float> ReferenceProject(const float *x, const float *weight, const float *bias, int row, int col) {
+  std::vector<float> out(row * col);
+  for (int i = 0; i < row; ++i) {
+    for (int c = 0; c < col; ++c) {
+      float sum = bias[c];
+      for (int d = 0; d < col; ++d) {
+        sum += x[i * col + d] * weight[c * col + d];
+      }
+      out[i * col + c] = sum;
+    }
+  }
+  return out;
+}
+
+// the Attention op of a single batch: the q, k, v projections, the attention of every head over the mask, which may be
+// nullptr, and the output projection.
+std::vector<float> ReferenceAttentionOp(const std::vector<float> &x_q, const std::vector<float> &x_kv,
+                                        const float *weight_q, const float *weight_k, const float *weight_v,
+                                        const std::vector<float> &weight_o, const std::vector<float> &bias_qkv,
+                                        const std::vector<float> &bias_o, const float *mask, int q_seq, int kv_seq,
+                                        int head_num, int head_size, bool causal) {
+  int hidden = head_num * head_size;
+  auto q = ReferenceProject(x_q.data(), weight_q, bias_qkv.data(), q_seq, hidden);
+  auto k = ReferenceProject(x_kv.data(), weight_k, bias_qkv.data() + hidden, kv_seq, hidden);
+  auto v = ReferenceProject(x_kv.data(), weight_v, bias_qkv.data() + 2 * hidden, kv_seq, hidden);
+  std::vector<float> attention(q_seq * hidden);
+  for (int h = 0; h < head_num; ++h) {
+    std::vector<float> q_head;
+    std::vector<float> k_head;
+    std::vector<float> v_head;
+    for (int i = 0; i < q_seq; ++i) {
+      auto offset = i * hidden + h * head_size;
+      q_head.insert(q_head.end(), q.begin() + offset, q.begin() + offset + head_size);
+    }
+    for (int i = 0; i < kv_seq; ++i) {
+      auto offset = i * hidden + h * head_size;
+      k_head.insert(k_head.end(), k.begin() + offset, k.begin() + offset + head_size);
+      v_head.insert(v_head.end(), v.begin() + offset, v.begin() + offset + head_size);
+    }
+    auto out = ReferenceAttention(q_head.data(), k_head.data(), v_head.data(), mask, q_seq, kv_seq, head_size,
+                                  1.0f / std::sqrt(static_cast<float>(head_size)), causal);
+    for (int i = 0; i < q_seq; ++i) {
+      std::copy(out.begin() + i * head_size, out.begin() + (i + 1) * head_size,
+                attention.begin() + i * hidden + h * head_size);
+    }
+  }
+  return ReferenceProject(attention.data(), weight_o.data(), bias_o.data(), q_seq, hidden);
+}
+
+std::vector<float> MakeData(int size, int period, float step, float offset) {
+  std::vector<float> data(size);
+  for (int i = 0; i < size; ++i) {
+    data[i] = static_cast<float>(i % period) * step + offset;
+  }
+  return data;
+}
+}  // namespace
+
+TEST_F(TestFlashAttentionFp32, CausalSingleHead) {
+  constexpr int kSeq = 11;
+  constexpr int kHeadSize = 6;
+  auto q = MakeData(kSeq * kHeadSize, 7, 0.25f, -0.75f);
+  auto k = MakeData(kSeq * kHeadSize, 5, 0.3f, -0.6f);
+  auto v = MakeData(kSeq * kHeadSize, 9, 0.1f, 0.0f);
+  FlashAttentionParameter param = InitParam(1, 1, kHeadSize, kSeq, kSeq, kSeq, true);
+  std::vector<float> workspace(FlashAttentionWorkspaceSize(&param));
+  std::vector<float> out(kSeq * kHeadSize);
+  ASSERT_EQ(FlashAttentionFp32(q.data(), k.data(), v.data(), nullptr, out.data(), workspace.data(), &param, 0, 1),
+            NNACL_OK);
+  auto expect = ReferenceAttention(q.data(), k.data(), v.data(), nullptr, kSeq, kSeq, kHeadSize, param.scale_, true);
+  ASSERT_EQ(0, CompareOutputData(out.data(), expect.data(), kSeq * kHeadSize, 1e-5));
+}
+
+/// Feature: flash attention with a mask.
+/// Description: two batches of three heads with a head size of 19, which leaves a tail after the SIMD blocks, and a
+/// per-batch mask that blocks some keys with a large negative value and biases the others.
+/// Expectation: every head of every batch matches the reference attention with the mask of its batch.
+TEST_F(TestFlashAttentionFp32, MaskedMultiBatch) {
+  constexpr int kBatch = 2;
+  constexpr int kHeads = 3;
+  constexpr int kHeadSize = 19;
+  constexpr int kQSeq = 5;
+  constexpr int kKVSeq = 8;
+  auto q = MakeData(kBatch * kHeads * kQSeq * kHeadSize, 13, 0.15f, -0.9f);
+  auto k = MakeData(kBatch * kHeads * kKVSeq * kHeadSize, 11, 0.2f, -1.0f);
+  auto v = MakeData(kBatch * kHeads * kKVSeq * kHeadSize, 7, 0.3f, -0.8f);
+  std::vector<float> mask(kBatch * kQSeq * kKVSeq);
+  for (int i = 0; i < static_cast<int>(mask.size()); ++i) {
+    mask[i] = i % 5 == 1 ? -1e9f : static_cast<float>(i % 3) * 0.5f;
+  }
+  FlashAttentionParameter param = InitParam(kBatch, kHeads, kHeadSize, kQSeq, kKVSeq, kKVSeq, false);
+  constexpr int kThreadNum = 3;
+  int workspace_size = FlashAttentionWorkspaceSize(&param);
+  std::vector<float> workspace(workspace_size * kThreadNum);
+  std::vector<float> out(kBatch * kQSeq * kHeads * kHeadSize);
+  for (int task_id = 0; task_id < kThreadNum; ++task_id) {
+    ASSERT_EQ(FlashAttentionFp32(q.data(), k.data(), v.data(), mask.data(), out.data(),
+                                 workspace.data() + task_id * workspace_size, &param, task_id, kThreadNum),
+              NNACL_OK);
+  }
+  for (int b = 0; b < kBatch; ++b) {
+    for (int h = 0; h < kHeads; ++h) {
+      auto head = b * kHeads + h;
+      auto expect = ReferenceAttention(q.data() + head * kQSeq * kHeadSize, k.data() + head * kKVSeq * kHeadSize,
+                                       v.data() + head * kKVSeq * kHeadSize, mask.data() + b * kQSeq * kKVSeq, kQSeq,
+                                       kKVSeq, kHeadSize, param.scale_, false);
+      for (int i = 0; i < kQSeq; ++i) {
+        // the output is [batch, q_seq, head_num, head_size]
+        auto out_row = out.data() + ((b * kQSeq + i) * kHeads + h) * kHeadSize;
+        ASSERT_EQ(0, CompareOutputData(out_row, expect.data() + i * kHeadSize, kHeadSize, 1e-4));
+      }
+    }
+  }
+}
+
+TEST_F(TestFlashAttentionFp32, DecodeWithKVCache) {
+  constexpr int kHeads = 2;
+  constexpr int kHeadSize = 4;
+  constexpr int kMaxSeq = 8;
+  constexpr int kPrompt = 5;
+  std::vector<float> k(kHeads * (kPrompt + 1) * kHeadSize);
+  std::vector<float> v(k.size());
+  for (size_t i = 0; i < k.size(); ++i) {
+    k[i] = static_cast<float>(i % 11) * 0.2f - 1.0f;
+    v[i] = static_cast<float>(i % 3) - 1.0f;
+  }
+  // the prompt fills the cache, then one decoding step appends a single row per head.
+  FlashAttentionParameter param = InitParam(1, kHeads, kHeadSize, 1, kPrompt + 1, kMaxSeq, true);
+  std::vector<float> k_cache(kHeads * kMaxSeq * kHeadSize);
+  std::vector<float> v_cache(k_cache.size());
+  std::vector<float> k_prompt;
+  std::vector<float> v_prompt;
+  std::vector<float> k_step;
+  std::vector<float> v_step;
+  for (int h = 0; h < kHeads; ++h) {
+    auto head_begin = h * (kPrompt + 1) * kHeadSize;
+    k_prompt.insert(k_prompt.end(), k.begin() + head_begin, k.begin() + head_begin + kPrompt * kHeadSize);
+    v_prompt.insert(v_prompt.end(), v.begin() + head_begin, v.begin() + head_begin + kPrompt * kHeadSize);
+    k_step.insert(k_step.end(), k.begin() + head_begin + kPrompt * kHeadSize,
+                  k.begin() + head_begin + (kPrompt + 1) * kHeadSize);
+    v_step.insert(v_step.end(), v.begin() + head_begin + kPrompt * kHeadSize,
+                  v.begin() + head_begin + (kPrompt + 1) * kHeadSize);
+  }
+  ASSERT_EQ(KVCacheAppendFp32(k_cache.data(), v_cache.data(), k_prompt.data(), v_prompt.data(), &param, 0, kPrompt),
+            NNACL_OK);
+  ASSERT_EQ(KVCacheAppendFp32(k_cache.data(), v_cache.data(), k_step.data(), v_step.data(), &param, kPrompt, 1),
+            NNACL_OK);
+  EXPECT_NE(KVCacheAppendFp32(k_cache.data(), v_cache.data(), k_step.data(), v_step.data(), &param, kMaxSeq, 1),
+            NNACL_OK);
+
+  std::vector<float> q = {0.5f, -0.25f, 1.0f, 0.75f, -1.0f, 0.5f, 0.25f, 0.0f};
+  std::vector<float> workspace(FlashAttentionWorkspaceSize(&param) * 2);
+  std::vector<float> out(kHeads * kHeadSize);
+  for (int task_id = 0; task_id < 2; ++task_id) {
+    ASSERT_EQ(FlashAttentionFp32(q.data(), k_cache.data(), v_cache.data(), nullptr, out.data(),
+                                 workspace.data() + task_id * FlashAttentionWorkspaceSize(&param), &param, task_id, 2),
+              NNACL_OK);
+  }
+  for (int h = 0; h < kHeads; ++h) {
+    auto head_begin = h * (kPrompt + 1) * kHeadSize;
+    auto expect = ReferenceAttention(q.data() + h * kHeadSize, k.data() + head_begin, v.data() + head_begin, nullptr,
+                                     1, kPrompt + 1, kHeadSize, param.scale_, true);
+    ASSERT_EQ(0, CompareOutputData(out.data() + h * kHeadSize, expect.data(), kHeadSize, 1e-5));
+  }
+}
+
+/// Feature: the projection of the attention op.
+/// Description: project a [2, 3, 12] input into 2 heads of size 6 over 4 tasks, once split into heads with a row stride
+/// of 5 and once in the input layout.
+/// Expectation: both layouts hold x * weight^T + bias.
+TEST_F(TestFlashAttentionFp32, Project) {
+  constexpr int kBatch = 2;
+  constexpr int kSeq = 3;
+  constexpr int kHeads = 2;
+  constexpr int kHeadSize = 6;
+  constexpr int kHidden = kHeads * kHeadSize;
+  constexpr int kStride = 5;
+  constexpr int kThreadNum = 4;
+  auto x = MakeData(kBatch * kSeq * kHidden, 7, 0.3f, -0.9f);
+  auto weight = MakeData(kHidden * kHidden, 17, 0.1f, -0.8f);
+  auto bias = MakeData(kHidden, 5, 0.5f, -1.0f);
+  FlashAttentionParameter param = InitParam(kBatch, kHeads, kHeadSize, kSeq, kSeq, kStride, false);
+  std::vector<float> split(kBatch * kHeads * kStride * kHeadSize);
+  std::vector<float> plain(kBatch * kSeq * kHidden);
+  for (int task_id = 0; task_id < kThreadNum; ++task_id) {
+    ASSERT_EQ(FlashAttentionProjectFp32(x.data(), weight.data(), bias.data(), split.data(), &param, kSeq, kStride,
+                                        true, task_id, kThreadNum),
+              NNACL_OK);
+    ASSERT_EQ(FlashAttentionProjectFp32(x.data(), weight.data(), bias.data(), plain.data(), &param, kSeq, kSeq, false,
+                                        task_id, kThreadNum),
+              NNACL_OK);
+  }
+  for (int b = 0; b < kBatch; ++b) {
+    auto expect = ReferenceProject(x.data() + b * kSeq * kHidden, weight.data(), bias.data(), kSeq, kHidden);
+    ASSERT_EQ(0, CompareOutputData(plain.data() + b * kSeq * kHidden, expect.data(), kSeq * kHidden, 1e-5));
+    for (int i = 0; i < kSeq; ++i) {
+      for (int c = 0; c < kHidden; ++c) {
+        auto index = ((b * kHeads + c / kHeadSize) * kStride + i) * kHeadSize + c % kHeadSize;
+        ASSERT_NEAR(split[index], expect[i * kHidden + c], 1e-5);
+      }
+    }
+  }
+}
+
+/// Feature: the Attention kernel with a kv-cache.
+/// Description: run the registered kernel with kv_cache_size on a prompt of 5 rows, then resize it to one row and run
+/// two decoding steps, then start a new kv_cache_sequence and feed its prompt in chunks of 2 and 3 rows.
+/// Expectation: every step matches the causal attention of the whole sequence so far, the new sequence does not see
+/// the cached rows of the previous one, and its second chunk sees the first.
+TEST_F(TestFlashAttentionFp32, AttentionKernelKVCache) {
+  constexpr int kHeads = 2;
+  constexpr int kHeadSize = 4;
+  constexpr int kHidden = kHeads * kHeadSize;
+  constexpr int kPrompt = 5;
+  constexpr int kSteps = 2;
+  constexpr int kSeq = kPrompt + kSteps;
+  auto x = MakeData(kSeq * kHidden, 13, 0.15f, -0.9f);
+  auto weight_qkv = MakeData(3 * kHidden * kHidden, 19, 0.05f, -0.45f);
+  auto weight_o = MakeData(kHidden * kHidden, 7, 0.1f, -0.3f);
+  auto bias_qkv = MakeData(3 * kHidden, 5, 0.1f, -0.2f);
+  auto bias_o = MakeData(kHidden, 3, 0.2f, -0.2f);
+  auto expect = ReferenceAttentionOp(x, x, weight_qkv.data(), weight_qkv.data() + kHidden * kHidden,
+                                     weight_qkv.data() + 2 * kHidden * kHidden, weight_o, bias_qkv, bias_o, nullptr,
+                                     kSeq, kSeq, kHeads, kHeadSize, true);
+
+  auto prompt = std::vector<float>(x.begin(), x.begin() + kPrompt * kHidden);
+  auto input = CreateTensor<float>(kNumberTypeFloat32, {1, kPrompt, kHidden}, prompt);
+  std::vector<lite::Tensor *> inputs = {
+    input,
+    input,
+    input,
+    CreateTensor<float>(kNumberTypeFloat32, {3 * kHidden, kHidden}, weight_qkv, NHWC, lite::Category::CONST_TENSOR),
+    CreateTensor<float>(kNumberTypeFloat32, {kHidden, kHidden}, weight_o, NHWC, lite::Category::CONST_TENSOR),
+    CreateTensor<float>(kNumberTypeFloat32, {3 * kHidden}, bias_qkv, NHWC, lite::Category::CONST_TENSOR),
+    CreateTensor<float>(kNumberTypeFloat32, {kHidden}, bias_o, NHWC, lite::Category::CONST_TENSOR)};
+  auto output = CreateTensor<float>(kNumberTypeFloat32, {1, kPrompt, kHidden}, {});
+  std::vector<lite::Tensor *> outputs = {output};
+
+  auto param = static_cast<FlashAttentionParameter *>(malloc(sizeof(FlashAttentionParameter)));
+  memset(param, 0, sizeof(FlashAttentionParameter));
+  param->head_num_ = kHeads;
+  param->causal_ = true;
+  auto ctx = std::make_shared<lite::InnerContext>();
+  ctx->thread_num_ = 2;
+  ASSERT_EQ(ctx->Init(), lite::RET_OK);
+  param->op_parameter_.thread_num_ = ctx->thread_num_;
+  kernel::KernelKey desc = {kernel::KERNEL_ARCH::kCPU, kNumberTypeFloat32, NHWC, schema::PrimitiveType_Attention};
+  auto creator = lite::KernelRegistry::GetInstance()->GetCreator(desc);
+  ASSERT_NE(creator, nullptr);
+  auto *kernel = creator(inputs, outputs, reinterpret_cast<OpParameter *>(param), ctx.get(), desc);
+  ASSERT_NE(kernel, nullptr);
+  std::map<std::string, std::map<std::string, std::string>> config = {
+    {lite::kAttention, {{lite::kKVCacheSize, "8"}, {lite::kKVCacheSequence, "0"}}}};
+  kernel->SetConfig(&config);
+  ASSERT_EQ(kernel->Prepare(), lite::RET_OK);
+  ASSERT_EQ(kernel->Run(), lite::RET_OK);
+  ASSERT_EQ(0, CompareOutputData(static_cast<float *>(output->data()), expect.data(), kPrompt * kHidden, 1e-4));
+
+  // every decoding step only feeds its own row
+  input->FreeData();
+  output->FreeData();
+  input->set_shape({1, 1, kHidden});
+  output->set_shape({1, 1, kHidden});
+  ASSERT_EQ(input->MallocData(), lite::RET_OK);
+  ASSERT_EQ(output->MallocData(), lite::RET_OK);
+  ASSERT_EQ(kernel->ReSize(), lite::RET_OK);
+  for (int step = kPrompt; step < kSeq; ++step) {
+    memcpy(input->data(), x.data() + step * kHidden, kHidden * sizeof(float));
+    ASSERT_EQ(kernel->Run(), lite::RET_OK);
+    ASSERT_EQ(0, CompareOutputData(static_cast<float *>(output->data()), expect.data() + step * kHidden, kHidden,
+                                   1e-4));
+  }
+
+  // a new sequence is started explicitly, and its prompt is fed in two chunks
+  config[lite::kAttention][lite::kKVCacheSequence] = "1";
+  int chunk_start = 0;
+  for (int chunk : {C2NUM, C3NUM}) {
+    input->FreeData();
+    output->FreeData();
+    input->set_shape({1, chunk, kHidden});
+    output->set_shape({1, chunk, kHidden});
+    ASSERT_EQ(input->MallocData(), lite::RET_OK);
+    ASSERT_EQ(output->MallocData(), lite::RET_OK);
+    ASSERT_EQ(kernel->ReSize(), lite::RET_OK);
+    memcpy(input->data(), x.data() + chunk_start * kHidden, chunk * kHidden * sizeof(float));
+    ASSERT_EQ(kernel->Run(), lite::RET_OK);
+    ASSERT_EQ(0, CompareOutputData(static_cast<float *>(output->data()), expect.data() + chunk_start * kHidden,
+                                   chunk * kHidden, 1e-4));
+    chunk_start += chunk;
+  }
+  delete kernel;
+  inputs.erase(inputs.begin() + 1, inputs.begin() + 3);
+  DestroyTensors(inputs);
+  DestroyTensors(outputs);
+}
+
+/// Feature: the cross-attention form of the Attention kernel.
+/// Description: 3 rows of q attend to 5 rows of k and v through a mask, with a weight of q and a concatenated weight
+/// of k and v as the converter fuses them, 2 heads of size 12 so that the column tiles of the packed weights cross the
+/// heads, over 2 tasks.
+/// Expectation: the output matches the reference projections and masked attention.
+TEST_F(TestFlashAttentionFp32, AttentionKernelCross) {
+  constexpr int kHeads = 2;
+  constexpr int kHeadSize = 12;
+  constexpr int kHidden = kHeads * kHeadSize;
+  constexpr int kQSeq = 3;
+  constexpr int kKVSeq = 5;
+  auto x_q = MakeData(kQSeq * kHidden, 13, 0.15f, -0.9f);
+  auto x_kv = MakeData(kKVSeq * kHidden, 11, 0.1f, -0.5f);
+  auto weight_q = MakeData(kHidden * kHidden, 19, 0.05f, -0.45f);
+  auto weight_kv = MakeData(2 * kHidden * kHidden, 23, 0.04f, -0.4f);
+  auto weight_o = MakeData(kHidden * kHidden, 7, 0.1f, -0.3f);
+  auto bias_qkv = MakeData(3 * kHidden, 5, 0.1f, -0.2f);
+  auto bias_o = MakeData(kHidden, 3, 0.2f, -0.2f);
+  std::vector<float> mask(kQSeq * kKVSeq);
+  for (int i = 0; i < kQSeq * kKVSeq; ++i) {
+    mask[i] = i % 4 == 3 ? -10000.0f : 0.0f;
+  }
+  auto expect = ReferenceAttentionOp(x_q, x_kv, weight_q.data(), weight_kv.data(), weight_kv.data() + kHidden * kHidden,
+                                     weight_o, bias_qkv, bias_o, mask.data(), kQSeq, kKVSeq, kHeads, kHeadSize, false);
+
+  auto input_kv = CreateTensor<float>(kNumberTypeFloat32, {1, kKVSeq, kHidden}, x_kv);
+  std::vector<lite::Tensor *> inputs = {
+    CreateTensor<float>(kNumberTypeFloat32, {1, kQSeq, kHidden}, x_q),
+    input_kv,
+    input_kv,
+    CreateTensor<float>(kNumberTypeFloat32, {kHidden, kHidden}, weight_q, NHWC, lite::Category::CONST_TENSOR),
+    CreateTensor<float>(kNumberTypeFloat32, {2 * kHidden, kHidden}, weight_kv, NHWC, lite::Category::CONST_TENSOR),
+    CreateTensor<float>(kNumberTypeFloat32, {kHidden, kHidden}, weight_o, NHWC, lite::Category::CONST_TENSOR),
+    CreateTensor<float>(kNumberTypeFloat32, {3 * kHidden}, bias_qkv, NHWC, lite::Category::CONST_TENSOR),
+    CreateTensor<float>(kNumberTypeFloat32, {kHidden}, bias_o, NHWC, lite::Category::CONST_TENSOR),
+    CreateTensor<float>(kNumberTypeFloat32, {1, kQSeq, kKVSeq}, mask)};
+  auto output = CreateTensor<float>(kNumberTypeFloat32, {1, kQSeq, kHidden}, {});
+  std::vector<lite::Tensor *> outputs = {output};
+
+  auto param = static_cast<FlashAttentionParameter *>(malloc(sizeof(FlashAttentionParameter)));
+  memset(param, 0, sizeof(FlashAttentionParameter));
+  param->head_num_ = kHeads;
+  auto ctx = std::make_shared<lite::InnerContext>();
+  ctx->thread_num_ = 2;
+  ASSERT_EQ(ctx->Init(), lite::RET_OK);
+  param->op_parameter_.thread_num_ = ctx->thread_num_;
+  kernel::KernelKey desc = {kernel::KERNEL_ARCH::kCPU, kNumberTypeFloat32, NHWC, schema::PrimitiveType_Attention};
+  auto creator = lite::KernelRegistry::GetInstance()->GetCreator(desc);
+  ASSERT_NE(creator, nullptr);
+  auto *kernel = creator(inputs, outputs, reinterpret_cast<OpParameter *>(param), ctx.get(), desc);
+  ASSERT_NE(kernel, nullptr);
+  ASSERT_EQ(kernel->Prepare(), lite::RET_OK);
+  ASSERT_EQ(kernel->Run(), lite::RET_OK);
+  ASSERT_EQ(0, CompareOutputData(static_cast<float *>(output->data()), expect.data(), kQSeq * kHidden, 1e-4));
+  delete kernel;
+  inputs.erase(inputs.begin() + C2NUM);
+  DestroyTensors(inputs);
+  DestroyTensors(outputs);
+}
+}  // namespace mindspore
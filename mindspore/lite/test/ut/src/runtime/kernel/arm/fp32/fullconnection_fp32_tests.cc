@@ -14,10 +14,16 @@
  * limitations under the License.
  */
 #include <sys/time.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
+#include <map>
 #include <memory>
+#include <string>
 #include "common/common_test.h"
 #include "nnacl/fp32/matmul_fp32.h"
+#include "nnacl/fp32/matmul_bf16_fp32.h"
 #include "src/common/file_utils.h"
 #include "src/litert/tensor_category.h"
 #include "src/common/log_adapter.h"
@@ -272,4 +278,125 @@ TEST_F(TestFcFp32, FcTest4_Vec2Batch) {
   DestroyTensors(inputs);
   DestroyTensors(outputs);
 }
+
+TEST_F(TestFcFp32, FcTest5_Bf16Weight) {
+  // bf16_weight is only used up to 4 rows, more rows keep the fp32 weights.
+  constexpr int kBf16MaxRow = 4;
+  constexpr int kCol = 11;
+  constexpr int kDeep = 20;
+  constexpr int kNanCol = 3;
+  // the weights are not representable in bf16, one of them is nan
+  std::vector<float> weight(kCol * kDeep);
+  for (size_t i = 0; i < weight.size(); ++i) {
+    weight[i] = 0.1f * static_cast<float>(i % 13) - 0.55f;
+  }
+  weight[kNanCol * kDeep + C5NUM] = std::numeric_limits<float>::quiet_NaN();
+  std::vector<float> bias = {1, -1, 2, -2, 3, -3, 4, -4, 5, -5, 6};
+  for (int row : {kBf16MaxRow - 1, kBf16MaxRow, kBf16MaxRow + 1}) {
+    std::vector<lite::Tensor *> inputs;
+    std::vector<float> in(row * kDeep);
+    for (size_t i = 0; i < in.size(); ++i) {
+      in[i] = static_cast<float>(i % 7) - 3;
+    }
+    inputs.push_back(CreateTensor<float>(kNumberTypeFloat32, {row, kDeep}, in));
+    inputs.push_back(
+      CreateTensor<float>(kNumberTypeFloat32, {kCol, kDeep}, weight, mindspore::NHWC, lite::Category::CONST_TENSOR));
+    inputs.push_back(
+      CreateTensor<float>(kNumberTypeFloat32, {kCol}, bias, mindspore::NHWC, lite::Category::CONST_TENSOR));
+
+    std::vector<lite::Tensor *> outputs;
+    outputs.push_back(CreateTensor<float>(kNumberTypeFloat32, {row, kCol}, {}));
+
+    auto param = static_cast<MatMulParameter *>(malloc(sizeof(MatMulParameter)));
+    memset(param, 0, sizeof(MatMulParameter));
+    param->a_transpose_ = false;
+    param->b_transpose_ = true;
+    param->has_bias_ = true;
+    param->act_type_ = ActType_No;
+
+    auto ctx = std::make_shared<lite::InnerContext>();
+    ctx->thread_num_ = 2;
+    ASSERT_EQ(ctx->Init(), RET_OK);
+    param->op_parameter_.thread_num_ = ctx->thread_num_;
+
+    kernel::KernelKey desc = {kernel::KERNEL_ARCH::kCPU, kNumberTypeFloat32, NHWC,
+                              schema::PrimitiveType_FullConnection};
+    auto creator = lite::KernelRegistry::GetInstance()->GetCreator(desc);
+    ASSERT_NE(creator, nullptr);
+    auto *kernel = creator(inputs, outputs, reinterpret_cast<OpParameter *>(param), ctx.get(), desc);
+    ASSERT_NE(kernel, nullptr);
+    std::map<std::string, std::map<std::string, std::string>> config = {
+      {lite::kWeight, {{lite::kBf16Weight, "true"}}}};
+    kernel->SetConfig(&config);
+    ASSERT_EQ(kernel->Prepare(), RET_OK);
+    ASSERT_EQ(kernel->Run(), RET_OK);
+
+    // up to 4 rows the result is the product with the weights rounded to bf16, which differs from the fp32 one.
+    bool use_bf16 = row <= kBf16MaxRow;
+    auto out = static_cast<float *>(outputs[0]->data());
+    float max_fp32_diff = 0.0f;
+    for (int r = 0; r < row; ++r) {
+      for (int c = 0; c < kCol; ++c) {
+        float bf16_sum = bias[c];
+        float fp32_sum = bias[c];
+        for (int d = 0; d < kDeep; ++d) {
+          bf16_sum += in[r * kDeep + d] * Bf16ToFloat32Scalar(Float32ToBf16Scalar(weight[c * kDeep + d]));
+          fp32_sum += in[r * kDeep + d] * weight[c * kDeep + d];
+        }
+        auto value = out[r * kCol + c];
+        if (c == kNanCol) {
+          ASSERT_TRUE(std::isnan(value));
+          continue;
+        }
+        ASSERT_NEAR(value, use_bf16 ? bf16_sum : fp32_sum, 1e-4);
+        max_fp32_diff = std::max(max_fp32_diff, std::fabs(value - fp32_sum));
+      }
+    }
+    if (use_bf16) {
+      ASSERT_GT(max_fp32_diff, 1e-3);
+    }
+    delete kernel;
+    DestroyTensors(inputs);
+    DestroyTensors(outputs);
+  }
+}
+
+TEST_F(TestFcFp32, FcTest6_Bf16Rounding) {
+  // round to nearest even, the overflow rounds to inf, nan stays nan without turning into inf, and a denormal is
+  // flushed to a zero of the same sign like vcvtneps2bf16 does, whichever path converts it.
+  const std::vector<uint32_t> src_bits = {
+    0x3F808000,  // 1 + 2^-8, a tie rounds down to the even 1
+    0x3F818000,  // 1 + 3 * 2^-8, a tie rounds up to the even 1 + 2^-6
+    0x3F808001,  // above the tie
+    0x3F817FFF,  // below the tie
+    0xBFC00000,  // -1.5, exact
+    0x7F7FFFFF,  // FLT_MAX rounds to inf
+    0x7F800000,  // inf
+    0xFF800000,  // -inf
+    0x7FC00000,  // quiet nan
+    0x7F800001,  // signaling nan, rounding would give inf
+    0x7FFFFFFF,  // nan, rounding would give -0
+    0x80000000,  // -0
+    0x00000001,  // the smallest denormal
+    0x007FFFFF,  // the largest denormal, rounding would give the smallest normal
+    0x80400000,  // a negative denormal, exact in bf16
+  };
+  const std::vector<uint16_t> expect = {0x3F80, 0x3F82, 0x3F81, 0x3F81, 0xBFC0, 0x7F80, 0x7F80,
+                                        0xFF80, 0x7FC0, 0x7FC0, 0x7FFF, 0x8000, 0x0000, 0x0000, 0x8000};
+  std::vector<float> src(src_bits.size());
+  memcpy(src.data(), src_bits.data(), src_bits.size() * sizeof(float));
+  std::vector<uint16_t> dst(src.size());
+  Float32ToBf16(src.data(), dst.data(), static_cast<int>(src.size()));
+  for (size_t i = 0; i < src.size(); ++i) {
+    ASSERT_EQ(dst[i], expect[i]);
+    ASSERT_EQ(Float32ToBf16Scalar(src[i]), expect[i]);
+  }
+  std::vector<float> back(dst.size());
+  Bf16ToFloat32(dst.data(), back.data(), static_cast<int>(dst.size()));
+  for (size_t i = 0; i < dst.size(); ++i) {
+    uint32_t bits;
+    memcpy(&bits, &back[i], sizeof(bits));
+    ASSERT_EQ(bits, static_cast<uint32_t>(expect[i]) << 16);
+  }
+}
 }  // namespace mindspore
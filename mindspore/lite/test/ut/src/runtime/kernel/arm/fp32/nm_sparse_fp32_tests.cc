@@ -0,0 +1,93 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <vector>
+#include "common/common_test.h"
+#include "nnacl/fp32/nm_sparse_fp32.h"
+
+namespace mindspore {
+class TestNMSparseFp32 : public mindspore::CommonTest {
+ public:
+  TestNMSparseFp32() {}
+};
+
+namespace {
+// weight [col, deep], or [deep, col] when not transposed, every group of m along deep keeps n values at positions
+// moving with the column, the last group is partial when m does not divide deep.
+std::vector<float> NMSparseWeight(int deep, int col, int n, int m, bool transposed) {
+  std::vector<float> weight(deep * col, 0.0f);
+  for (int c = 0; c < col; ++c) {
+    for (int d = 0; d < deep; ++d) {
+      if ((d + c) % m < n) {
+        weight[transposed ? c * deep + d : d * col + c] = static_cast<float>((c + d) % 5) * 0.5f - 0.75f;
+      }
+    }
+  }
+  return weight;
+}
+}  // namespace
+
+/// Feature: N:M sparse weight
+/// Description: check 2:4 and 4:8 weights, a group over n, an all-zero weight, in both layouts
+/// Expectation: only the weights with at most n non-zeros in every group and some non-zero are N:M sparse
+TEST_F(TestNMSparseFp32, IsNMSparseWeight) {
+  constexpr int kDeep = 22;
+  constexpr int kCol = 5;
+  for (bool transposed : {true, false}) {
+    auto weight = NMSparseWeight(kDeep, kCol, C2NUM, C4NUM, transposed);
+    EXPECT_TRUE(IsNMSparseWeight(weight.data(), kDeep, kCol, C2NUM, C4NUM, transposed));
+    EXPECT_TRUE(IsNMSparseWeight(weight.data(), kDeep, kCol, C4NUM, C8NUM, transposed));
+    EXPECT_FALSE(IsNMSparseWeight(weight.data(), kDeep, kCol, 1, C4NUM, transposed));
+    // three non-zeros in the last full group of the last column.
+    for (int d = kDeep - C6NUM; d < kDeep - C3NUM; ++d) {
+      weight[transposed ? (kCol - 1) * kDeep + d : d * kCol + kCol - 1] = 1.0f;
+    }
+    EXPECT_FALSE(IsNMSparseWeight(weight.data(), kDeep, kCol, C2NUM, C4NUM, transposed));
+  }
+  std::vector<float> zeros(kDeep * kCol, 0.0f);
+  EXPECT_FALSE(IsNMSparseWeight(zeros.data(), kDeep, kCol, C2NUM, C4NUM, true));
+  EXPECT_FALSE(IsNMSparseWeight(nullptr, kDeep, kCol, C2NUM, C4NUM, true));
+}
+
+/// Feature: N:M sparse weight
+/// Description: pack a dense column, which is pruned, and a column with a partial last group
+/// Expectation: every group keeps its n largest magnitudes in order, the earlier wins a tie, padding is 0 at offset 0
+TEST_F(TestNMSparseFp32, PackNMSparseWeight) {
+  constexpr int kDeep = 6;
+  constexpr int kCol = 2;
+  // [col, deep]
+  std::vector<float> weight = {1.0f, -4.0f, 3.0f, 2.0f, 5.0f, 5.0f, 0.0f, 0.0f, 0.0f, 7.0f, 0.0f, 0.0f};
+  int kept = NMSparseKeptNum(kDeep, C2NUM, C4NUM);
+  ASSERT_EQ(kept, C4NUM);
+  std::vector<float> values(kept * kCol);
+  std::vector<uint8_t> indexes(kept * kCol);
+  PackNMSparseWeight(weight.data(), values.data(), indexes.data(), kDeep, kCol, C2NUM, C4NUM, true);
+  std::vector<float> expect_values = {-4.0f, 3.0f, 5.0f, 5.0f, 0.0f, 7.0f, 0.0f, 0.0f};
+  std::vector<uint8_t> expect_indexes = {1, 2, 0, 1, 0, 3, 0, 1};
+  EXPECT_EQ(values, expect_values);
+  EXPECT_EQ(indexes, expect_indexes);
+
+  // the same weight in [deep, col] packs the same.
+  std::vector<float> weight_t(kDeep * kCol);
+  for (int c = 0; c < kCol; ++c) {
+    for (int d = 0; d < kDeep; ++d) {
+      weight_t[d * kCol + c] = weight[c * kDeep + d];
+    }
+  }
+  PackNMSparseWeight(weight_t.data(), values.data(), indexes.data(), kDeep, kCol, C2NUM, C4NUM, false);
+  EXPECT_EQ(values, expect_values);
+  EXPECT_EQ(indexes, expect_indexes);
+}
+}  // namespace mindspore
@@ -21,6 +21,8 @@
 #include <memory>
 #include <string>
 #include <functional>
+#include <map>
+#include <vector>
 
 #include "schema/inner/model_generated.h"
 #include "common/common_test.h"
@@ -32,6 +34,8 @@
 #include "src/common/file_utils.h"
 #include "src/litert/kernel_registry.h"
 #include "src/litert/kernel/cpu/fp32_grad/convolution.h"
+#include "src/common/common.h"
+#include "src/train/static_allocator.h"
 
 using mindspore::lite::RET_OK;
 namespace mindspore {
@@ -178,4 +182,76 @@ TEST_F(NetworkTest, setname) {
   delete session;
 }
 
+
+lite::TrainSession *CreateRecomputeSession(const std::string &net, const lite::Context &context,
+                                           const std::map<std::string, std::map<std::string, std::string>> *config) {
+  auto session = std::make_unique<lite::TrainSession>();
+  session->SetConfigInfo(config);
+  auto inner_context = new (std::nothrow) lite::InnerContext(&context);
+  inner_context->allocator = std::make_shared<StaticAllocator>();
+  if (session->TrainInit(inner_context, nullptr) != RET_OK) {
+    return nullptr;
+  }
+  auto model = std::shared_ptr<lite::Model>(lite::Model::Import(net.c_str()));
+  if (model == nullptr || session->CompileTrainGraph(model) != RET_OK || session->Train() != RET_OK) {
+    return nullptr;
+  }
+  return session.release();
+}
+
+/// Feature: recompute of forward activations in the train session
+/// Description: build the train session with the [recompute] config section, run some steps
+/// Expectation: kernels are recomputed and the losses match the session keeping its activations
+TEST_F(NetworkTest, auto_recompute) {
+  std::string net = "./nets/conv_train_model.ms";
+  lite::Context context;
+  context.device_list_[0].device_info_.cpu_device_info_.cpu_bind_mode_ = lite::NO_BIND;
+  context.thread_num_ = 1;
+  std::map<std::string, std::map<std::string, std::string>> configs[2];
+  configs[1][lite::kRecompute][lite::kAutoRecompute] = "true";
+  std::vector<float> losses[2];
+  for (int recompute = 0; recompute < 2; recompute++) {
+    auto session = CreateRecomputeSession(net, context, &configs[recompute]);
+    ASSERT_NE(session, nullptr);
+    if (recompute == 1) {
+      EXPECT_GT(session->GetRecomputeKernelNum(), 0);
+    } else {
+      EXPECT_EQ(session->GetRecomputeKernelNum(), 0);
+    }
+    for (auto input : session->GetInputs()) {
+      auto data = input->MutableData();
+      ASSERT_NE(data, nullptr);
+      memset(data, 0, input->Size());
+      if (input->data_type() == kNumberTypeFloat32) {
+        for (int i = 0; i < input->ElementsNum(); i++) {
+          static_cast<float *>(data)[i] = static_cast<float>(i % 7) * 0.1f;
+        }
+      }
+    }
+    for (int step = 0; step < 2; step++) {
+      ASSERT_EQ(session->RunGraph(), RET_OK);
+      auto outputs = session->GetOutputs();
+      ASSERT_FALSE(outputs.empty());
+      losses[recompute].push_back(static_cast<float *>(outputs.begin()->second->MutableData())[0]);
+    }
+    delete session;
+  }
+  ASSERT_EQ(losses[0].size(), losses[1].size());
+  for (size_t i = 0; i < losses[0].size(); i++) {
+    EXPECT_NEAR(losses[0][i], losses[1][i], 1e-5);
+  }
+}
+
+/// Feature: recompute of forward activations in the train session
+/// Description: name a node missing from the network in the [recompute] config section
+/// Expectation: compiling the train graph fails
+TEST_F(NetworkTest, recompute_unknown_node) {
+  lite::Context context;
+  context.device_list_[0].device_info_.cpu_device_info_.cpu_bind_mode_ = lite::NO_BIND;
+  context.thread_num_ = 1;
+  std::map<std::string, std::map<std::string, std::string>> config;
+  config[lite::kRecompute][lite::kRecomputeNodes] = "no_such_node";
+  auto session = CreateRecomputeSession("./nets/conv_train_model.ms", context, &config);
+  EXPECT_EQ(session, nullptr);
+}
 }  // namespace mindspore
@@ -21,6 +21,9 @@
 #include "nnacl/int8/quantize.h"
 #include "nnacl/common_func.h"
 #include "nnacl/int8/matmul_int8.h"
+#include "nnacl/int8/fixed_point.h"
+#include "nnacl/intrinsics/ms_simd_cpu_info.h"
+#include "nnacl/errorcode.h"
 #include "mindspore/lite/src/litert/kernel_registry.h"
 #include "mindspore/lite/src/litert/kernel_exec.h"
 
@@ -260,4 +263,126 @@ TEST_F(TestMatmulInt8, mmtest2) {
   delete[] out;
 }
 
+#ifdef ENABLE_AVX
+using MatMulInt8_8x8_rFunc = void (*)(const int8_t *, const int8_t *, int8_t *, size_t, size_t, size_t, size_t,
+                                      const int32_t *, const int32_t *, const int32_t *, const int32_t *,
+                                      const int32_t *, int32_t, int32_t, int32_t, size_t);
+using MatmulInt8OptFunc = void (*)(const int8_t *, const int8_t *, int8_t *, int, int, int, const int32_t *,
+                                   const int32_t *, int, int, int, const int32_t *, const int32_t *, const int32_t *,
+                                   size_t, size_t, const int32_t *);
+
+namespace {
+void FillInt8(std::vector<int8_t> *data, int step, int offset) {
+  for (size_t i = 0; i < data->size(); i++) {
+    (*data)[i] = static_cast<int8_t>((i * step + offset) % 256);
+  }
+}
+
+// the row-major a (row x deep) times the transposed b (col x deep), requantized
+int8_t MatMulInt8Ref(const std::vector<int8_t> &a, const std::vector<int8_t> &b, int r, int c, int deep,
+                     int32_t value, int32_t multiplier, int32_t left_shift, int32_t right_shift, int32_t out_zp) {
+  for (int d = 0; d < deep; d++) {
+    value += a[r * deep + d] * b[c * deep + d];
+  }
+  value = MultiplyByQuantizedMultiplier(value, multiplier, left_shift, right_shift) + out_zp;
+  return static_cast<int8_t>(MSMAX(INT8_MIN, MSMIN(INT8_MAX, value)));
+}
+
+void CheckMatMulInt8_8x8_r(MatMulInt8_8x8_rFunc func) {
+  const int row = 11;
+  const int col = 13;
+  const int deep = 37;
+  const int deep_4 = UP_ROUND(deep, C4NUM);
+  std::vector<int8_t> a(row * deep);
+  std::vector<int8_t> b(col * deep);
+  FillInt8(&a, 37, 11);
+  FillInt8(&b, 101, 7);
+  std::vector<int8_t> pack_a(UP_ROUND(row, C8NUM) * deep_4, 0);
+  std::vector<int8_t> pack_b(UP_ROUND(col, C8NUM) * deep_4, 0);
+  RowMajor2Row8x4MajorInt8(a.data(), pack_a.data(), row, deep);
+  RowMajor2Row8x4MajorInt8(b.data(), pack_b.data(), col, deep);
+  std::vector<int32_t> input_sum(row);
+  for (int r = 0; r < row; r++) {
+    input_sum[r] = r * 50 - 200;
+  }
+  std::vector<int32_t> bias(col, 100);
+  int32_t left_shift = 0;
+  int32_t right_shift = -10;
+  int32_t multiplier = 1518500250;
+  const int32_t out_zp = 3;
+
+  std::vector<int8_t> out(row * col);
+  func(pack_a.data(), pack_b.data(), out.data(), row, col, deep_4, col, input_sum.data(), bias.data(), &left_shift,
+       &right_shift, &multiplier, out_zp, INT8_MIN, INT8_MAX, false);
+  for (int r = 0; r < row; r++) {
+    for (int c = 0; c < col; c++) {
+      auto expect =
+        MatMulInt8Ref(a, b, r, c, deep, bias[c] - input_sum[r], multiplier, left_shift, right_shift, out_zp);
+      ASSERT_EQ(out[r * col + c], expect);
+    }
+  }
+}
+
+void CheckMatmulInt8Opt(MatmulInt8OptFunc func) {
+  const int row = 7;
+  const int col = 19;
+  const int deep = 45;
+  const int deep_16 = UP_ROUND(deep, C16NUM);
+  std::vector<int8_t> a(row * deep);
+  std::vector<int8_t> b(col * deep);
+  FillInt8(&a, 53, 5);
+  FillInt8(&b, 89, 13);
+  std::vector<int8_t> pack_a(UP_ROUND(row, C4NUM) * deep_16, 0);
+  std::vector<int8_t> pack_b(UP_ROUND(col, C4NUM) * deep_16, 0);
+  RowMajor2Row16x4MajorInt8(a.data(), pack_a.data(), row, deep);
+  RowMajor2Row16x4MajorInt8(b.data(), pack_b.data(), col, deep);
+  // per channel weights: a_sums is the input row sum, scaled by the zero point of every column
+  std::vector<int32_t> a_sums(row, 0);
+  for (int r = 0; r < row; r++) {
+    for (int d = 0; d < deep; d++) {
+      a_sums[r] += a[r * deep + d];
+    }
+  }
+  std::vector<int32_t> filter_zp(col);
+  std::vector<int32_t> bias(col);
+  std::vector<int32_t> multiplier(col);
+  std::vector<int32_t> left_shift(col, 0);
+  std::vector<int32_t> right_shift(col);
+  for (int c = 0; c < col; c++) {
+    filter_zp[c] = c % 5 - 2;
+    bias[c] = c * 30 - 250;
+    multiplier[c] = 1518500250 - c * 10000000;
+    right_shift[c] = -9 - c % 3;
+  }
+  const int32_t out_zp = -4;
+
+  std::vector<int8_t> out(row * col);
+  func(pack_a.data(), pack_b.data(), out.data(), row, col, deep_16, a_sums.data(), bias.data(), INT8_MIN, INT8_MAX,
+       out_zp, multiplier.data(), left_shift.data(), right_shift.data(), col, true, filter_zp.data());
+  for (int r = 0; r < row; r++) {
+    for (int c = 0; c < col; c++) {
+      auto expect = MatMulInt8Ref(a, b, r, c, deep, bias[c] - a_sums[r] * filter_zp[c], multiplier[c], left_shift[c],
+                                  right_shift[c], out_zp);
+      ASSERT_EQ(out[r * col + c], expect);
+    }
+  }
+}
+}  // namespace
+
+TEST_F(TestMatmulInt8, MatMulInt8_8x8_r_AVX2) { CheckMatMulInt8_8x8_r(MatMulInt8_8x8_r_AVX2); }
+
+TEST_F(TestMatmulInt8, MatmulInt8Opt_AVX2) { CheckMatmulInt8Opt(MatmulInt8Opt_AVX2); }
+
+#ifdef ENABLE_AVX512
+TEST_F(TestMatmulInt8, MatMulInt8_AVX512VNNI) {
+  if (IntelX86CpuInfoInit() != NNACL_OK || !X86_Avx512Vnni_Support()) {
+    MS_LOG(WARNING) << "avx512 vnni is not supported, skip the test.";
+    return;
+  }
+  CheckMatMulInt8_8x8_r(MatMulInt8_8x8_r_AVX512VNNI);
+  CheckMatmulInt8Opt(MatmulInt8Opt_AVX512VNNI);
+}
+#endif
+#endif
+
 }  // namespace mindspore
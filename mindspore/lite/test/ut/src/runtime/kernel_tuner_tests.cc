@@ -0,0 +1,221 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "include/errorcode.h"
+#include "nnacl/conv_parameter.h"
+#include "src/litert/kernel_registry.h"
+#include "src/litert/kernel_tuner.h"
+#include "src/litert/tensor_category.h"
+
+namespace mindspore {
+namespace {
+constexpr int kHeight = 6;
+constexpr int kWidth = 5;
+constexpr int kInChannel = 4;
+constexpr int kOutChannel = 5;
+constexpr int kKernelSize = 3;
+constexpr int kThreadNum = 2;
+}  // namespace
+
+class KernelTunerTest : public mindspore::CommonTest {
+ public:
+  KernelTunerTest() = default;
+  // the tuner is a singleton, a test must not leak its tuning file into the next one.
+  void TearDown() override { lite::KernelTuner::GetInstance()->Reset(); }
+
+  // Runs a 3x3 convolution with padding 1, which has the im2col and the winograd candidates, and checks its output.
+  void RunConv3x3(const std::string &name) {
+    std::vector<float> in(kHeight * kWidth * kInChannel);
+    for (size_t i = 0; i < in.size(); ++i) {
+      in[i] = static_cast<float>(i % 7) * 0.25f - 0.75f;
+    }
+    std::vector<float> weight(kOutChannel * kKernelSize * kKernelSize * kInChannel);
+    for (size_t i = 0; i < weight.size(); ++i) {
+      weight[i] = static_cast<float>(i % 13) * 0.1f - 0.6f;
+    }
+    std::vector<float> bias = {0.5, -0.5, 1, -1, 1.5};
+    std::vector<lite::Tensor *> inputs = {
+      CreateTensor<float>(kNumberTypeFloat32, {1, kHeight, kWidth, kInChannel}, in),
+      CreateTensor<float>(kNumberTypeFloat32, {kOutChannel, kKernelSize, kKernelSize, kInChannel}, weight,
+                          mindspore::NHWC, lite::Category::CONST_TENSOR),
+      CreateTensor<float>(kNumberTypeFloat32, {kOutChannel}, bias, mindspore::NHWC, lite::Category::CONST_TENSOR)};
+    std::vector<lite::Tensor *> outputs = {
+      CreateTensor<float>(kNumberTypeFloat32, {1, kHeight, kWidth, kOutChannel}, {})};
+
+    auto conv_param = static_cast<ConvParameter *>(malloc(sizeof(ConvParameter)));
+    ASSERT_NE(conv_param, nullptr);
+    memset(conv_param, 0, sizeof(ConvParameter));
+    conv_param->kernel_h_ = kKernelSize;
+    conv_param->kernel_w_ = kKernelSize;
+    conv_param->stride_h_ = 1;
+    conv_param->stride_w_ = 1;
+    conv_param->dilation_h_ = 1;
+    conv_param->dilation_w_ = 1;
+    conv_param->pad_u_ = 1;
+    conv_param->pad_d_ = 1;
+    conv_param->pad_l_ = 1;
+    conv_param->pad_r_ = 1;
+    conv_param->group_ = 1;
+    conv_param->input_channel_ = kInChannel;
+    conv_param->output_channel_ = kOutChannel;
+    conv_param->act_type_ = ActType_No;
+    auto ctx = std::make_shared<lite::InnerContext>();
+    ctx->thread_num_ = kThreadNum;
+    ASSERT_EQ(ctx->Init(), lite::RET_OK);
+    conv_param->op_parameter_.thread_num_ = ctx->thread_num_;
+
+    kernel::KernelKey desc = {kernel::KERNEL_ARCH::kCPU, kNumberTypeFloat32, NHWC, schema::PrimitiveType_Conv2DFusion};
+    auto creator = lite::KernelRegistry::GetInstance()->GetCreator(desc);
+    ASSERT_NE(creator, nullptr);
+    auto *kernel = creator(inputs, outputs, reinterpret_cast<OpParameter *>(conv_param), ctx.get(), desc);
+    ASSERT_NE(kernel, nullptr);
+    kernel->set_name(name);
+    // the output is not allocated yet, the tuning runs on scratch data.
+    ASSERT_EQ(kernel->Prepare(), lite::RET_OK);
+    ASSERT_EQ(outputs[0]->MallocData(), lite::RET_OK);
+    ASSERT_EQ(kernel->Run(), lite::RET_OK);
+
+    auto out = static_cast<float *>(outputs[0]->data());
+    for (int h = 0; h < kHeight; ++h) {
+      for (int w = 0; w < kWidth; ++w) {
+        for (int oc = 0; oc < kOutChannel; ++oc) {
+          float expect = bias[oc];
+          for (int kh = 0; kh < kKernelSize; ++kh) {
+            for (int kw = 0; kw < kKernelSize; ++kw) {
+              int ih = h + kh - 1;
+              int iw = w + kw - 1;
+              if (ih < 0 || ih >= kHeight || iw < 0 || iw >= kWidth) {
+                continue;
+              }
+              for (int ic = 0; ic < kInChannel; ++ic) {
+                expect += in[(ih * kWidth + iw) * kInChannel + ic] *
+                          weight[((oc * kKernelSize + kh) * kKernelSize + kw) * kInChannel + ic];
+              }
+            }
+          }
+          ASSERT_NEAR(out[(h * kWidth + w) * kOutChannel + oc], expect, 1e-4);
+        }
+      }
+    }
+    delete kernel;
+    DestroyTensors(inputs);
+    DestroyTensors(outputs);
+  }
+
+  std::string Conv3x3Key(const std::string &name) const {
+    return lite::KernelTuner::GetInstance()->host_identity() + "|" + name + "|1x" + std::to_string(kHeight) + "x" +
+           std::to_string(kWidth) + "x" + std::to_string(kInChannel) + "|" + std::to_string(kOutChannel) +
+           "|k3x3|s1x1|d1x1|p1,1,1,1|t" + std::to_string(kThreadNum);
+  }
+};
+
+TEST_F(KernelTunerTest, RecordAndSave) {
+  const std::string tuning_file = "./kernel_tuning.txt";
+  const std::string layer_key = "conv 1|1x56x56x64|64|k3x3|s1x1|d1x1|p1,1,1,1|t2";
+  {
+    std::ofstream ofs(tuning_file, std::ios::out | std::ios::trunc);
+    ASSERT_TRUE(ofs.is_open());
+    ofs << "0 0 conv0|1x56x56x64|64|k1x1|s1x1|d1x1|p0,0,0,0|t2\n";
+  }
+  auto tuner = lite::KernelTuner::GetInstance();
+  ASSERT_EQ(lite::RET_OK, tuner->Init(tuning_file, true, 1));
+  ASSERT_TRUE(tuner->enabled());
+  ASSERT_TRUE(tuner->tune());
+
+  lite::TunedAlgorithm algorithm;
+  ASSERT_TRUE(tuner->GetAlgorithm("conv0|1x56x56x64|64|k1x1|s1x1|d1x1|p0,0,0,0|t2", &algorithm));
+  ASSERT_EQ(algorithm.algorithm, 0);
+  ASSERT_FALSE(tuner->GetAlgorithm(layer_key, &algorithm));
+  constexpr int winograd = 2;
+  constexpr int out_unit = 4;
+  tuner->Record(layer_key, {winograd, out_unit});
+  ASSERT_TRUE(tuner->GetAlgorithm(layer_key, &algorithm));
+  ASSERT_EQ(algorithm.algorithm, winograd);
+  ASSERT_EQ(algorithm.tile, out_unit);
+
+  ASSERT_EQ(lite::RET_OK, tuner->SaveIfUpdated());
+  std::ifstream ifs(tuning_file);
+  ASSERT_TRUE(ifs.is_open());
+  int line_num = 0;
+  bool found = false;
+  std::string line;
+  while (std::getline(ifs, line)) {
+    ++line_num;
+    // the layer key keeps its spaces, it is the rest of the line.
+    found = found || line == "2 4 " + layer_key;
+  }
+  ASSERT_EQ(line_num, 2);
+  ASSERT_TRUE(found);
+  ifs.close();
+  (void)std::remove(tuning_file.c_str());
+}
+
+/// Feature: kernel tuning of the fp32 convolution
+/// Description: select the algorithm of a 3x3 convolution by timing, from the tuning file, then from a tuning file of
+///              another cpu with tuning on, and with an algorithm this build lacks
+/// Expectation: the winner is recorded under the key of this host, the layer of another host is tuned again next to
+///              it, and every selected kernel computes the convolution
+TEST_F(KernelTunerTest, TunedKernelSelect) {
+  const std::string tuning_file = "./kernel_tuning_conv.txt";
+  const std::string name = "conv_tuned";
+  (void)std::remove(tuning_file.c_str());
+  auto tuner = lite::KernelTuner::GetInstance();
+  ASSERT_EQ(lite::RET_OK, tuner->Init(tuning_file, true, 1));
+  ASSERT_FALSE(tuner->host_identity().empty());
+  RunConv3x3(name);
+  lite::TunedAlgorithm tuned;
+  ASSERT_TRUE(tuner->GetAlgorithm(Conv3x3Key(name), &tuned));
+  ASSERT_EQ(lite::RET_OK, tuner->SaveIfUpdated());
+
+  // the tuned algorithm is taken from the file without timing.
+  tuner->Reset();
+  ASSERT_EQ(lite::RET_OK, tuner->Init(tuning_file, false, 0));
+  lite::TunedAlgorithm loaded;
+  ASSERT_TRUE(tuner->GetAlgorithm(Conv3x3Key(name), &loaded));
+  ASSERT_EQ(loaded, tuned);
+  RunConv3x3(name);
+  ASSERT_EQ(lite::RET_OK, tuner->SaveIfUpdated());
+
+  // a file tuned on another cpu does not match the layer, which is tuned again and kept next to the other cpu's.
+  auto key = Conv3x3Key(name);
+  auto other_key = "other_cpu" + key.substr(tuner->host_identity().size());
+  tuner->Reset();
+  {
+    std::ofstream ofs(tuning_file, std::ios::out | std::ios::trunc);
+    ASSERT_TRUE(ofs.is_open());
+    ofs << "2 4 " << other_key << "\n";
+  }
+  ASSERT_EQ(lite::RET_OK, tuner->Init(tuning_file, true, 1));
+  ASSERT_FALSE(tuner->GetAlgorithm(key, &loaded));
+  RunConv3x3(name);
+  ASSERT_TRUE(tuner->GetAlgorithm(key, &loaded));
+  lite::TunedAlgorithm other;
+  ASSERT_TRUE(tuner->GetAlgorithm(other_key, &other));
+  ASSERT_EQ(other, (lite::TunedAlgorithm{2, 4}));
+  ASSERT_EQ(lite::RET_OK, tuner->SaveIfUpdated());
+
+  // an algorithm this build lacks falls back to the heuristics.
+  constexpr int unknown_algorithm = 99;
+  tuner->Record(key, {unknown_algorithm, 0});
+  RunConv3x3(name);
+  (void)std::remove(tuning_file.c_str());
+}
+}  // namespace mindspore
@@ -0,0 +1,91 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#include "src/litert/runtime_allocator.h"
+
+namespace mindspore {
+class RuntimeAllocatorTest : public mindspore::CommonTest {
+ public:
+  RuntimeAllocatorTest() = default;
+};
+
+namespace {
+bool Overlap(size_t lhs_offset, size_t lhs_size, size_t rhs_offset, size_t rhs_size) {
+  return lhs_offset < rhs_offset + rhs_size && rhs_offset < lhs_offset + lhs_size;
+}
+}  // namespace
+
+TEST_F(RuntimeAllocatorTest, PlanLargestFirst) {
+  // t0: 4KB, t1: 1KB, t2: 4KB, t3: 2KB, float32
+  lite::Tensor t0(kNumberTypeFloat32, {1024});
+  lite::Tensor t1(kNumberTypeFloat32, {256});
+  lite::Tensor t2(kNumberTypeFloat32, {1024});
+  lite::Tensor t3(kNumberTypeFloat32, {512});
+  RuntimeAllocator allocator;
+
+  /* step 1: t0 = op(in) */
+  allocator.NextStep();
+  allocator.MallocTensorData(&t0);
+  /* step 2: t1 = op(t0) */
+  allocator.NextStep();
+  allocator.MallocTensorData(&t1);
+  allocator.FreeTensorData(&t0);
+  /* step 3: t2 = op(t1) */
+  allocator.NextStep();
+  allocator.MallocTensorData(&t2);
+  allocator.FreeTensorData(&t1);
+  /* step 4: t3 = op(t2), t3 is the graph output */
+  allocator.NextStep();
+  allocator.MallocTensorData(&t3);
+  allocator.FreeTensorData(&t2);
+  allocator.Plan();
+
+  // t0 and t2 never live at the same time, they share the offset, a first fit plan needs 4KB + 1KB + 4KB
+  auto offset_map = allocator.GetOffsetMap();
+  ASSERT_EQ(offset_map.at(&t0), offset_map.at(&t2));
+  ASSERT_FALSE(Overlap(offset_map.at(&t0), t0.Size(), offset_map.at(&t1), t1.Size()));
+  ASSERT_FALSE(Overlap(offset_map.at(&t2), t2.Size(), offset_map.at(&t3), t3.Size()));
+  ASSERT_EQ(allocator.LivePeak(), t2.Size() + t3.Size());
+  ASSERT_EQ(allocator.total_size(), t2.Size() + t3.Size());
+  ASSERT_NE(allocator.MallocOptData(), nullptr);
+}
+
+TEST_F(RuntimeAllocatorTest, ShareTensorData) {
+  lite::Tensor t0(kNumberTypeFloat32, {1024});
+  lite::Tensor t1(kNumberTypeFloat32, {1024});
+  lite::Tensor t2(kNumberTypeFloat32, {1024});
+  RuntimeAllocator allocator;
+
+  allocator.NextStep();
+  allocator.MallocTensorData(&t0);
+  /* t1 = relu(t0) in place */
+  allocator.NextStep();
+  allocator.ShareTensorData(&t1, &t0);
+  /* t2 = op(t1) */
+  allocator.NextStep();
+  allocator.MallocTensorData(&t2);
+  allocator.FreeTensorData(&t1);
+  allocator.Plan();
+
+  auto offset_map = allocator.GetOffsetMap();
+  ASSERT_EQ(allocator.GetBufferId(&t0), allocator.GetBufferId(&t1));
+  ASSERT_EQ(offset_map.at(&t0), offset_map.at(&t1));
+  ASSERT_FALSE(Overlap(offset_map.at(&t1), t1.Size(), offset_map.at(&t2), t2.Size()));
+  ASSERT_EQ(allocator.total_size(), t1.Size() + t2.Size());
+}
+}  // namespace mindspore
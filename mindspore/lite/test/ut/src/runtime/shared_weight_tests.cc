@@ -0,0 +1,195 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "include/errorcode.h"
+#include "src/litert/pack_weight_manager.h"
+
+namespace mindspore {
+class SharedWeightTest : public mindspore::CommonTest {
+ public:
+  SharedWeightTest() = default;
+};
+
+namespace {
+constexpr int kElementNum = 256;
+constexpr size_t kPackSize = kElementNum * sizeof(float);
+const lite::PackFormat kPackFormat = {schema::PrimitiveType_MatMulFusion, "matmul_b", {1, 16, 16, 0}};
+
+// a const tensor of the weight of a model, with its own copy of the data
+lite::Tensor *CreateWeight(float value) {
+  auto tensor = new lite::Tensor(kNumberTypeFloat32, {kElementNum}, NHWC, lite::CONST_TENSOR);
+  auto data = static_cast<float *>(tensor->MutableData());
+  for (int i = 0; i < kElementNum; ++i) {
+    data[i] = value + i;
+  }
+  return tensor;
+}
+}  // namespace
+
+TEST_F(SharedWeightTest, ShareIdenticalWeights) {
+  auto manager = lite::PackWeightManager::GetInstance();
+  auto weight0 = CreateWeight(1.0f);
+  auto weight1 = CreateWeight(1.0f);
+  auto weight2 = CreateWeight(2.0f);
+  ASSERT_EQ(manager->ShareTensorData(weight0), lite::RET_OK);
+  ASSERT_EQ(manager->ShareTensorData(weight1), lite::RET_OK);
+  ASSERT_EQ(manager->ShareTensorData(weight2), lite::RET_OK);
+  ASSERT_EQ(weight0->data(), weight1->data());
+  ASSERT_NE(weight0->data(), weight2->data());
+
+  // the packed data of the same weights are shared too
+  bool is_packed = true;
+  auto packed0 = manager->GetPackData(weight0->data(), kPackSize, &is_packed, kPackFormat);
+  ASSERT_NE(packed0, nullptr);
+  ASSERT_FALSE(is_packed);
+  manager->PackDone(packed0);
+  auto packed1 = manager->GetPackData(weight1->data(), kPackSize, &is_packed, kPackFormat);
+  ASSERT_EQ(packed0, packed1);
+  ASSERT_TRUE(is_packed);
+
+  // the copy lives until the last tensor of it is freed
+  delete weight0;
+  auto data = static_cast<float *>(weight1->data());
+  ASSERT_EQ(data[kElementNum - 1], 1.0f + kElementNum - 1);
+  delete weight1;
+  delete weight2;
+  manager->Free(packed0);
+  manager->Free(packed1);
+}
+
+TEST_F(SharedWeightTest, PackFormats) {
+  auto manager = lite::PackWeightManager::GetInstance();
+  auto weight = CreateWeight(3.0f);
+  ASSERT_EQ(manager->ShareTensorData(weight), lite::RET_OK);
+  bool is_packed = true;
+  auto packed = manager->GetPackData(weight->data(), kPackSize, &is_packed, kPackFormat);
+  ASSERT_FALSE(is_packed);
+  manager->PackDone(packed);
+
+  // the same size in another kernel type, layout or shape is another pack
+  std::vector<lite::PackFormat> formats = {
+    {schema::PrimitiveType_FullConnection, kPackFormat.layout, kPackFormat.dims},
+    {kPackFormat.kernel_type, "matmul_b_bf16", kPackFormat.dims},
+    {kPackFormat.kernel_type, kPackFormat.layout, {1, 16, 16, 1}},
+    {kPackFormat.kernel_type, kPackFormat.layout, {1, 32, 8, 0}},
+  };
+  for (auto &format : formats) {
+    auto other = manager->GetPackData(weight->data(), kPackSize, &is_packed, format);
+    ASSERT_NE(other, nullptr);
+    ASSERT_NE(other, packed);
+    ASSERT_FALSE(is_packed);
+    manager->PackDone(other);
+    manager->Free(other);
+  }
+  // a pack without a format is never shared
+  auto private_pack = manager->GetPackData(weight->data(), kPackSize, &is_packed);
+  ASSERT_NE(private_pack, nullptr);
+  ASSERT_NE(private_pack, packed);
+  ASSERT_FALSE(is_packed);
+  manager->Free(private_pack);
+  manager->Free(packed);
+  delete weight;
+}
+
+TEST_F(SharedWeightTest, WaitForPacking) {
+  auto manager = lite::PackWeightManager::GetInstance();
+  auto weight0 = CreateWeight(4.0f);
+  auto weight1 = CreateWeight(4.0f);
+  ASSERT_EQ(manager->ShareTensorData(weight0), lite::RET_OK);
+  ASSERT_EQ(manager->ShareTensorData(weight1), lite::RET_OK);
+  bool is_packed = true;
+  auto packed0 = static_cast<float *>(manager->GetPackData(weight0->data(), kPackSize, &is_packed, kPackFormat));
+  ASSERT_NE(packed0, nullptr);
+  ASSERT_FALSE(is_packed);
+
+  // another session finds the pack before it is written and waits for it
+  std::atomic_bool got_pack = {false};
+  bool other_is_packed = false;
+  float first_value = 0.0f;
+  void *packed1 = nullptr;
+  std::thread other([&]() {
+    packed1 = manager->GetPackData(weight1->data(), kPackSize, &other_is_packed, kPackFormat);
+    first_value = static_cast<float *>(packed1)[0];
+    got_pack = true;
+  });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  ASSERT_FALSE(got_pack);
+  for (int i = 0; i < kElementNum; ++i) {
+    packed0[i] = -1.0f;
+  }
+  manager->PackDone(packed0);
+  other.join();
+  ASSERT_TRUE(got_pack);
+  ASSERT_TRUE(other_is_packed);
+  ASSERT_EQ(packed1, packed0);
+  ASSERT_EQ(first_value, -1.0f);
+  manager->Free(packed1);
+  manager->Free(packed0);
+  delete weight0;
+  delete weight1;
+}
+
+TEST_F(SharedWeightTest, TakeOverPacking) {
+  auto manager = lite::PackWeightManager::GetInstance();
+  auto weight0 = CreateWeight(5.0f);
+  auto weight1 = CreateWeight(5.0f);
+  ASSERT_EQ(manager->ShareTensorData(weight0), lite::RET_OK);
+  ASSERT_EQ(manager->ShareTensorData(weight1), lite::RET_OK);
+  bool is_packed = true;
+  auto packed0 = manager->GetPackData(weight0->data(), kPackSize, &is_packed, kPackFormat);
+  ASSERT_FALSE(is_packed);
+
+  // the packer fails before it writes the pack, the waiting session packs it instead
+  bool other_is_packed = true;
+  void *packed1 = nullptr;
+  std::thread other(
+    [&]() { packed1 = manager->GetPackData(weight1->data(), kPackSize, &other_is_packed, kPackFormat); });
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  manager->Free(packed0);
+  other.join();
+  ASSERT_EQ(packed1, packed0);
+  ASSERT_FALSE(other_is_packed);
+  manager->PackDone(packed1);
+  // the next one gets the packed data at once
+  auto packed2 = manager->GetPackData(weight0->data(), kPackSize, &is_packed, kPackFormat);
+  ASSERT_EQ(packed2, packed1);
+  ASSERT_TRUE(is_packed);
+  manager->Free(packed2);
+  manager->Free(packed1);
+  delete weight0;
+  delete weight1;
+}
+
+TEST_F(SharedWeightTest, RefCount) {
+  auto manager = lite::PackWeightManager::GetInstance();
+  auto weight = CreateWeight(6.0f);
+  ASSERT_EQ(manager->ShareTensorData(weight), lite::RET_OK);
+  auto allocator = weight->allocator();
+  ASSERT_NE(allocator, nullptr);
+  ASSERT_EQ(allocator->RefCount(weight->data()), 1);
+  ASSERT_EQ(allocator->SetRefCount(weight->data(), 3), 3);
+  ASSERT_EQ(allocator->RefCount(weight->data()), 3);
+  ASSERT_EQ(allocator->DecRefCount(weight->data(), 2), 1);
+  int not_shared = 0;
+  ASSERT_EQ(allocator->SetRefCount(&not_shared, 1), -1);
+  delete weight;
+}
+}  // namespace mindspore
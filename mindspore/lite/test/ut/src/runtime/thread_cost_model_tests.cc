@@ -0,0 +1,131 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include "common/common_test.h"
+#include "include/errorcode.h"
+#include "src/litert/inner_context.h"
+#include "src/litert/thread_cost_model.h"
+
+namespace mindspore {
+class ThreadCostModelTest : public mindspore::CommonTest {
+ public:
+  ThreadCostModelTest() = default;
+  // the calibrator is a process wide singleton, the other tests must not see the costs of this one
+  void TearDown() override {
+    lite::ThreadCostCalibrator::GetInstance()->Reset();
+    CommonTest::TearDown();
+  }
+};
+
+TEST_F(ThreadCostModelTest, CalibrateAndSave) {
+  const std::string cache_file = "./thread_cost_calibration.txt";
+  (void)std::remove(cache_file.c_str());
+  lite::InnerContext ctx;
+  ctx.thread_num_ = 2;
+  ASSERT_EQ(lite::RET_OK, ctx.Init());
+  constexpr int warmup_num = 2;
+  auto calibrator = lite::ThreadCostCalibrator::GetInstance();
+  ASSERT_EQ(lite::RET_OK, calibrator->Init(cache_file, warmup_num, &ctx));
+  ASSERT_TRUE(calibrator->enabled());
+
+  constexpr int64_t unit_num = 100000;
+  auto kernel_type = TC_PTYPE(schema::PrimitiveType_Cast);
+  lite::ThreadCostContext cost_context = {unit_num, 1, 1, 0.0f};
+  ASSERT_FALSE(calibrator->IsCalibrated(kernel_type, unit_num));
+  // the static table is used until the kernel is calibrated
+  ASSERT_EQ(lite::GetKernelComputeCost(kernel_type, unit_num), lite::GetKernelComputeCost(kernel_type));
+  calibrator->Record(kernel_type, &cost_context, 1, 2 * unit_num);
+  ASSERT_FALSE(calibrator->IsCalibrated(kernel_type, unit_num));
+  calibrator->Record(kernel_type, &cost_context, 1, unit_num);
+  ASSERT_TRUE(calibrator->IsCalibrated(kernel_type, unit_num));
+  // the sizes in the same power of two share the cost
+  ASSERT_TRUE(calibrator->IsCalibrated(kernel_type, unit_num + 1));
+  ASSERT_FALSE(calibrator->IsCalibrated(kernel_type, unit_num * 4));
+  float compute_cost = 0.0f;
+  ASSERT_TRUE(calibrator->GetComputeCost(kernel_type, unit_num, &compute_cost));
+  ASSERT_GE(compute_cost, 0.0f);
+
+  ASSERT_EQ(lite::RET_OK, calibrator->SaveIfUpdated());
+  std::ifstream ifs(cache_file);
+  ASSERT_TRUE(ifs.is_open());
+  std::string key;
+  std::string identity;
+  ifs >> key >> identity;
+  ASSERT_EQ(key, "identity");
+  ASSERT_EQ(identity, lite::HostIdentity() + ",2");
+  double startup_ns = 0.0;
+  ifs >> key >> startup_ns;
+  ASSERT_EQ(key, "startup_ns");
+  ASSERT_GT(startup_ns, 0.0);
+  double parallel_efficiency = 0.0;
+  ifs >> key >> parallel_efficiency;
+  ASSERT_EQ(key, "parallel_efficiency");
+  ASSERT_GT(parallel_efficiency, 0.0);
+  ASSERT_LE(parallel_efficiency, 1.0);
+  int32_t saved_type = 0;
+  ifs >> saved_type;
+  ASSERT_EQ(saved_type, kernel_type);
+  ifs.close();
+  (void)std::remove(cache_file.c_str());
+}
+
+TEST_F(ThreadCostModelTest, CacheOfAnotherSetup) {
+  const std::string cache_file = "./thread_cost_calibration_setup.txt";
+  (void)std::remove(cache_file.c_str());
+  lite::InnerContext ctx;
+  ctx.thread_num_ = 2;
+  ASSERT_EQ(lite::RET_OK, ctx.Init());
+  constexpr int warmup_num = 1;
+  constexpr int64_t unit_num = 100000;
+  auto kernel_type = TC_PTYPE(schema::PrimitiveType_Cast);
+  lite::ThreadCostContext cost_context = {unit_num, 1, 1, 0.0f};
+  auto calibrator = lite::ThreadCostCalibrator::GetInstance();
+  ASSERT_EQ(lite::RET_OK, calibrator->Init(cache_file, warmup_num, &ctx));
+  calibrator->Record(kernel_type, &cost_context, 1, unit_num);
+  ASSERT_TRUE(calibrator->IsCalibrated(kernel_type, unit_num));
+
+  // another thread num saves the costs and calibrates again
+  lite::InnerContext ctx4;
+  ctx4.thread_num_ = 4;
+  ASSERT_EQ(lite::RET_OK, ctx4.Init());
+  ASSERT_EQ(lite::RET_OK, calibrator->Init(cache_file, warmup_num, &ctx4));
+  ASSERT_FALSE(calibrator->IsCalibrated(kernel_type, unit_num));
+
+  // the same setup loads them back
+  calibrator->Reset();
+  ASSERT_EQ(lite::RET_OK, calibrator->Init(cache_file, warmup_num, &ctx));
+  ASSERT_TRUE(calibrator->IsCalibrated(kernel_type, unit_num));
+
+  // a cache of another host is ignored
+  std::ifstream ifs(cache_file);
+  ASSERT_TRUE(ifs.is_open());
+  std::string key;
+  std::string identity;
+  ifs >> key >> identity;
+  std::string rest((std::istreambuf_iterator<char>(ifs)), std::istreambuf_iterator<char>());
+  ifs.close();
+  std::ofstream ofs(cache_file, std::ios::out | std::ios::trunc);
+  ofs << key << " other_host" << identity << rest;
+  ofs.close();
+  calibrator->Reset();
+  ASSERT_EQ(lite::RET_OK, calibrator->Init(cache_file, warmup_num, &ctx));
+  ASSERT_FALSE(calibrator->IsCalibrated(kernel_type, unit_num));
+  (void)std::remove(cache_file.c_str());
+}
+}  // namespace mindspore
@@ -15,7 +15,10 @@
  */
 
 #include <cmath>
+#include <cstdio>
+#include <fstream>
 #include <memory>
+#include <string>
 #include "schema/inner/model_generated.h"
 #include "common/common_test.h"
 #include "include/context.h"
@@ -23,6 +26,7 @@
 #include "src/common/log_adapter.h"
 #include "mindspore/lite/src/litert/kernel_exec.h"
 #include "mindspore/lite/src/litert/kernel_exec_util.h"
+#include "src/common/file_utils.h"
 
 namespace mindspore {
 class UtilsTest : public mindspore::CommonTest {
@@ -64,4 +68,27 @@ TEST_F(UtilsTest, TestSubgraph) {
   auto output_tensors = kernel::KernelExecUtil::SubgraphOutputTensors(kernels);
   ASSERT_EQ(output_tensors.size(), 1);
 }
+
+TEST_F(UtilsTest, TestReadFileByMmap) {
+  const std::string file_path = "./utils_test_mmap.bin";
+  const std::string content = "mindspore lite mmap model buffer";
+  {
+    std::ofstream ofs(file_path, std::ios::out | std::ios::binary | std::ios::trunc);
+    ASSERT_TRUE(ofs.is_open());
+    ofs.write(content.data(), content.size());
+  }
+  size_t size = 0;
+  auto buf = lite::ReadFileByMmap(file_path, &size);
+  ASSERT_NE(buf, nullptr);
+  ASSERT_EQ(size, content.size());
+  ASSERT_EQ(std::string(buf, size), content);
+  // the mapping is private, writes do not reach the file
+  buf[0] = 'M';
+  lite::UnmapMmapBuffer(buf, size);
+  auto heap_buf = lite::ReadFile(file_path.c_str(), &size);
+  ASSERT_NE(heap_buf, nullptr);
+  ASSERT_EQ(std::string(heap_buf, size), content);
+  delete[] heap_buf;
+  (void)std::remove(file_path.c_str());
+}
 }  // namespace mindspore
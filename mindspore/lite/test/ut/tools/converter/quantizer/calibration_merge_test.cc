@@ -0,0 +1,175 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+#include "common/common_test.h"
+#include "include/errorcode.h"
+#include "ops/core_ops.h"
+#include "ops/fusion/mat_mul_fusion.h"
+#include "tools/converter/cxx_api/converter_para.h"
+#include "tools/converter/quantizer/data_distribution.h"
+#include "tools/converter/quantizer/weight_quantizer.h"
+
+namespace mindspore {
+namespace lite {
+namespace quant {
+namespace {
+constexpr int kBinNum = 2048;
+constexpr size_t kBatchNum = 7;
+constexpr size_t kCopyNum = 3;
+constexpr int kDataSize = 100;
+constexpr int kMatMulNum = 3;
+constexpr int64_t kWeightSize = 64;
+
+std::vector<float> ImageData(size_t image) {
+  std::vector<float> data(kDataSize);
+  for (int i = 0; i < kDataSize; ++i) {
+    data[i] = static_cast<float>((i * 37 + static_cast<int>(image) * 11) % 97) * 0.13f - 5.0f + image * 0.07f;
+  }
+  return data;
+}
+
+DataDistribution NewDistribution(ActivationQuantizedMethod method) {
+  static auto graph = std::make_shared<FuncGraph>();
+  auto cnode = graph->NewCNode(std::make_shared<Primitive>("Activation"), {});
+  cnode->set_fullname_with_scope("activation");
+  return DataDistribution(cnode, kBinNum, k8Bit, INT8_MAX, INT8_MIN, method, true);
+}
+
+FuncGraphPtr BuildMatMulGraph() {
+  auto graph = std::make_shared<FuncGraph>();
+  AnfNodePtr last = graph->add_parameter();
+  for (int i = 0; i < kMatMulNum; ++i) {
+    auto tensor = std::make_shared<tensor::Tensor>(kNumberTypeFloat32, ShapeVector{kWeightSize, kWeightSize});
+    auto data = static_cast<float *>(tensor->data_c());
+    for (int64_t j = 0; j < kWeightSize * kWeightSize; ++j) {
+      data[j] = static_cast<float>((j * (i + 3)) % 101) * 0.01f - 0.5f;
+    }
+    auto weight = graph->add_parameter();
+    weight->set_name("weight_" + std::to_string(i));
+    weight->set_default_param(tensor);
+    weight->set_abstract(tensor->ToAbstract());
+    auto cnode = graph->NewCNode(std::make_shared<ops::MatMulFusion>(), {last, weight});
+    cnode->set_fullname_with_scope("matmul_" + std::to_string(i));
+    last = cnode;
+  }
+  graph->set_output(last);
+  return graph;
+}
+
+std::vector<std::vector<uint8_t>> MixedBitWeightQuant(int thread_num) {
+  auto param = std::make_shared<ConverterPara>();
+  param->commonQuantParam.quant_type = schema::QuantType_QUANT_WEIGHT;
+  param->commonQuantParam.bit_num = 0;
+  param->commonQuantParam.min_quant_weight_size = 0;
+  param->commonQuantParam.min_quant_weight_channel = 0;
+  param->commonQuantParam.thread_num = thread_num;
+  auto graph = BuildMatMulGraph();
+  WeightQuantizer quantizer(param);
+  std::set<PrimitivePtr> support_types = {prim::kPrimMatMulFusion};
+  if (quantizer.WeightQuant(graph, support_types, {}, {}, false) != RET_OK) {
+    return {};
+  }
+  std::vector<std::vector<uint8_t>> weights;
+  for (auto &parameter : graph->parameters()) {
+    auto tensor = parameter->cast<ParameterPtr>()->default_param();
+    if (tensor == nullptr) {
+      continue;
+    }
+    auto tensor_info = tensor->cast<tensor::TensorPtr>();
+    auto data = static_cast<uint8_t *>(tensor_info->data_c());
+    weights.emplace_back(data, data + tensor_info->Size());
+  }
+  return weights;
+}
+}  // namespace
+
+class CalibrationMergeTest : public mindspore::CommonTest {
+ public:
+  CalibrationMergeTest() = default;
+};
+
+/// Feature: calibration on a session pool
+/// Description: record the images on copies, copy i takes the images i, i + 3, ..., and merge them
+/// Expectation: the real min/max and the quantile lists match a sequential run, in image order
+TEST_F(CalibrationMergeTest, MergeMaxMinValue) {
+  auto sequential = NewDistribution(REMOVAL_OUTLIER);
+  for (size_t image = 0; image < kBatchNum; ++image) {
+    ASSERT_EQ(sequential.RecordMaxMinValueArray(ImageData(image)), RET_OK);
+  }
+  auto merged = NewDistribution(REMOVAL_OUTLIER);
+  std::vector<DataDistribution> copies(kCopyNum, merged);
+  for (size_t image = 0; image < kBatchNum; ++image) {
+    ASSERT_EQ(copies[image % kCopyNum].RecordMaxMinValueArray(ImageData(image)), RET_OK);
+  }
+  std::vector<const DataDistribution *> copy_ptrs;
+  for (auto &copy : copies) {
+    copy_ptrs.push_back(&copy);
+  }
+  merged.MergeMaxMinValue(copy_ptrs, kBatchNum);
+  EXPECT_EQ(merged.GetRealMin(), sequential.GetRealMin());
+  EXPECT_EQ(merged.GetRealMax(), sequential.GetRealMax());
+  EXPECT_EQ(merged.GetMinDatas(), sequential.GetMinDatas());
+  EXPECT_EQ(merged.GetMaxDatas(), sequential.GetMaxDatas());
+  EXPECT_EQ(merged.GetScale(), sequential.GetScale());
+}
+
+/// Feature: calibration on a session pool
+/// Description: fill the histograms of copies sharing the interval of the MIN_MAX pass and merge them
+/// Expectation: the KL threshold and the scale match a sequential run, a histogram of another interval is rejected
+TEST_F(CalibrationMergeTest, MergeHistogram) {
+  auto sequential = NewDistribution(KL);
+  for (size_t image = 0; image < kBatchNum; ++image) {
+    ASSERT_EQ(sequential.RecordMaxMinValueArray(ImageData(image)), RET_OK);
+  }
+  sequential.UpdateInterval();
+  auto merged = sequential;
+  std::vector<DataDistribution> copies(kCopyNum, merged);
+  for (size_t image = 0; image < kBatchNum; ++image) {
+    ASSERT_EQ(sequential.UpdateHistogram(ImageData(image)), RET_OK);
+    ASSERT_EQ(copies[image % kCopyNum].UpdateHistogram(ImageData(image)), RET_OK);
+  }
+  for (auto &copy : copies) {
+    ASSERT_EQ(merged.MergeHistogram(copy), RET_OK);
+  }
+  ASSERT_EQ(sequential.ComputeThreshold(), RET_OK);
+  ASSERT_EQ(merged.ComputeThreshold(), RET_OK);
+  EXPECT_FLOAT_EQ(merged.GetScale(), sequential.GetScale());
+
+  auto other = NewDistribution(KL);
+  ASSERT_EQ(other.RecordMaxMinValueArray({1.0f, -1.0f}), RET_OK);
+  other.UpdateInterval();
+  EXPECT_NE(merged.MergeHistogram(other), RET_OK);
+}
+
+/// Feature: parallel scale search of mixed bit weight quantization
+/// Description: quantize the weights of a MatMul chain with the scales searched on 1 and on 4 threads
+/// Expectation: the quantized weights are the same
+TEST_F(CalibrationMergeTest, SearchMixedBitScales) {
+  auto sequential = MixedBitWeightQuant(1);
+  auto parallel = MixedBitWeightQuant(4);
+  ASSERT_EQ(sequential.size(), kMatMulNum);
+  ASSERT_EQ(parallel.size(), sequential.size());
+  for (size_t i = 0; i < sequential.size(); ++i) {
+    EXPECT_EQ(parallel[i], sequential[i]);
+  }
+}
+}  // namespace quant
+}  // namespace lite
+}  // namespace mindspore
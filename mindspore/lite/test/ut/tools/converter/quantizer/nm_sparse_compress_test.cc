@@ -0,0 +1,127 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <utility>
+#include <vector>
+#include "common/common_test.h"
+#include "include/errorcode.h"
+#include "nnacl/fp32/nm_sparse_fp32.h"
+#include "src/litert/weight_decoder.h"
+#include "src/tensor.h"
+#include "tools/converter/quantizer/tensor_compressor.h"
+
+namespace mindspore {
+namespace lite {
+namespace quant {
+namespace {
+constexpr int kLines = 6;
+constexpr int kDeep = 20;
+
+std::vector<float> DenseWeight(int sparse_n, int sparse_m, bool sparse) {
+  std::vector<float> weight(kLines * kDeep);
+  for (int i = 0; i < kLines * kDeep; ++i) {
+    auto in_group = i % kDeep % sparse_m;
+    auto keep = !sparse || (in_group + i / kDeep) % sparse_m < sparse_n;
+    weight[i] = keep ? static_cast<float>((i * 29) % 53) * 0.1f - 2.5f : 0.0f;
+    if (keep && weight[i] == 0.0f) {
+      weight[i] = 0.25f;
+    }
+  }
+  return weight;
+}
+
+ParameterPtr NewWeight(const std::vector<float> &data) {
+  static auto graph = std::make_shared<FuncGraph>();
+  auto tensor = std::make_shared<tensor::Tensor>(kNumberTypeFloat32, ShapeVector{kLines, kDeep});
+  (void)memcpy(tensor->data_c(), data.data(), data.size() * sizeof(float));
+  auto weight = graph->add_parameter();
+  weight->set_name("weight");
+  weight->set_default_param(tensor);
+  weight->set_abstract(tensor->ToAbstract());
+  return weight;
+}
+
+int Decode(const ParameterPtr &weight, std::vector<float> *decoded) {
+  auto tensor_info = weight->default_param()->cast<tensor::TensorPtr>();
+  if (tensor_info->compression_type() != kNMSparse) {
+    return RET_ERROR;
+  }
+  Tensor dst(kNumberTypeFloat32, {kLines, kDeep});
+  auto ret = WeightDecoder::NMSparseDecompress(static_cast<const uint8_t *>(tensor_info->data_c()),
+                                               tensor_info->Size(), &dst);
+  if (ret != RET_OK) {
+    return ret;
+  }
+  auto data = static_cast<float *>(dst.data());
+  decoded->assign(data, data + kLines * kDeep);
+  return RET_OK;
+}
+}  // namespace
+
+class NMSparseCompressTest : public mindspore::CommonTest {
+ public:
+  NMSparseCompressTest() = default;
+};
+
+/// Feature: N:M sparse weight storage
+/// Description: compress 2:4 and 4:8 sparse weights in the converter and densify them as the runtime does
+/// Expectation: the decoded weights are the original weights
+TEST_F(NMSparseCompressTest, RoundTrip) {
+  for (auto nm : std::vector<std::pair<int, int>>{{2, 4}, {4, 8}}) {
+    auto origin = DenseWeight(nm.first, nm.second, true);
+    auto weight = NewWeight(origin);
+    ASSERT_EQ(TensorCompressor().DoNMSparseCompress(weight, nm.first, nm.second, false), RET_OK);
+    std::vector<float> decoded;
+    ASSERT_EQ(Decode(weight, &decoded), RET_OK);
+    EXPECT_EQ(decoded, origin);
+  }
+}
+
+/// Feature: N:M sparse weight storage
+/// Description: compress a dense weight with and without pruning, and an all-zero weight
+/// Expectation: only pruning compresses the dense weight, keeping the n largest values of each group of m
+TEST_F(NMSparseCompressTest, Prune) {
+  auto origin = DenseWeight(C2NUM, C4NUM, false);
+  EXPECT_EQ(TensorCompressor().DoNMSparseCompress(NewWeight(origin), C2NUM, C4NUM, false), RET_NO_CHANGE);
+  EXPECT_EQ(TensorCompressor().DoNMSparseCompress(NewWeight(std::vector<float>(kLines * kDeep, 0.0f)), C2NUM,
+                                                  C4NUM, false),
+            RET_NO_CHANGE);
+
+  auto weight = NewWeight(origin);
+  ASSERT_EQ(TensorCompressor().DoNMSparseCompress(weight, C2NUM, C4NUM, true), RET_OK);
+  std::vector<float> decoded;
+  ASSERT_EQ(Decode(weight, &decoded), RET_OK);
+  EXPECT_TRUE(IsNMSparseWeight(decoded.data(), kDeep, kLines, C2NUM, C4NUM, true));
+  for (int i = 0; i < kLines * kDeep; i += C4NUM) {
+    for (int j = i; j < i + C4NUM; ++j) {
+      if (decoded[j] == 0.0f) {
+        continue;
+      }
+      EXPECT_EQ(decoded[j], origin[j]);
+      for (int k = i; k < i + C4NUM; ++k) {
+        if (decoded[k] == 0.0f) {
+          EXPECT_GE(fabsf(origin[j]), fabsf(origin[k]));
+        }
+      }
+    }
+  }
+}
+}  // namespace quant
+}  // namespace lite
+}  // namespace mindspore
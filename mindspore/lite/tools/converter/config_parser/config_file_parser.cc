@@ -27,6 +27,7 @@ constexpr auto kCommonQuantParam = "common_quant_param";
 constexpr auto kFullQuantParam = "full_quant_param";
 constexpr auto kMixedBitWeightQuantParam = "mixed_bit_weight_quant_param";
 constexpr auto kDataPreprocessParam = "data_preprocess_param";
+constexpr auto kSparsityParam = "sparsity_param";
 constexpr auto kRegistry = "registry";
 constexpr auto kAclOptionParam = "acl_option_cfg_param";
 constexpr auto kMicroParam = "micro_param";
@@ -75,6 +76,12 @@ int ConfigFileParser::ParseConfigParam(std::map<std::string, std::map<std::strin
     MS_LOG(ERROR) << "ParseFullQuantString failed.";
     return ret;
   }
+  ret = ParseSparsityParamString(*maps);
+  (void)maps->erase(kSparsityParam);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "ParseSparsityParamString failed.";
+    return ret;
+  }
   ret = ParseRegistryInfoString(*maps);
   (void)maps->erase(kRegistry);
   if (ret != RET_OK) {
@@ -145,6 +152,7 @@ int ConfigFileParser::ParseCommonQuantString(const std::map<std::string, std::ma
       {"min_quant_weight_channel", common_quant_string_.min_quant_weight_channel},
       {"skip_quant_node", common_quant_string_.skip_quant_node},
       {"debug_info_save_path", common_quant_string_.debug_info_save_path},
+      {"thread_num", common_quant_string_.thread_num},
     };
     return SetMapData(map, parse_map, kCommonQuantParam);
   }
@@ -179,6 +187,18 @@ int ConfigFileParser::ParseFullQuantString(const std::map<std::string, std::map<
   return RET_OK;
 }
 
+int ConfigFileParser::ParseSparsityParamString(const std::map<std::string, std::map<std::string, std::string>> &maps) {
+  if (maps.find(kSparsityParam) != maps.end()) {
+    const auto &map = maps.at(kSparsityParam);
+    std::map<std::string, std::string &> parse_map{
+      {"nm_sparsity", sparsity_param_string_.nm_sparsity},
+      {"prune", sparsity_param_string_.prune},
+    };
+    return SetMapData(map, parse_map, kSparsityParam);
+  }
+  return RET_OK;
+}
+
 int ConfigFileParser::ParseRegistryInfoString(const std::map<std::string, std::map<std::string, std::string>> &maps) {
   if (maps.find(kRegistry) != maps.end()) {
     const auto &map = maps.at(kRegistry);
@@ -43,6 +43,7 @@ struct CommonQuantString {
   std::string min_quant_weight_channel;
   std::string skip_quant_node;
   std::string debug_info_save_path;
+  std::string thread_num;
 };
 
 struct MixedBitWeightQuantString {
@@ -59,6 +60,11 @@ struct FullQuantString {
   std::string per_channel;
 };
 
+struct SparsityParamString {
+  std::string nm_sparsity;
+  std::string prune;
+};
+
 struct RegistryInfoString {
   std::string plugin_path;
   std::string disable_fusion;
@@ -97,6 +103,7 @@ class ConfigFileParser {
   CommonQuantString GetCommonQuantString() const { return this->common_quant_string_; }
   MixedBitWeightQuantString GetMixedBitWeightQuantString() const { return this->mixed_bit_quant_string_; }
   FullQuantString GetFullQuantString() const { return this->full_quant_string_; }
+  SparsityParamString GetSparsityParamString() const { return this->sparsity_param_string_; }
   RegistryInfoString GetRegistryInfoString() const { return this->registry_info_string_; }
   AclOptionCfgString GetAclOptionCfgString() { return this->acl_option_cfg_string_; }
   MicroParamString GetMicroParamString() { return this->micro_param_string_; }
@@ -106,6 +113,7 @@ class ConfigFileParser {
   int ParseCommonQuantString(const std::map<std::string, std::map<std::string, std::string>> &maps);
   int ParseMixedBitQuantString(const std::map<std::string, std::map<std::string, std::string>> &maps);
   int ParseFullQuantString(const std::map<std::string, std::map<std::string, std::string>> &maps);
+  int ParseSparsityParamString(const std::map<std::string, std::map<std::string, std::string>> &maps);
   int ParseRegistryInfoString(const std::map<std::string, std::map<std::string, std::string>> &maps);
   int ParseAclOptionCfgString(const std::map<std::string, std::map<std::string, std::string>> &maps);
   int SetMapData(const std::map<std::string, std::string> &input_map,
@@ -117,6 +125,7 @@ class ConfigFileParser {
   CommonQuantString common_quant_string_;
   MixedBitWeightQuantString mixed_bit_quant_string_;
   FullQuantString full_quant_string_;
+  SparsityParamString sparsity_param_string_;
   RegistryInfoString registry_info_string_;
   AclOptionCfgString acl_option_cfg_string_;
   MicroParamString micro_param_string_;
@@ -27,6 +27,12 @@ constexpr int kQuantBitNumInt16 = 16;
 constexpr int kQuantBitNumInt8 = 8;
 constexpr int kMinSize = 0;
 constexpr int kMaxSize = 65535;
+constexpr int kMinThreadNum = 1;
+constexpr int kMaxThreadNum = 64;
+constexpr int kSparseN2 = 2;
+constexpr int kSparseM4 = 4;
+constexpr int kSparseN4 = 4;
+constexpr int kSparseM8 = 8;
 }  // namespace
 int QuantParamParser::ParseFilter(const CommonQuantString &common_quant_string, quant::CommonQuantParam *common_quant) {
   MS_ASSERT(common_quant != nullptr);
@@ -107,6 +113,17 @@ int QuantParamParser::ParseCommonQuant(const CommonQuantString &common_quant_str
     return ret;
   }
 
+  if (!common_quant_string.thread_num.empty()) {
+    if (!ConvertIntNum(common_quant_string.thread_num, &common_quant->thread_num)) {
+      MS_LOG(ERROR) << "INPUT ILLEGAL: thread_num should be a valid number.";
+      return RET_INPUT_PARAM_INVALID;
+    }
+    if (common_quant->thread_num < kMinThreadNum || common_quant->thread_num > kMaxThreadNum) {
+      MS_LOG(ERROR) << "INPUT ILLEGAL: thread_num should be in the range [1,64].";
+      return RET_INPUT_PARAM_INVALID;
+    }
+  }
+
   common_quant->debug_info_save_path = common_quant_string.debug_info_save_path;
   if (!common_quant->debug_info_save_path.empty()) {
     common_quant->is_debug = true;
@@ -176,6 +193,33 @@ int QuantParamParser::ParseFullQuant(const FullQuantString &full_quant_string, q
   return RET_OK;
 }
 
+int QuantParamParser::ParseSparsity(const SparsityParamString &sparsity_string, quant::SparsityParam *sparsity) {
+  MS_ASSERT(sparsity != nullptr);
+  if (!sparsity_string.nm_sparsity.empty()) {
+    if (sparsity_string.nm_sparsity == "auto") {
+      sparsity->auto_detect = true;
+    } else if (sparsity_string.nm_sparsity == "2:4") {
+      sparsity->sparse_n = kSparseN2;
+      sparsity->sparse_m = kSparseM4;
+    } else if (sparsity_string.nm_sparsity == "4:8") {
+      sparsity->sparse_n = kSparseN4;
+      sparsity->sparse_m = kSparseM8;
+    } else {
+      MS_LOG(ERROR) << "INPUT ILLEGAL: nm_sparsity must be 2:4|4:8|auto.";
+      return RET_INPUT_PARAM_INVALID;
+    }
+  }
+  if (!sparsity_string.prune.empty() && !ConvertBool(sparsity_string.prune, &sparsity->prune)) {
+    MS_LOG(ERROR) << "INPUT ILLEGAL: prune should be true or false.";
+    return RET_INPUT_PARAM_INVALID;
+  }
+  if (sparsity->prune && sparsity->sparse_n == 0) {
+    MS_LOG(ERROR) << "INPUT ILLEGAL: prune needs nm_sparsity to be 2:4 or 4:8.";
+    return RET_INPUT_PARAM_INVALID;
+  }
+  return RET_OK;
+}
+
 int QuantParamParser::ParseQuantType(const std::string &quant_type_str, schema::QuantType *quant_type) {
   if (quant_type_str == "WEIGHT_QUANT") {
     (*quant_type) = schema::QuantType_QUANT_WEIGHT;
@@ -27,6 +27,7 @@ class QuantParamParser {
   static int ParseMixedBitWeightQuant(const MixedBitWeightQuantString &mixed_bit_weight_quant_string,
                                       quant::MixedBitWeightQuantParam *mixed_bit_weight_quant);
   static int ParseFullQuant(const FullQuantString &full_quant_string, quant::FullQuantParam *full_quant);
+  static int ParseSparsity(const SparsityParamString &sparsity_string, quant::SparsityParam *sparsity);
 
  private:
   static int ParseQuantType(const std::string &quant_type_str, schema::QuantType *quant_type);
@@ -377,6 +377,11 @@ int ConverterImpl::InitConfigParam(const std::shared_ptr<ConverterPara> &param)
     MS_LOG(ERROR) << "Parse mixed bit weight quant param failed.";
     return ret;
   }
+  ret = lite::QuantParamParser::ParseSparsity(config_parser.GetSparsityParamString(), &param->sparsityParam);
+  if (ret != RET_OK) {
+    MS_LOG(ERROR) << "Parse sparsity param failed.";
+    return ret;
+  }
   ret = InitExtendedIntegrationInfo(param, config_parser);
   if (ret != RET_OK) {
     MS_LOG(ERROR) << "Parse extended integration info failed.";
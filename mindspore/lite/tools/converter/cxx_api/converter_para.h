@@ -65,6 +65,7 @@ struct ConverterPara {
   lite::quant::CommonQuantParam commonQuantParam;
   lite::quant::MixedBitWeightQuantParam mixedBitWeightQuantParam;
   lite::quant::FullQuantParam fullQuantParam;
+  lite::quant::SparsityParam sparsityParam;
   lite::preprocess::DataPreProcessParam dataPreProcessParam;
   lite::acl::AclModelOptionCfg aclModelOptionCfgParam;
   lite::micro::MicroParam microParam;
@@ -13,6 +13,7 @@ set(WRAPPER_SRC
         ${WRAPPER_DIR}/fp32/scale_fp32_wrapper.c
         ${WRAPPER_DIR}/fp32/activation_fp32_wrapper.c
         ${WRAPPER_DIR}/fp32/conv_fp32_wrapper.c
+        ${WRAPPER_DIR}/fp32/conv_depthwise_fp32_wrapper.c
         ${WRAPPER_DIR}/fp32/conv_winograd_fp32_wrapper.c
         ${WRAPPER_DIR}/fp32/pooling_fp32_wrapper.c
         ${WRAPPER_DIR}/fp32/transpose_fp32_wrapper.c
@@ -78,15 +78,22 @@ int ConvolutionDepthwiseFP32Coder::DoCode(CoderContext *const context) {
             "activation_fp32.c",
           },
           {});
+  if (support_parallel_) {
+    Collect(context, {"wrapper/fp32/conv_depthwise_fp32_wrapper.h"}, {"conv_depthwise_fp32_wrapper.c"});
+  }
   nnacl::NNaclFp32Serializer code;
   // call the op function
   std::string param_name = "conv_parameter";
   code.CodeStruct(param_name, *conv_param_);
   if (support_parallel_) {
-    code << "    " << param_name << ".op_parameter_.thread_num_ = 1;\n";
-    code << "    " << param_name << ".thread_num_ = 1;\n";
+    // the output rows are split by conv_parameter.thread_num_, which is capped by the output height in Prepare.
+    code.CodeBaseStruct("ConvDwFp32Args", kRunArgs, output_tensor_, input_tensor_, packed_weight_, bias_,
+                        "&" + param_name);
+    code.CodeFunction(kParallelLaunch, "ConvDwFp32Run", kRunArgsAddr, param_name + ".thread_num_");
+  } else {
+    code.CodeFunction("ConvDw", output_tensor_, input_tensor_, packed_weight_, bias_, "&" + param_name,
+                      kDefaultTaskId);
   }
-  code.CodeFunction("ConvDw", output_tensor_, input_tensor_, packed_weight_, bias_, "&" + param_name, kDefaultTaskId);
   context->AppendCode(code.str());
   return RET_OK;
 }
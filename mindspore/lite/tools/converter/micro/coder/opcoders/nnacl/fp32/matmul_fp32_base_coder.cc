@@ -29,9 +29,6 @@ using mindspore::schema::PrimitiveType_MatMulFusion;
 
 namespace mindspore::lite::micro::nnacl {
 int MatMulFP32BaseCoder::ReSize() {
-  if (support_parallel_) {
-    thread_num_ = 1;
-  }
   ResizeParameter();
   MS_CHECK_TRUE(params_->col_align_ != 0, "params_->col_align_ = 0");
   thread_count_ = MSMIN(thread_num_, UP_DIV(params_->col_align_, col_tile_));
@@ -184,9 +181,6 @@ int MatMulFP32BaseCoder::DoCode(CoderContext *const context) {
   std::string param_name = "mat_mul_parameter";
 
   code.CodeStruct(param_name, *params_);
-  if (support_parallel_) {
-    code << "    " << param_name << ".op_parameter_.thread_num_ = 1;\n";
-  }
   init_code.CodeStruct("mat_mul_parameter", *params_);
   // do bias packing to init
   if (input_tensors_.size() == DIMENSION_3D) {
@@ -246,6 +240,16 @@ int MatMulFP32BaseCoder::DoCode(CoderContext *const context) {
     init_code.CodeFunction("InitMatrixA", a_src_str, a_pack_ptr_, "&mat_mul_parameter", vec_matmul_);
     code.CodeFunction("InitMatrixB", filter_tensor_, b_pack_ptr_, "&mat_mul_parameter", vec_matmul_);
   }
+  if (support_parallel_) {
+    // the packed a is shared by the tasks, every task computes its own output channels.
+    code.CodeBaseStruct("MatmulFp32Args", kRunArgs, a_pack_ptr_, b_pack_ptr_, bias_ptr_, output_tensor_,
+                        "&" + param_name, thread_stride_ * col_tile_, vec_matmul_);
+    code.CodeFunction(kParallelLaunch, "MatmulFp32Run", kRunArgsAddr, thread_count_);
+    context->AppendInitWeightSizeCode(w_buf_size);
+    context->AppendCode(code.str());
+    context->AppendInitCode(init_code.str());
+    return RET_OK;
+  }
   int current_stride_oc = thread_stride_ * col_tile_;
   int current_rest_oc = params_->col_ - kDefaultTaskId * thread_stride_ * col_tile_;
   int cur_oc = MSMIN(current_stride_oc, current_rest_oc);
@@ -0,0 +1,24 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "wrapper/fp32/conv_depthwise_fp32_wrapper.h"
+#include "nnacl/fp32/conv_depthwise_fp32.h"
+
+int ConvDwFp32Run(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+  ConvDwFp32Args *args = (ConvDwFp32Args *)cdata;
+  return ConvDw(args->output_data_, args->input_data_, args->weight_data_, args->bias_data_, args->conv_param_,
+                task_id);
+}
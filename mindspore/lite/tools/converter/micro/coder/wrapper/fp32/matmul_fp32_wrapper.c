@@ -16,6 +16,7 @@
 
 #include "wrapper/fp32/matmul_fp32_wrapper.h"
 #include "nnacl/fp32/pack_fp32.h"
+#include "nnacl/errorcode.h"
 void InitMatrixA(const float *src_ptr, float *dst_ptr, const MatMulParameter *params_, bool is_vector_a) {
   if (is_vector_a) {
     memcpy(dst_ptr, src_ptr, (size_t)(params_->batch * params_->deep_) * sizeof(float));
@@ -63,3 +64,27 @@ void InitMatrixB(const float *src_ptr, float *dst_ptr, const MatMulParameter *pa
 #endif
   }
 }
+
+int MatmulFp32Run(void *cdata, int task_id, float lhs_scale, float rhs_scale) {
+  const MatmulFp32Args *args = (const MatmulFp32Args *)cdata;
+  const MatMulParameter *param = args->param_;
+  int oc_start = task_id * args->oc_stride_;
+  int cur_oc = MSMIN(args->oc_stride_, param->col_ - oc_start);
+  if (cur_oc <= 0) {
+    return NNACL_OK;
+  }
+  const float *bias = args->bias_ == NULL ? NULL : args->bias_ + oc_start;
+  for (int i = 0; i < param->batch; ++i) {
+    float *c = args->c_ + i * param->row_ * param->col_ + oc_start;
+    if (args->is_vector_a_) {
+      const float *a = args->a_pack_ + i * param->deep_;
+      const float *b = args->b_pack_ + i * param->deep_ * param->col_ + oc_start * param->deep_;
+      MatVecMulFp32(a, b, c, bias, param->act_type_, param->deep_, cur_oc);
+    } else {
+      const float *a = args->a_pack_ + i * param->row_align_ * param->deep_;
+      const float *b = args->b_pack_ + i * param->deep_ * param->col_align_ + oc_start * param->deep_;
+      MatMulOpt(a, b, c, bias, param->act_type_, param->deep_, param->row_, cur_oc, param->col_, OutType_Nhwc);
+    }
+  }
+  return NNACL_OK;
+}
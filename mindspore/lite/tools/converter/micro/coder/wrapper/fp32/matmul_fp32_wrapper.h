@@ -26,6 +26,19 @@ void InitMatrixA(const float *src_ptr, float *dst_ptr, const MatMulParameter *pa
 
 void InitMatrixB(const float *src_ptr, float *dst_ptr, const MatMulParameter *params_, bool is_vector_a);
 
+typedef struct {
+  const float *a_pack_;
+  const float *b_pack_;
+  const float *bias_;
+  float *c_;
+  const MatMulParameter *param_;
+  int oc_stride_;
+  bool is_vector_a_;
+} MatmulFp32Args;
+
+// task task_id computes the output channels [task_id * oc_stride_, (task_id + 1) * oc_stride_) of every batch.
+int MatmulFp32Run(void *cdata, int task_id, float lhs_scale, float rhs_scale);
+
 #ifdef __cplusplus
 }
 #endif
@@ -200,4 +200,50 @@ int Calibrator::CollectDataDistribution(
   }
   return RET_OK;
 }
+
+int Calibrator::CopyDivergInfo(const DivergInfoMap &src, DivergInfoMap *dst) {
+  MS_CHECK_TRUE_MSG(dst != nullptr, RET_ERROR, "dst is nullptr.");
+  dst->clear();
+  for (const auto &node_infos : src) {
+    auto &dst_infos = (*dst)[node_infos.first];
+    for (const auto &info : node_infos.second) {
+      MS_CHECK_TRUE_MSG(info.second != nullptr, RET_NULL_PTR, "diverg info is nullptr.");
+      dst_infos[info.first] = std::make_unique<DataDistribution>(*info.second);
+    }
+  }
+  return RET_OK;
+}
+
+int Calibrator::MergeDivergInfo(const std::vector<DivergInfoMap> &srcs, size_t batch_num, DivergInfoMap *dst,
+                                CollectType collect_type) {
+  MS_CHECK_TRUE_MSG(dst != nullptr, RET_ERROR, "dst is nullptr.");
+  for (auto &node_infos : *dst) {
+    for (auto &info : node_infos.second) {
+      std::vector<const DataDistribution *> copies;
+      for (const auto &src : srcs) {
+        auto iter = src.find(node_infos.first);
+        if (iter == src.end() || iter->second.find(info.first) == iter->second.end()) {
+          MS_LOG(ERROR) << "diverg info of " << node_infos.first << " tensor " << info.first << " is missing.";
+          return RET_ERROR;
+        }
+        copies.push_back(iter->second.at(info.first).get());
+      }
+      if (collect_type == MIN_MAX) {
+        info.second->MergeMaxMinValue(copies, batch_num);
+        continue;
+      }
+      if (collect_type != KL_BIN) {
+        continue;
+      }
+      for (auto copy : copies) {
+        auto ret = info.second->MergeHistogram(*copy);
+        if (ret != RET_OK) {
+          MS_LOG(ERROR) << node_infos.first << " merge histogram failed.";
+          return ret;
+        }
+      }
+    }
+  }
+  return RET_OK;
+}
 }  // namespace mindspore::lite::quant
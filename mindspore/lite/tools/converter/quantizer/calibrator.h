@@ -30,6 +30,9 @@ enum CollectType {
   MIN_MAX,
   KL_BIN,
 };
+// {node_name,{tensor_index,DataDistribution}}
+using DivergInfoMap = std::unordered_map<std::string, std::map<int, std::unique_ptr<DataDistribution>>>;
+
 class Calibrator {
  public:
   Calibrator(size_t bit_num, int quant_max, int quant_min, ActivationQuantizedMethod activation_quant_method,
@@ -72,6 +75,13 @@ class Calibrator {
     std::unordered_map<std::string, std::map<int, std::unique_ptr<DataDistribution>>> *diverg_info_map,
     CollectType collect_type);
 
+  // A calibration session records into a copy of the distributions taken before the pass, the copies are merged back
+  // when all the sessions are done.
+  static int CopyDivergInfo(const DivergInfoMap &src, DivergInfoMap *dst);
+
+  static int MergeDivergInfo(const std::vector<DivergInfoMap> &srcs, size_t batch_num, DivergInfoMap *dst,
+                             CollectType collect_type);
+
  private:
   // {node_name,{tensor_index,DataDistribution}}
   std::unordered_map<std::string, std::map<int, std::unique_ptr<DataDistribution>>> inputs_diverg_info_;
@@ -71,6 +71,45 @@ int DataDistribution::UpdateHistogram(const std::vector<float> &data) {
   return RET_OK;
 }
 
+void DataDistribution::MergeMaxMinValue(const std::vector<const DataDistribution *> &copies, size_t batch_num) {
+  auto copy_num = copies.size();
+  if (copy_num == 0) {
+    return;
+  }
+  // the copies start with the quantiles recorded before the pass.
+  auto recorded_num = min_datas_.size();
+  std::vector<size_t> image_records(copy_num, 0);
+  for (size_t i = 0; i < copy_num; ++i) {
+    MS_ASSERT(copies[i] != nullptr);
+    real_min_ = std::min(real_min_, copies[i]->real_min_);
+    real_max_ = std::max(real_max_, copies[i]->real_max_);
+    auto image_num = i < batch_num ? (batch_num - i + copy_num - 1) / copy_num : 0;
+    if (image_num > 0 && copies[i]->min_datas_.size() > recorded_num) {
+      image_records[i] = (copies[i]->min_datas_.size() - recorded_num) / image_num;
+    }
+  }
+  for (size_t image = 0; image < batch_num; ++image) {
+    auto copy = copies[image % copy_num];
+    auto records = image_records[image % copy_num];
+    auto begin = recorded_num + image / copy_num * records;
+    min_datas_.insert(min_datas_.end(), copy->min_datas_.begin() + begin, copy->min_datas_.begin() + begin + records);
+    max_datas_.insert(max_datas_.end(), copy->max_datas_.begin() + begin, copy->max_datas_.begin() + begin + records);
+  }
+}
+
+int DataDistribution::MergeHistogram(const DataDistribution &other) {
+  if (other.bin_num_ != bin_num_ || !IsEqual(other.interval_, interval_)) {
+    MS_LOG(ERROR) << "The histograms to merge differ, bin num: " << bin_num_ << " vs " << other.bin_num_
+                  << ", interval: " << interval_ << " vs " << other.interval_;
+    return RET_ERROR;
+  }
+  // both started from the initial count.
+  for (int i = 0; i < bin_num_; ++i) {
+    histogram_[i] += other.histogram_[i] - kHistogramInitValue;
+  }
+  return RET_OK;
+}
+
 void DataDistribution::DumpHistogram() {
   MS_LOG(INFO) << "Print node " << cnode_->fullname_with_scope() << " histogram";
   for (float item : this->histogram_) {
@@ -26,6 +26,8 @@
 
 namespace mindspore::lite::quant {
 constexpr float kEps = 1e-8;
+// every bin starts with a tiny count, so that the KL divergence never divides by an empty bin.
+constexpr float kHistogramInitValue = 1.0e-7;
 
 class DataDistribution {
  public:
@@ -42,7 +44,7 @@ class DataDistribution {
     real_min_ = FLT_MAX;
     this->quant_max_ = quant_max;
     this->quant_min_ = quant_min;
-    std::fill(histogram_.begin(), histogram_.end(), 1.0e-7);
+    std::fill(histogram_.begin(), histogram_.end(), kHistogramInitValue);
     if (this->activation_quant_method_ == KL) {
       symmetric_ = true;
     } else {
@@ -56,6 +58,13 @@ class DataDistribution {
 
   int UpdateHistogram(const std::vector<float> &data);
 
+  // The calibration data can be split between sessions, each recording into a copy of the distribution taken before
+  // the pass. These add what the copies have recorded in a MIN_MAX or a KL_BIN pass back into this distribution.
+  // Copy i of n took the images i, i + n, ... of batch_num images, the quantile lists are merged in image order.
+  void MergeMaxMinValue(const std::vector<const DataDistribution *> &copies, size_t batch_num);
+
+  int MergeHistogram(const DataDistribution &other);
+
   void DumpHistogram();
 
   void HandleBinForKL(int quant_bint_nums, int bin_index, std::vector<float> *quantized_histogram,
@@ -77,6 +86,10 @@ class DataDistribution {
 
   CNodePtr GetCNode() { return this->cnode_; }
 
+  const std::vector<float> &GetMinDatas() const { return this->min_datas_; }
+
+  const std::vector<float> &GetMaxDatas() const { return this->max_datas_; }
+
  private:
   double CalculateMinMaxScale();
 
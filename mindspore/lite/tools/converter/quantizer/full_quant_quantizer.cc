@@ -18,6 +18,8 @@
 
 #include "tools/converter/quantizer/full_quant_quantizer.h"
 #include <dirent.h>
+#include <algorithm>
+#include <future>
 #include <memory>
 #include <unordered_map>
 #include <string>
@@ -594,16 +596,37 @@ int FullQuantQuantizer::InitDeviceConfig(const FuncGraphPtr &func_graph) {
   return RET_OK;
 }
 
-int FullQuantQuantizer::DoInference(CollectType collect_type) {
+int FullQuantQuantizer::BuildCalibrateModels(const FuncGraphPtr &func_graph) {
+  calibrate_models_ = {fp32_ms_model_};
+  auto session_num = std::min(static_cast<size_t>(std::max(param_->commonQuantParam.thread_num, 1)),
+                              calibrator_->GetBatchNum());
+  while (calibrate_models_.size() < session_num) {
+    auto model = std::make_shared<mindspore::Model>();
+    MS_CHECK_TRUE_MSG(model != nullptr, RET_ERROR, "New model failed.");
+    size_t size = 0;
+    auto ret = BuildModelByFuncGraph(model, func_graph, param_, &size);
+    if (ret != mindspore::kSuccess) {
+      MS_LOG(ERROR) << "Build calibration model failed.";
+      return RET_ERROR;
+    }
+    calibrate_models_.push_back(model);
+  }
+  MS_LOG(INFO) << "Calibrate with " << calibrate_models_.size() << " sessions.";
+  return RET_OK;
+}
+
+int FullQuantQuantizer::DoInference(const std::shared_ptr<mindspore::Model> &model, size_t first_index, size_t step,
+                                    CollectType collect_type, DivergInfoMap *inputs_diverg_info,
+                                    DivergInfoMap *outputs_diverg_info) {
   // get input tensor
-  vector<mindspore::MSTensor> inputs = fp32_ms_model_->GetInputs();
+  vector<mindspore::MSTensor> inputs = model->GetInputs();
   if (inputs.size() != calibrator_->GetInputNum()) {
     MS_LOG(ERROR) << "model's input tensor count: " << inputs.size() << " != "
                   << " calibrator count:" << calibrator_->GetInputNum();
     return RET_ERROR;
   }
 
-  for (size_t calib_index = 0; calib_index < calibrator_->GetBatchNum(); calib_index++) {
+  for (size_t calib_index = first_index; calib_index < calibrator_->GetBatchNum(); calib_index += step) {
     MS_LOG(INFO) << "Do inference round: " << calib_index;
     // set multi-input data
     for (auto tensor : inputs) {
@@ -613,8 +636,8 @@ int FullQuantQuantizer::DoInference(CollectType collect_type) {
     MSKernelCallBack beforeCallBack = [&](const std::vector<mindspore::MSTensor> &beforeInputs,
                                           const std::vector<mindspore::MSTensor> &beforeOutputs,
                                           const MSCallBackParam &callParam) -> bool {
-      auto diverg_info_map = calibrator_->GetInputDivergInfo();
-      auto ret = calibrator_->CollectDataDistribution(callParam.node_name, beforeInputs, diverg_info_map, collect_type);
+      auto ret =
+        calibrator_->CollectDataDistribution(callParam.node_name, beforeInputs, inputs_diverg_info, collect_type);
       if (ret != RET_OK) {
         MS_LOG(ERROR) << "CollectDataDistribution failed.";
         return false;
@@ -625,16 +648,16 @@ int FullQuantQuantizer::DoInference(CollectType collect_type) {
     MSKernelCallBack afterCallBack = [&](const std::vector<mindspore::MSTensor> &afterInputs,
                                          const std::vector<mindspore::MSTensor> &afterOutputs,
                                          const MSCallBackParam &callParam) -> bool {
-      auto diverg_info_map = calibrator_->GetOutputDivergInfo();
-      auto ret = calibrator_->CollectDataDistribution(callParam.node_name, afterOutputs, diverg_info_map, collect_type);
+      auto ret =
+        calibrator_->CollectDataDistribution(callParam.node_name, afterOutputs, outputs_diverg_info, collect_type);
       if (ret != RET_OK) {
         MS_LOG(ERROR) << "CollectDataDistribution failed.";
         return false;
       }
       return true;
     };
-    auto outputs = fp32_ms_model_->GetOutputs();
-    auto status = fp32_ms_model_->Predict(inputs, &outputs, beforeCallBack, afterCallBack);
+    auto outputs = model->GetOutputs();
+    auto status = model->Predict(inputs, &outputs, beforeCallBack, afterCallBack);
     if (status != mindspore::kSuccess) {
       MS_LOG(ERROR) << "run model failed!";
       return RET_ERROR;
@@ -643,6 +666,47 @@ int FullQuantQuantizer::DoInference(CollectType collect_type) {
   return RET_OK;
 }
 
+int FullQuantQuantizer::DoInference(CollectType collect_type) {
+  auto session_num = calibrate_models_.size();
+  if (session_num <= 1) {
+    return DoInference(fp32_ms_model_, 0, 1, collect_type, calibrator_->GetInputDivergInfo(),
+                       calibrator_->GetOutputDivergInfo());
+  }
+  // every session records into copies of the distributions, they are merged in image order afterwards.
+  std::vector<DivergInfoMap> inputs_diverg_infos(session_num);
+  std::vector<DivergInfoMap> outputs_diverg_infos(session_num);
+  for (size_t i = 0; i < session_num; ++i) {
+    auto ret = Calibrator::CopyDivergInfo(*calibrator_->GetInputDivergInfo(), &inputs_diverg_infos[i]);
+    MS_CHECK_TRUE_MSG(ret == RET_OK, ret, "Copy input diverg info failed.");
+    ret = Calibrator::CopyDivergInfo(*calibrator_->GetOutputDivergInfo(), &outputs_diverg_infos[i]);
+    MS_CHECK_TRUE_MSG(ret == RET_OK, ret, "Copy output diverg info failed.");
+  }
+  std::vector<std::future<int>> results;
+  for (size_t i = 0; i < session_num; ++i) {
+    results.push_back(std::async(std::launch::async, [&, i]() {
+      return DoInference(calibrate_models_[i], i, session_num, collect_type, &inputs_diverg_infos[i],
+                         &outputs_diverg_infos[i]);
+    }));
+  }
+  int status = RET_OK;
+  for (auto &result : results) {
+    if (result.get() != RET_OK) {
+      status = RET_ERROR;
+    }
+  }
+  if (status != RET_OK) {
+    MS_LOG(ERROR) << "Calibration session failed.";
+    return status;
+  }
+  auto ret = Calibrator::MergeDivergInfo(inputs_diverg_infos, calibrator_->GetBatchNum(),
+                                         calibrator_->GetInputDivergInfo(), collect_type);
+  MS_CHECK_TRUE_MSG(ret == RET_OK, ret, "Merge input diverg info failed.");
+  ret = Calibrator::MergeDivergInfo(outputs_diverg_infos, calibrator_->GetBatchNum(),
+                                    calibrator_->GetOutputDivergInfo(), collect_type);
+  MS_CHECK_TRUE_MSG(ret == RET_OK, ret, "Merge output diverg info failed.");
+  return RET_OK;
+}
+
 int FullQuantQuantizer::DoQuantize(FuncGraphPtr func_graph) {
   MS_ASSERT(func_graph != nullptr);
   MS_LOG(INFO) << "start to parse config file";
@@ -670,6 +734,11 @@ int FullQuantQuantizer::DoQuantize(FuncGraphPtr func_graph) {
     MS_LOG(ERROR) << "Build model failed.";
     return RET_ERROR;
   }
+  status = BuildCalibrateModels(func_graph);
+  if (status != RET_OK) {
+    MS_LOG(ERROR) << "Build calibration models failed.";
+    return status;
+  }
   MS_LOG(INFO) << "start to update divergence's max value";
   status = DoInference(MIN_MAX);
   if (status != RET_OK) {
@@ -684,6 +753,7 @@ int FullQuantQuantizer::DoQuantize(FuncGraphPtr func_graph) {
       return status;
     }
   }
+  calibrate_models_.clear();
 
   MS_LOG(INFO) << "start to generate quant param and quantize tensor's data";
   status = QuantNode(func_graph);
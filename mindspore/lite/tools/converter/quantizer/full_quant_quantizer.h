@@ -68,8 +68,14 @@ class FullQuantQuantizer : public Quantizer {
  private:
   int InitDeviceConfig(const FuncGraphPtr &func_graph);
 
+  int BuildCalibrateModels(const FuncGraphPtr &func_graph);
+
   int DoInference(CollectType collect_type);
 
+  // Runs the calibration images first_index, first_index + step, ... through one session of the pool.
+  int DoInference(const std::shared_ptr<mindspore::Model> &model, size_t first_index, size_t step,
+                  CollectType collect_type, DivergInfoMap *inputs_diverg_info, DivergInfoMap *outputs_diverg_info);
+
   int UpdateDivergeInterval();
 
   int QuantNodeSimpleOp(const CNodePtr &cnode);
@@ -119,6 +125,8 @@ class FullQuantQuantizer : public Quantizer {
   std::shared_ptr<Calibrator> calibrator_{nullptr};
   std::shared_ptr<QuantStrategy> quant_strategy_{nullptr};
   std::shared_ptr<mindspore::Model> fp32_ms_model_{nullptr};
+  // sessions sharing the calibration images, the first one is fp32_ms_model_. Released once calibrated.
+  std::vector<std::shared_ptr<mindspore::Model>> calibrate_models_;
 
   // key is tensor_name
   std::map<std::string, std::vector<schema::QuantParamT>> weight_quant_params_bak_;
@@ -233,13 +233,15 @@ int MixedBitWeightQuantization::DoQuantization(float *weights, std::vector<int64
   if (use_auto_tune_alg) {
     scale = GetDx(weights, input_shape, dims, node_name);
   } else {
-    BinarySearchResult br = BinarySearchForQuantizationScale(
-      weights, input_shape, dims, preferred_dim, max_search_iters_, target_relative_err_, target_search_tolerance_);
-    if (br.status != RET_OK) {
+    if (!scale_searched_) {
+      search_result_ = BinarySearchForQuantizationScale(
+        weights, input_shape, dims, preferred_dim, max_search_iters_, target_relative_err_, target_search_tolerance_);
+    }
+    if (search_result_.status != RET_OK) {
       MS_LOG(WARNING) << "this layer reached max iters.";
       return RET_NO_CHANGE;
     }
-    scale = br.scale;
+    scale = search_result_.scale;
   }
 
   schema::QuantParamT quant_param;
@@ -252,6 +254,24 @@ int MixedBitWeightQuantization::DoQuantization(float *weights, std::vector<int64
   return RET_OK;
 }
 
+int MixedBitWeightQuantization::SearchScale(const tensor::TensorPtr &weight) {
+  CHECK_NULL_RETURN(weight);
+  auto *raw_data = static_cast<float *>(weight->data_c());
+  CHECK_NULL_RETURN(raw_data);
+  auto shape = weight->shape_c();
+  int dims = shape.size();
+  int input_shape[4] = {0, 0, 0, 0};
+  MS_CHECK_LE(dims, static_cast<int>(sizeof(input_shape) / sizeof(input_shape[0])), RET_ERROR);
+  for (int i = 0; i < dims; i++) {
+    input_shape[i] = shape[i];
+  }
+  // QuantFilter quantizes along dim 0, the corrections of the last measure match the found scale.
+  search_result_ = BinarySearchForQuantizationScale(raw_data, input_shape, dims, 0, max_search_iters_,
+                                                    target_relative_err_, target_search_tolerance_);
+  scale_searched_ = true;
+  return RET_OK;
+}
+
 int MixedBitWeightQuantization::QuantizeByScale(const float *weights, int weightsc, float scale,
                                                 schema::QuantParamT *quant_params, std::vector<int16_t> *quant_datas) {
   MS_ASSERT(weights != nullptr);
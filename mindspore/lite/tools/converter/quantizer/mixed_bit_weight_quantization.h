@@ -49,6 +49,10 @@ class MixedBitWeightQuantization {
   int QuantFilter(const PrimitivePtr &primitive, const AnfNodePtr &parameter_node, const tensor::TensorPtr &weight,
                   int index, schema::QuantType quant_type, bool use_auto_tune_alg = false);
 
+  // Searches the scale of weight ahead of QuantFilter, which then takes the result instead of searching again. The
+  // search only reads the weight, the weights can be searched on several threads with an instance each.
+  int SearchScale(const tensor::TensorPtr &weight);
+
  private:
   int DoQuantization(float *weights, std::vector<int64_t> shape, int preferred_dim,
                      std::vector<schema::QuantParamT> *quant_params, std::vector<int16_t> *quant_datas,
@@ -73,6 +77,8 @@ class MixedBitWeightQuantization {
  private:
   float var_corr_{1};
   float mean_corr_{0};
+  bool scale_searched_{false};
+  BinarySearchResult search_result_{RET_ERROR, 0};
   float target_relative_err_;
   float target_search_tolerance_;
   int max_search_iters_;
@@ -92,7 +92,8 @@ struct CommonQuantParam {
   std::string debug_info_save_path;
   DebugMode debug_mode = DETAIL;
   std::set<std::string> skip_quant_node;
-  int thread_num = 4;
+  // sessions of the calibration inference and workers of the weight scale search, one keeps the sequential run.
+  int thread_num = 1;
 };
 
 struct MixedBitWeightQuantParam {
@@ -102,6 +103,15 @@ struct MixedBitWeightQuantParam {
   int max_iterations = kMinIterations;
 };
 
+// N:M structured sparsity of the fp32 MatMul and FullConnection weights, 0:0 leaves them dense. It only shrinks the
+// model file: the runtime densifies the weights at load and runs them through the dense packed matmul.
+struct SparsityParam {
+  int sparse_n = 0;
+  int sparse_m = 0;
+  bool auto_detect = false;  // keep either 2:4 or 4:8, whichever the weight already satisfies.
+  bool prune = false;        // drop the smallest magnitudes of a weight which is not N:M sparse yet.
+};
+
 struct FullQuantParam {
   ActivationQuantizedMethod activation_quant_method = MAX_MIN;
   bool bias_correction = true;
@@ -22,6 +22,8 @@
 #include <deque>
 #include <map>
 #include <set>
+#include <utility>
+#include <vector>
 #include "tools/lite_exporter/fetch_content.h"
 #include "base/base.h"
 #include "tools/converter/quantizer/quantize_util.h"
@@ -32,6 +34,10 @@
 #include "tools/converter/quantizer/dynamic_quantizer.h"
 #include "tools/lite_exporter/anf_exporter.h"
 #include "tools/converter/quantizer/cle_strategy.h"
+#include "tools/converter/quantizer/tensor_compressor.h"
+#include "tools/optimizer/common/gllo_utils.h"
+#include "ops/op_name.h"
+#include "nnacl/op_base.h"
 
 namespace mindspore::lite::quant {
 int DoFullQuant(const FuncGraphPtr &old_graph, const std::shared_ptr<ConverterPara> &param) {
@@ -274,6 +280,50 @@ int DoSingleGraphQuantize(const FuncGraphPtr &old_graph, const std::shared_ptr<C
   return RET_OK;
 }
 
+// The weight of a FullConnection, or of a MatMul which transposes it, has deep as the last axis, which is the axis the
+// runtime kernels skip the pruned weights along.
+int DoNMSparsityCompress(const FuncGraphPtr &old_graph, const std::shared_ptr<ConverterPara> &param) {
+  const auto &sparsity = param->sparsityParam;
+  std::vector<std::pair<int, int>> patterns;
+  if (sparsity.auto_detect) {
+    patterns = {{C2NUM, C4NUM}, {C4NUM, C8NUM}};
+  } else {
+    patterns = {{sparsity.sparse_n, sparsity.sparse_m}};
+  }
+  TensorCompressor compressor;
+  for (auto &cnode : old_graph->GetOrderedCnodes()) {
+    bool deep_last = opt::CheckPrimitiveType(cnode, prim::kPrimFullConnection);
+    if (opt::CheckPrimitiveType(cnode, prim::kPrimMatMulFusion)) {
+      auto primitive = GetValueNode<PrimitivePtr>(cnode->input(0));
+      CHECK_NULL_RETURN(primitive);
+      auto transpose_b = primitive->GetAttr(ops::kTransposeB);
+      deep_last = transpose_b != nullptr && GetValue<bool>(transpose_b);
+    }
+    if (!deep_last || cnode->size() <= kPrimOffset + 1) {
+      continue;
+    }
+    auto input = cnode->input(kPrimOffset + 1);
+    if (!input->isa<Parameter>() || !input->cast<ParameterPtr>()->has_default()) {
+      continue;
+    }
+    ParameterPtr param_node;
+    tensor::TensorPtr tensor_info;
+    GetLiteParameter(input, &param_node, &tensor_info);
+    CHECK_NULL_RETURN(param_node);
+    for (const auto &pattern : patterns) {
+      auto ret = compressor.DoNMSparseCompress(param_node, pattern.first, pattern.second, sparsity.prune);
+      if (ret == RET_OK) {
+        break;
+      }
+      if (ret != RET_NO_CHANGE) {
+        MS_LOG(ERROR) << input->fullname_with_scope() << " N:M sparse compress failed.";
+        return ret;
+      }
+    }
+  }
+  return RET_OK;
+}
+
 int QuantizationOptimizer::Run(const mindspore::FuncGraphPtr &func_graph) {
   std::set<FuncGraphPtr> all_func_graphs{};
   quant::GetFuncGraphs(func_graph, &all_func_graphs);
@@ -284,6 +334,13 @@ int QuantizationOptimizer::Run(const mindspore::FuncGraphPtr &func_graph) {
       MS_LOG(ERROR) << "Do Quantize failed.";
       return status;
     }
+    if (param_->sparsityParam.auto_detect || param_->sparsityParam.sparse_n > 0) {
+      status = DoNMSparsityCompress(item, param_);
+      if (status != RET_OK) {
+        MS_LOG(ERROR) << "Do N:M sparsity compress failed.";
+        return status;
+      }
+    }
   }
   return RET_OK;
 }
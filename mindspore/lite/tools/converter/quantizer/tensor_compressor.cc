@@ -24,6 +24,7 @@
 #include <set>
 #include <map>
 #include <algorithm>
+#include "nnacl/fp32/nm_sparse_fp32.h"
 
 namespace mindspore::lite::quant {
 void TensorCompressor::WriteBufferWithAlignByte(const std::vector<bool> &bool_vec, int8_t *data) {
@@ -145,4 +146,46 @@ int TensorCompressor::DoBitPack(const ParameterPtr &weight, size_t bit_num) {
   weight->set_abstract(compression_tensor->ToAbstract());
   return RET_OK;
 }
+
+int TensorCompressor::DoNMSparseCompress(const ParameterPtr &weight, int sparse_n, int sparse_m, bool prune) {
+  auto tensor_info = weight->default_param()->cast<tensor::TensorPtr>();
+  CHECK_NULL_RETURN(tensor_info);
+  if (tensor_info->compression_type() != kNoCompression || tensor_info->data_type() != kNumberTypeFloat32) {
+    MS_LOG(INFO) << weight->fullname_with_scope() << " is not a dense fp32 weight.";
+    return RET_NO_CHANGE;
+  }
+  auto dims = tensor_info->shape_c();
+  if (dims.size() < static_cast<size_t>(DIMENSION_2D) || dims.back() < sparse_m) {
+    return RET_NO_CHANGE;
+  }
+  auto deep = static_cast<int>(dims.back());
+  auto lines = static_cast<int>(tensor_info->DataSize() / deep);
+  auto weight_data = static_cast<float *>(tensor_info->data_c());
+  CHECK_NULL_RETURN(weight_data);
+  if (!prune && !IsNMSparseWeight(weight_data, deep, lines, sparse_n, sparse_m, true)) {
+    return RET_NO_CHANGE;
+  }
+  auto kept_num = static_cast<size_t>(NMSparseKeptNum(deep, sparse_n, sparse_m)) * lines;
+  auto header_size = C2NUM * sizeof(int32_t);
+  auto buffer_size = header_size + kept_num * (sizeof(float) + sizeof(uint8_t));
+  if (buffer_size >= tensor_info->Size()) {
+    return RET_NO_CHANGE;
+  }
+  auto compression_tensor =
+    std::make_shared<mindspore::tensor::Tensor>(kNumberTypeFloat32, tensor_info->shape(), buffer_size, kNMSparse);
+  CHECK_NULL_RETURN(compression_tensor);
+  auto buffer = static_cast<int8_t *>(compression_tensor->data_c());
+  CHECK_NULL_RETURN(buffer);
+  auto header = reinterpret_cast<int32_t *>(buffer);
+  header[0] = sparse_n;
+  header[1] = sparse_m;
+  auto values = reinterpret_cast<float *>(buffer + header_size);
+  auto indexes = reinterpret_cast<uint8_t *>(values + kept_num);
+  PackNMSparseWeight(weight_data, values, indexes, deep, lines, sparse_n, sparse_m, true);
+  MS_LOG(INFO) << weight->fullname_with_scope() << " is stored " << sparse_n << ":" << sparse_m << " sparse, from "
+               << tensor_info->Size() << " to " << buffer_size << " bytes.";
+  weight->set_default_param(compression_tensor);
+  weight->set_abstract(compression_tensor->ToAbstract());
+  return RET_OK;
+}
 }  // namespace mindspore::lite::quant
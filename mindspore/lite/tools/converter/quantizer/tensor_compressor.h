@@ -107,6 +107,10 @@ class TensorCompressor {
 
   int DoBitPack(const ParameterPtr &weight, size_t bit_num);
 
+  // Keeps the non-zeros of every group of sparse_m fp32 weights along the last axis and their offsets in the group,
+  // behind an int32 sparse_n and sparse_m header. Prunes the weight when it is not N:M sparse and prune is set.
+  int DoNMSparseCompress(const ParameterPtr &weight, int sparse_n, int sparse_m, bool prune);
+
  private:
   template <typename T>
   int IndexingCompress(const ParameterPtr &weight, const std::set<T> &quant_data_set,
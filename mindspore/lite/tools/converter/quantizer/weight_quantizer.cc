@@ -16,23 +16,50 @@
 
 #define USE_DEPRECATED_API
 #include "tools/converter/quantizer/weight_quantizer.h"
+#include <algorithm>
 #include <list>
+#include <memory>
 #include <string>
 #include <utility>
 #include <set>
+#include <vector>
 #include "tools/optimizer/common/gllo_utils.h"
 #include "src/common/log_util.h"
 #include "tools/converter/quantizer/fse_encoder.h"
 #include "tools/converter/quantizer/tensor_compressor.h"
 #include "tools/converter/quantizer/cluster_quantization.h"
-#include "tools/converter/quantizer/mixed_bit_weight_quantization.h"
 #include "tools/converter/quantizer/fixed_bit_weight_quantization.h"
 
 namespace mindspore::lite::quant {
+namespace {
+std::vector<int> GetWeightIndices(const CNodePtr &cnode) {
+  std::vector<int> weight_indices;
+  if (opt::CheckPrimitiveType(cnode, prim::kPrimAdam)) {
+    weight_indices = {2, 3};
+  } else if (opt::CheckPrimitiveType(cnode, prim::kPrimSGD)) {
+    weight_indices = {4, 6};
+  } else if (opt::CheckPrimitiveType(cnode, prim::kPrimApplyMomentum)) {
+    weight_indices = {2};
+  } else {
+    for (size_t i = 1; i < cnode->size(); ++i) {
+      weight_indices.push_back(i);
+    }
+  }
+  return weight_indices;
+}
+}  // namespace
+
 int WeightQuantizer::WeightQuant(const FuncGraphPtr &func_graph,
                                  const std::set<PrimitivePtr> &support_weight_quant_types,
                                  const std::set<PrimitivePtr> &per_layer_types,
                                  const std::set<PrimitivePtr> &symmetric_types, bool compression) {
+  if (is_mixed_bit_ && !is_auto_tune_ && linear_quant_) {
+    auto ret = SearchMixedBitScales(func_graph, support_weight_quant_types);
+    if (ret != RET_OK) {
+      MS_LOG(ERROR) << "Search mixed bit scales failed.";
+      return ret;
+    }
+  }
   for (auto &cnode : func_graph->GetOrderedCnodes()) {
     auto primitive = GetValueNode<std::shared_ptr<ops::PrimitiveC>>(cnode->input(0));
     if (primitive == nullptr) {
@@ -50,18 +77,7 @@ int WeightQuantizer::WeightQuant(const FuncGraphPtr &func_graph,
     }
 
     // Init weight quant index.
-    std::vector<int> weight_indices;
-    if (opt::CheckPrimitiveType(cnode, prim::kPrimAdam)) {
-      weight_indices = {2, 3};
-    } else if (opt::CheckPrimitiveType(cnode, prim::kPrimSGD)) {
-      weight_indices = {4, 6};
-    } else if (opt::CheckPrimitiveType(cnode, prim::kPrimApplyMomentum)) {
-      weight_indices = {2};
-    } else {
-      for (size_t i = 1; i < cnode->size(); ++i) {
-        weight_indices.push_back(i);
-      }
-    }
+    auto weight_indices = GetWeightIndices(cnode);
 
     if (linear_quant_) {
       auto ret = LinearQuant(func_graph, cnode, per_layer_types, symmetric_types, weight_indices, compression);
@@ -78,6 +94,7 @@ int WeightQuantizer::WeightQuant(const FuncGraphPtr &func_graph,
       }
     }
   }
+  mixed_bit_searches_.clear();
   return RET_OK;
 }
 
@@ -133,12 +150,80 @@ int WeightQuantizer::DoCompression(const CNodePtr &cnode, const ParameterPtr &pa
   return RET_OK;
 }
 
+// The binary search of a scale runs the quantization error of the whole weight many times, the weights are searched on
+// thread_num threads up front. Each search has an instance of its own and only reads its weight.
+int WeightQuantizer::SearchMixedBitScales(const FuncGraphPtr &func_graph,
+                                          const std::set<PrimitivePtr> &support_weight_quant_types) {
+  mixed_bit_searches_.clear();
+  auto quant_strategy = std::make_unique<QuantStrategy>(param_->commonQuantParam.min_quant_weight_size,
+                                                        param_->commonQuantParam.min_quant_weight_channel,
+                                                        param_->commonQuantParam.skip_quant_node);
+  CHECK_NULL_RETURN(quant_strategy);
+  std::vector<std::pair<tensor::TensorPtr, MixedBitWeightQuantization *>> searches;
+  for (auto &cnode : func_graph->GetOrderedCnodes()) {
+    auto primitive = GetValueNode<std::shared_ptr<ops::PrimitiveC>>(cnode->input(0));
+    if (primitive == nullptr ||
+        param_->commonQuantParam.skip_quant_node.find(cnode->fullname_with_scope()) !=
+          param_->commonQuantParam.skip_quant_node.end() ||
+        !CheckNodeInSet(cnode, support_weight_quant_types)) {
+      continue;
+    }
+    for (auto idx : GetWeightIndices(cnode)) {
+      auto input = cnode->input(idx);
+      ParameterPtr parameter;
+      tensor::TensorPtr tensor_info;
+      GetLiteParameter(input, &parameter, &tensor_info);
+      if (parameter == nullptr || tensor_info == nullptr || tensor_info->data_type() != TypeId::kNumberTypeFloat32 ||
+          tensor_info->compression_type() != kNoCompression ||
+          mixed_bit_searches_.find(tensor_info) != mixed_bit_searches_.end()) {
+        continue;
+      }
+      int preferred_dim = GetPreferredDim(cnode, idx - 1, ConvertShapeVectorToInt32(tensor_info->shape()));
+      if (!quant_strategy->CanTensorQuantized(cnode, input, preferred_dim)) {
+        continue;
+      }
+      auto iter = mixed_bit_searches_.emplace(tensor_info, MixedBitWeightQuantization(mixed_bit_init_scale_)).first;
+      searches.emplace_back(tensor_info, &iter->second);
+    }
+  }
+  auto thread_num = std::min(static_cast<size_t>(std::max(param_->commonQuantParam.thread_num, 1)), searches.size());
+  if (thread_num <= 1) {
+    // the searches run inline in QuantFilter.
+    mixed_bit_searches_.clear();
+    return RET_OK;
+  }
+  std::vector<std::future<int>> results;
+  for (size_t i = 0; i < thread_num; ++i) {
+    results.push_back(std::async(std::launch::async, [&searches, i, thread_num]() {
+      for (size_t j = i; j < searches.size(); j += thread_num) {
+        auto ret = searches[j].second->SearchScale(searches[j].first);
+        if (ret != RET_OK) {
+          MS_LOG(ERROR) << "Search mixed bit scale failed.";
+          return ret;
+        }
+      }
+      return RET_OK;
+    }));
+  }
+  int status = RET_OK;
+  for (auto &result : results) {
+    if (result.get() != RET_OK) {
+      status = RET_ERROR;
+    }
+  }
+  return status;
+}
+
 int WeightQuantizer::DoMixBitQuant(const CNodePtr &cnode, const ParameterPtr &parameter, int idx,
                                    const tensor::TensorPtr &tensor_info, int preferred_dim,
                                    WeightQuantType weight_quant_type, bool symmetric) {
   auto primitive = GetValueNode<PrimitivePtr>(cnode->input(0));
   CHECK_NULL_RETURN(primitive);
   auto mixed_bit_quantization = MixedBitWeightQuantization(mixed_bit_init_scale_);
+  auto search = mixed_bit_searches_.find(tensor_info);
+  if (search != mixed_bit_searches_.end()) {
+    mixed_bit_quantization = search->second;
+  }
   auto status = mixed_bit_quantization.QuantFilter(primitive, parameter, tensor_info, idx - 1,
                                                    param_->commonQuantParam.quant_type, is_auto_tune_);
   if (status == RET_OK) {
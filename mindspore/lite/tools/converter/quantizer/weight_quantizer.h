@@ -29,6 +29,7 @@
 #include "tools/converter/quantizer/quantize_util.h"
 #include "tools/converter/quantizer/quant_params.h"
 #include "tools/converter/quantizer/quant_strategy.h"
+#include "tools/converter/quantizer/mixed_bit_weight_quantization.h"
 #include "tools/converter/preprocess/preprocess_param.h"
 #include "ir/func_graph.h"
 #include "ir/anf.h"
@@ -86,6 +87,7 @@ class WeightQuantizer : public Quantizer {
                          WeightQuantType weight_quant_type, int q_min, int q_max, bool symmetric = false,
                          bool compression = true);
   int DoCompression(const CNodePtr &cnode, const ParameterPtr &parameter, int idx);
+  int SearchMixedBitScales(const FuncGraphPtr &func_graph, const std::set<PrimitivePtr> &support_weight_quant_types);
   int DoMixBitQuant(const CNodePtr &cnode, const ParameterPtr &parameter, int idx, const tensor::TensorPtr &tensor_info,
                     int preferred_dim, WeightQuantType weight_quant_type, bool symmetric = true);
 
@@ -94,6 +96,8 @@ class WeightQuantizer : public Quantizer {
   size_t bit_num_{8};
   // Support for mark shared weight node.
   std::set<tensor::TensorPtr> weight_quantized_tensors_;
+  // the scales of the mixed bit weights, searched side by side before the weights are quantized one by one.
+  std::map<tensor::TensorPtr, MixedBitWeightQuantization> mixed_bit_searches_;
   bool is_auto_tune_{false};
   bool is_mixed_bit_{false};
   double mixed_bit_init_scale_ = 0.02;
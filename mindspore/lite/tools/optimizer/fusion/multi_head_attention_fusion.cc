@@ -27,18 +27,18 @@ namespace mindspore::opt {
 namespace {
 const auto &p1 = std::placeholders::_1;
 const size_t kWeightShapeSize = 2;
+const size_t kFirstInputIndex = 1;
 }  // namespace
 
 namespace {
-VectorRef DefineEmbedding(const BaseRef &input, const BaseRef &weight, const BaseRef &bias, bool test_div = false) {
+VectorRef DefineEmbedding(const BaseRef &input, const BaseRef &weight, const BaseRef &bias, const BaseRef &shape,
+                          bool test_div = false) {
   auto is_matmul = std::make_shared<CondVar>(std::bind(IsOpType, p1, prim::kPrimMatMulFusion));
   MS_CHECK_TRUE_RET(is_matmul != nullptr, {});
   auto dense = VectorRef({is_matmul, input, weight, bias});
   auto is_reshape = std::make_shared<CondVar>(std::bind(IsOpType, p1, prim::kPrimReshape));
   MS_CHECK_TRUE_RET(is_reshape != nullptr, {});
-  auto var1 = std::make_shared<Var>();
-  MS_CHECK_TRUE_RET(var1 != nullptr, {});
-  auto reshape = VectorRef({is_reshape, dense, var1});
+  auto reshape = VectorRef({is_reshape, dense, shape});
   auto is_transpose = std::make_shared<CondVar>(std::bind(IsOpType, p1, prim::kPrimTranspose));
   MS_CHECK_TRUE_RET(is_transpose != nullptr, {});
   auto var2 = std::make_shared<Var>();
@@ -75,17 +75,19 @@ VectorRef DefineMask(const BaseRef &mask_input) {
 
 VectorRef MultiHeadAttentionFusion::DefineMPWithMaskPattern(bool cross, bool mask) const {
   VectorRef k_embedding, v_embedding;
-  auto q_embedding = DefineEmbedding(input_q_, weight_q_, bias_q_, true);
+  auto reshape_q = std::make_shared<Var>();
+  MS_CHECK_TRUE_RET(reshape_q != nullptr, {});
+  auto q_embedding = DefineEmbedding(input_q_, weight_q_, bias_q_, reshape_q, true);
   MS_CHECK_TRUE_RET(!q_embedding.empty(), {});
   if (!cross) {
-    k_embedding = DefineEmbedding(input_q_, weight_k_, bias_k_, true);
+    k_embedding = DefineEmbedding(input_q_, weight_k_, bias_k_, reshape_k_, true);
     MS_CHECK_TRUE_RET(!k_embedding.empty(), {});
-    v_embedding = DefineEmbedding(input_q_, weight_v_, bias_v_);
+    v_embedding = DefineEmbedding(input_q_, weight_v_, bias_v_, reshape_v_);
     MS_CHECK_TRUE_RET(!v_embedding.empty(), {});
   } else {
-    k_embedding = DefineEmbedding(input_k_, weight_k_, bias_k_, true);
+    k_embedding = DefineEmbedding(input_k_, weight_k_, bias_k_, reshape_k_, true);
     MS_CHECK_TRUE_RET(!k_embedding.empty(), {});
-    v_embedding = DefineEmbedding(input_k_, weight_v_, bias_v_);
+    v_embedding = DefineEmbedding(input_k_, weight_v_, bias_v_, reshape_v_);
     MS_CHECK_TRUE_RET(!v_embedding.empty(), {});
   }
   auto is_matmul1 = std::make_shared<CondVar>(std::bind(IsOpType, p1, prim::kPrimMatMulFusion));
@@ -135,17 +137,19 @@ VectorRef MultiHeadAttentionFusion::DefineMPWithMaskPattern(bool cross, bool mas
 
 VectorRef MultiHeadAttentionFusion::DefineMPWithMaskPatternPA(bool cross) const {
   VectorRef k_embedding, v_embedding;
-  auto q_embedding = DefineEmbedding(input_q_, weight_q_, bias_q_, true);
+  auto reshape_q = std::make_shared<Var>();
+  MS_CHECK_TRUE_RET(reshape_q != nullptr, {});
+  auto q_embedding = DefineEmbedding(input_q_, weight_q_, bias_q_, reshape_q, true);
   MS_CHECK_TRUE_RET(!q_embedding.empty(), {});
   if (!cross) {
-    k_embedding = DefineEmbedding(input_q_, weight_k_, bias_k_, true);
+    k_embedding = DefineEmbedding(input_q_, weight_k_, bias_k_, reshape_k_, true);
     MS_CHECK_TRUE_RET(!k_embedding.empty(), {});
-    v_embedding = DefineEmbedding(input_q_, weight_v_, bias_v_);
+    v_embedding = DefineEmbedding(input_q_, weight_v_, bias_v_, reshape_v_);
     MS_CHECK_TRUE_RET(!v_embedding.empty(), {});
   } else {
-    k_embedding = DefineEmbedding(input_k_, weight_k_, bias_k_, true);
+    k_embedding = DefineEmbedding(input_k_, weight_k_, bias_k_, reshape_k_, true);
     MS_CHECK_TRUE_RET(!k_embedding.empty(), {});
-    v_embedding = DefineEmbedding(input_k_, weight_v_, bias_v_);
+    v_embedding = DefineEmbedding(input_k_, weight_v_, bias_v_, reshape_v_);
     MS_CHECK_TRUE_RET(!v_embedding.empty(), {});
   }
   auto is_matmul1 = std::make_shared<CondVar>(std::bind(IsOpType, p1, prim::kPrimMatMulFusion));
@@ -279,13 +283,13 @@ AnfNodePtr MultiHeadAttentionFusion::Process(const std::string &pattern_name, co
     return nullptr;
   }
   if ((pattern_name == kMPAWithMaskPatternName) || (pattern_name == kMPAWithMaskPatternNamePA)) {
-    return CreateMaskedMultiHeadAttentionNode(func_graph, equiv, node->fullname_with_scope());
+    return CreateMaskedMultiHeadAttentionNode(func_graph, equiv, node);
   } else if ((pattern_name == kMPAXWithMaskPatternName) || (pattern_name == kMPAXWithMaskPatternNamePA)) {
-    return CreateMaskedMultiHeadAttentionNode(func_graph, equiv, node->fullname_with_scope(), true);
+    return CreateMaskedMultiHeadAttentionNode(func_graph, equiv, node, true);
   } else if (pattern_name == kMPAPatternName) {
-    return CreateMaskedMultiHeadAttentionNode(func_graph, equiv, node->fullname_with_scope(), false, false);
+    return CreateMaskedMultiHeadAttentionNode(func_graph, equiv, node, false, false);
   } else if (pattern_name == kMPAXPatternName) {
-    return CreateMaskedMultiHeadAttentionNode(func_graph, equiv, node->fullname_with_scope(), true, false);
+    return CreateMaskedMultiHeadAttentionNode(func_graph, equiv, node, true, false);
   }
 
   { return nullptr; }
@@ -350,15 +354,38 @@ std::shared_ptr<ops::Attention> MultiHeadAttentionFusion::BuildAttentionPrim(con
     MS_LOG(ERROR) << "Shape k or shape v is invalid.";
     return nullptr;
   }
+  // k and v are reshaped to [batch, seq, head_num, head_size] before they are split into heads
+  auto head_num = shape_k.at(shape_k.size() - kWeightShapeSize);
+  if (head_num <= 0) {
+    MS_LOG(ERROR) << "Invalid head num " << head_num;
+    return nullptr;
+  }
+  // the score mask is an input of the fused op, the pattern never implies a causal one
+  attention_prim->Init(head_num, false);
   return attention_prim;
 }
 
+AnfNodePtr MultiHeadAttentionFusion::GetScoreMask(const AnfNodePtr &node) const {
+  // walk from the output projection to the add of the scores, whose first input is the additive mask
+  auto cur = node;
+  while (cur != nullptr && utils::isa<CNodePtr>(cur)) {
+    auto cnode = cur->cast<CNodePtr>();
+    if (CheckPrimitiveType(cnode, prim::kPrimAddFusion)) {
+      return cnode->size() > kFirstInputIndex ? cnode->input(kFirstInputIndex) : nullptr;
+    }
+    cur = cnode->size() > kFirstInputIndex ? cnode->input(kFirstInputIndex) : nullptr;
+  }
+  return nullptr;
+}
+
 CNodePtr MultiHeadAttentionFusion::CreateMaskedMultiHeadAttentionNode(const FuncGraphPtr &func_graph,
-                                                                      const EquivPtr &equiv, const string &base_name,
+                                                                      const EquivPtr &equiv, const AnfNodePtr &node,
                                                                       bool cross, bool mask) const {
   MS_ASSERT(func_graph != nullptr);
   MS_ASSERT(equiv != nullptr);
-  auto attention_prim = std::make_shared<ops::Attention>();
+  MS_ASSERT(node != nullptr);
+  auto base_name = node->fullname_with_scope();
+  auto attention_prim = BuildAttentionPrim(equiv);
   if (attention_prim == nullptr) {
     MS_LOG(ERROR) << "Build attention primitive failed.";
     return nullptr;
@@ -385,7 +412,12 @@ CNodePtr MultiHeadAttentionFusion::CreateMaskedMultiHeadAttentionNode(const Func
   auto bias_v = utils::cast<AnfNodePtr>((*equiv)[bias_v_]);
   auto bias_o = utils::cast<AnfNodePtr>((*equiv)[bias_o_]);
   if (mask) {
-    input_mask = utils::cast<AnfNodePtr>((*equiv)[mask_]);
+    // the kernel adds the mask to the scores as it is, so it takes the scaled mask rather than the raw one
+    input_mask = GetScoreMask(node);
+    if (input_mask == nullptr) {
+      MS_LOG(ERROR) << "Get the score mask of attention failed.";
+      return nullptr;
+    }
   }
   std::shared_ptr<tensor::Tensor> weight_q_tensor = GetTensorInfo(weight_q);
   std::shared_ptr<tensor::Tensor> weight_k_tensor = GetTensorInfo(weight_k);
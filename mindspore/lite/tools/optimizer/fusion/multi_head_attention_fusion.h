@@ -49,9 +49,11 @@ class MultiHeadAttentionFusion : public MultiplePatternProcessPass {
   VectorRef DefineMPWithMaskPattern(bool cross = false, bool mask = true) const;
   VectorRef DefineMPWithMaskPatternPA(bool cross = false) const;
 
-  // create masked-multi-head-attention
+  // create masked-multi-head-attention, node is the output projection matched by the pattern
   CNodePtr CreateMaskedMultiHeadAttentionNode(const FuncGraphPtr &func_graph, const EquivPtr &equiv,
-                                              const std::string &base_name, bool cross = false, bool mask = true) const;
+                                              const AnfNodePtr &node, bool cross = false, bool mask = true) const;
+  // the additive mask of the scores, the first input of the add in front of the softmax
+  AnfNodePtr GetScoreMask(const AnfNodePtr &node) const;
 
  protected:
   const std::string kMPAWithMaskPatternName = "MPAWithMaskPattern";
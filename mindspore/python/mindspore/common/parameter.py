@@ -214,6 +214,8 @@ class Parameter(Tensor_):
         self.push_weight_to_server = False
         self.pull_weight_from_server = False
         self.requires_aggr = True
+        # this flag is for the parallel optimizer on CPU, the parameter is sharded along the first dimension.
+        self.zero_shard = False
         self._cast_type = None
         self._unique = False
         self.is_in_parallel = _is_in_parallel_mode()
@@ -318,6 +318,15 @@ class _Context:
                              "but got {}GB".format(float(mempool_block_size[:-2])))
         self.set_param(ms_ctx_param.mempool_block_size, mempool_block_size_value)
 
+    def set_recompute_memory_budget(self, recompute_memory_budget):
+        """Set the memory budget of the activations, the recomputed nodes are selected automatically to fit it."""
+        if recompute_memory_budget != "0GB" and not Validator.check_str_by_regular(recompute_memory_budget,
+                                                                                    _re_pattern):
+            raise ValueError("For 'context.set_context', the argument 'recompute_memory_budget' should be in "
+                             "correct format! It must be a string ending with 'GB', such as \"5GB\" or \"0GB\", "
+                             "but got {}.".format(recompute_memory_budget))
+        self.set_param(ms_ctx_param.recompute_memory_budget, float(recompute_memory_budget[:-2]))
+
     def set_print_file_path(self, file_path):
         """Add timestamp suffix to file name. Sets print file path."""
         print_file_path = os.path.realpath(file_path)
@@ -369,6 +378,7 @@ class _Context:
         'variable_memory_max_size': set_variable_memory_max_size,
         'max_device_memory': set_max_device_memory,
         'mempool_block_size': set_mempool_block_size,
+        'recompute_memory_budget': set_recompute_memory_budget,
         'print_file_path': set_print_file_path,
         'env_config_path': set_env_config_path,
         'runtime_num_threads': set_runtime_num_threads,
@@ -442,7 +452,7 @@ def _context():
                  auto_parallel_search_mode=str, search_mode=str, parameter_broadcast=bool, strategy_ckpt_load_file=str,
                  strategy_ckpt_save_file=str, full_batch=bool, enable_parallel_optimizer=bool, enable_alltoall=bool,
                  all_reduce_fusion_config=list, pipeline_stages=int, grad_accumulation_step=int,
-                 parallel_optimizer_config=dict, comm_fusion=dict)
+                 parallel_optimizer_config=dict, comm_fusion=dict, pipeline_interleave_num=int)
 def set_auto_parallel_context(**kwargs):
     r"""
     Set auto parallel context, only data parallel supported on CPU.
@@ -472,6 +482,7 @@ def set_auto_parallel_context(**kwargs):
     enable_alltoall              grad_accumulation_step
                \                 auto_parallel_search_mode
                \                 comm_fusion
+               \                 pipeline_interleave_num
     ===========================  ===========================
 
     Args:
@@ -532,6 +543,12 @@ def set_auto_parallel_context(**kwargs):
                         distributed alone in the pipeline. The total devices will be divided into 'pipeline_stags'
                         stages. Currently, this could only be used when parallel mode semi_auto_parallel is enabled.
                         Default: 1.
+        pipeline_interleave_num (int): Set the number of virtual stages every pipeline stage runs. The cells are
+                        labeled with 'pipeline_stages' * 'pipeline_interleave_num' virtual stages by 'pipeline_stage',
+                        and the virtual stage s runs on the stage s % 'pipeline_stages', so every stage runs several
+                        non-contiguous chunks of the network and the micro batches are scheduled by the interleaved
+                        1F1B order, which shrinks the pipeline bubble. The micro size must be a multiple of
+                        'pipeline_stages'. Default: 1.
         grad_accumulation_step (int): Set the accumulation steps of gradients in auto and semi auto parallel mode.
                         This should be a positive int. Default: 1.
         parallel_optimizer_config (dict): A dict contains the keys and values for setting the parallel optimizer
@@ -593,6 +610,7 @@ def set_auto_parallel_context(**kwargs):
         >>> ms.set_auto_parallel_context(enable_alltoall=False)
         >>> ms.set_auto_parallel_context(all_reduce_fusion_config=[8, 160])
         >>> ms.set_auto_parallel_context(pipeline_stages=2)
+        >>> ms.set_auto_parallel_context(pipeline_interleave_num=2)
         >>> parallel_config = {"gradient_accumulation_shard": True, "parallel_optimizer_threshold": 24}
         >>> ms.set_auto_parallel_context(parallel_optimizer_config=parallel_config, enable_parallel_optimizer=True)
         >>> config = {"allreduce": {"mode": "size", "config": 32}, "allgather": {"mode": "size", "config": 32}}
@@ -640,6 +658,7 @@ def reset_auto_parallel_context():
     - enable_parallel_optimizer: False.
     - enable_alltoall: False.
     - pipeline_stages: 1.
+    - pipeline_interleave_num: 1.
     - fusion_threshold: 64.
     """
     _reset_auto_parallel_context()
@@ -678,7 +697,8 @@ def _check_target_specific_cfgs(device, arg_key):
                  enable_graph_kernel=bool, reserve_class_name_in_scope=bool, check_bprop=bool,
                  max_device_memory=str, print_file_path=str, max_call_depth=int, env_config_path=str,
                  graph_kernel_flags=str, save_compile_cache=bool, runtime_num_threads=int, load_compile_cache=bool,
-                 grad_for_scalar=bool, pynative_synchronize=bool, mempool_block_size=str, disable_format_transform=bool)
+                 grad_for_scalar=bool, pynative_synchronize=bool, mempool_block_size=str, disable_format_transform=bool,
+                 recompute_memory_budget=str)
 def set_context(**kwargs):
     """
     Set context for running environment.
@@ -730,6 +750,8 @@ def set_context(**kwargs):
     |                         +------------------------------+----------------------------+
     |                         |  graph_kernel_flags          |  Ascend/GPU                |
     |                         +------------------------------+----------------------------+
+    |                         |  recompute_memory_budget     |  CPU/GPU/Ascend            |
+    |                         +------------------------------+----------------------------+
     |                         |  enable_reduce_precision     |  Ascend                    |
     |                         +------------------------------+----------------------------+
     |                         |  auto_tune_mode              |  Ascend                    |
@@ -884,6 +906,11 @@ def set_context(**kwargs):
         disable_format_transform (bool): Whether to disable the automatic format transform function from NCHW to NHWC.
             When the network training performance of fp16 is worse than fp32,
             `disable_format_transform` can be set to True to try to improve training performance. Default: False.
+        recompute_memory_budget (str): Set the memory budget of the activations kept for the backward pass on
+            a device in graph mode. The format is "xxGB". Default: "0GB", which disables the automatic recompute.
+            If the estimated activations exceed the budget, the forward nodes which free the most memory per
+            recomputed FLOP are recomputed in addition to the ones set by `Cell.recompute`, and the chosen plan
+            is reported in the INFO log.
         support_binary (bool): Whether to support run .pyc or .so in graph mode. If want to support run .so or .pyc
             in graph mode, coulde set 'support_binary' to be True, and run once .py file. It would save the source
             of the interfaces would be compiled by MindSpore to the interfaces definition .py file that should be
@@ -916,6 +943,7 @@ def set_context(**kwargs):
         >>> ms.set_context(pynative_synchronize=True)
         >>> ms.set_context(runtime_num_threads=10)
         >>> ms.set_context(disable_format_transform=True)
+        >>> ms.set_context(recompute_memory_budget="20GB")
     """
     ctx = _context()
     # set device target first
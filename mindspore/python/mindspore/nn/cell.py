@@ -2163,7 +2163,9 @@ class Cell(Cell_):
                                    "please check whether the cell where the param locates has been set "
                                    "'pipeline_stage'. Otherwise, the parameter should use 'add_pipeline_stage' "
                                    "to add its stage information".format(param.name))
-            if current_stage in param._pipeline_stage_list:
+            # with interleaved pipeline, the virtual stage s runs on the stage s % stage_num.
+            param_stages = [stage % stage_num for stage in param._pipeline_stage_list]  # pylint: disable=W0212
+            if current_stage in param_stages:
                 params.append(param)
         return params
 
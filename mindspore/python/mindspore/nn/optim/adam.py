@@ -34,10 +34,39 @@ from mindspore.nn.optim._dist_optimizer_registry import _register_dist_optimizer
 
 _adam_opt = C.MultitypeFuncGraph("adam_opt")
 _fused_adam_weight_decay = C.MultitypeFuncGraph("fused_adam_weight_decay")
+_zero_adam_weight_decay = C.MultitypeFuncGraph("zero_adam_weight_decay")
 _scaler_one = Tensor(1, mstype.int32)
 _scaler_ten = Tensor(10, mstype.float32)
 
 
+def _adam_weight_decay_step(beta1, beta2, eps, lr, weight_decay, param, m, v, gradient, decay_flag):
+    """Compute the next parameter, m and v of AdamWeightDecay in float32, without assigning them."""
+    op_mul = P.Mul()
+    op_square = P.Square()
+    op_sqrt = P.Sqrt()
+    op_cast = P.Cast()
+    op_reshape = P.Reshape()
+    op_shape = P.Shape()
+    param_fp32 = op_cast(param, mstype.float32)
+    m_fp32 = op_cast(m, mstype.float32)
+    v_fp32 = op_cast(v, mstype.float32)
+    gradient_fp32 = op_cast(gradient, mstype.float32)
+
+    next_m = op_mul(beta1, m_fp32) + op_mul(op_cast(F.tuple_to_array((1.0,)), mstype.float32)
+                                            - beta1, gradient_fp32)
+
+    next_v = op_mul(beta2, v_fp32) + op_mul(op_cast(F.tuple_to_array((1.0,)), mstype.float32)
+                                            - beta2, op_square(gradient_fp32))
+
+    update = next_m / (eps + op_sqrt(next_v))
+    if decay_flag:
+        update = op_mul(weight_decay, param_fp32) + update
+
+    update_with_lr = op_mul(lr, update)
+    next_param = param_fp32 - op_reshape(update_with_lr, op_shape(param_fp32))
+    return next_param, next_m, next_v
+
+
 @_adam_opt.register("Tensor", "Tensor", "Tensor", "Tensor", "Tensor", "Tensor", "Tensor", "Tensor",
                     "Tensor", "Bool", "Bool")
 def _update_run_op(beta1, beta2, eps, lr, weight_decay, param, m, v, gradient, decay_flag, optim_filter):
@@ -62,30 +91,8 @@ def _update_run_op(beta1, beta2, eps, lr, weight_decay, param, m, v, gradient, d
     """
     op_cast = P.Cast()
     if optim_filter:
-        op_mul = P.Mul()
-        op_square = P.Square()
-        op_sqrt = P.Sqrt()
-        op_cast = P.Cast()
-        op_reshape = P.Reshape()
-        op_shape = P.Shape()
-        param_fp32 = op_cast(param, mstype.float32)
-        m_fp32 = op_cast(m, mstype.float32)
-        v_fp32 = op_cast(v, mstype.float32)
-        gradient_fp32 = op_cast(gradient, mstype.float32)
-
-        next_m = op_mul(beta1, m_fp32) + op_mul(op_cast(F.tuple_to_array((1.0,)), mstype.float32)
-                                                - beta1, gradient_fp32)
-
-        next_v = op_mul(beta2, v_fp32) + op_mul(op_cast(F.tuple_to_array((1.0,)), mstype.float32)
-                                                - beta2, op_square(gradient_fp32))
-
-        update = next_m / (eps + op_sqrt(next_v))
-        if decay_flag:
-            update = op_mul(weight_decay, param_fp32) + update
-
-        update_with_lr = op_mul(lr, update)
-        next_param = param_fp32 - op_reshape(update_with_lr, op_shape(param_fp32))
-
+        next_param, next_m, next_v = _adam_weight_decay_step(beta1, beta2, eps, lr, weight_decay, param, m, v,
+                                                             gradient, decay_flag)
         next_param = F.depend(next_param, F.assign(param, op_cast(next_param, F.dtype(param))))
         next_param = F.depend(next_param, F.assign(m, op_cast(next_m, F.dtype(m))))
         next_param = F.depend(next_param, F.assign(v, op_cast(next_v, F.dtype(v))))
@@ -303,6 +310,29 @@ def _run_fused_adam_weight_decay_opt(opt, beta1, beta2, eps, lr, weight_decay, p
     return True
 
 
+@_zero_adam_weight_decay.register("Function", "Function", "Number", "Tensor", "Tensor", "Tensor", "Tensor", "Tensor",
+                                  "Tensor", "Tensor", "Tensor", "Tensor", "Bool", "Bool")
+def _run_zero_adam_weight_decay_opt(split, allgather, rank, beta1, beta2, eps, lr, weight_decay, param, m, v,
+                                    gradient, decay_flag, shard_flag):
+    """
+    Apply AdamWeightDecay optimizer to the weight parameter sharded by the parallel optimizer on CPU.
+
+    The gradient, m and v of a sharded parameter are the slices of this device along the first dimension. The slice of
+    the parameter is updated and all-gathered into the parameter, the parameters which are not sharded are updated as a
+    whole.
+    """
+    if not shard_flag:
+        return _update_run_op(beta1, beta2, eps, lr, weight_decay, param, m, v, gradient, decay_flag, True)
+    op_cast = P.Cast()
+    param_slice = split(param)[rank]
+    next_param, next_m, next_v = _adam_weight_decay_step(beta1, beta2, eps, lr, weight_decay, param_slice, m, v,
+                                                         gradient, decay_flag)
+    next_param = op_cast(next_param, F.dtype(param))
+    next_param = F.depend(next_param, F.assign(m, op_cast(next_m, F.dtype(m))))
+    next_param = F.depend(next_param, F.assign(v, op_cast(next_v, F.dtype(v))))
+    return F.depend(next_param, F.assign(param, allgather(next_param)))
+
+
 def _check_param_value(beta1, beta2, eps, prim_name):
     """Check the type of inputs."""
     validator.check_value_type("beta1", beta1, [float], prim_name)
@@ -743,8 +773,8 @@ class AdamWeightDecay(Optimizer):
         self.beta1 = Tensor(np.array([beta1]).astype(np.float32))
         self.beta2 = Tensor(np.array([beta2]).astype(np.float32))
         self.eps = Tensor(np.array([eps]).astype(np.float32))
-        self.moments1 = self._parameters.clone(prefix="adam_m", init='zeros')
-        self.moments2 = self._parameters.clone(prefix="adam_v", init='zeros')
+        self.moments1 = self._clone_states(prefix="adam_m", init='zeros')
+        self.moments2 = self._clone_states(prefix="adam_v", init='zeros')
         self.fused_opt = P.AdamWeightDecay()
         if context.get_context("device_target") == "CPU":
             self.use_fused_opt = True
@@ -757,7 +787,21 @@ class AdamWeightDecay(Optimizer):
         weight_decay = self.get_weight_decay()
         lr = self.get_lr()
 
-        if self.use_fused_opt:
+        if self.shard_states:
+            zero_opt = F.partial(_zero_adam_weight_decay, self.shard_split, self.shard_allgather, self.rank,
+                                 self.beta1, self.beta2, self.eps)
+            if self.is_group:
+                if self.is_group_lr:
+                    optim_result = self.hyper_map(zero_opt, lr, weight_decay, self._parameters, self.moments1,
+                                                  self.moments2, gradients, self.decay_flags, self.shard_flags)
+                else:
+                    optim_result = self.hyper_map(F.partial(zero_opt, lr), weight_decay, self._parameters,
+                                                  self.moments1, self.moments2, gradients, self.decay_flags,
+                                                  self.shard_flags)
+            else:
+                optim_result = self.hyper_map(F.partial(zero_opt, lr, weight_decay), self._parameters, self.moments1,
+                                              self.moments2, gradients, self.decay_flags, self.shard_flags)
+        elif self.use_fused_opt:
             if self.is_group:
                 if self.is_group_lr:
                     optim_result = self.hyper_map(
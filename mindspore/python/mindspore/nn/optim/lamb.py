@@ -255,8 +255,8 @@ class Lamb(Optimizer):
         self.beta2 = Tensor(np.array([beta2]).astype(np.float32))
         self.eps = Tensor(np.array([eps]).astype(np.float32))
         self.params = self._parameters
-        self.moments1 = self.params.clone(prefix="lamb_m", init='zeros')
-        self.moments2 = self.params.clone(prefix="lamb_v", init='zeros')
+        self.moments1 = self._clone_states(prefix="lamb_m", init='zeros')
+        self.moments2 = self._clone_states(prefix="lamb_v", init='zeros')
         self.device_ascend = context.get_context("device_target") == "Ascend"
 
     @ms_function
@@ -170,6 +170,7 @@ class Optimizer(Cell):
         self.is_group_lr = False
         self.is_group_params_ordered = False
         self.use_parallel = False
+        self.shard_states = False
         learning_rate = self._preprocess_single_lr(learning_rate)
         if isinstance(parameters[0], dict):
             self.is_group = True
@@ -265,10 +266,11 @@ class Optimizer(Cell):
         if context.get_auto_parallel_context("enable_parallel_optimizer"):
             if _get_parallel_mode() == ParallelMode.DATA_PARALLEL and context.get_context("device_target") == "Ascend":
                 self.use_parallel = True
-            elif _get_parallel_mode() == ParallelMode.DATA_PARALLEL \
-                    and context.get_context("device_target") != "Ascend":
-                raise RuntimeError(f'For "Optimizer", parallel optimizer only supports "Ascend" in data parallel mode, '
-                                   f'but got {context.get_context("device_target")}.')
+            elif _get_parallel_mode() == ParallelMode.DATA_PARALLEL and context.get_context("device_target") == "CPU":
+                self.shard_states = True
+            elif _get_parallel_mode() == ParallelMode.DATA_PARALLEL:
+                raise RuntimeError(f'For "Optimizer", parallel optimizer only supports "Ascend" and "CPU" in data '
+                                   f'parallel mode, but got {context.get_context("device_target")}.')
             elif _get_parallel_mode() in (ParallelMode.STAND_ALONE, ParallelMode.HYBRID_PARALLEL):
                 raise RuntimeError("For 'Optimizer', parallel optimizer is not supported in {}, you should set "
                                    "parallel mode to 'data_parallel', 'semi_auto_parallel' or 'auto_parallel'."
@@ -289,6 +291,32 @@ class Optimizer(Cell):
                 self.param_names.append(param.name)
         else:
             self.optim_filter = (True,) * self.param_length
+        if self.shard_states:
+            self._init_shard_states()
+
+    def _init_shard_states(self):
+        """
+        Shard the parameters along the first dimension on CPU in data parallel mode.
+
+        A sharded parameter keeps its full shape, but its gradient is reduce-scattered and each device keeps the
+        optimizer states of its slice only. The device updates its slice, which is then all-gathered into the
+        parameter. The parameters whose first dimension is not divisible by the number of devices are all-reduced and
+        updated on every device.
+        """
+        if self.cls_name != "AdamWeightDecay":
+            raise RuntimeError("For 'Optimizer', parallel optimizer on CPU only support optimizer 'AdamWeightDecay', "
+                               "but got {}.".format(self.cls_name))
+        if self._use_flattened_params:
+            raise RuntimeError("For 'Optimizer', parallel optimizer on CPU does not support flattened parameters.")
+        self.dev_num = _get_device_num()
+        self.rank = _get_global_rank()
+        shard_filter = lambda x: x.parallel_optimizer and not x.layerwise_parallel and len(x.shape) > 0 \
+            and x.shape[0] % self.dev_num == 0
+        self.shard_flags = tuple(shard_filter(x) for x in self._parameters)
+        for param, shard in zip(self._parameters, self.shard_flags):
+            param.zero_shard = shard
+        self.shard_split = P.Split(0, self.dev_num)
+        self.shard_allgather = P.AllGather()
 
     @property
     def unique(self):
@@ -782,6 +810,34 @@ class Optimizer(Cell):
                 count = 0
         return rank_list
 
+    def _clone_states(self, prefix, init='zeros'):
+        """
+        Clone the optimizer states of the parameters.
+
+        When the states are sharded, the state of a sharded parameter holds the slice of this device along the first
+        dimension. It is marked with `zero_shard`, so that a full-shape state of a checkpoint is sliced when it is
+        loaded.
+
+        Args:
+            prefix (str): Namespace of the states.
+            init (Union[str, numbers.Number]): The initialization method of the states. Default: 'zeros'.
+
+        Returns:
+            ParameterTuple, the states of the parameters.
+        """
+        if not self.shard_states:
+            return self._parameters.clone(prefix=prefix, init=init)
+        states = []
+        for param, shard in zip(self._parameters, self.shard_flags):
+            shape = param.shape
+            if shard:
+                shape = (shape[0] // self.dev_num,) + tuple(shape[1:])
+            state = Parameter(initializer(init, shape=shape, dtype=param.dtype), name=prefix + "." + param.name,
+                              requires_grad=False)
+            state.zero_shard = shard
+            states.append(state)
+        return ParameterTuple(states)
+
     def broadcast_params(self, optim_result):
         """
         Apply Broadcast operations in the sequential order of parameter groups.
@@ -21,7 +21,7 @@ from mindspore.nn.cell import Cell
 from mindspore.communication.management import GlobalComm, get_group_size
 from mindspore.common.tensor import RowTensor
 from mindspore.ops import functional as F, composite as C
-from mindspore.ops.operations.comm_ops import AllReduce, AllGather
+from mindspore.ops.operations.comm_ops import AllReduce, AllGather, ReduceScatter
 from mindspore.parallel._auto_parallel_context import auto_parallel_context
 import mindspore.common.dtype as mstype
 from mindspore.common.tensor import Tensor
@@ -30,6 +30,7 @@ from mindspore.common.api import is_pynative_parallel
 
 
 reduce_opt = C.MultitypeFuncGraph("reduce_opt")
+reduce_scatter_opt = C.MultitypeFuncGraph("reduce_scatter_opt")
 
 
 def _init_allreduce_operators(length, split_indices, group=GlobalComm.WORLD_COMM_GROUP):
@@ -225,6 +226,29 @@ def _tensors_allreduce_with_sparse_ps(degree, mean, allgather, allreduce, allred
     return grad
 
 
+@reduce_scatter_opt.register("Tensor", "Bool", "Function", "Bool", "Tensor")
+def _tensors_reduce_scatter(degree, mean, reduce_scatter, reduce_scatter_filter, grad):
+    """
+    Apply reducescatter on gradient of the parameter sharded by the parallel optimizer on CPU.
+
+    Args:
+        degree (int): The mean coefficient.
+        mean (bool): When mean is true, the mean coefficient (degree) would apply on gradients.
+        reduce_scatter (Primitive): The communication operator for gradients.
+        reduce_scatter_filter (bool): When it is true, reducescatter would apply.
+        grad (Tensor): The gradient tensor before operation.
+
+    Returns:
+        Tensor, the gradient tensor after operation, the slice of this device along the first dimension.
+    """
+    if reduce_scatter_filter:
+        grad = reduce_scatter(grad)
+        if mean:
+            grad = F.tensor_mul(grad, F.cast(degree, F.dtype(grad)))
+        return grad
+    return grad
+
+
 _get_datatype = C.MultitypeFuncGraph("_get_datatype")
 
 
@@ -295,7 +319,8 @@ class DistributedGradReducer(Cell):
     A distributed optimizer.
 
     Constructs a gradient reducer Cell, which applies communication and average operations on
-    single-process gradient values. Used in data parallel.
+    single-process gradient values. Used in data parallel. The gradients of the parameters sharded by the parallel
+    optimizer on CPU are reduce-scattered, so that each device gets the slice it updates.
 
     Args:
         parameters (list): the parameters to be updated.
@@ -395,7 +420,11 @@ class DistributedGradReducer(Cell):
             self.degree = degree
         self.degree = Tensor(1.0 / self.degree, mstype.float32)
         self.mean = mean
-        self.allreduce_filter = tuple(x.layerwise_parallel is False for x in parameters)
+        self.allreduce_filter = tuple(x.layerwise_parallel is False and not x.zero_shard for x in parameters)
+        self.reduce_scatter_filter = tuple(x.zero_shard for x in parameters)
+        self.enable_reduce_scatter = any(self.reduce_scatter_filter)
+        if self.enable_reduce_scatter:
+            self.reduce_scatter = ReduceScatter('sum', group)
         is_parallel_optimizer = context.get_auto_parallel_context("enable_parallel_optimizer")
         split_indices = auto_parallel_context().get_all_reduce_fusion_split_indices()
         if is_parallel_optimizer and split_indices:
@@ -447,5 +476,8 @@ class DistributedGradReducer(Cell):
             else:
                 new_grad = self.map_(F.partial(reduce_opt, self.degree, self.mean, self.allgather,
                                                self.allreduce), self.allreduce_filter, grads)
+        if self.enable_reduce_scatter:
+            new_grad = self.map_(F.partial(reduce_scatter_opt, self.degree, self.mean, self.reduce_scatter),
+                                 self.reduce_scatter_filter, new_grad)
         new_grad = self.map_(F.partial(_cast_datatype), datatypes, new_grad)
         return new_grad
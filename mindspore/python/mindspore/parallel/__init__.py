@@ -15,5 +15,6 @@
 """Interfaces for parallel-related functionality"""
 from .algo_parameter_config import get_algo_parameters, reset_algo_parameters, \
     set_algo_parameters
+from .pipeline_partition import partition_pipeline_stages
 
-__all__ = ["set_algo_parameters", "reset_algo_parameters", "get_algo_parameters"]
+__all__ = ["set_algo_parameters", "reset_algo_parameters", "get_algo_parameters", "partition_pipeline_stages"]
@@ -284,6 +284,22 @@ class _AutoParallelContext:
         self.check_context_handle()
         return self._context_handle.get_pipeline_stage_split_num()
 
+    def set_pipeline_interleave_num(self, interleave_num):
+        """Set the number of virtual stages run by every pipeline stage"""
+        if isinstance(interleave_num, bool) or not isinstance(interleave_num, int):
+            raise TypeError("For 'set_auto_parallel_context', the argument 'pipeline_interleave_num' "
+                            "must be int, but got the type : {}.".format(type(interleave_num)))
+        if interleave_num < 1:
+            raise ValueError("For 'set_auto_parallel_context', the argument 'pipeline_interleave_num' "
+                             "should be greater or equal 1, but got the value : {}.".format(interleave_num))
+        self.check_context_handle()
+        self._context_handle.set_pipeline_interleave_num(interleave_num)
+
+    def get_pipeline_interleave_num(self):
+        """Get the number of virtual stages run by every pipeline stage"""
+        self.check_context_handle()
+        return self._context_handle.get_pipeline_interleave_num()
+
     def set_gradients_mean(self, gradients_mean):
         """
         Set gradients_mean flag.
@@ -959,6 +975,7 @@ _set_auto_parallel_context_func_map = {
     "gradient_fp32_sync": auto_parallel_context().set_gradient_fp32_sync,
     "loss_repeated_mean": auto_parallel_context().set_loss_repeated_mean,
     "pipeline_stages": auto_parallel_context().set_pipeline_stages,
+    "pipeline_interleave_num": auto_parallel_context().set_pipeline_interleave_num,
     "parallel_mode": auto_parallel_context().set_parallel_mode,
     "search_mode": auto_parallel_context().set_strategy_search_mode,
     "auto_parallel_search_mode": auto_parallel_context().set_auto_parallel_search_mode,
@@ -987,6 +1004,7 @@ _get_auto_parallel_context_func_map = {
     "gradient_fp32_sync": auto_parallel_context().get_gradient_fp32_sync,
     "loss_repeated_mean": auto_parallel_context().get_loss_repeated_mean,
     "pipeline_stages": auto_parallel_context().get_pipeline_stages,
+    "pipeline_interleave_num": auto_parallel_context().get_pipeline_interleave_num,
     "parallel_mode": auto_parallel_context().get_parallel_mode,
     "search_mode": auto_parallel_context().get_strategy_search_mode,
     "auto_parallel_search_mode": auto_parallel_context().get_auto_parallel_search_mode,
@@ -1012,7 +1030,8 @@ _get_auto_parallel_context_func_map = {
                  strategy_ckpt_save_file=str, full_batch=bool, enable_parallel_optimizer=bool,
                  grad_accumulation_step=int, all_reduce_fusion_config=list, group_ckpt_save_file=str,
                  communi_parallel_mode=str, optimizer_weight_shard_size=int, sharding_propagation=bool,
-                 optimizer_weight_shard_aggregated_save=bool, enable_alltoall=bool, comm_fusion=dict)
+                 optimizer_weight_shard_aggregated_save=bool, enable_alltoall=bool, comm_fusion=dict,
+                 pipeline_interleave_num=int)
 
 def _set_auto_parallel_context(**kwargs):
     """
@@ -1066,6 +1085,9 @@ def _set_auto_parallel_context(**kwargs):
                         the devices are distributed alone the pipeline. The total devices will be divided into
                         'pipeline_stags' stages. This currently could only be used when
                         parallel mode semi_auto_parallel is enabled. Default: 0
+        pipeline_interleave_num (int): Set the number of virtual stages every pipeline stage runs. The cells are
+                        labeled with 'pipeline_stages' * 'pipeline_interleave_num' virtual stages, and the virtual
+                        stage s runs on the stage s % 'pipeline_stages'. Default: 1
         communi_parallel_mode (str): There are tree kinds of communication parallel modes, "all_group_parallel",
                      "same_server_group_parallel" and "no_group_parallel". Default: "all_group_parallel".
 
@@ -1142,6 +1164,7 @@ def _reset_auto_parallel_context():
     - auto_parallel_search_mode: dynamic_programming
     - sharding_propagation: False
     - pipeline_stages: 0
+    - pipeline_interleave_num: 1
     - gradient_accumulation_shard: True
     - fusion_threshold: 64
     """
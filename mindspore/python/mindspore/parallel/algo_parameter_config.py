@@ -175,6 +175,27 @@ class _AlgoParameterConfig:
         self.check_config_handle()
         return self._config_handle.get_dp_algo_approxi_epsilon()
 
+    def set_rec_algo_enable_coarsening(self, enable_flag):
+        """
+        Set the flag of whether to enable the coarsening in the recursive programming algorithm.
+        Default: False.
+
+        Args:
+            enable_flag (bool): The flag.
+        """
+        self.check_config_handle()
+        self._config_handle.set_rec_algo_enable_coarsening(enable_flag)
+
+    def get_rec_algo_enable_coarsening(self):
+        """
+        Get the flag of whether to enable the coarsening in the recursive programming algorithm.
+
+        Returns:
+            The flag.
+        """
+        self.check_config_handle()
+        return self._config_handle.get_rec_algo_enable_coarsening()
+
     def reset_algo_parameters(self):
         """
         Reset algorithm parameter attributes.
@@ -205,7 +226,8 @@ set_algo_parameters_config_func_map = {
     "tensor_slice_align_enable": _algo_parameter_config().set_tensor_slice_align_enable,
     "tensor_slice_align_size": _algo_parameter_config().set_tensor_slice_align_size,
     "enable_algo_approxi": _algo_parameter_config().set_dp_algo_enable_approxi,
-    "algo_approxi_epsilon": _algo_parameter_config().set_dp_algo_approxi_epsilon}
+    "algo_approxi_epsilon": _algo_parameter_config().set_dp_algo_approxi_epsilon,
+    "enable_rec_coarsening": _algo_parameter_config().set_rec_algo_enable_coarsening}
 
 
 get_algo_parameters_config_func_map = {
@@ -214,12 +236,13 @@ get_algo_parameters_config_func_map = {
     "tensor_slice_align_enable": _algo_parameter_config().get_tensor_slice_align_enable,
     "tensor_slice_align_size": _algo_parameter_config().get_tensor_slice_align_size,
     "enable_algo_approxi": _algo_parameter_config().get_dp_algo_enable_approxi,
-    "algo_approxi_epsilon": _algo_parameter_config().get_dp_algo_approxi_epsilon}
+    "algo_approxi_epsilon": _algo_parameter_config().get_dp_algo_approxi_epsilon,
+    "enable_rec_coarsening": _algo_parameter_config().get_rec_algo_enable_coarsening}
 
 
 @args_type_check(tensor_slice_align_enable=bool, tensor_slice_align_size=int,
                  fully_use_devices=bool, elementwise_op_strategy_follow=bool,
-                 enable_algo_approxi=bool, algo_approxi_epsilon=float)
+                 enable_algo_approxi=bool, algo_approxi_epsilon=float, enable_rec_coarsening=bool)
 def set_algo_parameters(**kwargs):
     """
     Set parameters in the algorithm for parallel strategy searching. See a typical use in
@@ -250,6 +273,10 @@ def set_algo_parameters(**kwargs):
         tensor_slice_align_size (int): The minimum tensor slice shape of MatMul, the value must be in [1, 1024].
             Default: 16. If 'tensor_slice_align_enable' is set true, then the slice size of last dimension of MatMul
             tensors should be multiple of this value.
+        enable_rec_coarsening (bool): Whether to coarsen the graph in the recursive programming algorithm. Default:
+            False. If this flag is set true, the isomorphic operators, such as the ones of the repeated layers of a
+            transformer, are searched once and share the strategy, so that the searching time grows with the number of
+            distinct layers rather than all layers.
 
     Raises:
         ValueError: If context keyword is not recognized.
@@ -271,7 +298,7 @@ def get_algo_parameters(attr_key):
     Args:
         attr_key (str): The key of the attribute. The keys include: "fully_use_devices",
             "elementwise_op_strategy_follow", "enable_algo_approxi", "algo_approxi_epsilon",
-            "tensor_slice_align_enable","tensor_slice_align_size".
+            "tensor_slice_align_enable","tensor_slice_align_size", "enable_rec_coarsening".
 
     Returns:
         Return attribute value according to the key.
@@ -299,5 +326,6 @@ def reset_algo_parameters():
     - algo_approxi_epsilon: 0.1.
     - tensor_slice_align_enable: False.
     - tensor_slice_align_size: 16.
+    - enable_rec_coarsening: False.
     """
     _algo_parameter_config().reset_algo_parameters()
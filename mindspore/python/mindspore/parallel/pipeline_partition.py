@@ -0,0 +1,256 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+"""Partition the layers of a network into pipeline stages by their costs"""
+
+import numpy as np
+from mindspore import context
+from mindspore import log as logger
+from mindspore._checkparam import Validator as validator
+
+__all__ = ["partition_pipeline_stages"]
+
+# The static memory of a parameter is estimated as the parameter, its gradient and two optimizer states.
+_STATIC_MEMORY_FACTOR = 4
+_INF = float("inf")
+
+
+def _check_costs(costs, layer_num, arg_name):
+    """Check the per-layer costs, None means zero costs."""
+    if costs is None:
+        return [0.0] * layer_num
+    validator.check_value_type(arg_name, costs, [list, tuple], "partition_pipeline_stages")
+    if len(costs) != layer_num:
+        raise ValueError(f"For 'partition_pipeline_stages', the length of '{arg_name}' must be equal to the number of "
+                         f"layers {layer_num}, but got {len(costs)}.")
+    for cost in costs:
+        validator.check_value_type(arg_name, cost, [int, float], "partition_pipeline_stages")
+        if cost < 0:
+            raise ValueError(f"For 'partition_pipeline_stages', the values of '{arg_name}' must be non-negative, but "
+                             f"got {cost}.")
+    return [float(cost) for cost in costs]
+
+
+def _param_count(layer):
+    return sum(int(np.prod(param.shape)) for param in layer.trainable_params())
+
+
+def _param_bytes(layer):
+    return sum(int(np.prod(param.shape)) * param.itemsize for param in layer.trainable_params())
+
+
+class _StageCostModel:
+    """
+    The costs of a contiguous range of layers as a pipeline stage.
+
+    A stage [begin, end) computes its layers, receives the output of the layer begin - 1 and sends the output of the
+    layer end - 1. Its memory is the static memory of its layers and the activations of the micro batches in flight,
+    with 1F1B the stage s holds the activations of at most stage_num - s micro batches.
+    """
+    def __init__(self, compute_costs, memory_costs, activation_costs, comm_costs, micro_batch_num):
+        self.layer_num = len(compute_costs)
+        self.compute_sum = np.concatenate(([0.0], np.cumsum(compute_costs)))
+        self.memory_sum = np.concatenate(([0.0], np.cumsum(memory_costs)))
+        self.activation_sum = np.concatenate(([0.0], np.cumsum(activation_costs)))
+        self.comm_costs = comm_costs
+        self.micro_batch_num = micro_batch_num
+
+    def time(self, begin, end):
+        cost = self.compute_sum[end] - self.compute_sum[begin]
+        if begin > 0:
+            cost += self.comm_costs[begin - 1]
+        if end < self.layer_num:
+            cost += self.comm_costs[end - 1]
+        return float(cost)
+
+    def memory(self, begin, end, stage, stage_num):
+        in_flight = min(self.micro_batch_num, stage_num - stage)
+        activations = self.activation_sum[end] - self.activation_sum[begin]
+        return float(self.memory_sum[end] - self.memory_sum[begin] + in_flight * activations)
+
+
+def _pareto_labels(candidates):
+    """Keep the candidates (cost, memory, prev) not dominated by another one in both the cost and the memory."""
+    labels = {}
+    for cost, memory, prev in sorted(candidates, key=lambda x: (x[0], sum(x[1]))):
+        if any(all(m <= n for m, n in zip(kept, memory)) for kept in labels):
+            continue
+        labels[memory] = (cost, prev)
+    return labels
+
+
+def _partition(cost_model, stage_num, interleave_num, memory_limit, max_stage_time):
+    """
+    Split the layers into stage_num * interleave_num contiguous virtual stages, the virtual stage k runs on the device
+    of the stage k % stage_num, and the memory of the virtual stages of every device must fit memory_limit. With
+    max_stage_time None, the slowest virtual stage is minimized, otherwise the total time of the virtual stages not
+    slower than max_stage_time is minimized. Returns the first layer of every virtual stage, or None if no split fits.
+    """
+    layer_num = cost_model.layer_num
+    chunk_num = stage_num * interleave_num
+    # labels[k][i] maps the memory of the devices holding more virtual stages after the first k ones to the cost of
+    # putting the first i layers into k virtual stages and the previous label, only the non-dominated ones are kept.
+    labels = [[{} for _ in range(layer_num + 1)] for _ in range(chunk_num + 1)]
+    labels[0][0][(0.0,) * stage_num] = (0.0, None)
+    for k in range(1, chunk_num + 1):
+        device = (k - 1) % stage_num
+        last_chunk = k + stage_num > chunk_num
+        # every virtual stage keeps at least one layer.
+        for i in range(k, layer_num - (chunk_num - k) + 1):
+            candidates = []
+            for j in range(k - 1, i):
+                stage_time = cost_model.time(j, i)
+                if max_stage_time is not None and stage_time > max_stage_time:
+                    continue
+                stage_memory = cost_model.memory(j, i, k - 1, chunk_num)
+                for memory, (prev_cost, _) in labels[k - 1][j].items():
+                    device_memory = memory[device] + stage_memory
+                    if device_memory > memory_limit:
+                        continue
+                    cost = max(prev_cost, stage_time) if max_stage_time is None else prev_cost + stage_time
+                    next_memory = list(memory)
+                    next_memory[device] = 0.0 if last_chunk else device_memory
+                    candidates.append((cost, tuple(next_memory), (j, memory)))
+            labels[k][i] = _pareto_labels(candidates)
+    final_labels = labels[chunk_num][layer_num]
+    if not final_labels:
+        return None
+    memory = min(final_labels, key=lambda x: final_labels[x][0])
+    begins = []
+    end = layer_num
+    for k in range(chunk_num, 0, -1):
+        end, memory = labels[k][end][memory][1]
+        begins.append(end)
+    return begins[::-1]
+
+
+def partition_pipeline_stages(layers, micro_batch_num, compute_costs=None, memory_costs=None, activation_costs=None,
+                              comm_costs=None, memory_limit=None):
+    """
+    Partition the sequential layers of a network into the pipeline stages by their costs and set the `pipeline_stage`
+    of the layers, instead of splitting the layers evenly by hand.
+
+    The layers are split into contiguous stages whose memory fits `memory_limit`. The slowest stage is minimized first,
+    as it bounds the throughput in the steady state, then the total time of the stages, which adds the communication
+    between the stages and the pipeline bubble. With `pipeline_interleave_num` set in the auto parallel context, the
+    layers are split into `pipeline_stages * pipeline_interleave_num` virtual stages.
+
+    The costs are profiled or estimated per layer, in any consistent unit. The compute costs default to the number of
+    parameters of a layer, which is proportional to the FLOPs of the dense layers. The memory costs default to four
+    times the bytes of the parameters of a layer, counting the gradients and two optimizer states.
+
+    Note:
+        The interface works in semi-auto and auto parallel mode with `pipeline_stages` larger than 1, and it is called
+        before the network is compiled. With the interleaved pipeline, the virtual stage `s` runs on the devices of the
+        stage `s % pipeline_stages`, and the memory of all the virtual stages of a device is checked against
+        `memory_limit`.
+
+    Args:
+        layers (Union[list[Cell], tuple[Cell], CellList]): The layers of the network, in the order of execution.
+        micro_batch_num (int): The number of micro batches, the same as `micro_size` of the PipelineCell.
+        compute_costs (Union[list[float], tuple[float]]): The time of the forward and backward of a layer for one micro
+            batch. Default: None.
+        memory_costs (Union[list[float], tuple[float]]): The static memory of a layer, such as its parameters and
+            optimizer states. Default: None.
+        activation_costs (Union[list[float], tuple[float]]): The memory of the activations a layer keeps for the
+            backward of one micro batch. Default: None, zero activation memory.
+        comm_costs (Union[list[float], tuple[float]]): The time of sending the output of a layer to the next stage
+            and receiving its gradient, for one micro batch. Default: None, no communication cost.
+        memory_limit (float): The memory of a device, in the unit of the memory costs. Default: None, no limit.
+
+    Returns:
+        dict, the partition with the keys
+
+        - stages (list[int]): The pipeline stage of every layer, the virtual stage with the interleaved pipeline.
+        - stage_times (list[float]): The time of every stage for one micro batch, of every virtual stage with the
+          interleaved pipeline.
+        - stage_memory (list[float]): The memory of the devices of every stage, summing its virtual stages.
+        - bubble (float): The expected ratio of the time the devices are idle in an iteration.
+        - throughput (float): The expected micro batches per unit of time.
+
+    Raises:
+        RuntimeError: If `pipeline_stages` is 1 or there are fewer layers than stages.
+        ValueError: If the length of a cost list is not the number of layers, or no partition fits `memory_limit`.
+
+    Examples:
+        >>> from mindspore import context, nn
+        >>> from mindspore.parallel import partition_pipeline_stages
+        >>> context.set_auto_parallel_context(parallel_mode="semi_auto_parallel", device_num=8, pipeline_stages=2)
+        >>> layers = nn.CellList([nn.Dense(64, 64) for _ in range(4)])
+        >>> result = partition_pipeline_stages(layers, micro_batch_num=4, compute_costs=[3, 1, 1, 1])
+        >>> print(result["stages"])
+        [0, 1, 1, 1]
+    """
+    # imported here, mindspore.nn imports mindspore.parallel.
+    from mindspore.nn.cell import Cell
+    layers = list(layers)
+    for layer in layers:
+        validator.check_value_type("layer", layer, [Cell], "partition_pipeline_stages")
+    validator.check_positive_int(micro_batch_num, "micro_batch_num", "partition_pipeline_stages")
+    stage_num = context.get_auto_parallel_context("pipeline_stages")
+    interleave_num = context.get_auto_parallel_context("pipeline_interleave_num")
+    chunk_num = stage_num * interleave_num
+    if stage_num <= 1:
+        raise RuntimeError("For 'partition_pipeline_stages', the 'pipeline_stages' in the auto parallel context must "
+                           f"be larger than 1, but got {stage_num}.")
+    layer_num = len(layers)
+    if layer_num < chunk_num:
+        raise RuntimeError(f"For 'partition_pipeline_stages', the number of layers {layer_num} must not be less than "
+                           f"the number of stages {chunk_num}.")
+    if compute_costs is None:
+        compute_costs = [_param_count(layer) for layer in layers]
+    if memory_costs is None:
+        memory_costs = [_STATIC_MEMORY_FACTOR * _param_bytes(layer) for layer in layers]
+    compute_costs = _check_costs(compute_costs, layer_num, "compute_costs")
+    memory_costs = _check_costs(memory_costs, layer_num, "memory_costs")
+    activation_costs = _check_costs(activation_costs, layer_num, "activation_costs")
+    comm_costs = _check_costs(comm_costs, layer_num, "comm_costs")
+    if memory_limit is None:
+        device_memory_limit = _INF
+    else:
+        validator.check_value_type("memory_limit", memory_limit, [int, float], "partition_pipeline_stages")
+        device_memory_limit = float(memory_limit)
+
+    cost_model = _StageCostModel(compute_costs, memory_costs, activation_costs, comm_costs, micro_batch_num)
+    begins = _partition(cost_model, stage_num, interleave_num, device_memory_limit, None)
+    if begins is None:
+        raise ValueError(f"For 'partition_pipeline_stages', the layers can not be split into {chunk_num} stages "
+                         f"within the memory limit {memory_limit}.")
+    ends = begins[1:] + [layer_num]
+    max_stage_time = max(cost_model.time(begin, end) for begin, end in zip(begins, ends))
+    begins = _partition(cost_model, stage_num, interleave_num, device_memory_limit, max_stage_time)
+    ends = begins[1:] + [layer_num]
+
+    stages = []
+    for stage, (begin, end) in enumerate(zip(begins, ends)):
+        stages.extend([stage] * (end - begin))
+    for layer, stage in zip(layers, stages):
+        layer.pipeline_stage = stage
+    stage_times = [cost_model.time(begin, end) for begin, end in zip(begins, ends)]
+    stage_memory = [0.0] * stage_num
+    for stage, (begin, end) in enumerate(zip(begins, ends)):
+        stage_memory[stage % stage_num] += cost_model.memory(begin, end, stage, chunk_num)
+
+    # With 1F1B, an iteration runs micro_batch_num * interleave_num units of the slowest virtual stage, plus filling
+    # and draining the pipeline once, which takes the time of a micro batch through one chunk of every stage.
+    total_time = sum(stage_times)
+    iteration_time = (micro_batch_num * interleave_num - 1) * max(stage_times) + total_time / interleave_num
+    busy_time = micro_batch_num * total_time / stage_num
+    bubble = 1.0 - busy_time / iteration_time if iteration_time > 0 else 0.0
+    throughput = micro_batch_num / iteration_time if iteration_time > 0 else _INF
+    logger.info(f"Pipeline partition: stages of the layers {stages}, stage times {stage_times}, stage memory "
+                f"{stage_memory}, expected bubble {bubble}, expected throughput {throughput} micro batches per unit "
+                f"of time.")
+    return {"stages": stages, "stage_times": stage_times, "stage_memory": stage_memory, "bubble": bubble,
+            "throughput": throughput}
@@ -54,7 +54,7 @@ from mindspore.compression.export import quant_export
 from mindspore.parallel._cell_wrapper import get_allgather_cell
 from mindspore.parallel._tensor import _load_tensor, _get_tensor_strategy, _get_tensor_slice_index
 from mindspore.parallel._tensor import _reshape_param_data, _reshape_param_data_with_weight
-from mindspore.parallel._utils import _infer_rank_list, _remove_repeated_slices
+from mindspore.parallel._utils import _infer_rank_list, _remove_repeated_slices, _get_device_num, _get_global_rank
 from mindspore.train._utils import read_proto
 from mindspore._c_expression import load_mindir, _encrypt, _decrypt, _is_cipher_file
 
@@ -103,10 +103,29 @@ def _special_process_par(par, new_par):
     return True
 
 
+def _slice_zero_shard_par(par, new_par):
+    """
+    Processes the optimizer state sharded by the parallel optimizer on CPU, whose data in the checkpoint is full-shape.
+
+    Returns:
+        Bool. True if the slice of this device along the first dimension is loaded.
+    """
+    if not par.zero_shard:
+        return False
+    dev_num = _get_device_num()
+    if new_par.data.shape != (par.data.shape[0] * dev_num,) + tuple(par.data.shape[1:]):
+        return False
+    new_val = np.split(new_par.data.asnumpy(), dev_num)[_get_global_rank()]
+    par.set_data(Tensor(new_val, par.data.dtype))
+    return True
+
+
 def _update_param(param, new_param, strict_load):
     """Updates param's data from new_param's data."""
     if isinstance(param.data, Tensor) and isinstance(new_param.data, Tensor):
         if param.data.shape != new_param.data.shape:
+            if _slice_zero_shard_par(param, new_param):
+                return
             if not _special_process_par(param, new_param):
                 logger.critical("Failed to combine the net and the parameters for param %s.", param.name)
                 msg = (f"For 'load_param_into_net', {param.name} in the argument 'net' should have the same shape "
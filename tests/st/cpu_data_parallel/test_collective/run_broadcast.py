@@ -0,0 +1,51 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+"""define and run Broadcast network"""
+
+import numpy as np
+
+from mindspore import Tensor
+from mindspore import context
+from mindspore import nn
+from mindspore.ops import operations as P
+from mindspore.communication.management import init, get_rank
+
+context.set_context(mode=context.GRAPH_MODE, device_target='CPU')
+context.set_ps_context(enable_ssl=False)
+init()
+
+
+class Net(nn.Cell):
+    def __init__(self, root_rank):
+        super(Net, self).__init__()
+        self.broadcast = P.Broadcast(root_rank)
+
+    def construct(self, x, y):
+        return self.broadcast((x, y))
+
+
+def run_broadcast(root_rank):
+    """ Run broadcast from the root rank"""
+    broadcast = Net(root_rank)
+    x_np = np.arange(2 * 3).reshape((2, 3)).astype(np.float32)
+    y_np = np.arange(3 * 4).reshape((3, 4)).astype(np.float32)
+    output = broadcast(Tensor(x_np * (get_rank() + 1)), Tensor(y_np - get_rank()))
+    assert np.array_equal(output[0].asnumpy(), x_np * (root_rank + 1))
+    assert np.array_equal(output[1].asnumpy(), y_np - root_rank)
+
+
+run_broadcast(0)
+run_broadcast(3)
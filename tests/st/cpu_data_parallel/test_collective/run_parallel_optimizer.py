@@ -0,0 +1,75 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+"""train a network with the parallel optimizer in data parallel mode"""
+
+import numpy as np
+
+from mindspore import Tensor
+from mindspore import context
+from mindspore import nn
+from mindspore.common.initializer import TruncatedNormal
+from mindspore.communication.management import init, get_group_size
+from mindspore.context import ParallelMode
+
+context.set_context(mode=context.GRAPH_MODE, device_target='CPU')
+context.set_ps_context(enable_ssl=False)
+init()
+
+STEPS = 5
+
+
+class Net(nn.Cell):
+    def __init__(self):
+        super(Net, self).__init__()
+        # The first layer is divisible by the 8 workers along the first dimension, the second one is not.
+        self.fc1 = nn.Dense(16, 8, weight_init=TruncatedNormal(0.1), activation='relu')
+        self.fc2 = nn.Dense(8, 3, weight_init=TruncatedNormal(0.1))
+
+    def construct(self, x):
+        return self.fc2(self.fc1(x))
+
+
+def train(net, data, label):
+    """ Train the network with AdamWeightDecay and return the losses"""
+    optimizer = nn.AdamWeightDecay(net.trainable_params(), learning_rate=0.01, weight_decay=0.1)
+    train_net = nn.TrainOneStepCell(nn.WithLossCell(net, nn.MSELoss()), optimizer)
+    train_net.set_train()
+    losses = [train_net(data, label).asnumpy() for _ in range(STEPS)]
+    return losses, optimizer
+
+
+def run_parallel_optimizer():
+    """ Every worker trains on the same data, so the sharded run matches the standalone run"""
+    data = Tensor(np.random.RandomState(0).randn(4, 16).astype(np.float32))
+    label = Tensor(np.random.RandomState(1).randn(4, 3).astype(np.float32))
+    standalone_net = Net()
+    sharded_net = Net()
+    for param, standalone_param in zip(sharded_net.trainable_params(), standalone_net.trainable_params()):
+        param.set_data(Tensor(standalone_param.asnumpy()))
+    standalone_losses, _ = train(standalone_net, data, label)
+
+    context.set_auto_parallel_context(parallel_mode=ParallelMode.DATA_PARALLEL, gradients_mean=True,
+                                      device_num=get_group_size(), enable_parallel_optimizer=True)
+    sharded_losses, optimizer = train(sharded_net, data, label)
+    assert optimizer.shard_flags == (True, True, False, False)
+    for moment, shard in zip(optimizer.moments1, optimizer.shard_flags):
+        assert moment.shape[0] == (1 if shard else 3)
+    assert np.allclose(sharded_losses, standalone_losses, rtol=1e-4, atol=1e-5)
+    for param, standalone_param in zip(sharded_net.trainable_params(), standalone_net.trainable_params()):
+        assert np.allclose(param.asnumpy(), standalone_param.asnumpy(), rtol=1e-4, atol=1e-5)
+
+
+run_parallel_optimizer()
@@ -0,0 +1,53 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+"""define and run ReduceScatter and AllGather network"""
+
+import numpy as np
+
+from mindspore import Tensor
+from mindspore import context
+from mindspore import nn
+from mindspore.ops import operations as P
+from mindspore.communication.management import init, get_rank, get_group_size
+
+context.set_context(mode=context.GRAPH_MODE, device_target='CPU')
+context.set_ps_context(enable_ssl=False)
+init()
+
+
+class Net(nn.Cell):
+    def __init__(self):
+        super(Net, self).__init__()
+        self.reduce_scatter = P.ReduceScatter(P.ReduceOp.SUM)
+        self.all_gather = P.AllGather()
+
+    def construct(self, x):
+        y = self.reduce_scatter(x)
+        return y, self.all_gather(y)
+
+
+def run_reduce_scatter_all_gather():
+    """ Run reduce scatter and all gather"""
+    net = Net()
+    rank_size = get_group_size()
+    x_np = np.arange(rank_size * 2 * 3).reshape((rank_size * 2, 3)).astype(np.float32)
+    output = net(Tensor(x_np * (get_rank() + 1)))
+    expected = x_np * (rank_size * (rank_size + 1) // 2)
+    assert np.array_equal(output[0].asnumpy(), np.split(expected, rank_size)[get_rank()])
+    assert np.array_equal(output[1].asnumpy(), expected)
+
+
+run_reduce_scatter_all_gather()
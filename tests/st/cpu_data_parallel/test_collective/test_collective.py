@@ -0,0 +1,66 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+
+"""test collective ops and the parallel optimizer on CPU"""
+
+import os
+import sys
+
+import pytest
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_broadcast():
+    """
+    Feature: CPU data parallel.
+    Description: Test Broadcast op from rank 0 and from rank 3 on CPU.
+    Expectation: Each node obtains the tensors of the root.
+    """
+    if sys.platform != 'linux':
+        return
+    return_code = os.system("bash build_collective_net_cluster.sh run_broadcast.py 8125")
+    assert return_code == 0
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_reduce_scatter_all_gather():
+    """
+    Feature: CPU data parallel.
+    Description: Test ReduceScatter op and AllGather op on CPU.
+    Expectation: Each node obtains its slice of the reduced tensor, and the gathered slices make the reduced tensor.
+    """
+    if sys.platform != 'linux':
+        return
+    return_code = os.system("bash build_collective_net_cluster.sh run_reduce_scatter_all_gather.py 8126")
+    assert return_code == 0
+
+
+@pytest.mark.level0
+@pytest.mark.platform_x86_cpu
+@pytest.mark.env_onecard
+def test_parallel_optimizer():
+    """
+    Feature: CPU data parallel.
+    Description: Train a network with AdamWeightDecay and the parallel optimizer on CPU, every node feeds the same data.
+    Expectation: The moments are sharded, the losses and the parameters are the same as the standalone training.
+    """
+    if sys.platform != 'linux':
+        return
+    return_code = os.system("bash build_collective_net_cluster.sh run_parallel_optimizer.py 8127")
+    assert return_code == 0
@@ -0,0 +1,103 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "common/common_test.h"
+#include "debug/data_dump/dump_file_writer.h"
+
+namespace mindspore {
+class TestDumpFileWriter : public UT::Common {
+ public:
+  TestDumpFileWriter() {}
+
+  void TearDown() override { DumpFileWriter::GetInstance().Finalize(); }
+
+  // Write the files into memory, the files whose path starts with "fail" are not written.
+  DumpFileWriter::WriteFunc MemoryWriter(bool slow = false) {
+    return [this, slow](const std::string &file_path, const std::string &header, const void *data, size_t len) {
+      if (slow) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+      if (file_path.rfind("fail", 0) == 0) {
+        return false;
+      }
+      std::lock_guard<std::mutex> lock(lock_);
+      files_[file_path] = header + std::string(static_cast<const char *>(data), len);
+      return true;
+    };
+  }
+
+  std::mutex lock_;
+  std::map<std::string, std::string> files_;
+};
+
+/// Feature: Asynchronous dump file writer.
+/// Description: Submit files to the writer threads and reuse the submitted buffer.
+/// Expectation: Flush returns after all the files are written with the data at the time of Submit.
+TEST_F(TestDumpFileWriter, test_async_write) {
+  auto &writer = DumpFileWriter::GetInstance();
+  writer.Init(2, 16);
+  ASSERT_TRUE(writer.enabled());
+  std::vector<char> data(10);
+  for (size_t i = 0; i < 8; ++i) {
+    std::fill(data.begin(), data.end(), static_cast<char>('a' + i));
+    ASSERT_TRUE(writer.Submit("file" + std::to_string(i), "h", data.data(), data.size(), MemoryWriter(true)));
+  }
+  ASSERT_TRUE(writer.Flush());
+  ASSERT_EQ(files_.size(), 8);
+  ASSERT_EQ(files_["file3"], "h" + std::string(10, 'd'));
+}
+
+/// Feature: Asynchronous dump file writer.
+/// Description: Submit files whose writing fails, with and without writer threads.
+/// Expectation: The failure is returned by Submit in synchronous mode and by the next Flush in asynchronous mode.
+TEST_F(TestDumpFileWriter, test_write_error) {
+  auto &writer = DumpFileWriter::GetInstance();
+  char data[4] = {0};
+  writer.Init(0, 0);
+  ASSERT_FALSE(writer.enabled());
+  ASSERT_FALSE(writer.Submit("fail0", "", data, sizeof(data), MemoryWriter()));
+  ASSERT_TRUE(writer.Submit("file0", "", data, sizeof(data), MemoryWriter()));
+
+  writer.Init(1, 1024);
+  ASSERT_TRUE(writer.Submit("fail1", "", data, sizeof(data), MemoryWriter()));
+  ASSERT_TRUE(writer.Submit("file1", "", data, sizeof(data), MemoryWriter()));
+  ASSERT_FALSE(writer.Flush());
+  ASSERT_TRUE(writer.Flush());
+  ASSERT_EQ(files_.size(), 2);
+}
+
+/// Feature: Asynchronous dump file writer.
+/// Description: Finalize the writer with files still staged.
+/// Expectation: The staged files are written and the writer falls back to synchronous writing.
+TEST_F(TestDumpFileWriter, test_finalize) {
+  auto &writer = DumpFileWriter::GetInstance();
+  writer.Init(1, 1024);
+  char data[4] = {0};
+  for (size_t i = 0; i < 5; ++i) {
+    ASSERT_TRUE(writer.Submit("file" + std::to_string(i), "", data, sizeof(data), MemoryWriter(true)));
+  }
+  writer.Finalize();
+  ASSERT_FALSE(writer.enabled());
+  ASSERT_EQ(files_.size(), 5);
+  ASSERT_TRUE(writer.Submit("file5", "", data, sizeof(data), MemoryWriter()));
+  ASSERT_EQ(files_.size(), 6);
+}
+}  // namespace mindspore
@@ -0,0 +1,116 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifdef ENABLE_DEBUGGER
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "common/common_test.h"
+#include "debug/data_dump/tensor_stat_stream.h"
+
+namespace mindspore {
+class TestTensorStatStream : public UT::Common {
+ public:
+  TestTensorStatStream() {}
+};
+
+/// Feature: Statistic dump on CPU.
+/// Description: Compute the statistics of a float32 tensor with nan, inf, zeros and a tail shorter than the lanes.
+/// Expectation: The non-finite values are counted but excluded from max, min and the average.
+TEST_F(TestTensorStatStream, test_float_stat) {
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+  std::vector<float> data = {1.0, -2.0, 0.0, 3.5, NAN, kInf, -kInf, 0.0, 4.0, -1.5, 2.0};
+  TensorStatValues stat;
+  ASSERT_TRUE(ComputeHostTensorStat(data.data(), data.size() * sizeof(float), kNumberTypeFloat32, &stat));
+  ASSERT_EQ(stat.data_size, data.size() * sizeof(float));
+  ASSERT_EQ(stat.count, data.size());
+  ASSERT_DOUBLE_EQ(stat.max_value, 4.0);
+  ASSERT_DOUBLE_EQ(stat.min_value, -2.0);
+  ASSERT_DOUBLE_EQ(stat.avg_value, 7.0 / 8);
+  ASSERT_EQ(stat.nan_count, 1);
+  ASSERT_EQ(stat.pos_inf_count, 1);
+  ASSERT_EQ(stat.neg_inf_count, 1);
+  ASSERT_EQ(stat.zero_count, 2);
+  ASSERT_EQ(stat.pos_zero_count, 4);
+  ASSERT_EQ(stat.neg_zero_count, 2);
+}
+
+/// Feature: Statistic dump on CPU.
+/// Description: Compute the statistics of a float32 tensor spanning several blocks of the vector kernel, the first
+///              block holds only nan and the last one a tail shorter than the lanes.
+/// Expectation: The statistics equal the ones counted element by element.
+TEST_F(TestTensorStatStream, test_float_stat_blocks) {
+  constexpr size_t kBlock = 4096;
+  constexpr float kInf = std::numeric_limits<float>::infinity();
+  std::vector<float> data(3 * kBlock + 3);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = i < kBlock ? NAN : static_cast<float>(static_cast<int>(i % 7) - 3);
+  }
+  data[2 * kBlock + 1] = kInf;
+  data[data.size() - 1] = -kInf;
+  data[data.size() - 2] = 5.0;
+  double sum = 0;
+  size_t finite = 0;
+  size_t zeros = 0;
+  size_t pos = 0;
+  size_t neg = 0;
+  for (size_t i = kBlock; i < data.size(); ++i) {
+    if (std::isinf(data[i])) {
+      continue;
+    }
+    sum += data[i];
+    ++finite;
+    zeros += data[i] == 0 ? 1 : 0;
+    pos += data[i] > 0 ? 1 : 0;
+    neg += data[i] < 0 ? 1 : 0;
+  }
+  TensorStatValues stat;
+  ASSERT_TRUE(ComputeHostTensorStat(data.data(), data.size() * sizeof(float), kNumberTypeFloat32, &stat));
+  ASSERT_EQ(stat.count, data.size());
+  ASSERT_DOUBLE_EQ(stat.max_value, 5.0);
+  ASSERT_DOUBLE_EQ(stat.min_value, -3.0);
+  ASSERT_NEAR(stat.avg_value, sum / finite, 1e-6);
+  ASSERT_EQ(stat.nan_count, kBlock);
+  ASSERT_EQ(stat.pos_inf_count, 1);
+  ASSERT_EQ(stat.neg_inf_count, 1);
+  ASSERT_EQ(stat.zero_count, zeros);
+  ASSERT_EQ(stat.pos_zero_count, pos);
+  ASSERT_EQ(stat.neg_zero_count, neg);
+}
+
+/// Feature: Statistic dump on CPU.
+/// Description: Compute the statistics of an int32 tensor longer than the lanes, and of an unsupported type.
+/// Expectation: The integer statistics are exact, the unsupported type returns false.
+TEST_F(TestTensorStatStream, test_int_and_unsupported_stat) {
+  std::vector<int32_t> data(100);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = static_cast<int32_t>(i) - 50;
+  }
+  TensorStatValues stat;
+  ASSERT_TRUE(ComputeHostTensorStat(data.data(), data.size() * sizeof(int32_t), kNumberTypeInt32, &stat));
+  ASSERT_EQ(stat.count, 100);
+  ASSERT_DOUBLE_EQ(stat.max_value, 49.0);
+  ASSERT_DOUBLE_EQ(stat.min_value, -50.0);
+  ASSERT_DOUBLE_EQ(stat.avg_value, -0.5);
+  ASSERT_EQ(stat.zero_count, 1);
+  ASSERT_EQ(stat.neg_zero_count, 50);
+  ASSERT_EQ(stat.pos_zero_count, 49);
+  ASSERT_EQ(stat.nan_count, 0);
+
+  ASSERT_FALSE(ComputeHostTensorStat(data.data(), data.size(), kObjectTypeString, &stat));
+  ASSERT_FALSE(ComputeHostTensorStat(nullptr, 4, kNumberTypeFloat32, &stat));
+}
+}  // namespace mindspore
+#endif
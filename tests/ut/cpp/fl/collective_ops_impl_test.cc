@@ -0,0 +1,91 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <vector>
+#include "common/common_test.h"
+#define protected public
+#include "ps/core/worker_node.h"
+#undef protected
+#include "fl/server/collective_ops_impl.h"
+
+namespace mindspore {
+namespace fl {
+namespace server {
+namespace {
+constexpr uint32_t kWorkerNum = 8;
+
+// The group of the global ranks 1, 3, 5 and 7.
+CommunicationGroupInfo OddRanksGroup() {
+  CommunicationGroupInfo group_info = {};
+  group_info.group_ranks = {1, 3, 5, 7};
+  group_info.size = SizeToUint(group_info.group_ranks.size());
+  for (uint32_t i = 0; i < group_info.size; ++i) {
+    group_info.group_to_global_ranks[i] = group_info.group_ranks[i];
+    group_info.global_to_group_ranks[group_info.group_ranks[i]] = i;
+  }
+  return group_info;
+}
+
+std::shared_ptr<ps::core::WorkerNode> NewWorkerNode(uint32_t rank_id) {
+  auto node = std::make_shared<ps::core::WorkerNode>();
+  node->node_info_.node_role_ = ps::core::NodeRole::WORKER;
+  node->node_info_.rank_id_ = rank_id;
+  node->worker_num_ = kWorkerNum;
+  return node;
+}
+}  // namespace
+
+class TestCollectiveOpsImpl : public UT::Common {
+ public:
+  TestCollectiveOpsImpl() = default;
+  virtual ~TestCollectiveOpsImpl() = default;
+
+  void SetUp() override {}
+  void TearDown() override {}
+};
+
+/// Feature: Broadcast of the server collective communication.
+/// Description: get the processes the root sends to, for a root which is not the group rank 0.
+/// Expectation: the root sends to all the other processes of the group, including the group rank 0, but not itself.
+TEST_F(TestCollectiveOpsImpl, BroadcastDestinations) {
+  auto group_info = OddRanksGroup();
+  EXPECT_EQ(CollectiveOpsImpl::BroadcastDestinations(0, group_info), std::vector<uint32_t>({3, 5, 7}));
+  EXPECT_EQ(CollectiveOpsImpl::BroadcastDestinations(2, group_info), std::vector<uint32_t>({1, 3, 7}));
+  EXPECT_EQ(CollectiveOpsImpl::BroadcastDestinations(3, group_info), std::vector<uint32_t>({1, 3, 5}));
+}
+
+/// Feature: Broadcast of the server collective communication.
+/// Description: broadcast on the group rank 1 from the group rank 2, the data of the global rank 5 has arrived.
+/// Expectation: the data is received from the global rank of the root, a root out of the group is rejected.
+TEST_F(TestCollectiveOpsImpl, BroadcastReceiveFromRoot) {
+  auto node = NewWorkerNode(3);
+  std::vector<float> data = {1.0f, -2.0f, 3.5f};
+  auto data_bytes = reinterpret_cast<const unsigned char *>(data.data());
+  node->received_data_[std::make_pair(5, 1)] =
+    std::make_shared<std::vector<unsigned char>>(data_bytes, data_bytes + data.size() * sizeof(float));
+
+  std::vector<float> send(data.size(), 0.0f);
+  std::vector<float> recv(data.size(), 0.0f);
+  auto group_info = OddRanksGroup();
+  ASSERT_TRUE(CollectiveOpsImpl::GetInstance().Broadcast<float>(send.data(), recv.data(), data.size(), 2, node,
+                                                                group_info));
+  EXPECT_EQ(recv, data);
+  EXPECT_FALSE(CollectiveOpsImpl::GetInstance().Broadcast<float>(send.data(), recv.data(), data.size(), 4, node,
+                                                                 group_info));
+}
+}  // namespace server
+}  // namespace fl
+}  // namespace mindspore
@@ -762,4 +762,47 @@ TEST_F(TestManager, test_set_edge) {
   ASSERT_EQ(mgr->node_users()[t].front().first, get_item);
 }
 
+/// Feature: Incremental update of manager dependency computers.
+/// Description: Add free variables and func graph uses after the relations are computed.
+/// Expectation: The relations are updated for the changed graph and its callers.
+TEST_F(TestManager, test_incremental_dep_computers) {
+  // fg(x, y) = c() + u(x) + leaf_0(x) + ... ; c() = x + x ; u(p) = p + p.
+  FuncGraphPtr fg = std::make_shared<FuncGraph>();
+  auto x = fg->add_parameter();
+  auto y = fg->add_parameter();
+  FuncGraphPtr c = std::make_shared<FuncGraph>();
+  auto c_add = c->NewCNode({NewValueNode(prim::kPrimScalarAdd), x, x});
+  c->set_output(c_add);
+  FuncGraphPtr u = std::make_shared<FuncGraph>();
+  auto p = u->add_parameter();
+  auto u_add = u->NewCNode({NewValueNode(prim::kPrimScalarAdd), p, p});
+  u->set_output(u_add);
+  std::vector<AnfNodePtr> outputs{NewValueNode(prim::kPrimMakeTuple), fg->NewCNode({NewValueNode(c)}),
+                                  fg->NewCNode({NewValueNode(u), x})};
+  constexpr size_t leaf_num = 4;
+  for (size_t i = 0; i < leaf_num; ++i) {
+    FuncGraphPtr leaf = std::make_shared<FuncGraph>();
+    leaf->set_output(leaf->add_parameter());
+    outputs.push_back(fg->NewCNode({NewValueNode(leaf), x}));
+  }
+  fg->set_output(fg->NewCNode(outputs));
+  auto mgr = Manage(fg);
+  ASSERT_EQ(mgr->parent(c), fg);
+  ASSERT_EQ(mgr->parent(u), nullptr);
+  ASSERT_EQ(mgr->func_graphs_used_total(u).size(), 0);
+
+  // Free variable from a known parent.
+  mgr->SetEdge(c_add, 2, y);
+  ASSERT_EQ(mgr->parent(c), fg);
+  ASSERT_EQ(mgr->free_variables_total()[c].count(y), 1);
+
+  // New func graph use which brings a new parent to u.
+  mgr->SetEdge(u_add, 2, u->NewCNode({NewValueNode(c)}));
+  ASSERT_EQ(mgr->func_graphs_used_total(u).size(), 1);
+  ASSERT_EQ(mgr->func_graphs_used_total(fg).count(c), 1);
+  ASSERT_EQ(mgr->func_graph_parents_total(u).size(), 1);
+  ASSERT_EQ(mgr->parent(u), fg);
+  ASSERT_EQ(mgr->children(fg).count(u), 1);
+}
+
 }  // namespace mindspore
@@ -0,0 +1,138 @@
+/**
+ * Copyright 2022 Huawei Technologies Co., Ltd
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "common/common_test.h"
+#include "backend/common/session/kernel_graph.h"
+#include "ir/anf.h"
+#include "ir/func_graph.h"
+#include "ir/func_graph_cloner.h"
+#include "ir/node_arena.h"
+#include "frontend/operator/ops.h"
+
+namespace mindspore {
+class TestNodeArena : public UT::Common {
+ public:
+  TestNodeArena() {}
+};
+
+/// Feature: Node arena of func graph.
+/// Description: Create nodes from an arena, release the graph and then the nodes.
+/// Expectation: A surviving node keeps only its own chunk alive, and the chunks are released with the last node.
+TEST_F(TestNodeArena, test_allocate_and_release) {
+  auto live_chunks = NodeArena::LiveChunks();
+  FuncGraphPtr fg = std::make_shared<FuncGraph>();
+  fg->EnableNodeArena();
+  auto x = fg->add_parameter();
+  std::vector<CNodePtr> nodes;
+  for (size_t i = 0; i < 1000; ++i) {
+    nodes.push_back(fg->NewCNode({NewValueNode(prim::kPrimScalarAdd), x, x}));
+  }
+  fg->set_output(nodes.back());
+  ASSERT_EQ(nodes.back()->func_graph(), fg);
+  ASSERT_GT(NodeArena::LiveChunks(), live_chunks + 1);
+
+  // The node outlives the graph and its arena.
+  auto survivor = nodes.front();
+  nodes.clear();
+  fg = nullptr;
+  x = nullptr;
+  ASSERT_EQ(NodeArena::LiveChunks(), live_chunks + 1);
+  ASSERT_EQ(survivor->size(), 3);
+  survivor = nullptr;
+  ASSERT_EQ(NodeArena::LiveChunks(), live_chunks);
+}
+
+/// Feature: Node arena of func graph.
+/// Description: Clone a graph whose target graph has an arena.
+/// Expectation: Cloned nodes are allocated from the arena of the target graph.
+TEST_F(TestNodeArena, test_clone) {
+  FuncGraphPtr fg = std::make_shared<FuncGraph>();
+  AnfNodePtr node = fg->add_parameter();
+  // The source graph has no arena, its clones need more than the first chunk of the target arena.
+  for (size_t i = 0; i < 100; ++i) {
+    node = fg->NewCNode({NewValueNode(prim::kPrimScalarAdd), node, node});
+  }
+  fg->set_output(node);
+
+  auto target = std::make_shared<FuncGraph>();
+  target->EnableNodeArena();
+  auto y = target->add_parameter();
+  auto allocated_bytes = target->node_arena()->allocated_bytes();
+  ASSERT_GT(allocated_bytes, 0);
+  Cloner cloner({}, false, false, false);
+  cloner.AddClone(fg, target, {y}, kInline);
+  auto new_output = cloner[fg->output()];
+  ASSERT_NE(new_output, nullptr);
+  ASSERT_EQ(new_output->func_graph(), target);
+  ASSERT_GT(target->node_arena()->allocated_bytes(), allocated_bytes);
+}
+
+/// Feature: Node arena of func graph.
+/// Description: Copy a kernel graph whose nodes are allocated from an arena.
+/// Expectation: The copy gets an arena of its own and keeps the nodes of the source graph.
+TEST_F(TestNodeArena, test_copy) {
+  auto graph = std::make_shared<session::KernelGraph>();
+  graph->EnableNodeArena();
+  auto x = graph->add_parameter();
+  graph->set_output(graph->NewCNode({NewValueNode(prim::kPrimScalarAdd), x, x}));
+  auto copy = std::make_shared<session::KernelGraph>(*graph);
+  ASSERT_NE(copy->node_arena(), nullptr);
+  ASSERT_NE(copy->node_arena(), graph->node_arena());
+  ASSERT_EQ(copy->output(), graph->output());
+  ASSERT_EQ(copy->node_arena()->allocated_bytes(), 0);
+}
+
+/// Feature: Node arena of func graph.
+/// Description: Create the nodes of a graph with an arena on several threads at the same time.
+/// Expectation: Every node gets its own memory, and the chunks are released with the graph.
+TEST_F(TestNodeArena, test_concurrent_allocate) {
+  constexpr size_t kThreadNum = 4;
+  constexpr size_t kNodeNum = 2000;
+  auto live_chunks = NodeArena::LiveChunks();
+  FuncGraphPtr fg = std::make_shared<FuncGraph>();
+  fg->EnableNodeArena();
+  auto x = fg->add_parameter();
+  std::vector<std::vector<CNodePtr>> nodes(kThreadNum);
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < kThreadNum; ++i) {
+    threads.emplace_back([&fg, &x, &nodes, i]() {
+      for (size_t j = 0; j < kNodeNum; ++j) {
+        nodes[i].push_back(fg->NewCNode({NewValueNode(prim::kPrimScalarAdd), x, x}));
+      }
+    });
+  }
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  std::set<CNode *> addresses;
+  for (const auto &thread_nodes : nodes) {
+    for (const auto &node : thread_nodes) {
+      ASSERT_EQ(node->size(), 3);
+      ASSERT_EQ(node->input(1), x);
+      (void)addresses.insert(node.get());
+    }
+  }
+  ASSERT_EQ(addresses.size(), kThreadNum * kNodeNum);
+  nodes.clear();
+  fg = nullptr;
+  x = nullptr;
+  ASSERT_EQ(NodeArena::LiveChunks(), live_chunks);
+}
+}  // namespace mindspore
@@ -19,6 +19,7 @@
 #include "frontend/parallel/device_manager.h"
 #include "frontend/parallel/auto_parallel/edge_costmodel.h"
 #include "frontend/parallel/ops_info/matmul_info.h"
+#include "frontend/parallel/tensor_layout/tensor_redistribution.h"
 
 namespace mindspore {
 namespace parallel {
@@ -163,5 +164,58 @@ TEST_F(TestEdgeCostModel, test_EdgeEliminationSetNewCost) {
   new_edge->EdgeEliminationSetNewCost(matmul1, edges, matmul5);
 }
 
+/// Feature: parallel edge cost initialization
+/// Description: init the edge of two batch matmuls, which has enough strategy pairs to run on the thread pool, with a
+///              cold and a warm redistribution cost cache
+/// Expectation: the cost of every pair is the one computed serially with a cold cache
+TEST_F(TestEdgeCostModel, test_InitEdgeCostParallel) {
+  mindspore::HashMap<std::string, ValuePtr> attr = {{"transpose_a", MakeValue(false)},
+                                                    {"transpose_b", MakeValue(false)}};
+  auto batch_matmul1 = std::make_shared<MatMulInfo>("matmul_info", Shapes{{8, 8, 16}, {8, 16, 32}},
+                                                    Shapes{{8, 8, 32}}, attr);
+  batch_matmul1->set_outputs_type({kFloat32});
+  auto batch_matmul2 = std::make_shared<MatMulInfo>("matmul_info", Shapes{{8, 8, 32}, {8, 32, 16}},
+                                                    Shapes{{8, 8, 16}}, attr);
+  batch_matmul2->set_outputs_type({kFloat32});
+  batch_matmul1->GenerateStrategies(0);
+  batch_matmul2->GenerateStrategies(0);
+
+  std::string edge_name = "MatMul-MatMul";
+  auto cold_edge = std::make_shared<Edge>(edge_name, batch_matmul1, batch_matmul2, 0, 0, false);
+  auto warm_edge = std::make_shared<Edge>(edge_name, batch_matmul1, batch_matmul2, 0, 0, false);
+  TensorRedistribution::ClearCostCache();
+  ASSERT_EQ(cold_edge->InitEdgeCost(), SUCCESS);
+  ASSERT_EQ(warm_edge->InitEdgeCost(), SUCCESS);
+  auto outputs = cold_edge->prev_op_output();
+  auto inputs = cold_edge->next_op_input();
+  ASSERT_GE(outputs.size() * inputs.size(), 128);
+  ASSERT_EQ(cold_edge->GetCostMap().size(), outputs.size() * inputs.size());
+
+  auto type_length = batch_matmul1->GetOutputTypeLengths()[0];
+  auto type = batch_matmul1->outputs_type()[0];
+  for (auto &output : outputs) {
+    for (auto &input : inputs) {
+      TensorRedistribution::ClearCostCache();
+      CostPtr expect;
+      ASSERT_EQ(cold_edge->GetRedistributionCost(output.second[0].tensor_layout(), input.second[0].tensor_layout(),
+                                                 type_length, type, &expect),
+                SUCCESS);
+      RefineForPracticalCost(expect, true);
+      expect->communication_forward_ = expect->communication_redis_forward_;
+      for (auto &edge : {cold_edge, warm_edge}) {
+        auto cost_list = edge->GetCostList(output.first, input.first);
+        ASSERT_EQ(cost_list.size(), 1);
+        auto cost = cost_list.front();
+        ASSERT_DOUBLE_EQ(cost->computation_cost_, expect->computation_cost_);
+        ASSERT_DOUBLE_EQ(cost->communication_cost_, expect->communication_cost_);
+        ASSERT_DOUBLE_EQ(cost->communication_forward_, expect->communication_forward_);
+        ASSERT_DOUBLE_EQ(cost->communication_redis_backward_, expect->communication_redis_backward_);
+        ASSERT_DOUBLE_EQ(cost->memory_with_reuse_, expect->memory_with_reuse_);
+      }
+    }
+  }
+  TensorRedistribution::ClearCostCache();
+}
+
 }  // namespace parallel
 }  // namespace mindspore
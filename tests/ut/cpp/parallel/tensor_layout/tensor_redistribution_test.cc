@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <utility>
 #include <vector>
 #include "common/common_test.h"
 #include "common/py_func_graph_fetcher.h"
@@ -206,5 +207,53 @@ TEST_F(TestTensorRedistribution, TestInferRedistribution3) {
   ASSERT_EQ(op_names, expected_op_names);
 }
 
+namespace {
+TensorLayout CreateLayout(const Shape &device_arrangement, const Shape &tensor_map, const Shape &tensor_shape) {
+  TensorLayout layout;
+  EXPECT_EQ(layout.InitFromVector(device_arrangement, tensor_map, tensor_shape), Status::SUCCESS);
+  return layout;
+}
+
+std::vector<double> ComputeRedistributionCost(const TensorLayout &from, const TensorLayout &to) {
+  TensorRedistribution tensor_redistribution;
+  RankList dev_list = g_device_manager->GetDeviceListByStageId(0);
+  EXPECT_EQ(tensor_redistribution.Init(from, to, dev_list), Status::SUCCESS);
+  EXPECT_EQ(tensor_redistribution.ComputeCost(), Status::SUCCESS);
+  return {tensor_redistribution.reshape_flag() ? 1.0 : 0.0, tensor_redistribution.comm_cost(),
+          tensor_redistribution.forward_comm_cost(), tensor_redistribution.backward_comm_cost(),
+          tensor_redistribution.computation_cost(), tensor_redistribution.memory_cost()};
+}
+}  // namespace
+
+/// Feature: memoized redistribution cost
+/// Description: compute the costs of several layout pairs with a warm cache, two pairs only differ in the device
+///              dimensions of size 1 of their origin layouts and share a cache entry
+/// Expectation: every memoized cost is the one computed with a cold cache
+TEST_F(TestTensorRedistribution, TestComputeCostMemoized) {
+  Shape tensor_shape = {512, 1024};
+  std::vector<std::pair<TensorLayout, TensorLayout>> layouts = {
+    {CreateLayout({2, 4, 2}, {2, 0}, tensor_shape), CreateLayout({4, 2, 2}, {2, 1}, tensor_shape)},
+    {CreateLayout({16, 1, 1}, {2, 0}, tensor_shape), CreateLayout({1, 16, 1}, {2, 1}, tensor_shape)},
+    {CreateLayout({16}, {0, -1}, tensor_shape), CreateLayout({16}, {-1, 0}, tensor_shape)},
+    {CreateLayout({1, 2, 4, 2}, {2, 0}, tensor_shape), CreateLayout({4, 2, 2}, {2, 1}, tensor_shape)},
+    {CreateLayout({16}, {0, -1}, tensor_shape), CreateLayout({16}, {0, -1}, tensor_shape)}};
+  std::vector<std::vector<double>> cold_costs;
+  for (auto &layout : layouts) {
+    TensorRedistribution::ClearCostCache();
+    cold_costs.push_back(ComputeRedistributionCost(layout.first, layout.second));
+  }
+  ASSERT_EQ(cold_costs[1], cold_costs[2]);
+  ASSERT_EQ(cold_costs[0], cold_costs[3]);
+  ASSERT_NE(cold_costs[0], cold_costs[1]);
+
+  TensorRedistribution::ClearCostCache();
+  for (size_t round = 0; round < 2; ++round) {
+    for (size_t i = 0; i < layouts.size(); ++i) {
+      ASSERT_EQ(ComputeRedistributionCost(layouts[i].first, layouts[i].second), cold_costs[i]);
+    }
+  }
+  TensorRedistribution::ClearCostCache();
+}
+
 }  // namespace parallel
 }  // namespace mindspore
@@ -13,9 +13,17 @@
 # limitations under the License.
 # ============================================================================
 
+import glob
+import os
+import shutil
+
+import numpy as np
 import pytest
 import mindspore.context as context
 import mindspore.nn as nn
+from mindspore import Tensor
+from mindspore.common.api import _cell_graph_executor
+from mindspore.nn import TrainOneStepCell, WithLossCell
 
 recompute_prefix = 'recompute_'
 
@@ -53,3 +61,42 @@ def test_set_recompute_true_twice():
     net.pool.recompute()
     with pytest.raises(RuntimeError):
         net.pool.recompute()
+
+class DenseNet(nn.Cell):
+    def __init__(self):
+        super(DenseNet, self).__init__()
+        self.dense1 = nn.Dense(64, 64, activation='relu')
+        self.dense2 = nn.Dense(64, 64, activation='relu')
+        self.dense3 = nn.Dense(64, 10)
+
+    def construct(self, x):
+        return self.dense3(self.dense2(self.dense1(x)))
+
+def count_recomputed_nodes(budget, graphs_path):
+    """Compile a train network under the budget, and count the recomputed copies in the validate ir."""
+    context.set_context(mode=context.GRAPH_MODE, recompute_memory_budget=budget, save_graphs=True,
+                        save_graphs_path=graphs_path)
+    try:
+        net = DenseNet()
+        optimizer = nn.Momentum(net.trainable_params(), learning_rate=0.1, momentum=0.9)
+        train_net = TrainOneStepCell(WithLossCell(net, nn.SoftmaxCrossEntropyWithLogits(sparse=True)), optimizer)
+        inputs = Tensor(np.ones([32, 64]).astype(np.float32))
+        label = Tensor(np.ones([32]).astype(np.int32))
+        _cell_graph_executor.compile(train_net, inputs, label)
+        ir_files = glob.glob(os.path.join(graphs_path, '**', '*_validate*.ir'), recursive=True)
+        assert len(ir_files) == 1
+        with open(ir_files[0], 'r') as fp:
+            return sum(1 for line in fp if 'duplicated: true' in line)
+    finally:
+        context.set_context(recompute_memory_budget="0GB", save_graphs=False)
+        shutil.rmtree(graphs_path, ignore_errors=True)
+
+
+def test_recompute_memory_budget():
+    """
+    Feature: automatic recompute under a memory budget.
+    Description: compile a train network whose activations exceed the recompute memory budget, and without a budget.
+    Expectation: forward nodes are recomputed in the backward pass under the budget only.
+    """
+    assert count_recomputed_nodes("0.000001GB", "./graphs_recompute_budget") > 0
+    assert count_recomputed_nodes("0GB", "./graphs_recompute_no_budget") == 0
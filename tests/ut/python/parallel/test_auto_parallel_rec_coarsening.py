@@ -0,0 +1,124 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+import re
+import numpy as np
+
+import mindspore as ms
+import mindspore.nn as nn
+from mindspore import Tensor, Parameter, context
+from mindspore.common.api import _cell_graph_executor
+from mindspore.ops import operations as P
+from mindspore.parallel import set_algo_parameters, reset_algo_parameters
+
+
+class Block(nn.Cell):
+    def __init__(self, hidden_size):
+        super().__init__()
+        self.weight1 = Parameter(Tensor(np.ones([hidden_size, hidden_size * 4]), dtype=ms.float32), "w1")
+        self.weight2 = Parameter(Tensor(np.ones([hidden_size * 4, hidden_size]), dtype=ms.float32), "w2")
+        self.matmul1 = P.MatMul()
+        self.matmul2 = P.MatMul()
+        self.relu = P.ReLU()
+        self.add = P.Add()
+
+    def construct(self, x):
+        out = self.relu(self.matmul1(x, self.weight1))
+        out = self.matmul2(out, self.weight2)
+        return self.add(out, x)
+
+
+class Net(nn.Cell):
+    def __init__(self, layer_num, hidden_size):
+        super().__init__()
+        self.layers = nn.CellList([Block(hidden_size) for _ in range(layer_num)])
+
+    def construct(self, x):
+        for layer in self.layers:
+            x = layer(x)
+        return x
+
+
+def compile_net(net, *inputs):
+    net.set_auto_parallel()
+    net.set_train()
+    _cell_graph_executor.compile(net, *inputs, phase='train')
+    strategies = _cell_graph_executor._get_shard_strategy(net)
+    context.reset_auto_parallel_context()
+    return strategies
+
+
+def layer_strategies(strategies, layer_num, op_name):
+    result = []
+    for layer in range(layer_num):
+        pattern = "layers-CellList/{}-Block/{}-op".format(layer, op_name)
+        result.append([v for (k, v) in strategies.items() if re.search(pattern, k) is not None])
+    return result
+
+
+def test_rec_coarsening_repeated_layers():
+    """
+    Feature: graph coarsening of the recursive programming algorithm.
+    Description: search the strategies of a network of repeated layers with the coarsening.
+    Expectation: the isomorphic layers share the strategies.
+    """
+    layer_num = 10
+    x = Tensor(np.ones([128, 64]), dtype=ms.float32)
+    context.set_auto_parallel_context(parallel_mode="auto_parallel", device_num=8, global_rank=0,
+                                      search_mode="recursive_programming")
+    set_algo_parameters(enable_rec_coarsening=True)
+    strategies = compile_net(Net(layer_num, 64), x)
+    reset_algo_parameters()
+    matmul_strategies = layer_strategies(strategies, layer_num, "MatMul")
+    # the layers next to the input and the output have different neighborhoods.
+    for layer in range(3, layer_num - 3):
+        assert matmul_strategies[layer]
+        assert matmul_strategies[layer] == matmul_strategies[2]
+
+
+class MultiBranchNet(nn.Cell):
+    def __init__(self, hidden_size):
+        super().__init__()
+        self.branches = nn.CellList([Block(hidden_size) for _ in range(4)])
+
+    def construct(self, x0, x1, x2, x3):
+        return self.branches[0](x0), self.branches[1](x1), self.branches[2](x2), self.branches[3](x3)
+
+
+def test_rec_coarsening_multiple_components():
+    """
+    Feature: graph coarsening of the recursive programming algorithm.
+    Description: search the strategies of a network of 4 independent branches, which are partitioned as separate
+                 components on the thread pool, with and without the coarsening.
+    Expectation: the coarsening does not change the strategies, and the isomorphic branches share the strategies.
+    """
+    branch_num = 4
+    inputs = [Tensor(np.ones([128, 64]), dtype=ms.float32) for _ in range(branch_num)]
+    branch_strategies = {}
+    for enable_coarsening in (False, True):
+        context.set_auto_parallel_context(parallel_mode="auto_parallel", device_num=8, global_rank=0,
+                                          search_mode="recursive_programming")
+        set_algo_parameters(enable_rec_coarsening=enable_coarsening)
+        strategies = compile_net(MultiBranchNet(64), *inputs)
+        reset_algo_parameters()
+        branch_strategies[enable_coarsening] = []
+        for branch in range(branch_num):
+            pattern = "branches-CellList/{}-Block/".format(branch)
+            branch_strategies[enable_coarsening].append(
+                sorted((re.sub("-op[0-9]+$", "", k.split("-Block/")[-1]), v) for (k, v) in strategies.items()
+                       if re.search(pattern, k) is not None))
+    assert branch_strategies[True] == branch_strategies[False]
+    for branch in range(branch_num):
+        assert branch_strategies[False][branch]
+        assert branch_strategies[False][branch] == branch_strategies[False][0]
@@ -113,7 +113,7 @@ def test_two_matmul():
 
     set_algo_parameters(tensor_slice_align_enable=False, tensor_slice_align_size=32,
                         fully_use_devices=False, elementwise_op_strategy_follow=False,
-                        enable_algo_approxi=True, algo_approxi_epsilon=0.001)
+                        enable_algo_approxi=True, algo_approxi_epsilon=0.001, enable_rec_coarsening=True)
     para_slice_align_enable = get_algo_parameters("tensor_slice_align_enable")
     assert not para_slice_align_enable
     para_slice_align_size = get_algo_parameters("tensor_slice_align_size")
@@ -126,6 +126,8 @@ def test_two_matmul():
     assert enable_approxi
     algo_epsilon = get_algo_parameters("algo_approxi_epsilon")
     assert math.isclose(algo_epsilon, 0.001, rel_tol=1e-6)
+    enable_rec_coarsening = get_algo_parameters("enable_rec_coarsening")
+    assert enable_rec_coarsening
 
     expecte_single_loop = False
     signle_loop = _get_algo_single_loop()
@@ -148,6 +150,8 @@ def test_two_matmul():
     assert not enable_approxi
     algo_epsilon = get_algo_parameters("algo_approxi_epsilon")
     assert math.isclose(algo_epsilon, 0.1, rel_tol=1e-6)
+    enable_rec_coarsening = get_algo_parameters("enable_rec_coarsening")
+    assert not enable_rec_coarsening
 
     x = Tensor(np.ones([128, 32]), dtype=ms.float32)
     y = Tensor(np.ones([32, 64]), dtype=ms.float32)
@@ -24,6 +24,7 @@ from mindspore.nn.wrap.cell_wrapper import _VirtualDatasetCell
 from mindspore.nn.optim import Adam, AdamWeightDecay, Lamb, Momentum
 from mindspore.ops import operations as P
 from mindspore import context
+from mindspore.train.serialization import load_param_into_net
 
 
 def setup_function():
@@ -209,6 +210,42 @@ def test_AdamWeightDecay():
     context.reset_auto_parallel_context()
 
 
+def test_AdamWeightDecay_shard_states_cpu():
+    """
+    Feature: parallel optimizer in data parallel mode on CPU.
+    Description: create AdamWeightDecay and the training cell with the parallel optimizer enabled on rank 1, then load
+                 full-shape moments into the optimizer.
+    Expectation: the moments of the parameters divisible along the first dimension hold the slice of this device, their
+                 gradients are reduce-scattered, and the full-shape moments are sliced on load.
+    """
+    context.set_context(device_target="CPU")
+    context.set_auto_parallel_context(parallel_mode="data_parallel", device_num=2, global_rank=1,
+                                      enable_parallel_optimizer=True, dataset_strategy="data_parallel")
+    net = Net()
+    net.odd = Parameter(Tensor(np.ones([3, 128]).astype(np.float32)), name="odd")
+    optimizer = AdamWeightDecay(net.trainable_params(), learning_rate=0.1)
+    assert optimizer.shard_states and not optimizer.use_parallel
+    for param, moment1, moment2, shard in zip(optimizer.parameters, optimizer.moments1, optimizer.moments2,
+                                              optimizer.shard_flags):
+        assert shard == (param.name != "odd")
+        assert param.zero_shard == shard
+        expected_shape = (param.shape[0] // 2,) + tuple(param.shape[1:]) if shard else param.shape
+        assert moment1.shape == expected_shape and moment1.zero_shard == shard
+        assert moment2.shape == expected_shape and moment2.zero_shard == shard
+
+    train_network = TrainOneStepCell(WithLossCell(net, nn.SoftmaxCrossEntropyWithLogits()), optimizer)
+    grad_reducer = train_network.grad_reducer
+    assert grad_reducer.reduce_scatter_filter == optimizer.shard_flags
+    assert grad_reducer.allreduce_filter == tuple(not shard for shard in optimizer.shard_flags)
+
+    full_moment = np.arange(768 * 128).reshape(768, 128).astype(np.float32)
+    load_param_into_net(optimizer, {"adam_m.fc1.weight": Parameter(Tensor(full_moment), name="adam_m.fc1.weight")})
+    moment1 = [x for x in optimizer.moments1 if x.name == "adam_m.fc1.weight"][0]
+    assert np.allclose(moment1.asnumpy(), full_moment[384:])
+    context.set_context(device_target="Ascend")
+    context.reset_auto_parallel_context()
+
+
 def test_lamb_compile():
     """ test_Lamb_compile """
     context.set_auto_parallel_context(parallel_mode="data_parallel", device_num=2, enable_parallel_optimizer=True,
@@ -0,0 +1,102 @@
+# Copyright 2022 Huawei Technologies Co., Ltd
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ============================================================================
+import pytest
+
+import mindspore.nn as nn
+from mindspore import context
+from mindspore.parallel import partition_pipeline_stages
+
+
+def setup_function():
+    context.set_auto_parallel_context(parallel_mode="semi_auto_parallel", device_num=8, global_rank=0,
+                                      pipeline_stages=2)
+
+
+def teardown_function():
+    context.reset_auto_parallel_context()
+
+
+def test_partition_by_compute_costs():
+    """
+    Feature: automatic pipeline stage partition.
+    Description: partition layers with unbalanced compute costs.
+    Expectation: the slowest stage is minimized and the pipeline_stage of the layers is set.
+    """
+    layers = nn.CellList([nn.Dense(16, 16) for _ in range(4)])
+    result = partition_pipeline_stages(layers, micro_batch_num=4, compute_costs=[3, 1, 1, 1])
+    assert result["stages"] == [0, 1, 1, 1]
+    assert result["stage_times"] == [3.0, 3.0]
+    assert [layer.pipeline_stage for layer in layers] == [0, 1, 1, 1]
+    assert result["bubble"] == pytest.approx(0.2)
+    assert result["throughput"] == pytest.approx(4 / 15)
+
+
+def test_partition_avoids_heavy_communication():
+    """
+    Feature: automatic pipeline stage partition.
+    Description: the output of one layer is expensive to send to the next stage.
+    Expectation: the stages are not split after that layer.
+    """
+    layers = [nn.Dense(16, 16) for _ in range(8)]
+    result = partition_pipeline_stages(layers, micro_batch_num=8, compute_costs=[1] * 8,
+                                       comm_costs=[1, 1, 1, 5, 1, 1, 1, 0])
+    assert result["stages"] == [0, 0, 0, 1, 1, 1, 1, 1]
+    assert max(result["stage_times"]) == 6.0
+
+
+def test_partition_memory_limit():
+    """
+    Feature: automatic pipeline stage partition.
+    Description: partition layers under a device memory limit, counting the activations in flight.
+    Expectation: the stages fit the limit, and an impossible limit raises ValueError.
+    """
+    layers = [nn.Dense(16, 16) for _ in range(6)]
+    result = partition_pipeline_stages(layers, micro_batch_num=4, compute_costs=[1] * 6, memory_costs=[1] * 6,
+                                       activation_costs=[1] * 6, memory_limit=8)
+    assert result["stages"] == [0, 0, 1, 1, 1, 1]
+    assert result["stage_memory"] == [6.0, 8.0]
+    with pytest.raises(ValueError):
+        partition_pipeline_stages(layers, micro_batch_num=4, memory_costs=[1] * 6, activation_costs=[1] * 6,
+                                  memory_limit=5)
+
+
+def test_partition_interleaved_memory_limit():
+    """
+    Feature: automatic pipeline stage partition.
+    Description: partition layers into 2 stages of 2 virtual stages, the first layer has a large static memory.
+    Expectation: the memory of the 2 virtual stages of a device is summed and fits the limit of the device.
+    """
+    context.set_auto_parallel_context(pipeline_interleave_num=2)
+    layers = [nn.Dense(16, 16) for _ in range(8)]
+    memory_costs = [3, 1, 1, 1, 1, 1, 1, 1]
+    result = partition_pipeline_stages(layers, micro_batch_num=4, compute_costs=[1] * 8, memory_costs=memory_costs,
+                                       memory_limit=6)
+    assert result["stages"] == [0, 0, 1, 1, 2, 2, 3, 3]
+    assert [layer.pipeline_stage for layer in layers] == [0, 0, 1, 1, 2, 2, 3, 3]
+    assert result["stage_times"] == [2.0, 2.0, 2.0, 2.0]
+    assert result["stage_memory"] == [6.0, 4.0]
+    assert result["bubble"] == pytest.approx(1 / 9)
+
+    # a virtual stage does not fit half of the limit, but the 2 virtual stages of a device fit the limit.
+    result = partition_pipeline_stages(layers, micro_batch_num=4, compute_costs=[1] * 8, memory_costs=memory_costs,
+                                       memory_limit=5)
+    assert max(result["stage_times"]) == 3.0
+    assert max(result["stage_memory"]) <= 5.0
+    for device in range(2):
+        device_memory = sum(cost for cost, stage in zip(memory_costs, result["stages"]) if stage % 2 == device)
+        assert result["stage_memory"][device] == device_memory
+    with pytest.raises(ValueError):
+        partition_pipeline_stages(layers, micro_batch_num=4, compute_costs=[1] * 8, memory_costs=memory_costs,
+                                  memory_limit=4)
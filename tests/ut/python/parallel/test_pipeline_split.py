@@ -13,6 +13,7 @@
 # limitations under the License.
 # ============================================================================
 import os
+import re
 import shutil
 import glob
 
@@ -531,3 +532,144 @@ def test_pipeline_split_stage1_device_num_48():
     for _, param in model._train_network.parameters_and_names():
         assert param.name != "cell.block.0.param"
         assert param.name != "cell.block.0.param1"
+
+
+class InterleaveNet(nn.Cell):
+    def __init__(self, strategy1, strategy2, stage_num, interleave_num):
+        super().__init__()
+        self.block = nn.CellList()
+        self.block_num = stage_num * interleave_num
+        for i in range(self.block_num):
+            cell = MatMulCell(strategy1, strategy2)
+            cell.pipeline_stage = i
+            self.block.append(cell)
+        self.block[0].matmul.add_prim_attr("parameter_start", 0)
+
+    def construct(self, x, label):
+        for i in range(self.block_num):
+            x = self.block[i](x)
+        return x
+
+
+def run_pipeline_split_interleave(global_rank, owned_blocks):
+    context.set_auto_parallel_context(device_num=32, global_rank=global_rank, pipeline_stages=2,
+                                      pipeline_interleave_num=2)
+    context.set_auto_parallel_context(parallel_mode="semi_auto_parallel")
+    data = Tensor(np.ones([32, 64]), dtype=ms.float32)
+    label = Tensor(np.ones([64, 64]), dtype=ms.float32)
+    strategy1 = ((16, 1), (1, 1))
+    strategy2 = ((8, 1), (1, 1))
+    net = PipelineCell(InterleaveNet(strategy1, strategy2, 2, 2), 4)
+    params = []
+    for i in owned_blocks:
+        params.extend(net.network.block[i].trainable_params())
+    dataset = DatasetLenet(data, label, 3)
+    optimizer = nn.Lamb(params, learning_rate=0.01)
+    model = Model(net, optimizer=optimizer)
+    model.train(2, dataset, dataset_sink_mode=False)
+    for _, param in model._train_network.parameters_and_names():
+        for i in range(4):
+            if i not in owned_blocks:
+                assert param.name != "block.{}.param".format(i)
+                assert param.name != "block.{}.param1".format(i)
+
+
+def interleave_order(stage_num, interleave_num, micro_size, is_forward):
+    """The (micro, chunk) of every unit in the interleaved 1F1B order, backward walks the chunks in reverse."""
+    order = []
+    for k in range(micro_size * interleave_num):
+        micro = k // (stage_num * interleave_num) * stage_num + k % stage_num
+        chunk = k // stage_num % interleave_num
+        if not is_forward:
+            chunk = interleave_num - 1 - chunk
+        order.append((micro, chunk))
+    return order
+
+
+class TestPipelineSplitInterleave:
+    def setup_method(self):
+        self.output_path = './graphs' + self.__str__()
+        context.set_context(save_graphs=True,
+                            save_graphs_path=self.output_path)
+
+    def teardown_method(self):
+        context.set_context(save_graphs=False)
+        shutil.rmtree(self.output_path)
+
+    def border_nodes_from_ir(self):
+        """
+        The Send and Receive nodes in the order of the validate ir, which follows the depends of the reorder.
+        :return: a list of (is_forward, op, micro, chunk, peer rank, is_pipeline_end), first occurrences only
+        """
+        ir_files = glob.glob(os.path.join(self.output_path, 'rank_*', '*_validate*.ir'))
+        assert len(ir_files) == 1
+        nodes = []
+        with open(ir_files[0], 'r') as fp:
+            for line in fp:
+                op = re.search(r'= (Send|Receive)\(', line)
+                micro = re.search(r'[{ ]micro: (\d+)', line)
+                chunk = re.search(r'pipeline_chunk: (\d+)', line)
+                rank = re.search(r'(?:dest|src)_rank: (\d+)', line)
+                if op is None or micro is None or chunk is None or rank is None:
+                    continue
+                node = ('forward_node_name' not in line, op.group(1), int(micro.group(1)), int(chunk.group(1)),
+                        int(rank.group(1)), 'pipeline_end' in line)
+                if node not in nodes:
+                    nodes.append(node)
+        return nodes
+
+    def test_pipeline_split_interleave_stage0(self):
+        """
+        Feature: test interleaved pipeline with 2 virtual stages on every stage.
+        Description: stage0 runs the non-contiguous chunks block0 and block2, block2 receives from stage1.
+        Expectation: the sends of the forward units follow the interleaved order, 4 warmup units run before the
+                     first backward one, then one forward and one backward alternate, then the cooldown.
+        """
+        stage_num, interleave_num, micro_size = 2, 2, 4
+        run_pipeline_split_interleave(0, (0, 2))
+        nodes = self.border_nodes_from_ir()
+        # the wrap from the last stage back to the first one.
+        assert (True, 'Receive', 0, 1, 1, False) in nodes
+        ends = [(is_forward, micro, chunk) for is_forward, _, micro, chunk, _, is_end in nodes if is_end]
+        forward = iter(interleave_order(stage_num, interleave_num, micro_size, True))
+        backward = iter(interleave_order(stage_num, interleave_num, micro_size, False))
+        warmup_num = (stage_num - 0 - 1) * 2 + (interleave_num - 1) * stage_num
+        unit_num = micro_size * interleave_num
+        expect = [(True,) + next(forward) for _ in range(warmup_num)]
+        for _ in range(unit_num - warmup_num):
+            expect.append((False,) + next(backward))
+            expect.append((True,) + next(forward))
+        expect.extend((False,) + unit for unit in backward)
+        assert ends == expect
+
+    def test_pipeline_split_interleave_stage1(self):
+        """
+        Feature: test interleaved pipeline with 2 virtual stages on every stage.
+        Description: stage1 runs the non-contiguous chunks block1 and block3, block1 sends to stage0.
+        Expectation: the forward send of the chunk 0 goes back to stage0.
+        """
+        run_pipeline_split_interleave(16, (1, 3))
+        nodes = self.border_nodes_from_ir()
+        for micro in range(4):
+            assert (True, 'Send', micro, 0, 0, True) in nodes
+
+
+def test_pipeline_split_interleave_micro_size_not_divisible():
+    """
+    Feature: test interleaved pipeline with a micro size which is not a multiple of the stage num.
+    Description: 3 micro batches on 2 stages.
+    Expectation: raise RuntimeError.
+    """
+    context.set_auto_parallel_context(device_num=32, global_rank=0, pipeline_stages=2, pipeline_interleave_num=2)
+    context.set_auto_parallel_context(parallel_mode="semi_auto_parallel")
+    data = Tensor(np.ones([48, 64]), dtype=ms.float32)
+    label = Tensor(np.ones([64, 64]), dtype=ms.float32)
+    strategy1 = ((16, 1), (1, 1))
+    strategy2 = ((8, 1), (1, 1))
+    net = PipelineCell(InterleaveNet(strategy1, strategy2, 2, 2), 3)
+    params = net.network.block[0].trainable_params()
+    dataset = DatasetLenet(data, label, 3)
+    optimizer = nn.Lamb(params, learning_rate=0.01)
+    model = Model(net, optimizer=optimizer)
+    with pytest.raises(RuntimeError):
+        model.train(2, dataset, dataset_sink_mode=False)